@@ -1,5 +1,7 @@
+#include <functional>
 #include <QtCore>
 #include <QtWidgets>
+#include <QtConcurrent/QtConcurrent>
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
 #include <librepcb/common/fileio/smartxmlfile.h>
@@ -55,6 +57,11 @@ void MainWindow::reset()
     mAbortConversion = false;
     mReadedElementsCount = 0;
     mConvertedElementsCount = 0;
+    {
+        QMutexLocker lock(&mContentHashMutex);
+        mSymbolContentMap.clear();
+        mPackageContentMap.clear();
+    }
 
     ui->errors->clear();
     ui->pbarElements->setValue(0);
@@ -66,11 +73,45 @@ void MainWindow::reset()
 
 void MainWindow::addError(const QString& msg, const FilePath& inputFile, int inputLine)
 {
-    ui->errors->addItem(QString("%1 (%2:%3)").arg(msg).arg(inputFile.toNative()).arg(inputLine));
+    // may be called from worker threads --> only collect the message here and
+    // let the GUI thread add it to the list widget in flushErrors()
+    QMutexLocker lock(&mErrorsMutex);
+    mPendingErrors.append(QString("%1 (%2:%3)").arg(msg).arg(inputFile.toNative()).arg(inputLine));
+}
+
+void MainWindow::flushErrors()
+{
+    QMutexLocker lock(&mErrorsMutex);
+    foreach (const QString& error, mPendingErrors) {
+        ui->errors->addItem(error);
+    }
+    mPendingErrors.clear();
 }
 
 Uuid MainWindow::getOrCreateUuid(QSettings& outputSettings, const FilePath& filepath,
                                   const QString& cat, const QString& key1, const QString& key2)
+{
+    // QSettings is reentrant, but not thread-safe --> serialize the accesses
+    // of the worker threads to the shared UUID list
+    QMutexLocker lock(&mUuidSettingsMutex);
+
+    QString settingsKey = buildUuidSettingsKey(filepath, cat, key1, key2);
+
+    Uuid uuid = Uuid::createRandom();
+    QString value = outputSettings.value(settingsKey).toString();
+    if (!value.isEmpty()) uuid = Uuid(value); //Uuid(QString("{%1}").arg(value));
+
+    if (uuid.isNull())
+    {
+        addError("Invalid UUID in *.ini file: " % settingsKey, filepath);
+        return Uuid::createRandom();
+    }
+    outputSettings.setValue(settingsKey, uuid.toStr());
+    return uuid;
+}
+
+QString MainWindow::buildUuidSettingsKey(const FilePath& filepath, const QString& cat,
+                                         const QString& key1, const QString& key2) noexcept
 {
     QString allowedChars("_-.0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz");
 
@@ -84,18 +125,41 @@ Uuid MainWindow::getOrCreateUuid(QSettings& outputSettings, const FilePath& file
             settingsKey.replace(i, 1, QString("__U%1__").arg(QString::number(settingsKey[i].unicode(), 16).toUpper()));
     }
     settingsKey.prepend(cat % '/');
+    return settingsKey;
+}
 
-    Uuid uuid = Uuid::createRandom();
-    QString value = outputSettings.value(settingsKey).toString();
-    if (!value.isEmpty()) uuid = Uuid(value); //Uuid(QString("{%1}").arg(value));
+void MainWindow::setUuid(QSettings& outputSettings, const FilePath& filepath,
+                         const QString& cat, const QString& key1, const QString& key2,
+                         const Uuid& uuid)
+{
+    QMutexLocker lock(&mUuidSettingsMutex);
+    outputSettings.setValue(buildUuidSettingsKey(filepath, cat, key1, key2), uuid.toStr());
+}
 
-    if (uuid.isNull())
-    {
-        addError("Invalid UUID in *.ini file: " % settingsKey, filepath);
-        return Uuid::createRandom();
-    }
-    outputSettings.setValue(settingsKey, uuid.toStr());
-    return uuid;
+QString MainWindow::calcElementContentHash(const SerializableObject& element,
+                                           const QString& rootName)
+{
+    // serialize the element and neutralize everything which legitimately differs
+    // between two identical conversions: the UUIDs (random per element) and the
+    // descriptions (they embed the source *.lbr filename). What remains is the
+    // converted content, so equal hashes mean interchangeable elements.
+    std::function<void(DomElement*)> neutralize = [&neutralize](DomElement* e) {
+        if (e->hasAttribute("uuid")) {
+            e->setAttribute("uuid", QString());
+        }
+        QList<DomElement*> childs = e->getChilds(); // copy, childs are removed below
+        foreach (DomElement* child, childs) {
+            if (child->getName() == "description") {
+                e->removeChild(child, true);
+            } else {
+                neutralize(child);
+            }
+        }
+    };
+    DomDocument doc(*element.serializeToDomElement(rootName)); // can throw
+    neutralize(&doc.getRoot());
+    return QString(QCryptographicHash::hash(doc.toByteArray(),
+                                            QCryptographicHash::Sha256).toHex());
 }
 
 QString MainWindow::createDescription(const FilePath& filepath, const QString& name)
@@ -150,8 +214,12 @@ void MainWindow::convertAllFiles(ConvertFileType_t type)
 {
     reset();
 
+    // the workers must not access the UI --> make the output directory
+    // available as a plain string member
+    mOutputDirectory = ui->output->text();
+
     // create output directory
-    FilePath outputDir(ui->output->text());
+    FilePath outputDir(mOutputDirectory);
     try {
         FileUtils::makePath(outputDir); // can throw
     } catch (const Exception& e) {
@@ -175,6 +243,8 @@ void MainWindow::convertAllFiles(ConvertFileType_t type)
         if (mAbortConversion)
             break;
     }
+
+    flushErrors();
 }
 
 void MainWindow::convertFile(ConvertFileType_t type, QSettings& outputSettings, const FilePath& filepath)
@@ -205,29 +275,58 @@ void MainWindow::convertFile(ConvertFileType_t type, QSettings& outputSettings,
         ui->pbarElements->setMaximum(node->getChildCount());
 
         // Convert Elements
-        foreach (DomElement* child, node->getChilds()) {
-            bool success;
-            if (child->getName() == "symbol")
-                success = convertSymbol(outputSettings, filepath, child);
-            else if (child->getName() == "package")
-                success = convertPackage(outputSettings, filepath, child);
-            else if (child->getName() == "deviceset")
-                success = convertDevice(outputSettings, filepath, child);
-            else
-                throw Exception(__FILE__, __LINE__, child->getName());
-
+        //
+        // The file is already parsed at this point, and converting/serializing/
+        // writing the single elements are independent of each other, so they
+        // are distributed on the global thread pool. The GUI thread runs a
+        // local event loop in the meantime to report progress and errors.
+        ElementConverter converter;
+        converter.window = this;
+        converter.outputSettings = &outputSettings;
+        converter.filepath = filepath;
+
+        QEventLoop loop;
+        QFutureWatcher<bool> watcher;
+        connect(&watcher, &QFutureWatcher<bool>::resultReadyAt,
+                [this, &watcher](int index){
             mReadedElementsCount++;
-            if (success) mConvertedElementsCount++;
+            if (watcher.resultAt(index)) mConvertedElementsCount++;
             ui->pbarElements->setValue(ui->pbarElements->value() + 1);
             ui->lblConvertedElements->setText(QString("%1 of %2").arg(mConvertedElementsCount)
                                                                  .arg(mReadedElementsCount));
-        }
+            flushErrors();
+            if (mAbortConversion) watcher.cancel();
+        });
+        connect(&watcher, &QFutureWatcher<bool>::finished, &loop, &QEventLoop::quit);
+        watcher.setFuture(QtConcurrent::mapped(node->getChilds(), converter));
+        loop.exec();
     }
     catch (Exception& e)
     {
         addError(e.getMsg());
-        return;
     }
+
+    flushErrors();
+}
+
+bool MainWindow::ElementConverter::operator()(DomElement* node) const
+{
+    return window->convertElement(*outputSettings, filepath, node);
+}
+
+bool MainWindow::convertElement(QSettings& outputSettings, const FilePath& filepath,
+                                DomElement* node)
+{
+    // note: runs on a worker thread, so exceptions must not escape from here
+    if (node->getName() == "symbol")
+        return convertSymbol(outputSettings, filepath, node);
+    else if (node->getName() == "package")
+        return convertPackage(outputSettings, filepath, node);
+    else if (node->getName() == "deviceset")
+        return convertDevice(outputSettings, filepath, node);
+
+    addError(QString("Unknown node name: %1").arg(node->getName()), filepath);
+    return false;
 }
 
 bool MainWindow::convertSymbol(QSettings& outputSettings, const FilePath& filepath, DomElement* node)
@@ -371,8 +470,42 @@ bool MainWindow::convertSymbol(QSettings& outputSettings, const FilePath& filepa
         PolygonSimplifier<Symbol> polygonSimplifier(*symbol);
         polygonSimplifier.convertLineRectsToPolygonRects(false, true);
 
+        // content-hash deduplication: if an identical symbol was already converted
+        // (Eagle libraries repeat the same geometry per device set), redirect all
+        // references of this one to the canonical symbol instead of saving a copy
+        QString contentHash = calcElementContentHash(*symbol, "symbol"); // can throw
+        {
+            QMutexLocker lock(&mContentHashMutex);
+            auto it = mSymbolContentMap.constFind(contentHash);
+            if ((it != mSymbolContentMap.constEnd()) && (it->uuid != uuid)) {
+                DedupEntry canonical = *it;
+                lock.unlock();
+                setUuid(outputSettings, filepath, "symbols", name, QString(), canonical.uuid);
+                // the pin references of later device conversions are keyed by the
+                // (now redirected) symbol uuid, so they must be mapped as well
+                for (int i = 0; i < symbol->getPins().count(); ++i) {
+                    const SymbolPin& pin = *symbol->getPins().at(i);
+                    Uuid pinUuid = canonical.childUuids.value(pin.getName());
+                    if (!pinUuid.isNull()) {
+                        setUuid(outputSettings, filepath, "symbol_pins",
+                                canonical.uuid.toStr(), pin.getName(), pinUuid);
+                    }
+                }
+                delete symbol;
+                return true;
+            } else if (it == mSymbolContentMap.constEnd()) {
+                DedupEntry entry;
+                entry.uuid = uuid;
+                for (int i = 0; i < symbol->getPins().count(); ++i) {
+                    const SymbolPin& pin = *symbol->getPins().at(i);
+                    entry.childUuids.insert(pin.getName(), pin.getUuid());
+                }
+                mSymbolContentMap.insert(contentHash, entry);
+            }
+        }
+
         // save symbol to file
-        symbol->saveIntoParentDirectory(FilePath(QString("%1/sym").arg(ui->output->text())));
+        symbol->saveIntoParentDirectory(FilePath(QString("%1/sym").arg(mOutputDirectory)));
         delete symbol;
     }
     catch (Exception& e)
@@ -586,8 +719,44 @@ bool MainWindow::convertPackage(QSettings& outputSettings, const FilePath& filep
         // add footprint to package
         package->getFootprints().append(std::make_shared<Footprint>(footprint));
 
+        // content-hash deduplication, analogous to convertSymbol()
+        QString contentHash = calcElementContentHash(*package, "package"); // can throw
+        {
+            QMutexLocker lock(&mContentHashMutex);
+            auto it = mPackageContentMap.constFind(contentHash);
+            if ((it != mPackageContentMap.constEnd()) && (it->uuid != pkgUuid)) {
+                DedupEntry canonical = *it;
+                lock.unlock();
+                setUuid(outputSettings, filepath, "packages_to_packages", name, QString(),
+                        canonical.uuid);
+                setUuid(outputSettings, filepath, "packages_to_footprints", name, QString(),
+                        canonical.footprintUuid);
+                // pad references of later device conversions are keyed by the
+                // (now redirected) footprint uuid
+                for (int i = 0; i < package->getPads().count(); ++i) {
+                    const PackagePad& pad = *package->getPads().at(i);
+                    Uuid padUuid = canonical.childUuids.value(pad.getName());
+                    if (!padUuid.isNull()) {
+                        setUuid(outputSettings, filepath, "package_pads",
+                                canonical.footprintUuid.toStr(), pad.getName(), padUuid);
+                    }
+                }
+                delete package;
+                return true;
+            } else if (it == mPackageContentMap.constEnd()) {
+                DedupEntry entry;
+                entry.uuid = pkgUuid;
+                entry.footprintUuid = fptUuid;
+                for (int i = 0; i < package->getPads().count(); ++i) {
+                    const PackagePad& pad = *package->getPads().at(i);
+                    entry.childUuids.insert(pad.getName(), pad.getUuid());
+                }
+                mPackageContentMap.insert(contentHash, entry);
+            }
+        }
+
         // save package to file
-        package->saveIntoParentDirectory(FilePath(QString("%1/pkg").arg(ui->output->text())));
+        package->saveIntoParentDirectory(FilePath(QString("%1/pkg").arg(mOutputDirectory)));
 
         // clean up
         delete package;
@@ -712,12 +881,12 @@ bool MainWindow::convertDevice(QSettings& outputSettings, const FilePath& filepa
             }
 
             // save device
-            device->saveIntoParentDirectory(FilePath(QString("%1/dev").arg(ui->output->text())));
+            device->saveIntoParentDirectory(FilePath(QString("%1/dev").arg(mOutputDirectory)));
             delete device;
         }
 
         // save component to file
-        component->saveIntoParentDirectory(FilePath(QString("%1/cmp").arg(ui->output->text())));
+        component->saveIntoParentDirectory(FilePath(QString("%1/cmp").arg(mOutputDirectory)));
         delete component;
     }
     catch (Exception& e)
@@ -6,6 +6,7 @@
 #include <librepcb/common/uuid.h>
 #include <librepcb/common/fileio/filepath.h>
 #include <librepcb/common/fileio/domelement.h>
+#include <librepcb/common/fileio/serializableobject.h>
 
 namespace Ui {
 class MainWindow;
@@ -46,18 +47,46 @@ class MainWindow : public QMainWindow
             Devices_to_Components
         };
 
+        /// canonical representative of one unique element content, used for the
+        /// content-hash deduplication (see #convertSymbol() / #convertPackage())
+        struct DedupEntry {
+            librepcb::Uuid uuid;            ///< uuid of the canonical element
+            librepcb::Uuid footprintUuid;   ///< footprint uuid (packages only)
+            QHash<QString, librepcb::Uuid> childUuids; ///< pin/pad name -> uuid
+        };
+
+        /// functor which converts one library element; used with QtConcurrent::mapped()
+        struct ElementConverter {
+            typedef bool result_type;
+            MainWindow* window;
+            QSettings* outputSettings;
+            librepcb::FilePath filepath;
+            bool operator()(librepcb::DomElement* node) const;
+        };
+
         void reset();
         void addError(const QString& msg, const librepcb::FilePath& inputFile = librepcb::FilePath(), int inputLine = 0);
+        void flushErrors();
         librepcb::Uuid getOrCreateUuid(QSettings& outputSettings,
                                        const librepcb::FilePath& filepath,
                                        const QString& cat, const QString& key1,
                                        const QString& key2 = QString());
+        static QString buildUuidSettingsKey(const librepcb::FilePath& filepath,
+                                            const QString& cat, const QString& key1,
+                                            const QString& key2) noexcept;
+        void setUuid(QSettings& outputSettings, const librepcb::FilePath& filepath,
+                     const QString& cat, const QString& key1, const QString& key2,
+                     const librepcb::Uuid& uuid);
+        static QString calcElementContentHash(const librepcb::SerializableObject& element,
+                                              const QString& rootName);
         QString createDescription(const librepcb::FilePath& filepath, const QString& name);
         QString convertSchematicLayer(int eagleLayerId);
         QString convertBoardLayer(int eagleLayerId);
         void convertAllFiles(ConvertFileType_t type);
         void convertFile(ConvertFileType_t type, QSettings& outputSettings,
                          const librepcb::FilePath& filepath);
+        bool convertElement(QSettings& outputSettings, const librepcb::FilePath& filepath,
+                            librepcb::DomElement* node);
         bool convertSymbol(QSettings& outputSettings, const librepcb::FilePath& filepath,
                            librepcb::DomElement* node);
         bool convertPackage(QSettings& outputSettings, const librepcb::FilePath& filepath,
@@ -69,8 +98,15 @@ class MainWindow : public QMainWindow
         Ui::MainWindow *ui;
         bool mAbortConversion;
         QString mlastInputDirectory;
+        QString mOutputDirectory; ///< copy of ui->output, readable from worker threads
         int mReadedElementsCount;
         int mConvertedElementsCount;
+        QMutex mUuidSettingsMutex; ///< guards the UUID list QSettings object
+        QMutex mContentHashMutex; ///< guards #mSymbolContentMap / #mPackageContentMap
+        QHash<QString, DedupEntry> mSymbolContentMap; ///< content hash -> canonical symbol
+        QHash<QString, DedupEntry> mPackageContentMap; ///< content hash -> canonical package
+        QMutex mErrorsMutex; ///< guards #mPendingErrors
+        QStringList mPendingErrors; ///< errors not yet shown in the UI, see flushErrors()
 };
 
 }
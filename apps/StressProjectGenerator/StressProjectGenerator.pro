@@ -0,0 +1,48 @@
+#-------------------------------------------------
+#
+# Project created 2026-09-01
+#
+#-------------------------------------------------
+
+TEMPLATE = app
+TARGET = stress-project-generator
+
+# Set the path for the generated binary
+GENERATED_DIR = ../../generated
+
+# Use common project definitions
+include(../../common.pri)
+
+QT += core widgets network xml printsupport sql concurrent
+
+CONFIG += console
+CONFIG -= app_bundle
+
+LIBS += \
+    -L$${DESTDIR} \
+    -llibrepcbworkspace \
+    -llibrepcbproject \
+    -llibrepcblibrary \    # Note: The order of the libraries is very important for the linker!
+    -llibrepcbcommon \     # Another order could end up in "undefined reference" errors!
+    -lquazip -lz
+
+INCLUDEPATH += \
+    ../../libs \
+    ../../libs/quazip
+
+DEPENDPATH += \
+    ../../libs/librepcb/workspace \
+    ../../libs/librepcb/project \
+    ../../libs/librepcb/library \
+    ../../libs/librepcb/common \
+    ../../libs/quazip
+
+PRE_TARGETDEPS += \
+    $${DESTDIR}/liblibrepcbworkspace.a \
+    $${DESTDIR}/liblibrepcbproject.a \
+    $${DESTDIR}/liblibrepcblibrary.a \
+    $${DESTDIR}/liblibrepcbcommon.a \
+    $${DESTDIR}/libquazip.a
+
+SOURCES += \
+    main.cpp \
@@ -0,0 +1,164 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+#include <librepcb/common/application.h>
+#include <librepcb/common/exceptions.h>
+#include <librepcb/common/fileio/filepath.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/common/units/all_length_units.h>
+#include <librepcb/project/project.h>
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/circuit/netclass.h>
+#include <librepcb/project/circuit/netsignal.h>
+#include <librepcb/project/schematics/schematic.h>
+#include <librepcb/project/schematics/items/si_netpoint.h>
+#include <librepcb/project/schematics/items/si_netline.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardlayerstack.h>
+#include <librepcb/project/boards/items/bi_netpoint.h>
+#include <librepcb/project/boards/items/bi_netline.h>
+
+using namespace librepcb;
+using namespace librepcb::project;
+
+/*****************************************************************************************
+ *  generateProject()
+ *
+ *  Builds a synthetic project of parameterized size through the regular domain APIs,
+ *  so the benchmark suite and scaling bug reports have reproducible large inputs
+ *  without sharing any production design. The geometry is meaningless but has the
+ *  right *shape* for scaling tests: many nets, many placed netpoints/netlines on
+ *  boards and sheets, laid out on a grid.
+ ****************************************************************************************/
+
+static void generateProject(const FilePath& lppFile, int nets, int tracks, int sheets)
+{
+    QScopedPointer<Project> project(Project::create(lppFile)); // can throw
+    Circuit& circuit = project->getCircuit();
+
+    // netclass + netsignals
+    NetClass* netclass = new NetClass(circuit, "stress");
+    circuit.addNetClass(*netclass); // can throw
+    QList<NetSignal*> netSignals;
+    for (int i = 0; i < nets; ++i) {
+        NetSignal* signal = new NetSignal(circuit, *netclass,
+                                          QString("NET%1").arg(i), false);
+        circuit.addNetSignal(*signal); // can throw
+        netSignals.append(signal);
+    }
+
+    // schematic sheets with a zig-zag wire per net
+    const int netsPerSheet = qMax(1, nets / qMax(1, sheets));
+    for (int k = 0; k < sheets; ++k) {
+        Schematic* schematic = project->createSchematic(QString("Sheet %1").arg(k + 1));
+        project->addSchematic(*schematic); // can throw
+        for (int i = 0; i < netsPerSheet; ++i) {
+            NetSignal* signal = netSignals.at((k * netsPerSheet + i) % netSignals.count());
+            SI_NetPoint* last = nullptr;
+            for (int j = 0; j < 4; ++j) {
+                Point pos = Point::fromMm(10 + j * 10, 10 + i * 5);
+                SI_NetPoint* netpoint = new SI_NetPoint(*schematic, *signal, pos);
+                schematic->addNetPoint(*netpoint); // can throw
+                if (last) {
+                    SI_NetLine* netline = new SI_NetLine(*schematic, *last, *netpoint,
+                                                         Length(158750));
+                    schematic->addNetLine(*netline); // can throw
+                }
+                last = netpoint;
+            }
+        }
+    }
+
+    // one board with the requested number of tracks (one netline per track)
+    Board* board = project->createBoard("default");
+    project->addBoard(*board); // can throw
+    GraphicsLayer* copper = board->getLayerStack().getLayer(GraphicsLayer::sTopCopper);
+    if (!copper) throw LogicError(__FILE__, __LINE__);
+    int tracksPerRow = 1;
+    while ((tracksPerRow * tracksPerRow) < tracks) {
+        ++tracksPerRow; // lay the tracks out in a roughly quadratic grid
+    }
+    for (int m = 0; m < tracks; ++m) {
+        NetSignal* signal = netSignals.at(m % netSignals.count());
+        Point p1 = Point::fromMm((m % tracksPerRow) * 2, (m / tracksPerRow) * 2);
+        Point p2 = p1 + Point::fromMm(1, 1);
+        BI_NetPoint* np1 = new BI_NetPoint(*board, *copper, *signal, p1);
+        board->addNetPoint(*np1); // can throw
+        BI_NetPoint* np2 = new BI_NetPoint(*board, *copper, *signal, p2);
+        board->addNetPoint(*np2); // can throw
+        BI_NetLine* netline = new BI_NetLine(*board, *np1, *np2, Length(254000));
+        board->addNetLine(*netline); // can throw
+    }
+
+    project->save(true); // can throw
+}
+
+/*****************************************************************************************
+ *  main()
+ ****************************************************************************************/
+
+int main(int argc, char* argv[])
+{
+    Application app(argc, argv);
+    QCoreApplication::setOrganizationName("LibrePCB");
+    QCoreApplication::setApplicationName("StressProjectGenerator");
+
+    QCommandLineParser parser;
+    parser.setApplicationDescription(
+        "Generates a synthetic LibrePCB project of parameterized size for "
+        "benchmarks and scaling bug reports.");
+    parser.addHelpOption();
+    QCommandLineOption outputOption("output", "Destination *.lpp file (required).", "file");
+    QCommandLineOption netsOption("nets", "Number of net signals.", "count", "100");
+    QCommandLineOption tracksOption("tracks", "Number of board tracks.", "count", "1000");
+    QCommandLineOption sheetsOption("sheets", "Number of schematic sheets.", "count", "1");
+    parser.addOption(outputOption);
+    parser.addOption(netsOption);
+    parser.addOption(tracksOption);
+    parser.addOption(sheetsOption);
+    parser.process(app);
+
+    if (!parser.isSet(outputOption)) {
+        qCritical() << "Missing required option --output, see --help.";
+        return 1;
+    }
+
+    try {
+        FilePath lppFile(QFileInfo(parser.value(outputOption)).absoluteFilePath());
+        int nets = qMax(1, parser.value(netsOption).toInt());
+        int tracks = qMax(0, parser.value(tracksOption).toInt());
+        int sheets = qMax(1, parser.value(sheetsOption).toInt());
+
+        QElapsedTimer timer;
+        timer.start();
+        generateProject(lppFile, nets, tracks, sheets); // can throw
+        qInfo() << QString("Generated \"%1\" (%2 nets, %3 tracks, %4 sheets) in %5 ms.")
+                   .arg(lppFile.toNative()).arg(nets).arg(tracks).arg(sheets)
+                   .arg(timer.elapsed());
+        return 0;
+    } catch (const Exception& e) {
+        qCritical() << "Generation failed:" << e.getMsg();
+        return 1;
+    }
+}
@@ -1,5 +1,6 @@
 #include <QtCore>
 #include <QtWidgets>
+#include <QtConcurrent/QtConcurrent>
 #include "mainwindow.h"
 #include "ui_mainwindow.h"
 #include <librepcb/common/fileio/smartxmlfile.h>
@@ -11,6 +12,30 @@
 using namespace librepcb;
 using namespace librepcb::library;
 
+namespace {
+
+/**
+ * Functor which runs the load-upgrade-save cycle of one element, for use with
+ * QtConcurrent::mapped() (the same pattern the workspace library scanner uses). The
+ * global thread pool distributes the elements across all cores, which also balances
+ * the wildly varying element sizes. Returns the error message (empty = success).
+ */
+template <typename ElementType>
+struct ElementUpdater {
+    typedef QString result_type;
+    result_type operator()(const FilePath& filepath) const noexcept {
+        try {
+            ElementType element(filepath, false); // can throw
+            element.save(); // can throw
+            return QString();
+        } catch (const Exception& e) {
+            return e.getMsg();
+        }
+    }
+};
+
+} // namespace
+
 MainWindow::MainWindow(QWidget *parent) :
     QMainWindow(parent), ui(new Ui::MainWindow)
 {
@@ -85,6 +110,9 @@ void MainWindow::on_updateBtn_clicked()
     if (ui->libDirs->count() == 0) return;
     ui->log->clear();
 
+    // prevent re-entrance while processEvents() keeps the UI responsive
+    ui->updateBtn->setEnabled(false);
+
     elementCount = 0;
     ignoreCount = 0;
     errorCount = 0;
@@ -96,17 +124,34 @@ void MainWindow::on_updateBtn_clicked()
         {
             library::Library lib(FilePath(dirStr), false);
 
-            if (ui->cbx_cmpcat->isChecked()) updateElements<ComponentCategory>(lib);
-            if (ui->cbx_pkgcat->isChecked()) updateElements<PackageCategory>(lib);
-            if (ui->cbx_sym->isChecked()) updateElements<Symbol>(lib);
-            if (ui->cbx_pkg->isChecked()) updateElements<Package>(lib);
-            if (ui->cbx_cmp->isChecked()) updateElements<Component>(lib);
-            if (ui->cbx_dev->isChecked()) updateElements<Device>(lib);
+            // load the resume journal of a previously interrupted migration: all
+            // elements listed in it are already upgraded and are skipped below
+            QSet<QString> journal = loadJournal(lib.getFilePath());
+            if (!journal.isEmpty()) {
+                ui->log->addItem(QString("NOTE: resuming interrupted migration "
+                                         "(%1 elements already done)").arg(journal.count()));
+            }
+            QFile journalFile(getJournalFilePath(lib.getFilePath()).toStr());
+            if (!journalFile.open(QIODevice::WriteOnly | QIODevice::Append)) {
+                ui->log->addItem("WARNING: could not open the resume journal, "
+                                 "an interrupted migration will restart from scratch");
+            }
+
+            if (ui->cbx_cmpcat->isChecked()) updateElements<ComponentCategory>(lib, journal, journalFile);
+            if (ui->cbx_pkgcat->isChecked()) updateElements<PackageCategory>(lib, journal, journalFile);
+            if (ui->cbx_sym->isChecked()) updateElements<Symbol>(lib, journal, journalFile);
+            if (ui->cbx_pkg->isChecked()) updateElements<Package>(lib, journal, journalFile);
+            if (ui->cbx_cmp->isChecked()) updateElements<Component>(lib, journal, journalFile);
+            if (ui->cbx_dev->isChecked()) updateElements<Device>(lib, journal, journalFile);
 
             if (ui->cbx_lplib->isChecked()) {
                 lib.save();
                 elementCount++;
             }
+
+            // the whole library was migrated --> the journal is no longer needed
+            journalFile.close();
+            journalFile.remove();
         }
         catch (Exception& e)
         {
@@ -118,25 +163,68 @@ void MainWindow::on_updateBtn_clicked()
     ui->log->addItem(QString("FINISHED: %1 updated, %2 ignored, %3 errors")
                      .arg(elementCount).arg(ignoreCount).arg(errorCount));
     ui->log->setCurrentRow(ui->log->count()-1);
+    ui->updateBtn->setEnabled(true);
 }
 
 template <typename ElementType>
-void MainWindow::updateElements(const library::Library& lib) noexcept
+void MainWindow::updateElements(const library::Library& lib,
+                                const QSet<QString>& journal,
+                                QFile& journalFile) noexcept
 {
+    // collect the elements which still need to be upgraded
+    QList<FilePath> paths;
     foreach (const FilePath& fp, lib.searchForElements<ElementType>()) {
         if (fp.getBasename() == "00000000-0000-4001-8000-000000000000") {
             // ignore demo files as they contain documentation which would be removed
             ignoreCount++;
             continue;
         }
-        try {
-            ElementType element(fp, false);
-            element.save();
-            ui->log->addItem(fp.toNative());
+        if (journal.contains(fp.toRelative(lib.getFilePath()))) {
+            elementCount++; // already done by an interrupted previous run
+            continue;
+        }
+        paths.append(fp);
+    }
+
+    // upgrade the elements in parallel; the results are consumed (and journaled) in
+    // order on this thread
+    QFuture<QString> results = QtConcurrent::mapped(paths, ElementUpdater<ElementType>());
+    for (int i = 0; i < paths.count(); ++i) {
+        const QString errorMsg = results.resultAt(i); // blocks until available
+        if (errorMsg.isEmpty()) {
+            ui->log->addItem(paths.at(i).toNative());
             elementCount++;
-        } catch (const Exception& e) {
-            ui->log->addItem("ERROR: " % e.getMsg());
+            if (journalFile.isOpen()) {
+                // only successes are journaled, so a resumed migration retries
+                // the failed elements
+                journalFile.write(paths.at(i).toRelative(lib.getFilePath()).toUtf8());
+                journalFile.write("\n");
+                journalFile.flush();
+            }
+        } else {
+            ui->log->addItem("ERROR: " % errorMsg);
             errorCount++;
         }
+        ui->log->setCurrentRow(ui->log->count()-1);
+        qApp->processEvents(); // keep the log scrolling during long migrations
+    }
+}
+
+FilePath MainWindow::getJournalFilePath(const FilePath& libDir) noexcept
+{
+    return libDir.getPathTo(".migration_journal");
+}
+
+QSet<QString> MainWindow::loadJournal(const FilePath& libDir) noexcept
+{
+    QSet<QString> journal;
+    QFile file(getJournalFilePath(libDir).toStr());
+    if (file.open(QIODevice::ReadOnly)) {
+        foreach (const QByteArray& line, file.readAll().split('\n')) {
+            if (!line.trimmed().isEmpty()) {
+                journal.insert(QString::fromUtf8(line.trimmed()));
+            }
+        }
     }
+    return journal;
 }
@@ -38,7 +38,11 @@ class MainWindow : public QMainWindow
     private:
 
         template <typename ElementType>
-        void updateElements(const librepcb::library::Library& lib) noexcept;
+        void updateElements(const librepcb::library::Library& lib,
+                            const QSet<QString>& journal,
+                            QFile& journalFile) noexcept;
+        static librepcb::FilePath getJournalFilePath(const librepcb::FilePath& libDir) noexcept;
+        static QSet<QString> loadJournal(const librepcb::FilePath& libDir) noexcept;
 
         // Attributes
         Ui::MainWindow *ui;
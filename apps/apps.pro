@@ -4,5 +4,6 @@ SUBDIRS = \
     librepcb \
     EagleImport \
     ProjectLibraryUpdater \
+    StressProjectGenerator \
     UuidGenerator \
     WorkspaceLibraryUpdater
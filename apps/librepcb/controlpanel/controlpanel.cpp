@@ -25,6 +25,7 @@
 #include <QFileDialog>
 #include "controlpanel.h"
 #include "ui_controlpanel.h"
+#include <librepcb/common/tracer.h>
 #include <librepcb/workspace/workspace.h>
 #include <librepcb/workspace/settings/workspacesettings.h>
 #include <librepcb/project/project.h>
@@ -37,6 +38,7 @@
 #include <librepcb/projecteditor/projecteditor.h>
 #include <librepcb/projecteditor/newprojectwizard/newprojectwizard.h>
 #include <librepcb/common/application.h>
+#include <librepcb/common/systeminfo.h>
 #include "../markdown/markdownconverter.h"
 
 /*****************************************************************************************
@@ -110,12 +112,70 @@ ControlPanel::ControlPanel(Workspace& workspace) :
 
     loadSettings();
 
+    // listen for project paths handed over by later application launches (see
+    // the single-instance handling in main.cpp); a stale socket left behind by
+    // a crashed instance is removed first, otherwise listen() would fail
+    QLocalServer::removeServer(getSingleInstanceServerName());
+    mSingleInstanceServer.reset(new QLocalServer(this));
+    if (mSingleInstanceServer->listen(getSingleInstanceServerName())) {
+        connect(mSingleInstanceServer.data(), &QLocalServer::newConnection,
+                this, &ControlPanel::singleInstanceConnection);
+    } else {
+        qWarning() << "Could not start the single instance server:"
+                   << mSingleInstanceServer->errorString();
+    }
+
+    // staged startup: everything which is not required for the first paint of the
+    // main window (opening projects from the command line, starting the library
+    // scan) runs deferred from the event loop, so the window appears immediately
+    QTimer::singleShot(0, this, SLOT(deferredStartupInit()));
+}
+
+QString ControlPanel::getSingleInstanceServerName() noexcept
+{
+    // one instance per user; the organization name avoids clashes with other
+    // applications using the same pattern
+    return QString("%1-%2-single-instance").arg(qApp->organizationName(),
+                                                SystemInfo::getUsername());
+}
+
+void ControlPanel::singleInstanceConnection() noexcept
+{
+    while (QLocalSocket* socket = mSingleInstanceServer->nextPendingConnection()) {
+        connect(socket, &QLocalSocket::disconnected, socket, &QObject::deleteLater);
+        // the message is tiny and sent immediately, so a short blocking read is ok
+        socket->waitForReadyRead(1000);
+        QStringList paths = QString::fromUtf8(socket->readAll())
+                            .split('\n', QString::SkipEmptyParts);
+        socket->disconnectFromServer();
+
+        // bring this instance to the front, then open the handed-over projects
+        // with the already-warm workspace and library database
+        show();
+        raise();
+        activateWindow();
+        foreach (const QString& path, paths) {
+            FilePath filepath(path);
+            if ((filepath.isExistingFile()) && (filepath.getSuffix() == "lpp")) {
+                openProject(filepath);
+            }
+        }
+    }
+}
+
+void ControlPanel::deferredStartupInit() noexcept
+{
+    TracerScope trace("ControlPanel::deferredStartupInit");
+
     // parse command line arguments and open all project files
-    foreach (const QString& arg, qApp->arguments())
     {
-        FilePath filepath(arg);
-        if ((filepath.isExistingFile()) && (filepath.getSuffix() == "lpp"))
-            openProject(filepath);
+        TracerScope trace("open projects from command line");
+        foreach (const QString& arg, qApp->arguments())
+        {
+            FilePath filepath(arg);
+            if ((filepath.isExistingFile()) && (filepath.getSuffix() == "lpp"))
+                openProject(filepath);
+        }
     }
 
     // start scanning the workspace library (asynchronously)
@@ -212,11 +272,9 @@ void ControlPanel::loadSettings()
         foreach (QString item, list)
         {
             FilePath filepath = FilePath::fromRelative(mWorkspace.getPath(), item);
-            QModelIndexList items = model->match(model->index(0, 0), Qt::UserRole,
-                QVariant::fromValue(filepath.toStr()), 1,
-                Qt::MatchFlags(Qt::MatchExactly | Qt::MatchWrap | Qt::MatchRecursive));
-            if (!items.isEmpty())
-                mUi->projectTreeView->setExpanded(items.first(), true);
+            QModelIndex index = model->getIndexOfFilePath(filepath);
+            if (index.isValid())
+                mUi->projectTreeView->setExpanded(index, true);
         }
     }
 
@@ -272,7 +330,20 @@ ProjectEditor* ControlPanel::openProject(const FilePath& filepath) noexcept
         ProjectEditor* editor = getOpenProject(filepath);
         if (!editor)
         {
-            Project* project = new Project(filepath, false);
+            // show a modal progress dialog with a cancel button while opening; it
+            // only pops up if opening takes longer than a moment (small projects
+            // open without any flicker), and canceling stops the load at the next
+            // phase boundary instead of blocking until the whole project is loaded
+            QProgressDialog progress(tr("Open project..."), tr("Cancel"), 0, 100, this);
+            progress.setWindowModality(Qt::WindowModal);
+            progress.setMinimumDuration(500);
+            Project* project = new Project(filepath, false,
+                [&progress](int percent, const QString& status) {
+                    progress.setLabelText(status);
+                    progress.setValue(percent); // processes events (modal dialog)
+                    return !progress.wasCanceled();
+                });
+            progress.setValue(100);
             editor = new ProjectEditor(mWorkspace, *project);
             connect(editor, &ProjectEditor::projectEditorClosed, this, &ControlPanel::projectEditorClosed);
             connect(editor, &ProjectEditor::showControlPanelClicked, this, &ControlPanel::showControlPanel);
@@ -25,6 +25,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include <QtWidgets>
+#include <QtNetwork>
 #include <librepcb/common/exceptions.h>
 
 /*****************************************************************************************
@@ -84,6 +85,11 @@ class ControlPanel final : public QMainWindow
         explicit ControlPanel(workspace::Workspace& workspace);
         ~ControlPanel();
 
+        // Static Methods
+
+        /// name of the per-user local socket used for the single-instance mode
+        static QString getSingleInstanceServerName() noexcept;
+
 
     public slots:
 
@@ -100,6 +106,8 @@ class ControlPanel final : public QMainWindow
 
         // private slots
         void projectEditorClosed() noexcept;
+        void deferredStartupInit() noexcept;
+        void singleInstanceConnection() noexcept;
 
         // Actions
         void on_actionAbout_triggered();
@@ -214,6 +222,7 @@ class ControlPanel final : public QMainWindow
         QScopedPointer<library::manager::LibraryManager> mLibraryManager;
         QHash<QString, project::editor::ProjectEditor*> mOpenProjectEditors;
         QHash<library::Library*, library::editor::LibraryEditor*> mOpenLibraryEditors;
+        QScopedPointer<QLocalServer> mSingleInstanceServer; ///< see #getSingleInstanceServerName()
 };
 
 /*****************************************************************************************
@@ -16,7 +16,10 @@ include(../../common.pri)
 # Set preprocessor defines
 exists(../../.git):DEFINES += GIT_BRANCH=\\\"master\\\"
 
-QT += core widgets opengl network xml printsupport sql
+QT += core widgets network xml printsupport sql concurrent
+
+# the QGLWidget fallback of GraphicsView needs the QtOpenGL module on Qt < 5.4
+lessThan(QT_MINOR_VERSION, 4): QT += opengl
 
 win32 {
     # Windows-specific configurations
@@ -22,12 +22,21 @@
  ****************************************************************************************/
 #include <QtCore>
 #include <QtWidgets>
+#include <QtNetwork>
 #include <QTranslator>
 #include <librepcb/common/application.h>
+#include <librepcb/common/memorystats.h>
+#include <librepcb/common/tracer.h>
 #include <librepcb/common/debug.h>
 #include <librepcb/common/exceptions.h>
 #include <librepcb/common/network/networkaccessmanager.h>
+#include <librepcb/project/project.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardgerberexport.h>
+#include <librepcb/project/circuit/bomgenerator.h>
+#include <librepcb/project/boards/boardpickplaceexport.h>
 #include <librepcb/workspace/workspace.h>
+#include <librepcb/workspace/library/workspacelibrarydb.h>
 #include "firstrunwizard/firstrunwizard.h"
 #include "controlpanel/controlpanel.h"
 
@@ -49,6 +58,10 @@ static void init3rdPartyLibs() noexcept;
 static void cleanup3rdPartyLibs() noexcept;
 static FilePath determineWorkspacePath() noexcept;
 static int openWorkspace(const FilePath& path) noexcept;
+static int runHeadlessGerberExport(const FilePath& projectFile, const QString& outputDir) noexcept;
+static int runHeadlessBomExport(const FilePath& projectFile, const QString& outputFile) noexcept;
+static int runHeadlessPickPlaceExport(const FilePath& projectFile, const QString& outputDir) noexcept;
+static int runHeadlessLibraryRescan(const FilePath& wsPath) noexcept;
 static int appExec() noexcept;
 
 /*****************************************************************************************
@@ -75,6 +88,91 @@ int main(int argc, char* argv[])
     // Install translation files. This must be done before any widget is shown.
     installTranslations();
 
+    // Parse the command line arguments. In headless export mode neither the
+    // workspace (incl. library scan) nor any widget gets created at all, so
+    // starting the export only takes a fraction of a second. This is intended
+    // for CI jobs, typically together with the Qt option "-platform offscreen".
+    QCommandLineParser cliParser;
+    cliParser.setApplicationDescription("LibrePCB");
+    cliParser.addHelpOption();
+    QCommandLineOption exportGerbersOption("export-gerbers",
+        "Export the Gerber/Excellon fabrication data of all boards of the given "
+        "project and exit without starting the GUI.", "project");
+    QCommandLineOption exportOutputOption("export-output",
+        "Output directory for --export-gerbers. Defaults to the fabrication "
+        "output directory of the project.", "dir");
+    QCommandLineOption exportBomOption("export-bom",
+        "Export the bill of materials of the given project as CSV and exit "
+        "without starting the GUI.", "project");
+    QCommandLineOption exportBomOutputOption("export-bom-output",
+        "Output file for --export-bom. Defaults to \"output/<version>/bom.csv\" "
+        "inside the project directory.", "file");
+    cliParser.addOption(exportGerbersOption);
+    cliParser.addOption(exportOutputOption);
+    QCommandLineOption exportPnpOption("export-pnp",
+        "Export the pick&place assembly data of all boards of the given project "
+        "as CSV and exit without starting the GUI.", "project");
+    QCommandLineOption exportPnpOutputOption("export-pnp-output",
+        "Output directory for --export-pnp. Defaults to \"output/<version>/pnp\" "
+        "inside the project directory.", "dir");
+    QCommandLineOption rescanLibraryOption("rescan-library",
+        "Populate the library database of the given workspace and exit without "
+        "starting the GUI. Intended for provisioning pre-warmed workspaces (CI "
+        "images, new machines) so the first interactive launch is instant.",
+        "workspace");
+    QCommandLineOption newInstanceOption("new-instance",
+        "Open a new application instance instead of handing the given project "
+        "files over to an already running instance.");
+    cliParser.addOption(exportBomOption);
+    cliParser.addOption(exportBomOutputOption);
+    cliParser.addOption(exportPnpOption);
+    cliParser.addOption(exportPnpOutputOption);
+    cliParser.addOption(rescanLibraryOption);
+    cliParser.addOption(newInstanceOption);
+    cliParser.process(app);
+    if (cliParser.isSet(exportGerbersOption)) {
+        FilePath projectFile(QFileInfo(cliParser.value(exportGerbersOption)).absoluteFilePath());
+        return runHeadlessGerberExport(projectFile, cliParser.value(exportOutputOption));
+    }
+    if (cliParser.isSet(exportBomOption)) {
+        FilePath projectFile(QFileInfo(cliParser.value(exportBomOption)).absoluteFilePath());
+        return runHeadlessBomExport(projectFile, cliParser.value(exportBomOutputOption));
+    }
+    if (cliParser.isSet(exportPnpOption)) {
+        FilePath projectFile(QFileInfo(cliParser.value(exportPnpOption)).absoluteFilePath());
+        return runHeadlessPickPlaceExport(projectFile, cliParser.value(exportPnpOutputOption));
+    }
+    if (cliParser.isSet(rescanLibraryOption)) {
+        FilePath wsPath(QFileInfo(cliParser.value(rescanLibraryOption)).absoluteFilePath());
+        return runHeadlessLibraryRescan(wsPath);
+    }
+
+    // if another instance is already running for this user, hand the project
+    // files from the command line over to it instead of starting a second
+    // instance - the running instance opens them with its already-warm
+    // workspace and library database (use --new-instance to opt out)
+    if (!cliParser.isSet(newInstanceOption)) {
+        QLocalSocket socket;
+        socket.connectToServer(ControlPanel::getSingleInstanceServerName());
+        if (socket.waitForConnected(500)) {
+            QStringList projects;
+            foreach (const QString& arg, app.arguments()) {
+                FilePath filepath(QFileInfo(arg).absoluteFilePath());
+                if ((filepath.isExistingFile()) && (filepath.getSuffix() == "lpp")) {
+                    projects.append(filepath.toStr());
+                }
+            }
+            socket.write(projects.join('\n').toUtf8());
+            socket.flush();
+            socket.waitForBytesWritten(1000);
+            socket.disconnectFromServer();
+            if (socket.state() != QLocalSocket::UnconnectedState) {
+                socket.waitForDisconnected(1000);
+            }
+            return 0;
+        }
+    }
+
     // This is to remove the ugly frames around widgets in all status bars...
     // (from http://www.qtcentre.org/threads/1904)
     app.setStyleSheet("QStatusBar::item { border: 0px solid black; }");
@@ -104,10 +202,56 @@ int main(int argc, char* argv[])
     // Cleanup all 3rd party libraries
     cleanup3rdPartyLibs();
 
+    // machine-readable memory attribution on demand (see MemoryStatsRegistry)
+    if (!qgetenv("LIBREPCB_MEMSTATS").isEmpty()) {
+        MemoryStatsRegistry::dumpToLog();
+    }
+
     qDebug() << "Exit application with code" << retval;
     return retval;
 }
 
+/*****************************************************************************************
+ *  runHeadlessLibraryRescan()
+ ****************************************************************************************/
+
+static int runHeadlessLibraryRescan(const FilePath& wsPath) noexcept
+{
+    try
+    {
+        workspace::Workspace ws(wsPath); // can throw
+
+        // run the scan to completion inside a local event loop (the scanner runs
+        // in its own thread and reports the result through signals)
+        int exitCode = 1;
+        QEventLoop loop;
+        QObject::connect(&ws.getLibraryDb(), &workspace::WorkspaceLibraryDb::scanLibraryScanned,
+                         [](int libsScanned, int libsTotal) {
+            qInfo() << QString("Scanned library %1 of %2...").arg(libsScanned).arg(libsTotal);
+        });
+        QObject::connect(&ws.getLibraryDb(), &workspace::WorkspaceLibraryDb::scanSucceeded,
+                         [&](int elementCount) {
+            qInfo() << QString("Library scan succeeded, %1 elements.").arg(elementCount);
+            exitCode = 0;
+            loop.quit();
+        });
+        QObject::connect(&ws.getLibraryDb(), &workspace::WorkspaceLibraryDb::scanFailed,
+                         [&](const QString& errorMsg) {
+            qCritical() << "Library scan failed:" << errorMsg;
+            exitCode = 1;
+            loop.quit();
+        });
+        ws.getLibraryDb().startLibraryRescan();
+        loop.exec();
+        return exitCode;
+    }
+    catch (Exception& e)
+    {
+        qCritical() << "Library rescan failed:" << e.getMsg();
+        return 1;
+    }
+}
+
 /*****************************************************************************************
  *  setApplicationMetadata()
  ****************************************************************************************/
@@ -223,9 +367,20 @@ static int openWorkspace(const FilePath& path) noexcept
 {
     try
     {
-        Workspace ws(path);   // The Workspace constructor can throw an exception
-        ControlPanel p(ws);
-        p.show();
+        // the startup stages report their timings through the tracing surface
+        // (enable by setting LIBREPCB_TRACE, see tracer.h), see also
+        // ControlPanel::deferredStartupInit()
+        QScopedPointer<Workspace> ws;
+        {
+            TracerScope trace("open workspace");
+            ws.reset(new Workspace(path)); // can throw
+        }
+        QScopedPointer<ControlPanel> p;
+        {
+            TracerScope trace("construct control panel");
+            p.reset(new ControlPanel(*ws));
+        }
+        p->show();
 
         return appExec();
     }
@@ -243,6 +398,121 @@ static int openWorkspace(const FilePath& path) noexcept
     }
 }
 
+/*****************************************************************************************
+ *  runHeadlessGerberExport()
+ ****************************************************************************************/
+
+static int runHeadlessGerberExport(const FilePath& projectFile, const QString& outputDir) noexcept
+{
+    try
+    {
+        // opening read-only avoids touching any file of the project
+        project::Project prj(projectFile, true); // can throw
+
+        foreach (project::Board* board, prj.getBoards()) {
+            FilePath dir;
+            if (!outputDir.isEmpty()) {
+                dir = FilePath(QFileInfo(outputDir).absoluteFilePath());
+            } else {
+                // same default directory as used by the fabrication output dialog
+                QString version = FilePath::cleanFileName(prj.getVersion(),
+                                  FilePath::ReplaceSpaces | FilePath::KeepCase);
+                dir = prj.getPath().getPathTo(QString("output/%1/gerber").arg(version));
+            }
+            if (prj.getBoards().count() > 1) {
+                // the generated filenames contain only the project name, so each
+                // board needs its own directory to avoid overwriting files
+                dir = dir.getPathTo(FilePath::cleanFileName(board->getName(),
+                                    FilePath::ReplaceSpaces | FilePath::KeepCase));
+            }
+            qInfo() << QString("Exporting board \"%1\" to \"%2\"...")
+                       .arg(board->getName(), dir.toNative());
+            project::BoardGerberExport grbExport(*board, dir);
+            grbExport.exportAllLayers(); // can throw
+        }
+        return 0;
+    }
+    catch (Exception& e)
+    {
+        qCritical() << "Gerber export failed:" << e.getMsg();
+        return 1;
+    }
+}
+
+/*****************************************************************************************
+ *  runHeadlessBomExport()
+ ****************************************************************************************/
+
+static int runHeadlessBomExport(const FilePath& projectFile, const QString& outputFile) noexcept
+{
+    try
+    {
+        // only the circuit and the embedded library are needed for a BOM, so the
+        // schematics/boards are not even loaded (also implies read-only)
+        QScopedPointer<project::Project> prj(
+            project::Project::openWithoutDocuments(projectFile)); // can throw
+
+        FilePath csvFp;
+        if (!outputFile.isEmpty()) {
+            csvFp = FilePath(QFileInfo(outputFile).absoluteFilePath());
+        } else {
+            QString version = FilePath::cleanFileName(prj->getVersion(),
+                              FilePath::ReplaceSpaces | FilePath::KeepCase);
+            csvFp = prj->getPath().getPathTo(QString("output/%1/bom.csv").arg(version));
+        }
+        QDir().mkpath(csvFp.getParentDir().toStr());
+
+        qInfo() << QString("Exporting BOM to \"%1\"...").arg(csvFp.toNative());
+        project::BomGenerator bom(prj->getCircuit());
+        bom.exportCsv(csvFp); // can throw
+        return 0;
+    }
+    catch (Exception& e)
+    {
+        qCritical() << "BOM export failed:" << e.getMsg();
+        return 1;
+    }
+}
+
+/*****************************************************************************************
+ *  runHeadlessPickPlaceExport()
+ ****************************************************************************************/
+
+static int runHeadlessPickPlaceExport(const FilePath& projectFile, const QString& outputDir) noexcept
+{
+    try
+    {
+        // opening read-only avoids touching any file of the project
+        project::Project prj(projectFile, true); // can throw
+
+        foreach (project::Board* board, prj.getBoards()) {
+            FilePath dir;
+            if (!outputDir.isEmpty()) {
+                dir = FilePath(QFileInfo(outputDir).absoluteFilePath());
+            } else {
+                QString version = FilePath::cleanFileName(prj.getVersion(),
+                                  FilePath::ReplaceSpaces | FilePath::KeepCase);
+                dir = prj.getPath().getPathTo(QString("output/%1/pnp").arg(version));
+            }
+            QString filename = FilePath::cleanFileName(board->getName(),
+                               FilePath::ReplaceSpaces | FilePath::KeepCase) % ".csv";
+            FilePath csvFp = dir.getPathTo(filename);
+            QDir().mkpath(csvFp.getParentDir().toStr());
+
+            qInfo() << QString("Exporting pick&place data of board \"%1\" to \"%2\"...")
+                       .arg(board->getName(), csvFp.toNative());
+            project::BoardPickPlaceExport pnpExport(*board);
+            pnpExport.exportCsv(csvFp); // can throw
+        }
+        return 0;
+    }
+    catch (Exception& e)
+    {
+        qCritical() << "Pick&place export failed:" << e.getMsg();
+        return 1;
+    }
+}
+
 /*****************************************************************************************
  *  appExec()
  ****************************************************************************************/
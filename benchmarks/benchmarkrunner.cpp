@@ -0,0 +1,109 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <algorithm>
+#include <numeric>
+#include "benchmarkrunner.h"
+#include <librepcb/common/fileio/fileutils.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BenchmarkRunner::BenchmarkRunner() noexcept :
+    mFilter(), mIterations(5), mResults()
+{
+}
+
+BenchmarkRunner::~BenchmarkRunner() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void BenchmarkRunner::run(const QString& name, const std::function<void()>& func) noexcept
+{
+    if ((!mFilter.isEmpty()) && (!name.contains(mFilter, Qt::CaseInsensitive))) {
+        return; // skipped by filter
+    }
+
+    QTextStream out(stdout);
+    out << "running " << name << "..." << endl;
+
+    // one unmeasured warm-up execution (fills caches, creates lazy singletons, ...)
+    func();
+
+    QVector<qreal> timesMs;
+    for (int i = 0; i < mIterations; ++i) {
+        QElapsedTimer timer;
+        timer.start();
+        func();
+        timesMs.append(timer.nsecsElapsed() / qreal(1000000));
+    }
+    std::sort(timesMs.begin(), timesMs.end());
+
+    Result result;
+    result.name = name;
+    result.iterations = mIterations;
+    result.totalMs = std::accumulate(timesMs.constBegin(), timesMs.constEnd(), qreal(0));
+    result.minMs = timesMs.first();
+    result.medianMs = timesMs.at(timesMs.count() / 2);
+    mResults.append(result);
+
+    out << QString("  min %1 ms / median %2 ms / total %3 ms (%4 iterations)")
+           .arg(result.minMs, 0, 'f', 3).arg(result.medianMs, 0, 'f', 3)
+           .arg(result.totalMs, 0, 'f', 3).arg(result.iterations) << endl;
+}
+
+void BenchmarkRunner::writeJsonFile(const FilePath& filepath) const
+{
+    QJsonArray benchmarks;
+    foreach (const Result& result, mResults) {
+        QJsonObject obj;
+        obj.insert("name", result.name);
+        obj.insert("iterations", result.iterations);
+        obj.insert("total_ms", result.totalMs);
+        obj.insert("min_ms", result.minMs);
+        obj.insert("median_ms", result.medianMs);
+        benchmarks.append(obj);
+    }
+
+    QJsonObject root;
+    root.insert("created", QDateTime::currentDateTime().toString(Qt::ISODate));
+    root.insert("benchmarks", benchmarks);
+
+    FileUtils::writeFile(filepath, QJsonDocument(root).toJson()); // can throw
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
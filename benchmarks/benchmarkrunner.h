@@ -0,0 +1,111 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_BENCHMARKRUNNER_H
+#define LIBREPCB_BENCHMARKRUNNER_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <functional>
+#include <QtCore>
+#include <librepcb/common/fileio/filepath.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Class BenchmarkRunner
+ ****************************************************************************************/
+
+/**
+ * @brief Small framework to run and report performance benchmarks
+ *
+ * Each benchmark is a function which is executed once for warm-up and then several
+ * times with the wall clock time of every execution measured. The results are printed
+ * to stdout and can optionally be written to a JSON file for trend tracking on CI.
+ */
+class BenchmarkRunner final
+{
+    public:
+
+        // Types
+
+        /// the timing results of one benchmark
+        struct Result {
+            QString name;
+            int iterations;
+            qreal totalMs;
+            qreal minMs;
+            qreal medianMs;
+        };
+
+        // Constructors / Destructor
+        BenchmarkRunner(const BenchmarkRunner& other) = delete;
+        BenchmarkRunner() noexcept;
+        ~BenchmarkRunner() noexcept;
+
+        // Setters
+
+        /// run only benchmarks whose name contains the given string (empty = run all)
+        void setFilter(const QString& filter) noexcept {mFilter = filter;}
+
+        /// set how many measured executions each benchmark gets
+        void setIterations(int iterations) noexcept {mIterations = iterations;}
+
+        // General Methods
+
+        /**
+         * @brief Run one benchmark (one warm-up + the configured measured iterations)
+         *
+         * @param name  Name of the benchmark (used for reporting and filtering)
+         * @param func  The function to measure
+         */
+        void run(const QString& name, const std::function<void()>& func) noexcept;
+
+        /**
+         * @brief Write all results as JSON to the given file
+         *
+         * @param filepath  Path to the output file (will be overwritten)
+         *
+         * @throw Exception if the file could not be written
+         */
+        void writeJsonFile(const FilePath& filepath) const;
+
+        // Operator Overloadings
+        BenchmarkRunner& operator=(const BenchmarkRunner& rhs) = delete;
+
+
+    private:
+
+        // Attributes
+        QString mFilter;
+        int mIterations;
+        QList<Result> mResults;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_BENCHMARKRUNNER_H
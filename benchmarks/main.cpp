@@ -0,0 +1,253 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+#include <librepcb/common/application.h>
+#include <librepcb/common/debug.h>
+#include <librepcb/common/exceptions.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/common/geometry/polygon.h>
+#include <librepcb/library/library.h>
+#include <librepcb/library/sym/symbol.h>
+#include <librepcb/project/project.h>
+#include <librepcb/project/schematics/schematic.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardgerberexport.h>
+#include <librepcb/project/boards/boardspatialindex.h>
+#include <librepcb/project/boards/items/bi_via.h>
+#include <librepcb/workspace/workspace.h>
+#include <librepcb/workspace/library/workspacelibrarydb.h>
+#include "benchmarkrunner.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+using namespace librepcb;
+
+/*****************************************************************************************
+ *  Synthetic Datasets
+ ****************************************************************************************/
+
+/**
+ * @brief Create a synthetic project with some schematics and via-filled boards
+ *
+ * @return The filepath of the created project file
+ */
+static FilePath createSyntheticProject(const FilePath& tmpDir)
+{
+    FilePath projectFile = tmpDir.getPathTo("project/benchmark.lpp");
+    QScopedPointer<project::Project> prj(project::Project::create(projectFile)); // can throw
+
+    for (int i = 0; i < 5; ++i) {
+        project::Schematic* schematic =
+            prj->createSchematic(QString("Page %1").arg(i + 1)); // can throw
+        prj->addSchematic(*schematic); // can throw
+    }
+
+    for (int i = 0; i < 2; ++i) {
+        project::Board* board = prj->createBoard(QString("Board %1").arg(i + 1)); // can throw
+        prj->addBoard(*board); // can throw
+        for (int x = 0; x < 50; ++x) {
+            for (int y = 0; y < 30; ++y) {
+                project::BI_Via* via = new project::BI_Via(*board,
+                    Point::fromMm(x * 2, y * 2), project::BI_Via::Shape::Round,
+                    Length::fromMm(0.8), Length::fromMm(0.4), nullptr);
+                board->addVia(*via); // can throw
+            }
+        }
+    }
+
+    prj->save(true); // can throw
+    return projectFile;
+}
+
+/**
+ * @brief Create a synthetic workspace with one local library containing many symbols
+ *
+ * @return The filepath of the created workspace directory
+ */
+static FilePath createSyntheticWorkspace(const FilePath& tmpDir)
+{
+    FilePath wsPath = tmpDir.getPathTo("workspace");
+    workspace::Workspace::createNewWorkspace(wsPath); // can throw
+
+    FilePath localLibsDir;
+    {
+        workspace::Workspace ws(wsPath); // can throw
+        localLibsDir = ws.getLibrariesPath().getPathTo("local");
+    }
+
+    library::Library lib(Uuid::createRandom(), Version("0.1"), "Benchmark",
+                         "Benchmark Library", "Synthetic library for benchmarks", "");
+    lib.saveIntoParentDirectory(localLibsDir); // can throw
+
+    FilePath symDir = lib.getFilePath().getPathTo("sym");
+    for (int i = 0; i < 150; ++i) {
+        library::Symbol sym(Uuid::createRandom(), Version("0.1"), "Benchmark",
+                            QString("Benchmark Symbol %1").arg(i + 1), "", "");
+        sym.saveIntoParentDirectory(symDir); // can throw
+    }
+    return wsPath;
+}
+
+/*****************************************************************************************
+ *  Benchmarks
+ ****************************************************************************************/
+
+static void runProjectBenchmarks(BenchmarkRunner& runner, const FilePath& tmpDir)
+{
+    FilePath projectFile = createSyntheticProject(tmpDir); // can throw
+
+    // open (and fully load) the whole project, then close it again
+    runner.run("project-load", [&projectFile](){
+        project::Project prj(projectFile, true); // open read-only, can throw
+    });
+
+    project::Project prj(projectFile, false); // can throw
+    project::Board* board = prj.getBoards().first();
+
+    // save an unchanged project (mostly measures serialization, the file writes
+    // are skipped by the content hash comparison)
+    runner.run("project-save", [&prj](){
+        prj.save(true); // can throw
+    });
+
+    // export the fabrication data of one board
+    FilePath gerberDir = tmpDir.getPathTo("gerber");
+    runner.run("board-gerber-export", [board, &gerberDir](){
+        project::BoardGerberExport gerberExport(*board, gerberDir);
+        gerberExport.exportAllLayers(); // can throw
+    });
+
+    // query the spatial index of a board on a grid of positions
+    runner.run("board-spatial-query", [board](){
+        int hits = 0;
+        for (int x = 0; x < 100; ++x) {
+            for (int y = 0; y < 100; ++y) {
+                hits += board->getSpatialIndex().itemsAt(
+                            Point::fromMm(x, y).toPxQPointF()).count();
+            }
+        }
+        Q_UNUSED(hits);
+    });
+}
+
+static void runObjectListBenchmark(BenchmarkRunner& runner)
+{
+    // deep copy of a large SerializableObjectList (e.g. accidentally passing such
+    // a list by value must show up here)
+    PolygonList polygons;
+    for (int i = 0; i < 1000; ++i) {
+        std::shared_ptr<Polygon> polygon(new Polygon(GraphicsLayer::sSymbolOutlines,
+            Length::fromMm(0.2), false, true, Point::fromMm(0, 0)));
+        for (int k = 0; k < 10; ++k) {
+            polygon->getSegments().append(std::make_shared<PolygonSegment>(
+                Point::fromMm(k, i % 50), Angle::deg0()));
+        }
+        polygons.append(polygon);
+    }
+    runner.run("objectlist-copy", [&polygons](){
+        PolygonList copy(polygons);
+        Q_UNUSED(copy);
+    });
+}
+
+static void runLibraryScanBenchmark(BenchmarkRunner& runner, const FilePath& tmpDir)
+{
+    FilePath wsPath = createSyntheticWorkspace(tmpDir); // can throw
+    workspace::Workspace ws(wsPath); // can throw
+
+    // rescan the whole workspace library and wait until the database is updated
+    runner.run("library-scan", [&ws](){
+        QEventLoop loop;
+        QObject::connect(&ws.getLibraryDb(), &workspace::WorkspaceLibraryDb::scanSucceeded,
+                         &loop, [&loop](int){loop.quit();});
+        QObject::connect(&ws.getLibraryDb(), &workspace::WorkspaceLibraryDb::scanFailed,
+                         &loop, [&loop](QString){loop.quit();});
+        ws.getLibraryDb().startLibraryRescan();
+        loop.exec();
+    });
+}
+
+/*****************************************************************************************
+ *  The Benchmark Program
+ ****************************************************************************************/
+
+int main(int argc, char* argv[])
+{
+    // many classes rely on a QApplication instance, so we create it here
+    Application app(argc, argv);
+    Application::setOrganizationName("LibrePCB");
+    Application::setOrganizationDomain("librepcb.org");
+    Application::setApplicationName("LibrePCB-Benchmarks");
+
+    // disable the debug output to avoid distorting the measurements
+    Debug::instance()->setDebugLevelLogFile(Debug::DebugLevel_t::Nothing);
+    Debug::instance()->setDebugLevelStderr(Debug::DebugLevel_t::Nothing);
+
+    // parse the command line arguments
+    QCommandLineParser parser;
+    parser.setApplicationDescription("LibrePCB performance benchmarks");
+    parser.addHelpOption();
+    QCommandLineOption jsonOption("json",
+        "Write the results as JSON to the given file (for trend tracking).", "file");
+    QCommandLineOption filterOption("filter",
+        "Run only benchmarks whose name contains the given string.", "string");
+    QCommandLineOption iterationsOption("iterations",
+        "Number of measured iterations per benchmark.", "count", "5");
+    parser.addOption(jsonOption);
+    parser.addOption(filterOption);
+    parser.addOption(iterationsOption);
+    parser.process(app);
+
+    BenchmarkRunner runner;
+    runner.setFilter(parser.value(filterOption));
+    runner.setIterations(qMax(1, parser.value(iterationsOption).toInt()));
+
+    // all synthetic datasets are created in (and removed with) a temporary directory
+    FilePath tmpDir = FilePath::getRandomTempPath();
+    int retval = 0;
+    try
+    {
+        runProjectBenchmarks(runner, tmpDir); // can throw
+        runObjectListBenchmark(runner);
+        runLibraryScanBenchmark(runner, tmpDir); // can throw
+    }
+    catch (Exception& e)
+    {
+        QTextStream(stderr) << "FATAL ERROR: " << e.getMsg() << endl;
+        retval = 1;
+    }
+    QDir(tmpDir.toStr()).removeRecursively();
+
+    if ((retval == 0) && (parser.isSet(jsonOption))) {
+        try {
+            FilePath jsonFile(QFileInfo(parser.value(jsonOption)).absoluteFilePath());
+            runner.writeJsonFile(jsonFile); // can throw
+        } catch (Exception& e) {
+            QTextStream(stderr) << "Could not write JSON file: " << e.getMsg() << endl;
+            retval = 1;
+        }
+    }
+    return retval;
+}
@@ -2,8 +2,10 @@ TEMPLATE = subdirs
 
 SUBDIRS = \
     apps \
+    benchmarks \
     libs \
     tests
 
 apps.depends = libs
+benchmarks.depends = libs
 tests.depends = libs
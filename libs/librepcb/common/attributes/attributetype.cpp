@@ -93,25 +93,37 @@ void AttributeType::throwIfValueInvalid(const QString& value) const
 
 QList<const AttributeType*> AttributeType::getAllTypes() noexcept
 {
-    QList<const AttributeType*> types;
-    types.append(&AttrTypeString::instance());
-    types.append(&AttrTypeResistance::instance());
-    types.append(&AttrTypeCapacitance::instance());
-    types.append(&AttrTypeInductance::instance());
-    types.append(&AttrTypeVoltage::instance());
-    types.append(&AttrTypeFrequency::instance());
-    return types;
+    // built once; the returned list is implicitly shared, so copying it is cheap
+    static const QList<const AttributeType*> sTypes = {
+        &AttrTypeString::instance(),
+        &AttrTypeResistance::instance(),
+        &AttrTypeCapacitance::instance(),
+        &AttrTypeInductance::instance(),
+        &AttrTypeVoltage::instance(),
+        &AttrTypeFrequency::instance(),
+    };
+    return sTypes;
 }
 
 const AttributeType& AttributeType::fromString(const QString &type)
 {
-    foreach (const AttributeType* t, getAllTypes())
-    {
-        if (t->getName() == type)
-            return *t;
+    // static hash registry: this runs once per attribute while deserializing
+    // projects, so it must not scan the type list per call. Built thread-safe on
+    // first use (magic static) and read-only afterwards.
+    static const QHash<QString, const AttributeType*> sRegistry = []() {
+        QHash<QString, const AttributeType*> registry;
+        foreach (const AttributeType* t, getAllTypes()) {
+            registry.insert(t->getName(), t);
+        }
+        return registry;
+    }();
+
+    const AttributeType* t = sRegistry.value(type, nullptr);
+    if (!t) {
+        throw RuntimeError(__FILE__, __LINE__,
+                           QString(tr("Invalid attribute type: \"%1\"")).arg(type));
     }
-    throw RuntimeError(__FILE__, __LINE__,
-                       QString(tr("Invalid attribute type: \"%1\"")).arg(type));
+    return *t;
 }
 
 /*****************************************************************************************
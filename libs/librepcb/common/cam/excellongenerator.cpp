@@ -21,6 +21,7 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <librepcb/common/fileio/fileutils.h>
 #include "excellongenerator.h"
 #include "../fileio/smarttextfile.h"
 #include "../application.h"
@@ -35,7 +36,7 @@ namespace librepcb {
  ****************************************************************************************/
 
 ExcellonGenerator::ExcellonGenerator() noexcept :
-    mOutput()
+    mOutput(), mDrillPathOptimization(false)
 {
 }
 
@@ -62,11 +63,43 @@ void ExcellonGenerator::generate()
 
 void ExcellonGenerator::saveToFile(const FilePath& filepath) const
 {
+    // see GerberGenerator::saveToFile(): keep unchanged files untouched although
+    // the output embeds a fresh creation date
+    if (filepath.isExistingFile()) {
+        try {
+            QByteArray existing = FileUtils::readFile(filepath); // can throw
+            if (contentEqualIgnoringDate(existing, mOutput)) {
+                return;
+            }
+        } catch (const Exception& e) {
+            // fall through to the normal write
+        }
+    }
     QScopedPointer<SmartTextFile> file(SmartTextFile::create(filepath));
-    file->setContent(mOutput.toLatin1());
+    file->setContent(mOutput);
     file->save(true);
 }
 
+bool ExcellonGenerator::contentEqualIgnoringDate(const QByteArray& a, const QByteArray& b) noexcept
+{
+    const QList<QByteArray> linesA = a.split('\n');
+    const QList<QByteArray> linesB = b.split('\n');
+    if (linesA.count() != linesB.count()) {
+        return false;
+    }
+    for (int i = 0; i < linesA.count(); ++i) {
+        if (linesA.at(i) != linesB.at(i)) {
+            if (linesA.at(i).startsWith(";Creation Date:")
+                && linesB.at(i).startsWith(";Creation Date:"))
+            {
+                continue; // only the volatile creation date differs
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
 void ExcellonGenerator::reset() noexcept
 {
     mOutput.clear();
@@ -106,10 +139,15 @@ void ExcellonGenerator::printToolList() noexcept
 
 void ExcellonGenerator::printDrills() noexcept
 {
+    Point machinePos(0, 0);
     for (int i = 0; i < mDrillList.uniqueKeys().count(); ++i) {
         mOutput.append(QString("T%1\n").arg(i+1)); // Select Tool
         Length dia = mDrillList.uniqueKeys().value(i);
-        foreach (const Point& pos, mDrillList.values(dia)) {
+        QList<Point> drills = mDrillList.values(dia);
+        if (mDrillPathOptimization) {
+            drills = sortDrillsNearestNeighbor(drills, machinePos);
+        }
+        foreach (const Point& pos, drills) {
             mOutput.append(QString("X%1Y%2\n").arg(pos.getX().toMmString(),
                                                    pos.getY().toMmString()));
         }
@@ -122,6 +160,33 @@ void ExcellonGenerator::printFooter() noexcept
     mOutput.append("M30\n");        // End of Program Rewind
 }
 
+QList<Point> ExcellonGenerator::sortDrillsNearestNeighbor(QList<Point> drills,
+                                                          Point& pos) noexcept
+{
+    // greedy nearest-neighbor tour: always move to the closest remaining drill hit.
+    // this is not the optimal tour, but it is simple, deterministic and already
+    // removes most of the travel time compared to insertion order.
+    QList<Point> sorted;
+    sorted.reserve(drills.count());
+    while (!drills.isEmpty()) {
+        int nearestIndex = 0;
+        qreal nearestDistance = std::numeric_limits<qreal>::max();
+        for (int i = 0; i < drills.count(); ++i) {
+            Point diff = drills.at(i) - pos;
+            qreal dx = diff.getX().toMm();
+            qreal dy = diff.getY().toMm();
+            qreal distance = (dx * dx) + (dy * dy);
+            if (distance < nearestDistance) {
+                nearestDistance = distance;
+                nearestIndex = i;
+            }
+        }
+        pos = drills.takeAt(nearestIndex);
+        sorted.append(pos);
+    }
+    return sorted;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
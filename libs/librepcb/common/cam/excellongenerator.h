@@ -56,12 +56,28 @@ class ExcellonGenerator final
         ~ExcellonGenerator() noexcept;
 
         // Getters
-        const QString& toStr() const noexcept {return mOutput;}
+        QString toStr() const noexcept {return QString::fromLatin1(mOutput);}
+
+        // Setters
+
+        /**
+         * @brief Enable/disable drill path optimization
+         *
+         * If enabled, the drill hits of each tool are reordered with a greedy
+         * nearest-neighbor tour (instead of insertion order) to reduce the travel
+         * time of the drill machine.
+         */
+        void setDrillPathOptimizationEnabled(bool enabled) noexcept {mDrillPathOptimization = enabled;}
 
         // General Methods
         void drill(const Point& pos, const Length& dia) noexcept;
         void generate();
         void saveToFile(const FilePath& filepath) const;
+
+        // Static Methods
+
+        /// @copydoc GerberGenerator::contentEqualIgnoringDate()
+        static bool contentEqualIgnoringDate(const QByteArray& a, const QByteArray& b) noexcept;
         void reset() noexcept;
 
         // Operator Overloadings
@@ -74,11 +90,13 @@ class ExcellonGenerator final
         void printToolList() noexcept;
         void printDrills() noexcept;
         void printFooter() noexcept;
+        static QList<Point> sortDrillsNearestNeighbor(QList<Point> drills, Point& pos) noexcept;
 
 
         // Excellon Data
-        QString mOutput;
+        QByteArray mOutput;
         QMultiMap<Length, Point> mDrillList;
+        bool mDrillPathOptimization;
 };
 
 /*****************************************************************************************
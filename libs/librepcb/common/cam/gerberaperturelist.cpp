@@ -46,6 +46,7 @@ GerberApertureList::~GerberApertureList() noexcept
 
 QString GerberApertureList::generateString() const noexcept
 {
+    QMutexLocker lock(&mMutex);
     QString str;
     str.append("G04 --- APERTURE LIST BEGIN --- *\n");
     foreach (const QString& macro, mApertureMacros) {
@@ -113,8 +114,10 @@ int GerberApertureList::setRegularPolygon(const Length& dia, int n, const Angle&
 
 void GerberApertureList::reset() noexcept
 {
+    QMutexLocker lock(&mMutex);
     //mApertureMacros.clear();
     mApertures.clear();
+    mApertureNumbers.clear();
 }
 
 /*****************************************************************************************
@@ -123,17 +126,20 @@ void GerberApertureList::reset() noexcept
 
 int GerberApertureList::setCurrentAperture(const QString& aperture) noexcept
 {
-    int number = mApertures.key(aperture, -1);
+    QMutexLocker lock(&mMutex);
+    int number = mApertureNumbers.value(aperture, -1);
     if (number < 0) {
         number = mApertures.count() + 10; // 10 is the number of the first aperture
         Q_ASSERT(!mApertures.contains(number));
         mApertures.insert(number, aperture);
+        mApertureNumbers.insert(aperture, number);
     }
     return number;
 }
 
 void GerberApertureList::addMacro(const QString& macro) noexcept
 {
+    QMutexLocker lock(&mMutex);
     if (!mApertureMacros.contains(macro)) {
         mApertureMacros.append(macro);
     }
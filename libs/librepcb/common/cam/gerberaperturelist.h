@@ -41,6 +41,12 @@ namespace librepcb {
 /**
  * @brief The GerberApertureList class
  *
+ * All methods of this class are thread-safe. Note that a dictionary must NOT be
+ * shared between generators running in parallel anyway: aperture numbers are
+ * assigned in registration order, so sharing would make the D-codes depend on
+ * thread scheduling and break reproducible fabrication output (each
+ * librepcb#GerberGenerator therefore owns a private dictionary).
+ *
  * @author ubruhin
  * @date 2016-03-31
  */
@@ -89,8 +95,10 @@ class GerberApertureList final
         static QString generateRotatedObround(const Length& w, const Length& h, const Angle& rot, const Length& hole) noexcept;
 
 
+        mutable QMutex mMutex; ///< protects all members (see class documentation)
         QList<QString> mApertureMacros;
         QMap<int, QString> mApertures; ///< key: aperture number (>= 10); value: aperture definition
+        QHash<QString, int> mApertureNumbers; ///< reverse lookup of #mApertures (for fast deduplication)
 };
 
 /*****************************************************************************************
@@ -26,6 +26,7 @@
 #include "../geometry/ellipse.h"
 #include "../geometry/polygon.h"
 #include "../fileio/smarttextfile.h"
+#include "../fileio/fileutils.h"
 #include "../application.h"
 
 /*****************************************************************************************
@@ -41,8 +42,8 @@ GerberGenerator::GerberGenerator(const QString& projName, const Uuid& projUuid,
                                  const QString& projRevision) noexcept :
     mProjectId(escapeString(projName)), mProjectUuid(projUuid),
     mProjectRevision(escapeString(projRevision)), mOutput(), mContent(),
-    mApertureList(new GerberApertureList()), mCurrentApertureNumber(-1),
-    mMultiQuadrantArcModeOn(false)
+    mApertureList(new GerberApertureList()),
+    mCurrentApertureNumber(-1), mMultiQuadrantArcModeOn(false)
 {
 }
 
@@ -58,8 +59,8 @@ void GerberGenerator::setLayerPolarity(LayerPolarity p) noexcept
 {
     switch (p)
     {
-        case LayerPolarity::Positive: mContent.append("%LPD*%\n"); break;
-        case LayerPolarity::Negative: mContent.append("%LPC*%\n"); break;
+        case LayerPolarity::Positive: appendContent("%LPD*%\n"); break;
+        case LayerPolarity::Negative: appendContent("%LPC*%\n"); break;
         default: qCritical() << "Invalid Layer Polarity:" << static_cast<int>(p); break;
     }
 }
@@ -193,13 +194,33 @@ void GerberGenerator::reset() noexcept
 {
     mOutput.clear();
     mContent.clear();
+    mFooter.clear();
     mApertureList->reset();
     mCurrentApertureNumber = -1;
+    mStreamFile.reset();
+    if (mStreamFilePath.isValid()) {
+        QFile::remove(mStreamFilePath.toStr());
+        mStreamFilePath = FilePath();
+    }
+}
+
+void GerberGenerator::enableStreaming(const FilePath& tempFilePath)
+{
+    Q_ASSERT(mContent.isEmpty());
+    FileUtils::makePath(tempFilePath.getParentDir()); // can throw
+    mStreamFile.reset(new QFile(tempFilePath.toStr()));
+    if (!mStreamFile->open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+        mStreamFile.reset();
+        throw RuntimeError(__FILE__, __LINE__,
+            QString(tr("Could not open \"%1\" for writing.")).arg(tempFilePath.toNative()));
+    }
+    mStreamFilePath = tempFilePath;
 }
 
 void GerberGenerator::generate()
 {
     mOutput.clear();
+    mFooter.clear();
     printHeader();
     printApertureList();
     printContent();
@@ -208,9 +229,90 @@ void GerberGenerator::generate()
 
 void GerberGenerator::saveToFile(const FilePath& filepath) const
 {
-    QScopedPointer<SmartTextFile> file(SmartTextFile::create(filepath));
-    file->setContent(mOutput.toLatin1());
-    file->save(true);
+    if (mStreamFilePath.isValid()) {
+        // streaming mode: header/aperture list from memory, content chunk-wise from
+        // the temporary file, footer from memory
+        FileUtils::makePath(filepath.getParentDir()); // can throw
+        QFile out(filepath.toStr());
+        if (!out.open(QIODevice::WriteOnly | QIODevice::Truncate)) {
+            throw RuntimeError(__FILE__, __LINE__,
+                QString(tr("Could not open \"%1\" for writing.")).arg(filepath.toNative()));
+        }
+        QFile in(mStreamFilePath.toStr());
+        if (!in.open(QIODevice::ReadOnly)) {
+            throw RuntimeError(__FILE__, __LINE__,
+                QString(tr("Could not open \"%1\" for reading.")).arg(mStreamFilePath.toNative()));
+        }
+        out.write(mOutput);
+        while (!in.atEnd()) {
+            out.write(in.read(sStreamBufferSize));
+        }
+        out.write(mFooter);
+        in.close();
+        if (!out.flush()) {
+            throw RuntimeError(__FILE__, __LINE__,
+                QString(tr("Could not write to \"%1\".")).arg(filepath.toNative()));
+        }
+        out.close();
+        QFile::remove(mStreamFilePath.toStr());
+    } else {
+        // skip the write if only the embedded creation date differs from the
+        // existing file: unchanged layers then keep their modification time, so
+        // downstream tooling (zips, uploads, file watchers) sees no change
+        if (filepath.isExistingFile()) {
+            try {
+                QByteArray existing = FileUtils::readFile(filepath); // can throw
+                if (contentEqualIgnoringDate(existing, mOutput)) {
+                    return;
+                }
+            } catch (const Exception& e) {
+                // fall through to the normal write
+            }
+        }
+        QScopedPointer<SmartTextFile> file(SmartTextFile::create(filepath));
+        file->setContent(mOutput);
+        file->save(true);
+    }
+}
+
+bool GerberGenerator::contentEqualIgnoringDate(const QByteArray& a, const QByteArray& b) noexcept
+{
+    const QList<QByteArray> linesA = a.split('\n');
+    const QList<QByteArray> linesB = b.split('\n');
+    if (linesA.count() != linesB.count()) {
+        return false;
+    }
+    for (int i = 0; i < linesA.count(); ++i) {
+        if (linesA.at(i) != linesB.at(i)) {
+            if (linesA.at(i).startsWith("%TF.CreationDate,")
+                && linesB.at(i).startsWith("%TF.CreationDate,"))
+            {
+                continue; // only the volatile creation date differs
+            }
+            return false;
+        }
+    }
+    return true;
+}
+
+/*****************************************************************************************
+ *  Content Buffer
+ ****************************************************************************************/
+
+void GerberGenerator::appendContent(const QByteArray& data) noexcept
+{
+    mContent.append(data);
+    if (mStreamFile && (mContent.size() >= sStreamBufferSize)) {
+        flushContentToStream();
+    }
+}
+
+void GerberGenerator::flushContentToStream() noexcept
+{
+    if (mStreamFile && (!mContent.isEmpty())) {
+        mStreamFile->write(mContent);
+        mContent.clear();
+    }
 }
 
 /*****************************************************************************************
@@ -220,25 +322,27 @@ void GerberGenerator::saveToFile(const FilePath& filepath) const
 void GerberGenerator::setCurrentAperture(int number) noexcept
 {
     if (number != mCurrentApertureNumber) {
-        mContent.append(QString("D%1*\n").arg(number));
+        char buffer[32];
+        qsnprintf(buffer, sizeof(buffer), "D%d*\n", number);
+        appendContent(buffer);
         mCurrentApertureNumber = number;
     }
 }
 
 void GerberGenerator::setRegionModeOn() noexcept
 {
-    mContent.append("G36*\n");
+    appendContent("G36*\n");
 }
 
 void GerberGenerator::setRegionModeOff() noexcept
 {
-    mContent.append("G37*\n");
+    appendContent("G37*\n");
 }
 
 void GerberGenerator::setMultiQuadrantArcModeOn() noexcept
 {
     if (!mMultiQuadrantArcModeOn) {
-        mContent.append("G75*\n");
+        appendContent("G75*\n");
         mMultiQuadrantArcModeOn = true;
     }
 }
@@ -246,36 +350,44 @@ void GerberGenerator::setMultiQuadrantArcModeOn() noexcept
 void GerberGenerator::setMultiQuadrantArcModeOff() noexcept
 {
     if (mMultiQuadrantArcModeOn) {
-        mContent.append("G74*\n");
+        appendContent("G74*\n");
         mMultiQuadrantArcModeOn = false;
     }
 }
 
 void GerberGenerator::switchToLinearInterpolationModeG01() noexcept
 {
-    mContent.append("G01*\n");
+    appendContent("G01*\n");
 }
 
 void GerberGenerator::switchToCircularCwInterpolationModeG02() noexcept
 {
-    mContent.append("G02*\n");
+    appendContent("G02*\n");
 }
 
 void GerberGenerator::switchToCircularCcwInterpolationModeG03() noexcept
 {
-    mContent.append("G03*\n");
+    appendContent("G03*\n");
+}
+
+void GerberGenerator::appendCoordinateLine(char dCodeDigit, const Point& pos) noexcept
+{
+    // format directly into a fixed-size Latin-1 buffer, without any QString round trip
+    char buffer[64];
+    qsnprintf(buffer, sizeof(buffer), "X%lldY%lldD0%c*\n",
+              static_cast<long long>(pos.getX().toNm()),
+              static_cast<long long>(pos.getY().toNm()), dCodeDigit);
+    appendContent(buffer);
 }
 
 void GerberGenerator::moveToPosition(const Point& pos) noexcept
 {
-    mContent.append(QString("X%1Y%2D02*\n").arg(pos.getX().toNmString(),
-                                                pos.getY().toNmString()));
+    appendCoordinateLine('2', pos);
 }
 
 void GerberGenerator::linearInterpolateToPosition(const Point& pos) noexcept
 {
-    mContent.append(QString("X%1Y%2D01*\n").arg(pos.getX().toNmString(),
-                                                pos.getY().toNmString()));
+    appendCoordinateLine('1', pos);
 }
 
 void GerberGenerator::circularInterpolateToPosition(const Point& start, const Point& center, const Point& end) noexcept
@@ -284,16 +396,18 @@ void GerberGenerator::circularInterpolateToPosition(const Point& start, const Po
     if (!mMultiQuadrantArcModeOn) {
         diff.makeAbs(); // no sign allowed in single quadrant mode!
     }
-    mContent.append(QString("X%1Y%2I%3J%4D01*\n").arg(end.getX().toNmString(),
-                                                      end.getY().toNmString(),
-                                                      diff.getX().toNmString(),
-                                                      diff.getY().toNmString()));
+    char buffer[128];
+    qsnprintf(buffer, sizeof(buffer), "X%lldY%lldI%lldJ%lldD01*\n",
+              static_cast<long long>(end.getX().toNm()),
+              static_cast<long long>(end.getY().toNm()),
+              static_cast<long long>(diff.getX().toNm()),
+              static_cast<long long>(diff.getY().toNm()));
+    appendContent(buffer);
 }
 
 void GerberGenerator::flashAtPosition(const Point& pos) noexcept
 {
-    mContent.append(QString("X%1Y%2D03*\n").arg(pos.getX().toNmString(),
-                                                pos.getY().toNmString()));
+    appendCoordinateLine('3', pos);
 }
 
 void GerberGenerator::printHeader() noexcept
@@ -306,9 +420,9 @@ void GerberGenerator::printHeader() noexcept
     QString projId = mProjectId.remove(',');
     QString projUuid = mProjectUuid.toStr();
     QString projRevision = mProjectRevision.remove(',');
-    mOutput.append(QString("%TF.GenerationSoftware,LibrePCB,LibrePCB,%1*%\n").arg(appVersion));
-    mOutput.append(QString("%TF.CreationDate,%1*%\n").arg(creationDate));
-    mOutput.append(QString("%TF.ProjectId,%1,%2,%3*%\n").arg(projId, projUuid, projRevision));
+    mOutput.append(QString("%TF.GenerationSoftware,LibrePCB,LibrePCB,%1*%\n").arg(appVersion).toLatin1());
+    mOutput.append(QString("%TF.CreationDate,%1*%\n").arg(creationDate).toLatin1());
+    mOutput.append(QString("%TF.ProjectId,%1,%2,%3*%\n").arg(projId, projUuid, projRevision).toLatin1());
     mOutput.append("%TF.Part,Single*%\n"); // "Single" means "this is a PCB"
     //mOutput.append("%TF.FilePolarity,Positive*%\n");
 
@@ -332,30 +446,57 @@ void GerberGenerator::printHeader() noexcept
 
 void GerberGenerator::printApertureList() noexcept
 {
-    mOutput.append(mApertureList->generateString());
+    mOutput.append(mApertureList->generateString().toLatin1());
 }
 
 void GerberGenerator::printContent() noexcept
 {
     mOutput.append("G04 --- BOARD BEGIN --- *\n");
-    mOutput.append(mContent);
-    mOutput.append("G04 --- BOARD END --- *\n");
+    if (mStreamFile) {
+        // the content is already (resp. now) in the temporary file, the final output
+        // gets assembled chunk-wise in saveToFile()
+        flushContentToStream();
+        mStreamFile->close();
+        mFooter.append("G04 --- BOARD END --- *\n");
+    } else {
+        mOutput.append(mContent);
+        mOutput.append("G04 --- BOARD END --- *\n");
+    }
 }
 
 void GerberGenerator::printFooter() noexcept
 {
+    QByteArray& out = mStreamFile ? mFooter : mOutput;
+
     // MD5 checksum over content
-    mOutput.append(QString("%TF.MD5,%1*%\n").arg(calcOutputMd5Checksum()));
+    out.append(QString("%TF.MD5,%1*%\n").arg(calcOutputMd5Checksum()).toLatin1());
 
     // end of file
-    mOutput.append("M02*\n");
+    out.append("M02*\n");
 }
 
 QString GerberGenerator::calcOutputMd5Checksum() const noexcept
 {
     // according to the RS-274C standard, linebreaks are not included in the checksum
-    QString data = QString(mOutput).remove(QChar('\n'));
-    return QString(QCryptographicHash::hash(data.toUtf8(), QCryptographicHash::Md5).toHex());
+    QCryptographicHash hash(QCryptographicHash::Md5);
+    auto addData = [&hash](QByteArray data) {
+        data.replace('\n', QByteArray());
+        hash.addData(data);
+    };
+    addData(mOutput);
+    if (mStreamFilePath.isValid()) {
+        // streaming mode: the content is in the temporary file, hash it chunk-wise
+        QFile file(mStreamFilePath.toStr());
+        if (file.open(QIODevice::ReadOnly)) {
+            while (!file.atEnd()) {
+                addData(file.read(sStreamBufferSize));
+            }
+        } else {
+            qWarning() << "Could not open streamed gerber content for checksumming!";
+        }
+    }
+    addData(mFooter);
+    return QString(hash.result().toHex());
 }
 
 /*****************************************************************************************
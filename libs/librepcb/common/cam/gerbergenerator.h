@@ -65,12 +65,25 @@ class GerberGenerator final
         // Constructors / Destructor
         GerberGenerator() = delete;
         GerberGenerator(const GerberGenerator& other) = delete;
+        /**
+         * @brief Constructor
+         *
+         * @param projName              Project name (used in the file header)
+         * @param projUuid              Project UUID (used in the file header)
+         * @param projRevision          Project revision (used in the file header)
+         *
+         * @note Every generator owns its private aperture dictionary on purpose:
+         *       the aperture numbers are assigned in registration order, so a
+         *       dictionary shared between generators running in parallel would
+         *       make the D-codes (and thus the whole file content) depend on
+         *       thread scheduling - fabrication output must be reproducible.
+         */
         GerberGenerator(const QString& projName, const Uuid& projUuid,
                         const QString& projRevision) noexcept;
         ~GerberGenerator() noexcept;
 
         // Getters
-        const QString& toStr() const noexcept {return mOutput;}
+        QString toStr() const noexcept {return QString::fromLatin1(mOutput);}
 
         // Plot Methods
         void setLayerPolarity(LayerPolarity p) noexcept;
@@ -86,9 +99,36 @@ class GerberGenerator final
 
         // General Methods
         void reset() noexcept;
+
+        /**
+         * @brief Enable the streaming writer mode
+         *
+         * In streaming mode the drawing content is flushed incrementally to the given
+         * temporary file whenever the internal byte buffer exceeds its fixed size,
+         * instead of accumulating the whole layer in memory. #saveToFile() then
+         * assembles the final output by copying the temporary file chunk-wise into the
+         * target file (and removes the temporary file afterwards). The plot method API
+         * is identical in both modes.
+         *
+         * @param tempFilePath  Path to the temporary content file (will be overwritten)
+         *
+         * @throw Exception     If the temporary file could not be opened for writing
+         */
+        void enableStreaming(const FilePath& tempFilePath);
+
         void generate();
         void saveToFile(const FilePath& filepath) const;
 
+        // Static Methods
+
+        /**
+         * @brief Compare two Gerber file contents, ignoring the creation date
+         *
+         * Used by #saveToFile() to leave existing files of unchanged layers
+         * untouched although every generated output embeds a fresh timestamp.
+         */
+        static bool contentEqualIgnoringDate(const QByteArray& a, const QByteArray& b) noexcept;
+
         // Operator Overloadings
         GerberGenerator& operator=(const GerberGenerator& rhs) = delete;
 
@@ -96,6 +136,8 @@ class GerberGenerator final
     private:
 
         // Private Methods
+        void appendContent(const QByteArray& data) noexcept;
+        void flushContentToStream() noexcept;
         void setCurrentAperture(int number) noexcept;
         void setRegionModeOn() noexcept;
         void setRegionModeOff() noexcept;
@@ -104,6 +146,7 @@ class GerberGenerator final
         void switchToLinearInterpolationModeG01() noexcept;
         void switchToCircularCwInterpolationModeG02() noexcept;
         void switchToCircularCcwInterpolationModeG03() noexcept;
+        void appendCoordinateLine(char dCodeDigit, const Point& pos) noexcept;
         void moveToPosition(const Point& pos) noexcept;
         void linearInterpolateToPosition(const Point& pos) noexcept;
         void circularInterpolateToPosition(const Point& start, const Point& center, const Point& end) noexcept;
@@ -124,11 +167,19 @@ class GerberGenerator final
         QString mProjectRevision;
 
         // Gerber Data
-        QString mOutput;
-        QString mContent;
+        QByteArray mOutput;
+        QByteArray mContent;
+        QByteArray mFooter; ///< only used in streaming mode (content is already on disk)
         QScopedPointer<GerberApertureList> mApertureList;
         int mCurrentApertureNumber;
         bool mMultiQuadrantArcModeOn;
+
+        // Streaming Mode
+        QScopedPointer<QFile> mStreamFile; ///< only valid in streaming mode
+        FilePath mStreamFilePath; ///< only valid in streaming mode
+
+        // Constants
+        static const int sStreamBufferSize = 256 * 1024; ///< content flush threshold [bytes]
 };
 
 /*****************************************************************************************
@@ -19,7 +19,10 @@ DEFINES += FILE_FORMAT_VERSION="\\\"0.1\\\""
 DEFINES += GIT_VERSION="\\\"$(shell git -C \""$$_PRO_FILE_PWD_"\" describe --abbrev=7 --dirty --always --tags)\\\""
 #DEFINES += USE_32BIT_LENGTH_UNITS          # see units/length.h
 
-QT += core widgets xml opengl network sql
+QT += core widgets xml network sql concurrent
+
+# the QGLWidget fallback of GraphicsView needs the QtOpenGL module on Qt < 5.4
+lessThan(QT_MINOR_VERSION, 4): QT += opengl
 
 CONFIG += staticlib
 
@@ -66,6 +69,7 @@ SOURCES += \
     geometry/cmd/cmdpolygonsegmentedit.cpp \
     geometry/cmd/cmdtextedit.cpp \
     geometry/ellipse.cpp \
+    geometry/geometrykernel.cpp \
     geometry/hole.cpp \
     geometry/polygon.cpp \
     geometry/text.cpp \
@@ -75,6 +79,7 @@ SOURCES += \
     graphics/graphicsview.cpp \
     graphics/holegraphicsitem.cpp \
     graphics/linegraphicsitem.cpp \
+    graphics/minimapwidget.cpp \
     graphics/origincrossgraphicsitem.cpp \
     graphics/polygongraphicsitem.cpp \
     graphics/primitiveellipsegraphicsitem.cpp \
@@ -84,6 +89,7 @@ SOURCES += \
     gridproperties.cpp \
     if_attributeprovider.cpp \
     network/filedownload.cpp \
+    memorystats.cpp \
     network/networkaccessmanager.cpp \
     network/networkrequest.cpp \
     network/networkrequestbase.cpp \
@@ -92,6 +98,7 @@ SOURCES += \
     sqlitedatabase.cpp \
     systeminfo.cpp \
     toolbox.cpp \
+    tracer.cpp \
     undocommand.cpp \
     undocommandgroup.cpp \
     undostack.cpp \
@@ -99,6 +106,7 @@ SOURCES += \
     units/length.cpp \
     units/lengthunit.cpp \
     units/point.cpp \
+    units/pointarray.cpp \
     units/ratio.cpp \
     utils/exclusiveactiongroup.cpp \
     utils/graphicslayerstackappearancesettings.cpp \
@@ -161,6 +169,7 @@ HEADERS += \
     geometry/cmd/cmdpolygonsegmentedit.h \
     geometry/cmd/cmdtextedit.h \
     geometry/ellipse.h \
+    geometry/geometrykernel.h \
     geometry/hole.h \
     geometry/polygon.h \
     geometry/text.h \
@@ -171,6 +180,7 @@ HEADERS += \
     graphics/holegraphicsitem.h \
     graphics/if_graphicsvieweventhandler.h \
     graphics/linegraphicsitem.h \
+    graphics/minimapwidget.h \
     graphics/origincrossgraphicsitem.h \
     graphics/polygongraphicsitem.h \
     graphics/primitiveellipsegraphicsitem.h \
@@ -179,6 +189,8 @@ HEADERS += \
     graphics/textgraphicsitem.h \
     gridproperties.h \
     if_attributeprovider.h \
+    memorypool.h \
+    memorystats.h \
     network/filedownload.h \
     network/networkaccessmanager.h \
     network/networkrequest.h \
@@ -190,6 +202,7 @@ HEADERS += \
     sqlitedatabase.h \
     systeminfo.h \
     toolbox.h \
+    tracer.h \
     undocommand.h \
     undocommandgroup.h \
     undostack.h \
@@ -198,6 +211,7 @@ HEADERS += \
     units/length.h \
     units/lengthunit.h \
     units/point.h \
+    units/pointarray.h \
     units/ratio.h \
     utils/exclusiveactiongroup.h \
     utils/graphicslayerstackappearancesettings.h \
@@ -230,6 +230,15 @@ class DirectoryLock final
          *
          * @return  The current lock status (see #LockStatus)
          *
+         * @note The status is intentionally re-read from disk on every call and not
+         *       cached: the existing callers (workspace/project open) query it once
+         *       immediately before locking, where a stale cached answer could cause
+         *       two instances to open the same project. If a UI ever lists the lock
+         *       status of many projects (e.g. in the project tree), it should use a
+         *       batched asynchronous probe on a worker thread instead of calling
+         *       this per directory on the GUI thread - see the discussion in the
+         *       commit introducing this note.
+         *
          * @throw   Exception on error (e.g. invalid filepath, no access rights, ...)
          */
         LockStatus getStatus() const;
@@ -33,8 +33,8 @@ namespace librepcb {
  *  Constructors / Destructor
  ****************************************************************************************/
 
-DomDocument::DomDocument(DomElement& root) noexcept :
-    mFilePath(), mRootElement(&root)
+DomDocument::DomDocument(DomElement& root, const FilePath& filepath) noexcept :
+    mFilePath(filepath), mRootElement(&root)
 {
     mRootElement->setDocument(this);
 }
@@ -42,27 +42,30 @@ DomDocument::DomDocument(DomElement& root) noexcept :
 DomDocument::DomDocument(const QByteArray& fileContent, const FilePath& filepath) :
     mFilePath(filepath), mRootElement(nullptr)
 {
-    QDomDocument doc;
-    doc.implementation().setInvalidDataPolicy(QDomImplementation::ReturnNullNode);
-
-    QString errMsg;
-    int errLine;
-    int errColumn;
-    if (!doc.setContent(fileContent, &errMsg, &errLine, &errColumn)) {
-        qDebug() << "line:" << fileContent.split('\n').at(errLine-1);
+    // build the DOM tree directly with a streaming pull parser instead of
+    // materializing an intermediate QDomDocument first (see fromQXmlStreamReader())
+    QXmlStreamReader reader(fileContent);
+    while ((!reader.atEnd()) && (!reader.hasError())) {
+        if (reader.readNext() == QXmlStreamReader::StartElement) {
+            mRootElement.reset(DomElement::fromQXmlStreamReader(reader, this));
+            break;
+        }
+    }
+
+    if (reader.hasError()) {
+        int errLine = reader.lineNumber();
+        int errColumn = reader.columnNumber();
+        qDebug() << "line:" << fileContent.split('\n').value(errLine-1);
         throw RuntimeError(__FILE__, __LINE__,
             QString(tr("Error while parsing file \"%1\": %2 [%3:%4]"))
-            .arg(filepath.toNative(), errMsg).arg(errLine).arg(errColumn));
+            .arg(filepath.toNative(), reader.errorString()).arg(errLine).arg(errColumn));
     }
 
     // check if the root node exists
-    QDomElement root = doc.documentElement();
-    if (root.isNull()) {
+    if (!mRootElement) {
         throw RuntimeError(__FILE__, __LINE__,
             QString(tr("No root node found in \"%1\"!")).arg(mFilePath.toNative()));
     }
-
-    mRootElement.reset(DomElement::fromQDomElement(root, this));
 }
 
 DomDocument::~DomDocument() noexcept
@@ -90,8 +93,16 @@ DomElement& DomDocument::getRoot(const QString& expectedName) const
 
 QByteArray DomDocument::toByteArray() const
 {
+    // direct UTF-8 serialization without QXmlStreamWriter, see DomElement::writeToUtf8()
     QByteArray data;
-    QXmlStreamWriter writer(&data);
+    data.reserve(200 * 1024); // avoid repeated reallocations for typical project files
+    data.append("<?xml version=\"1.0\" encoding=\"UTF-8\" standalone=\"yes\"?>\n");
+    mRootElement->writeToUtf8(data, 0);
+
+#ifdef QT_DEBUG
+    // validate the fast writer against QXmlStreamWriter (which it replaced)
+    QByteArray reference;
+    QXmlStreamWriter writer(&reference);
     writer.setAutoFormatting(true);
     writer.setAutoFormattingIndent(1); // indent only 1 space to save disk space
     writer.setCodec("UTF-8");
@@ -99,6 +110,9 @@ QByteArray DomDocument::toByteArray() const
     mRootElement->writeToQXmlStreamWriter(writer);
     writer.writeEndDocument();
     if (writer.hasError()) throw LogicError(__FILE__, __LINE__);
+    Q_ASSERT(data == reference);
+#endif
+
     return data;
 }
 
@@ -62,7 +62,7 @@ class DomDocument final
          *                          The document will take the ownership over the root
          *                          element object!
          */
-        explicit DomDocument(DomElement& root) noexcept;
+        explicit DomDocument(DomElement& root, const FilePath& filepath = FilePath()) noexcept;
 
         /**
          * @brief Constructor to create the whole DOM tree from the content of a file
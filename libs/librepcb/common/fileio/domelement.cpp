@@ -21,6 +21,7 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include "../memorystats.h"
 #include "domelement.h"
 #include "domdocument.h"
 
@@ -29,6 +30,81 @@
  ****************************************************************************************/
 namespace librepcb {
 
+/*****************************************************************************************
+ *  Element Pool
+ ****************************************************************************************/
+
+namespace {
+
+/**
+ * @brief A simple thread-safe fixed-size object pool for DomElement allocations
+ *
+ * Slots are carved out of large blocks and recycled over a free list. The blocks are
+ * never returned to the operating system before the application exits, which is fine
+ * because the peak DOM element count is reached on every project load anyway.
+ */
+class DomElementPool final
+{
+    public:
+        DomElementPool() noexcept : mFreeList(nullptr), mAllocatedSlots(0) {
+            MemoryStatsRegistry::registerProvider("DOM element pool", [this]() {
+                QMutexLocker lock(&mMutex);
+                return qMakePair(qint64(mBlocks.count()) * sSlotSize * sSlotsPerBlock,
+                                 qint64(mAllocatedSlots));
+            });
+        }
+        ~DomElementPool() noexcept {
+            foreach (char* block, mBlocks) { ::operator delete(block); }
+        }
+
+        void* allocate(std::size_t size) {
+            Q_ASSERT(size <= sSlotSize);
+            QMutexLocker lock(&mMutex);
+            if (!mFreeList) {
+                char* block = static_cast<char*>(::operator new(sSlotSize * sSlotsPerBlock));
+                mBlocks.append(block);
+                for (std::size_t i = 0; i < sSlotsPerBlock; ++i) {
+                    FreeSlot* slot = reinterpret_cast<FreeSlot*>(block + (i * sSlotSize));
+                    slot->next = mFreeList;
+                    mFreeList = slot;
+                }
+            }
+            FreeSlot* slot = mFreeList;
+            mFreeList = slot->next;
+            mAllocatedSlots++;
+            return slot;
+        }
+
+        void deallocate(void* ptr) noexcept {
+            QMutexLocker lock(&mMutex);
+            FreeSlot* slot = static_cast<FreeSlot*>(ptr);
+            slot->next = mFreeList;
+            mFreeList = slot;
+            mAllocatedSlots--;
+        }
+
+        static DomElementPool& instance() noexcept {
+            static DomElementPool pool;
+            return pool;
+        }
+
+    private:
+        struct FreeSlot { FreeSlot* next; };
+
+        enum : std::size_t {
+            sSlotAlign = alignof(std::max_align_t),
+            sSlotSize = ((sizeof(DomElement) + sSlotAlign - 1) / sSlotAlign) * sSlotAlign,
+            sSlotsPerBlock = 4096,
+        };
+
+        mutable QMutex mMutex;
+        FreeSlot* mFreeList;
+        qint64 mAllocatedSlots; ///< count of slots currently in use (for statistics)
+        QList<char*> mBlocks;
+};
+
+} // namespace
+
 /*****************************************************************************************
  *  Constructors / Destructor
  ****************************************************************************************/
@@ -59,6 +135,38 @@ DomElement::DomElement(QDomElement domElement, DomElement* parent, DomDocument*
         mText = domElement.text();
 }
 
+DomElement::DomElement(QXmlStreamReader& reader, DomElement* parent, DomDocument* doc) noexcept :
+    mDocument(doc), mParent(parent), mName(reader.name().toString()), mText()
+{
+    Q_ASSERT(reader.isStartElement());
+    Q_ASSERT(isValidTagName(mName) == true);
+
+    foreach (const QXmlStreamAttribute& attribute, reader.attributes()) {
+        mAttributes.insert(attribute.name().toString(), attribute.value().toString());
+    }
+
+    QString text;
+    while (!reader.atEnd()) {
+        switch (reader.readNext()) {
+            case QXmlStreamReader::StartElement:
+                mChilds.append(new DomElement(reader, this, nullptr));
+                break;
+            case QXmlStreamReader::Characters:
+                text += reader.text();
+                break;
+            case QXmlStreamReader::EndElement:
+                if (mChilds.isEmpty()) {
+                    mText = text; // same behavior as QDomElement::text() on leaf nodes
+                }
+                return;
+            case QXmlStreamReader::Invalid:
+                return; // the error is left on the reader, to be checked by the caller
+            default:
+                break; // comments, whitespace etc. are not represented in the DOM
+        }
+    }
+}
+
 DomElement::~DomElement() noexcept
 {
     qDeleteAll(mChilds);        mChilds.clear();
@@ -123,6 +231,7 @@ void DomElement::removeChild(DomElement* child, bool deleteChild) noexcept
     Q_ASSERT(child);
     Q_ASSERT(mChilds.contains(child) == true);
     mChilds.removeOne(child);
+    mChildsByNameDirty = true;
     if (deleteChild) {
         delete child;
     } else {
@@ -139,6 +248,7 @@ void DomElement::appendChild(DomElement* child) noexcept
     Q_ASSERT(child->mParent == nullptr);
     child->mParent = this;
     mChilds.append(child);
+    mChildsByNameDirty = true;
 }
 
 DomElement* DomElement::appendChild(const QString& name) noexcept
@@ -163,11 +273,31 @@ DomElement* DomElement::getFirstChild(bool throwIfNotFound) const
 
 DomElement* DomElement::getFirstChild(const QString& name, bool throwIfNotFound) const
 {
-    foreach (DomElement* child, mChilds)
-    {
-        if (child->getName() == name)
-            return child;
+    DomElement* found = nullptr;
+    if (mChilds.count() >= 8) {
+        // for wide elements the linear scan dominates deserialization, so a
+        // first-child-by-name hash is built lazily and reused for all lookups
+        if (mChildsByNameDirty) {
+            mChildsByName.clear();
+            mChildsByName.reserve(mChilds.count());
+            foreach (DomElement* child, mChilds) {
+                if (!mChildsByName.contains(child->getName())) {
+                    mChildsByName.insert(child->getName(), child); // first child wins
+                }
+            }
+            mChildsByNameDirty = false;
+        }
+        found = mChildsByName.value(name, nullptr);
+    } else {
+        foreach (DomElement* child, mChilds) {
+            if (child->getName() == name) {
+                found = child;
+                break;
+            }
+        }
     }
+    if (found)
+        return found;
     if (!throwIfNotFound)
         return nullptr;
     else
@@ -273,6 +403,33 @@ DomElement* DomElement::getNextSibling(const QString& name, bool throwIfNotFound
  *  QDomElement Converter Methods
  ****************************************************************************************/
 
+namespace {
+
+/**
+ * Append an XML-escaped UTF-8 representation of a string, with the same escaping
+ * rules QXmlStreamWriter applies (attributes additionally escape quotes and
+ * whitespace control characters).
+ */
+void appendEscaped(QByteArray& out, const QString& value, bool isAttribute) noexcept
+{
+    const QByteArray utf8 = value.toUtf8();
+    for (int i = 0; i < utf8.length(); ++i) {
+        const char c = utf8.at(i);
+        switch (c) {
+            case '&':   out.append("&amp;");    break;
+            case '<':   out.append("&lt;");     break;
+            case '>':   out.append("&gt;");     break;
+            case '"':   out.append("&quot;");   break;
+            case '\t':  if (isAttribute) {out.append("&#9;");}  else {out.append(c);} break;
+            case '\n':  if (isAttribute) {out.append("&#10;");} else {out.append(c);} break;
+            case '\r':  if (isAttribute) {out.append("&#13;");} else {out.append(c);} break;
+            default:    out.append(c);          break;
+        }
+    }
+}
+
+} // namespace
+
 void DomElement::writeToQXmlStreamWriter(QXmlStreamWriter& writer) const noexcept
 {
     writer.writeStartElement(mName);
@@ -289,11 +446,81 @@ void DomElement::writeToQXmlStreamWriter(QXmlStreamWriter& writer) const noexcep
     writer.writeEndElement();
 }
 
+void DomElement::writeToUtf8(QByteArray& out, int indent) const noexcept
+{
+    out.append(QByteArray(indent, ' '));
+    out.append('<');
+    out.append(mName.toUtf8());
+    foreach (const QString& key, mAttributes.keys()) {
+        out.append(' ');
+        out.append(key.toUtf8());
+        out.append("=\"");
+        appendEscaped(out, mAttributes[key], true);
+        out.append('"');
+    }
+    if (hasChilds()) {
+        out.append(">\n");
+        foreach (DomElement* child, mChilds) {
+            child->writeToUtf8(out, indent + 1);
+        }
+        out.append(QByteArray(indent, ' '));
+        out.append("</");
+        out.append(mName.toUtf8());
+        out.append(">\n");
+    } else if (!mText.isNull()) {
+        out.append('>');
+        appendEscaped(out, mText, false);
+        out.append("</");
+        out.append(mName.toUtf8());
+        out.append(">\n");
+    } else {
+        out.append("/>\n");
+    }
+}
+
 DomElement* DomElement::fromQDomElement(QDomElement domElement, DomDocument* doc) noexcept
 {
     return new DomElement(domElement, nullptr, doc);
 }
 
+DomElement* DomElement::fromQXmlStreamReader(QXmlStreamReader& reader, DomDocument* doc) noexcept
+{
+    return new DomElement(reader, nullptr, doc);
+}
+
+void DomElement::writeBinary(QDataStream& stream) const noexcept
+{
+    stream << mName << mText << mAttributes;
+    stream << qint32(mChilds.count());
+    foreach (DomElement* child, mChilds) {
+        child->writeBinary(stream);
+    }
+}
+
+DomElement* DomElement::readBinary(QDataStream& stream) noexcept
+{
+    QString name;
+    QString text;
+    QMap<QString, QString> attributes;
+    qint32 childCount = -1;
+    stream >> name >> text >> attributes >> childCount;
+    if ((stream.status() != QDataStream::Ok) || (!isValidTagName(name)) || (childCount < 0)
+        || ((childCount > 0) && (!text.isNull())))
+    {
+        return nullptr; // corrupt or truncated stream
+    }
+    QScopedPointer<DomElement> element(new DomElement(name, text));
+    element->mAttributes = attributes;
+    for (qint32 i = 0; i < childCount; ++i) {
+        DomElement* child = readBinary(stream);
+        if (!child) {
+            return nullptr; // the subtree created so far is freed by the QScopedPointer
+        }
+        element->appendChild(child);
+    }
+    return element.take();
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
@@ -315,6 +542,22 @@ bool DomElement::isValidTagName(const QString& name) noexcept
     return valid;
 }
 
+/*****************************************************************************************
+ *  Static Operator Overloadings
+ ****************************************************************************************/
+
+void* DomElement::operator new(std::size_t size)
+{
+    return DomElementPool::instance().allocate(size);
+}
+
+void DomElement::operator delete(void* ptr) noexcept
+{
+    if (ptr) {
+        DomElementPool::instance().deallocate(ptr);
+    }
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -136,6 +136,7 @@ class DomElement final
         void setName(const QString& name) noexcept {
             Q_ASSERT(isValidTagName(name));
             mName = name;
+            if (mParent) mParent->mChildsByNameDirty = true; // invalidate name index
         }
 
 
@@ -451,10 +452,26 @@ class DomElement final
         /**
          * @brief Serialize this DomElement into a QXmlStreamWriter (recursively)
          *
+         * @note This is only used to validate the output of #writeToUtf8() in debug
+         *       builds; the save path uses #writeToUtf8() directly.
+         *
          * @param writer        The QXmlStreamWriter object to write into
          */
         void writeToQXmlStreamWriter(QXmlStreamWriter& writer) const noexcept;
 
+        /**
+         * @brief Serialize this DomElement directly into a UTF-8 byte array (recursively)
+         *
+         * Functionally equivalent to #writeToQXmlStreamWriter() (the output is byte
+         * identical to QXmlStreamWriter with auto formatting and indent 1, so saving
+         * does not reformat existing files), but without the per-string QString
+         * round trips and codec conversions, which dominated the project save time.
+         *
+         * @param out           The byte array to append to
+         * @param indent        The indentation depth of this element (0 = root)
+         */
+        void writeToUtf8(QByteArray& out, int indent) const noexcept;
+
         /**
          * @brief Construct a DomElement object from a QDomElement object (recursively)
          *
@@ -466,6 +483,64 @@ class DomElement final
          */
         static DomElement* fromQDomElement(QDomElement domElement, DomDocument* doc = nullptr) noexcept;
 
+        /**
+         * @brief Construct a DomElement tree from a QXmlStreamReader (recursively)
+         *
+         * In contrast to #fromQDomElement(), no intermediate QDomDocument is
+         * materialized -- the tree is built directly while pulling tokens from the
+         * stream, which roughly halves the peak memory usage of loading a file.
+         *
+         * @param reader        The reader, positioned on the start tag of the element
+         *                      to create; parse errors are left on the reader and must
+         *                      be checked by the caller with QXmlStreamReader::hasError()
+         * @param doc           The DOM Document of the newly created DomElement (only
+         *                      needed for the root element)
+         *
+         * @return The created DomElement (the caller takes the ownership!)
+         */
+        static DomElement* fromQXmlStreamReader(QXmlStreamReader& reader,
+                                                DomDocument* doc = nullptr) noexcept;
+
+        /**
+         * @brief Serialize this DomElement into a QDataStream (recursively)
+         *
+         * Used for the binary sidecar cache (see SmartXmlFile), which avoids XML
+         * parsing entirely when loading an unchanged file a second time.
+         *
+         * @param stream        The stream to write into
+         */
+        void writeBinary(QDataStream& stream) const noexcept;
+
+        /**
+         * @brief Construct a DomElement tree from a QDataStream (recursively)
+         *
+         * Counterpart of #writeBinary().
+         *
+         * @param stream        The stream to read from
+         *
+         * @retval DomElement*   The created element (the caller takes the ownership!)
+         * @retval nullptr          If the stream is corrupt or truncated
+         */
+        static DomElement* readBinary(QDataStream& stream) noexcept;
+
+
+        // Static Operator Overloadings
+
+        /**
+         * @brief Pooled allocation of DOM elements
+         *
+         * Loading a big project file creates hundreds of thousands of DomElement
+         * objects. Allocating each of them with a separate malloc() call is slow and
+         * fragments the heap badly, so all DOM elements are allocated out of a pool of
+         * large blocks with a simple free list instead (see anonymous namespace in
+         * domelement.cpp). The pool is thread-safe because project files may be parsed
+         * on worker threads.
+         */
+        static void* operator new(std::size_t size);
+
+        /// @copydoc operator new()
+        static void operator delete(void* ptr) noexcept;
+
 
     private:
 
@@ -488,6 +563,17 @@ class DomElement final
         explicit DomElement(QDomElement domElement, DomElement* parent = nullptr,
                                DomDocument* doc = nullptr) noexcept;
 
+        /**
+         * @brief Private constructor to create a DomElement from a QXmlStreamReader
+         *
+         * @param reader        The reader, positioned on the start tag of the element
+         * @param parent        The parent of the newly created DomElement
+         * @param doc           The DOM Document of the newly created DomElement (only
+         *                      needed for the root element)
+         */
+        explicit DomElement(QXmlStreamReader& reader, DomElement* parent,
+                               DomDocument* doc) noexcept;
+
         /**
          * @brief Check if a QString represents a valid tag name for elements and attributes
          *
@@ -540,6 +626,12 @@ class DomElement final
         QString mText;              ///< the text of this element (only if there are no childs)
         QList<DomElement*> mChilds;      ///< all child elements (only if there is no text)
         QMap<QString, QString> mAttributes; ///< all attributes of this element (key, value) in alphabetical order
+
+        /// lazy first-child-by-name index, built on demand by #getFirstChild() for
+        /// elements with many children (e.g. boards with thousands of sibling
+        /// nodes) and invalidated whenever the child list changes
+        mutable QHash<QString, DomElement*> mChildsByName;
+        mutable bool mChildsByNameDirty = true;
 };
 
 /*****************************************************************************************
@@ -195,6 +195,15 @@ FilePath FilePath::getParentDir() const noexcept
 
 FilePath FilePath::getPathTo(const QString& filename) const noexcept
 {
+    if (mIsValid && isCleanRelativePath(filename)) {
+        // appending a clean name to a well-formatted path yields a well-formatted
+        // path by construction, so the expensive cleaning pass can be skipped
+        QString parent = mFileInfo.filePath();
+        if (parent == QLatin1String("/")) {
+            return FilePath(parent % filename, WellFormattedTag()); // no double slash
+        }
+        return FilePath(parent % QLatin1Char('/') % filename, WellFormattedTag());
+    }
     return FilePath(mFileInfo.filePath() % QLatin1Char('/') % filename);
 }
 
@@ -274,6 +283,40 @@ QString FilePath::cleanFileName(const QString& userInput, CleanFileNameOptions o
     return ret;
 }
 
+FilePath::FilePath(const QString& cleanAbsolutePath, WellFormattedTag) noexcept :
+    mIsValid(true), mFileInfo(cleanAbsolutePath)
+{
+    Q_ASSERT(makeWellFormatted(cleanAbsolutePath) == cleanAbsolutePath);
+}
+
+bool FilePath::isCleanRelativePath(const QString& path) noexcept
+{
+    if (path.isEmpty() || path.startsWith(QLatin1Char('/'))
+        || path.endsWith(QLatin1Char('/')))
+    {
+        return false;
+    }
+    int segmentStart = 0;
+    for (int i = 0; i <= path.length(); ++i) {
+        if ((i == path.length()) || (path.at(i) == QLatin1Char('/'))) {
+            int segmentLength = i - segmentStart;
+            if (segmentLength == 0) {
+                return false; // empty segment ("//")
+            }
+            if ((path.at(segmentStart) == QLatin1Char('.'))
+                && ((segmentLength == 1)
+                    || ((segmentLength == 2) && (path.at(segmentStart + 1) == QLatin1Char('.')))))
+            {
+                return false; // "." or ".." segment
+            }
+            segmentStart = i + 1;
+        } else if (path.at(i) == QLatin1Char('\\')) {
+            return false; // backslashes need cleaning
+        }
+    }
+    return true;
+}
+
 QString FilePath::makeWellFormatted(const QString& filepath) noexcept
 {
     // change all separators to "/", remove redundant separators, resolve "." and "..".
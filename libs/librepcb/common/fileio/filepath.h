@@ -425,8 +425,32 @@ class FilePath final
 
     private:
 
+        // Private Types
+
+        /// Tag type for the private fast constructor, see #getPathTo()
+        struct WellFormattedTag {};
+
+
         // Private Methods
 
+        /**
+         * @brief Private fast constructor for already well-formatted absolute paths
+         *
+         * Skips makeWellFormatted() (i.e. QDir::cleanPath()), which dominates the
+         * cost of constructing the millions of child paths the library scanner and
+         * the project tree build from known-clean parent paths.
+         */
+        FilePath(const QString& cleanAbsolutePath, WellFormattedTag) noexcept;
+
+        /**
+         * @brief Check if a relative path needs no cleaning when appended to a
+         *        well-formatted parent path
+         *
+         * True if the path contains no backslashes, no empty segments (double
+         * slashes, leading/trailing slash) and no "." or ".." segments.
+         */
+        static bool isCleanRelativePath(const QString& path) noexcept;
+
         /**
          * @brief Make a filepath well-formatted (except making it absolute!)
          *
@@ -20,7 +20,9 @@
 /*****************************************************************************************
  *  Includes
  ****************************************************************************************/
+#include <functional>
 #include <QtCore>
+#include <QtConcurrent/QtConcurrent>
 #include "fileutils.h"
 #include "filepath.h"
 
@@ -101,13 +103,45 @@ void FileUtils::copyDirRecursively(const FilePath& source, const FilePath& dest)
             QString(tr("The file or directory \"%1\" exists already."))
             .arg(dest.toNative()));
     }
-    makePath(dest); // can throw
-    QDir sourceDir(source.toStr());
-    foreach (const QString& file, sourceDir.entryList(QDir::Files | QDir::Hidden)) {
-        copyFile(source.getPathTo(file), dest.getPathTo(file));
+
+    // collect all directories and file pairs first (sequential, cheap), then create
+    // the directory tree and copy the files in parallel on the global thread pool.
+    // Especially on network filesystems - where every single copy pays round trips -
+    // this cuts the duration of "save as", library installs and the new-project
+    // wizard roughly by the number of cores/outstanding requests.
+    QList<QPair<FilePath, FilePath>> files;
+    QList<QPair<FilePath, FilePath>> dirs;
+    dirs.append(qMakePair(source, dest));
+    for (int i = 0; i < dirs.count(); ++i) { // dirs grows while iterating
+        const QPair<FilePath, FilePath> pair = dirs.at(i); // copy: appending below
+                                                           // may reallocate the list
+        const FilePath& src = pair.first;
+        const FilePath& dst = pair.second;
+        makePath(dst); // can throw
+        QDir sourceDir(src.toStr());
+        foreach (const QString& file, sourceDir.entryList(QDir::Files | QDir::Hidden)) {
+            files.append(qMakePair(src.getPathTo(file), dst.getPathTo(file)));
+        }
+        foreach (const QString& dir, sourceDir.entryList(QDir::AllDirs | QDir::NoDotAndDotDot)) {
+            dirs.append(qMakePair(src.getPathTo(dir), dst.getPathTo(dir)));
+        }
     }
-    foreach (const QString& dir, sourceDir.entryList(QDir::AllDirs | QDir::NoDotAndDotDot)) {
-        copyDirRecursively(source.getPathTo(dir), dest.getPathTo(dir));
+
+    // copy the files in parallel; the first error (if any) is rethrown afterwards
+    std::function<QString(const QPair<FilePath, FilePath>&)> copyOne =
+        [](const QPair<FilePath, FilePath>& pair) -> QString {
+            try {
+                copyFile(pair.first, pair.second); // can throw
+                return QString();
+            } catch (const Exception& e) {
+                return e.getMsg();
+            }
+        };
+    QStringList errors = QtConcurrent::blockingMapped(files, copyOne);
+    foreach (const QString& error, errors) {
+        if (!error.isEmpty()) {
+            throw RuntimeError(__FILE__, __LINE__, error);
+        }
     }
 }
 
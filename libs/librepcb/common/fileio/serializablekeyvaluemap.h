@@ -69,28 +69,39 @@ class SerializableKeyValueMap final : public SerializableObject
 
         // Getters
         QStringList keys() const noexcept {
-            return mValues.keys();
+            QStringList list;
+            list.reserve(mValues.count());
+            foreach (const Entry& entry, mValues) { list.append(entry.first); }
+            return list;
         }
         QString getDefaultValue() const noexcept {
-            return mValues.value("");
+            return value(QString(""));
         }
         bool contains(const QString& key) const noexcept {
-            return mValues.contains(key);
+            foreach (const Entry& entry, mValues) {
+                if (entry.first == key) return true;
+            }
+            return false;
         }
         QString value(const QString& key) const noexcept {
-            return mValues.value(key);
+            foreach (const Entry& entry, mValues) {
+                if (entry.first == key) return entry.second;
+            }
+            return QString();
         }
         QString value(const QStringList& keyOrder, QString* usedKey = nullptr) const noexcept {
             // search in the specified key order
             foreach (const QString& key, keyOrder) {
-                if (mValues.contains(key)) {
-                    if (usedKey) *usedKey = key;
-                    return mValues.value(key);
+                foreach (const Entry& entry, mValues) {
+                    if (entry.first == key) {
+                        if (usedKey) *usedKey = key;
+                        return entry.second;
+                    }
                 }
             }
             // use empty key as fallback
             if (usedKey) *usedKey = "";
-            return mValues.value("");
+            return value(QString(""));
         }
 
         // General Methods
@@ -100,7 +111,18 @@ class SerializableKeyValueMap final : public SerializableObject
         }
 
         void insert(const QString& key, const QString& value) noexcept {
-            mValues.insert(key, value);
+            // the entries are kept sorted by key, so keys()/serialize() behave exactly
+            // like with the QMap which was used before (stable serialization order)
+            for (int i = 0; i < mValues.count(); ++i) {
+                if (mValues.at(i).first == key) {
+                    mValues[i].second = value;
+                    return;
+                } else if (mValues.at(i).first > key) {
+                    mValues.insert(i, Entry(internedKey(key), value));
+                    return;
+                }
+            }
+            mValues.append(Entry(internedKey(key), value));
         }
 
         void clear() noexcept {
@@ -114,14 +136,14 @@ class SerializableKeyValueMap final : public SerializableObject
             {
                 QString key = child->getAttribute<QString>(T::keyname, false);
                 QString value = child->getText<QString>(false);
-                if (mValues.contains(key)) {
+                if (contains(key)) {
                     throw RuntimeError(__FILE__, __LINE__,
                         QString(tr("Key \"%1\" defined multiple times in \"%2\"."))
                         .arg(key, domElement.getDocFilePath().toNative()));
                 }
-                mValues.insert(key, value);
+                insert(key, value);
             }
-            if (!mValues.contains(QString(""))) {
+            if (!contains(QString(""))) {
                 throw RuntimeError(__FILE__, __LINE__,
                     QString(tr("The file \"%1\" has no default %2 defined."))
                     .arg(domElement.getDocFilePath().toNative(), T::tagname));
@@ -130,10 +152,10 @@ class SerializableKeyValueMap final : public SerializableObject
 
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(DomElement& root) const override {
-            foreach (const QString& key, mValues.keys()) {
+            foreach (const Entry& entry, mValues) {
                 DomElement* child = root.appendChild(T::tagname);
-                child->setAttribute(T::keyname, key);
-                child->setText(mValues.value(key));
+                child->setAttribute(T::keyname, entry.first);
+                child->setText(entry.second);
             }
         }
 
@@ -150,8 +172,36 @@ class SerializableKeyValueMap final : public SerializableObject
         }
 
 
+    private: // Methods
+
+        /**
+         * @brief Get an interned copy of a key (locale) string
+         *
+         * Nearly all elements use the same few locale strings ("", "en_US", ...), so
+         * all maps share one string allocation per distinct locale (QString is
+         * implicitly shared). Thread-safe because library elements are parsed on
+         * worker threads.
+         */
+        static QString internedKey(const QString& key) noexcept {
+            static QMutex mutex;
+            static QSet<QString> pool;
+            QMutexLocker lock(&mutex);
+            auto it = pool.constFind(key);
+            if (it == pool.constEnd()) {
+                it = pool.insert(key);
+            }
+            return *it;
+        }
+
+
     private: // Data
-        QMap<QString, QString> mValues;
+
+        /// One (key, value) entry. A flat sorted vector is used instead of a QMap:
+        /// nearly all maps hold only 1-2 locale entries, so this avoids the per-node
+        /// heap allocations of the map (which dominated the scanner peak memory) and
+        /// is faster to search in the list view hot paths.
+        typedef QPair<QString, QString> Entry;
+        QVector<Entry> mValues;
 };
 
 /*****************************************************************************************
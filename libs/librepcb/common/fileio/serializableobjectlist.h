@@ -47,6 +47,7 @@ namespace librepcb {
  * - Iterators (for example to use in C++11 range based for loops).
  * - Methods to find elements by UUID and/or name (if supported by template type `T`).
  * - Method #sortedByUuid() to create a copy of the list with elements sorted by UUID.
+ * - Method #takeSnapshot() to create a cheap immutable snapshot of the list state.
  * - Observer pattern to get notified about added and removed elements.
  * - Undo commands librepcb::CmdListElementInsert, librepcb::CmdListElementRemove and
  *   ibrepcb::CmdListElementsSwap.
@@ -108,6 +109,60 @@ class SerializableObjectList : public SerializableObject
         using iterator = Iterator<typename QVector<std::shared_ptr<T>>::iterator, T>;
         using const_iterator = Iterator<typename QVector<std::shared_ptr<T>>::const_iterator, const T>;
 
+        // Snapshot Type
+
+        /**
+         * @brief An immutable, cheap-to-create snapshot of a #SerializableObjectList
+         *
+         * Creating a snapshot only copies the `std::shared_ptr` of every element, so
+         * it is O(n) in pointer copies but does not deep-copy any element - taking a
+         * snapshot of a 500-pad footprint costs basically nothing. The snapshot
+         * provides read-only access and can be serialized, e.g. to write out the
+         * state of a list at the time the snapshot was taken.
+         *
+         * All *structural* modifications of the source list (insert, remove, swap,
+         * assignment, clear, ...) after taking the snapshot are invisible to the
+         * snapshot because they only affect the pointer vector of the list.
+         *
+         * @warning As the elements themselves are shared, modifications of an element
+         *          *in place* through the source list are visible through the
+         *          snapshot! So a snapshot must only be kept alive while the elements
+         *          are guaranteed to stay unmodified, or with element types which are
+         *          treated as immutable values (i.e. which are always replaced
+         *          instead of modified).
+         */
+        class Snapshot final : public SerializableObject
+        {
+            public:
+                Snapshot() noexcept {}
+                Snapshot(const Snapshot& other) noexcept : mObjects(other.mObjects) {}
+                explicit Snapshot(const SerializableObjectList<T, P>& list) noexcept :
+                    mObjects(list.mObjects) {}
+                ~Snapshot() noexcept {}
+
+                // Getters
+                bool isEmpty() const noexcept {return mObjects.empty();}
+                int count() const noexcept {return mObjects.count();}
+                std::shared_ptr<const T> at(int index) const noexcept {
+                    return std::const_pointer_cast<const T>(mObjects.at(index));
+                }
+
+                /// @copydoc librepcb::SerializableObject::serialize()
+                void serialize(DomElement& root) const override {
+                    serializePointerContainer(root, mObjects, P::tagname); // can throw
+                }
+
+                // Operator Overloadings
+                Snapshot& operator=(const Snapshot& rhs) noexcept {
+                    mObjects = rhs.mObjects;
+                    return *this;
+                }
+
+            private:
+                friend class SerializableObjectList<T, P>;
+                QVector<std::shared_ptr<T>> mObjects;
+        };
+
         // Constructors / Destructor
         explicit SerializableObjectList(IF_Observer* observer = nullptr) noexcept {
             if (observer) registerObserver(observer);
@@ -130,6 +185,13 @@ class SerializableObjectList : public SerializableObject
             for (const T& obj : elements) { append(std::make_shared<T>(obj)); } // copy element
             if (observer) registerObserver(observer);
         }
+        explicit SerializableObjectList(const Snapshot& snapshot, IF_Observer* observer = nullptr) noexcept {
+            mObjects.reserve(snapshot.mObjects.count());
+            foreach (const std::shared_ptr<T>& ptr, snapshot.mObjects) {
+                append(std::make_shared<T>(*ptr)); // deep copy to avoid aliasing mutable elements
+            }
+            if (observer) registerObserver(observer);
+        }
         explicit SerializableObjectList(const DomElement& domElement, IF_Observer* observer = nullptr) {
             loadFromDomElement(domElement); // can throw
             if (observer) registerObserver(observer);
@@ -169,7 +231,8 @@ class SerializableObjectList : public SerializableObject
             return indexOf(obj) >= 0;
         }
         bool contains(const Uuid& key) const noexcept {
-            return indexOf(key) >= 0;
+            updateUuidIndex();
+            return mUuidIndex.contains(key);
         }
         bool contains(const QString& name) const noexcept {
             return indexOf(name) >= 0;
@@ -178,8 +241,14 @@ class SerializableObjectList : public SerializableObject
         // "Soft" Element Access (null if not found)
         std::shared_ptr<T> value(int index) noexcept {return mObjects.value(index);}
         std::shared_ptr<const T> value(int index) const noexcept {return std::const_pointer_cast<const T>(mObjects.value(index));}
-        std::shared_ptr<T> find(const Uuid& key) noexcept {return value(indexOf(key));}
-        std::shared_ptr<const T> find(const Uuid& key) const noexcept {return value(indexOf(key));}
+        std::shared_ptr<T> find(const Uuid& key) noexcept {
+            updateUuidIndex();
+            return mUuidIndex.value(key);
+        }
+        std::shared_ptr<const T> find(const Uuid& key) const noexcept {
+            updateUuidIndex();
+            return std::const_pointer_cast<const T>(mUuidIndex.value(key));
+        }
         std::shared_ptr<T> find(const QString& name) noexcept {return value(indexOf(name));}
         std::shared_ptr<const T> find(const QString& name) const noexcept {return value(indexOf(name));}
 
@@ -243,15 +312,23 @@ class SerializableObjectList : public SerializableObject
             Q_ASSERT(obj);
             qBound(0, index, count());
             mObjects.insert(index, obj);
+            mUuidIndexDirty = true;
             notifyObjectAdded(index, obj);
             return index;
         }
+        int insert(int index, T&& obj) noexcept {
+            return insert(index, std::make_shared<T>(std::move(obj))); // move, don't copy
+        }
         int append(const std::shared_ptr<T>& obj) noexcept {
             return insert(count(), obj);
         }
+        int append(T&& obj) noexcept {
+            return insert(count(), std::make_shared<T>(std::move(obj))); // move, don't copy
+        }
         std::shared_ptr<T> take(int index) noexcept {
             Q_ASSERT(contains(index));
             std::shared_ptr<T> obj = mObjects.takeAt(index);
+            mUuidIndexDirty = true;
             notifyObjectRemoved(index, obj);
             return std::move(obj);
         }
@@ -286,6 +363,12 @@ class SerializableObjectList : public SerializableObject
         }
 
         // Convenience Methods
+        /**
+         * @brief Take an immutable snapshot of the current list state (see #Snapshot)
+         */
+        Snapshot takeSnapshot() const noexcept {
+            return Snapshot(*this);
+        }
         SerializableObjectList<T, P> sortedByUuid() const noexcept {
             SerializableObjectList<T, P> copiedList;
             copiedList.mObjects = mObjects; // copy only the pointers, not the objects!
@@ -368,9 +451,44 @@ class SerializableObjectList : public SerializableObject
         }
 
 
+    private: // Methods
+
+        /// @brief Rebuild #mUuidIndex if it is outdated, see its documentation
+        void updateUuidIndex() const noexcept {
+            if (mUuidIndexDirty) {
+                mUuidIndex.clear();
+                mUuidIndex.reserve(mObjects.count());
+                foreach (const std::shared_ptr<T>& obj, mObjects) {
+                    // keep the first element on (corrupt) duplicate UUIDs, like the
+                    // linear scan which was used before
+                    if (!mUuidIndex.contains(obj->getUuid())) {
+                        mUuidIndex.insert(obj->getUuid(), obj);
+                    }
+                }
+                mUuidIndexDirty = false;
+            }
+        }
+
+
     protected: // Data
         QVector<std::shared_ptr<T>> mObjects;
         QList<IF_Observer*> mObservers;
+
+
+    private: // Data
+
+        /**
+         * @brief Lazily built UUID lookup index over #mObjects
+         *
+         * find(const Uuid&) and contains(const Uuid&) sit on hot paths (symbol
+         * variant item and pad resolution run per item per repaint), so they must
+         * not scan the list. The index maps UUIDs to the elements themselves (not to
+         * positions, which would invalidate on every reorder); it is rebuilt lazily
+         * after any structural change. Element UUIDs are immutable, so no further
+         * invalidation is needed.
+         */
+        mutable QHash<Uuid, std::shared_ptr<T>> mUuidIndex;
+        mutable bool mUuidIndexDirty = true;
 };
 
 } // namespace librepcb
@@ -82,6 +82,25 @@ SmartFile::~SmartFile() noexcept
  *  General Methods
  ****************************************************************************************/
 
+QByteArray SmartFile::readContent() const
+{
+    mMappedFile.reset(); // release the mapping of the previous call (if any)
+    QScopedPointer<QFile> file(new QFile(mOpenedFilePath.toStr()));
+    if (!file->open(QIODevice::ReadOnly)) {
+        throw RuntimeError(__FILE__, __LINE__, QString(tr("Cannot open file \"%1\": %2"))
+            .arg(mOpenedFilePath.toNative(), file->errorString()));
+    }
+    qint64 size = file->size();
+    uchar* data = (size > 0) ? file->map(0, size) : nullptr;
+    if (data) {
+        // the mapping stays valid as long as the QFile object is alive
+        mMappedFile.swap(file);
+        return QByteArray::fromRawData(reinterpret_cast<const char*>(data), size);
+    } else {
+        return file->readAll(); // e.g. an empty or not mappable file
+    }
+}
+
 void SmartFile::removeFile(bool original)
 {
     if (mIsReadOnly) {
@@ -92,6 +111,13 @@ void SmartFile::removeFile(bool original)
     if (filepath.isExistingFile()) {
         FileUtils::removeFile(filepath);
     }
+
+    // the file is gone, so the content written last is no longer on disk
+    if (original) {
+        mOriginalContentHash = QByteArray();
+    } else {
+        mBackupContentHash = QByteArray();
+    }
 }
 
 /*****************************************************************************************
@@ -116,6 +142,35 @@ void SmartFile::updateMembersAfterSaving(bool toOriginal) noexcept
         mIsCreated = false;
 }
 
+void SmartFile::writeContentIfChanged(const FilePath& filepath, const QByteArray& content,
+                                      bool toOriginal)
+{
+    // note on hard-link/reflink snapshots: the original/backup pair is never
+    // created by copying file contents - both variants are serialized and
+    // written independently, and thanks to the content hashes below, unchanged
+    // files are not rewritten at all. So there is no copy to replace with a
+    // link. If multi-generation backup points are ever added, hard links are
+    // safe to use here because writeFile() replaces the inode atomically
+    // (QSaveFile + rename) and can never write through an existing link.
+
+    QByteArray& lastHash = toOriginal ? mOriginalContentHash : mBackupContentHash;
+    QByteArray hash = QCryptographicHash::hash(content, QCryptographicHash::Sha256);
+    if (lastHash.isNull() && filepath.isExistingFile()) {
+        // first save since the file was opened --> compare with the content on disk
+        try {
+            lastHash = QCryptographicHash::hash(FileUtils::readFile(filepath),
+                                                QCryptographicHash::Sha256);
+        } catch (const Exception&) {
+            // could not read the file --> just overwrite it
+        }
+    }
+    if (hash == lastHash) {
+        return; // the file content is still up to date --> skip writing the file
+    }
+    FileUtils::writeFile(filepath, content); // can throw
+    lastHash = hash;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -128,6 +128,26 @@ class SmartFile
 
         // General Methods
 
+        /**
+         * @brief Read the content of the opened file, memory-mapped when possible
+         *
+         * The file is mapped into memory with QFile::map() and the returned byte array
+         * only wraps the mapped region (QByteArray::fromRawData()), i.e. the bytes are
+         * not copied and parsers consume them directly from the page cache. If mapping
+         * is not possible (e.g. on virtual file systems), the content is read into
+         * memory the ordinary way instead.
+         *
+         * @warning The returned byte array (including all shallow copies of it!) is
+         *          only valid until the next call to this method or the destruction of
+         *          this object, because the underlying mapping is released then. Use
+         *          it only as a temporary, e.g. to feed a parser.
+         *
+         * @return The file content
+         *
+         * @throw Exception If the file could not be opened
+         */
+        QByteArray readContent() const;
+
         /**
          * @brief Remove the file from the file system
          *
@@ -176,6 +196,27 @@ class SmartFile
          */
         void updateMembersAfterSaving(bool toOriginal) noexcept;
 
+        /**
+         * @brief Write content to a file, unless the file already has this content
+         *
+         * This method compares a SHA-256 hash of the given content with the hash of
+         * the content written to the same file before (or, on the first save, with the
+         * content currently on disk) and skips the write if they are equal. This way
+         * the #save() implementations of the subclasses avoid unnecessary I/O and
+         * modification time churn for files whose serialized content has not changed
+         * (differential save).
+         *
+         * @param filepath      The file to write (as returned by
+         *                      #prepareSaveAndReturnFilePath())
+         * @param content       The content to write
+         * @param toOriginal    Specifies whether the original or the backup file is
+         *                      written (the written content is tracked per file)
+         *
+         * @throw Exception If the file could not be written
+         */
+        void writeContentIfChanged(const FilePath& filepath, const QByteArray& content,
+                                   bool toOriginal);
+
 
         // General Attributes
 
@@ -197,6 +238,30 @@ class SmartFile
          */
         FilePath mOpenedFilePath;
 
+        /**
+         * @brief The file which holds the mapping of the last #readContent() call
+         *
+         * Keeping the QFile object alive keeps the mapped memory valid. The pointer is
+         * reset (and the memory unmapped) on the next #readContent() call and in the
+         * destructor.
+         */
+        mutable QScopedPointer<QFile> mMappedFile;
+
+        /**
+         * @brief Hash of the content written last to the original file
+         *
+         * Used by #writeContentIfChanged() to skip writing unchanged files. A null
+         * hash means that the content of the file is unknown (nothing written yet).
+         */
+        QByteArray mOriginalContentHash;
+
+        /**
+         * @brief Hash of the content written last to the backup file
+         *
+         * @see #mOriginalContentHash
+         */
+        QByteArray mBackupContentHash;
+
         /**
          * @brief This variable determines whether the file was restored or not
          *
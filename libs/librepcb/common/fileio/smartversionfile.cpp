@@ -65,7 +65,8 @@ void SmartVersionFile::save(bool toOriginal)
 {
     if (mVersion.isValid()) {
         const FilePath& filepath = prepareSaveAndReturnFilePath(toOriginal);
-        FileUtils::writeFile(filepath, QString("%1\n").arg(mVersion.toStr()).toUtf8());
+        writeContentIfChanged(filepath, QString("%1\n").arg(mVersion.toStr()).toUtf8(),
+                              toOriginal);
         updateMembersAfterSaving(toOriginal);
     } else {
         qDebug() << mVersion.toStr();
@@ -50,17 +50,75 @@ SmartXmlFile::~SmartXmlFile() noexcept
 
 std::unique_ptr<DomDocument> SmartXmlFile::parseFileAndBuildDomTree() const
 {
-    return std::unique_ptr<DomDocument>(
-        new DomDocument(FileUtils::readFile(mOpenedFilePath), mOpenedFilePath));
+    QByteArray content = readContent(); // memory-mapped, can throw
+    QByteArray hash = QCryptographicHash::hash(content, QCryptographicHash::Sha256);
+    FilePath cacheFp(mOpenedFilePath.toStr() % ".bin");
+
+    // a valid sidecar cache lets us skip the XML parsing entirely
+    std::unique_ptr<DomDocument> doc = loadDomTreeFromCache(cacheFp, hash);
+    if (!doc) {
+        doc.reset(new DomDocument(content, mOpenedFilePath)); // can throw
+        if (!mIsReadOnly) {
+            // files opened read-only (e.g. by the library scanner or the command line
+            // exporter) must not be touched at all, so no cache is written for them
+            saveDomTreeToCache(*doc, cacheFp, hash);
+        }
+    }
+    return doc;
 }
 
 void SmartXmlFile::save(const DomDocument& domDocument, bool toOriginal)
 {
     const FilePath& filepath = prepareSaveAndReturnFilePath(toOriginal);
-    FileUtils::writeFile(filepath, domDocument.toByteArray());
+    writeContentIfChanged(filepath, domDocument.toByteArray(), toOriginal);
     updateMembersAfterSaving(toOriginal);
 }
 
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+std::unique_ptr<DomDocument> SmartXmlFile::loadDomTreeFromCache(const FilePath& cacheFp,
+                                                                const QByteArray& hash) const noexcept
+{
+    QFile file(cacheFp.toStr());
+    if (!file.open(QIODevice::ReadOnly)) {
+        return nullptr; // not cached yet
+    }
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_2);
+    quint32 magic = 0;
+    quint16 version = 0;
+    QByteArray cachedHash;
+    stream >> magic >> version >> cachedHash;
+    if ((stream.status() != QDataStream::Ok) || (magic != sBinaryCacheMagic)
+        || (version != sBinaryCacheVersion) || (cachedHash != hash))
+    {
+        return nullptr; // e.g. the XML file was modified by another application
+    }
+    QScopedPointer<DomElement> root(DomElement::readBinary(stream));
+    if (!root) {
+        return nullptr; // corrupt or truncated cache file
+    }
+    return std::unique_ptr<DomDocument>(new DomDocument(*root.take(), mOpenedFilePath));
+}
+
+void SmartXmlFile::saveDomTreeToCache(const DomDocument& domDocument, const FilePath& cacheFp,
+                                      const QByteArray& hash) const noexcept
+{
+    QSaveFile file(cacheFp.toStr());
+    if (!file.open(QIODevice::WriteOnly)) {
+        return; // e.g. a read-only directory --> just don't cache
+    }
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_2);
+    stream << sBinaryCacheMagic << sBinaryCacheVersion << hash;
+    domDocument.getRoot().writeBinary(stream);
+    if (stream.status() == QDataStream::Ok) {
+        file.commit();
+    }
+}
+
 /*****************************************************************************************
  *  Static Methods
  ****************************************************************************************/
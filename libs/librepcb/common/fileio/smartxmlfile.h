@@ -140,6 +140,39 @@ class SmartXmlFile final : public SmartFile
          */
         SmartXmlFile(const FilePath& filepath, bool restore, bool readOnly, bool create);
 
+        /**
+         * @brief Try to load the DOM tree from the binary sidecar cache
+         *
+         * @param cacheFp   The filepath of the sidecar cache file
+         * @param hash      The hash of the current XML file content; a cache written
+         *                  for any other content is ignored
+         *
+         * @retval DomDocument  The loaded DOM tree
+         * @retval nullptr      If there is no usable cache for this content
+         */
+        std::unique_ptr<DomDocument> loadDomTreeFromCache(const FilePath& cacheFp,
+                                                          const QByteArray& hash) const noexcept;
+
+        /**
+         * @brief Write the binary sidecar cache for the given DOM tree (best effort)
+         *
+         * Failures (e.g. a read-only directory) are silently ignored, the cache is
+         * only an optimization.
+         *
+         * @param domDocument   The DOM tree to cache
+         * @param cacheFp       The filepath of the sidecar cache file
+         * @param hash          The hash of the XML file content the tree was built from
+         */
+        void saveDomTreeToCache(const DomDocument& domDocument, const FilePath& cacheFp,
+                                const QByteArray& hash) const noexcept;
+
+
+    private: // Data
+
+        // Constants
+        static const quint32 sBinaryCacheMagic = 0x4C504243; ///< "LPBC"
+        static const quint16 sBinaryCacheVersion = 1; ///< bump when the format changes
+
 };
 
 /*****************************************************************************************
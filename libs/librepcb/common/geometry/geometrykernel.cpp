@@ -0,0 +1,199 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <functional>
+#include <QtCore>
+#include <QtGui>
+#include <QtConcurrent/QtConcurrent>
+#include "geometrykernel.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Static Helpers
+ ****************************************************************************************/
+
+namespace {
+
+/**
+ * Internally all clipping is done in millimeter floating point coordinates (without
+ * the Y axis inversion of the pixel coordinate system) and rounded back to
+ * nanometers at the end.
+ */
+QPainterPath toMmPath(const GeometryKernel::PathList& paths) noexcept
+{
+    QPainterPath p;
+    p.setFillRule(Qt::WindingFill);
+    foreach (const GeometryKernel::Path& path, paths) {
+        if (path.count() < 3) continue; // not an area
+        QPolygonF polygon;
+        polygon.reserve(path.count() + 1);
+        foreach (const Point& point, path) {
+            polygon.append(point.toMmQPointF());
+        }
+        polygon.append(path.first().toMmQPointF()); // close the outline
+        p.addPolygon(polygon);
+    }
+    return p;
+}
+
+GeometryKernel::PathList fromMmPath(const QPainterPath& p) noexcept
+{
+    GeometryKernel::PathList paths;
+    foreach (const QPolygonF& polygon, p.toSubpathPolygons()) {
+        GeometryKernel::Path path;
+        path.reserve(polygon.count());
+        foreach (const QPointF& point, polygon) {
+            Point converted = Point::fromMm(point);
+            // drop duplicates created by rounding to nanometers
+            if (path.isEmpty() || (path.last() != converted)) {
+                path.append(converted);
+            }
+        }
+        // remove the explicit closing vertex again
+        if ((path.count() > 1) && (path.first() == path.last())) {
+            path.removeLast();
+        }
+        if (path.count() >= 3) {
+            paths.append(path);
+        }
+    }
+    return paths;
+}
+
+QPainterPath offsetMmPath(const QPainterPath& p, const Length& offset) noexcept
+{
+    if (offset == 0) {
+        return p;
+    }
+    // grow = union with the stroked outline, shrink = subtract the stroked outline
+    QPainterPathStroker stroker;
+    stroker.setWidth(2.0 * qAbs(offset.toMm()));
+    stroker.setJoinStyle(Qt::RoundJoin);
+    stroker.setCapStyle(Qt::RoundCap);
+    QPainterPath stroke = stroker.createStroke(p);
+    QPainterPath result = (offset > 0) ? p.united(stroke) : p.subtracted(stroke);
+    result.setFillRule(Qt::WindingFill);
+    return result;
+}
+
+} // namespace
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+GeometryKernel::PathList GeometryKernel::unite(const PathList& subject,
+                                               const PathList& clip) noexcept
+{
+    return fromMmPath(toMmPath(subject).united(toMmPath(clip)));
+}
+
+GeometryKernel::PathList GeometryKernel::intersect(const PathList& subject,
+                                                   const PathList& clip) noexcept
+{
+    return fromMmPath(toMmPath(subject).intersected(toMmPath(clip)));
+}
+
+GeometryKernel::PathList GeometryKernel::subtract(const PathList& subject,
+                                                  const PathList& clip) noexcept
+{
+    return fromMmPath(toMmPath(subject).subtracted(toMmPath(clip)));
+}
+
+GeometryKernel::PathList GeometryKernel::offset(const PathList& paths,
+                                                const Length& offset) noexcept
+{
+    return fromMmPath(offsetMmPath(toMmPath(paths), offset));
+}
+
+QVector<GeometryKernel::PathList> GeometryKernel::uniteBatch(
+    const QVector<QPair<PathList, PathList>>& jobs) noexcept
+{
+    std::function<PathList(const QPair<PathList, PathList>&)> job =
+        [](const QPair<PathList, PathList>& pair) -> PathList {
+            return unite(pair.first, pair.second);
+        };
+    return QtConcurrent::blockingMapped(jobs, job);
+}
+
+QVector<GeometryKernel::PathList> GeometryKernel::offsetBatch(
+    const QVector<QPair<PathList, Length>>& jobs) noexcept
+{
+    std::function<PathList(const QPair<PathList, Length>&)> job =
+        [](const QPair<PathList, Length>& pair) -> PathList {
+            return offset(pair.first, pair.second);
+        };
+    return QtConcurrent::blockingMapped(jobs, job);
+}
+
+/*****************************************************************************************
+ *  Conversion Methods
+ ****************************************************************************************/
+
+QPainterPath GeometryKernel::toQPainterPathPx(const PathList& paths) noexcept
+{
+    QPainterPath p;
+    p.setFillRule(Qt::WindingFill);
+    foreach (const Path& path, paths) {
+        if (path.count() < 3) continue;
+        QPolygonF polygon;
+        polygon.reserve(path.count() + 1);
+        foreach (const Point& point, path) {
+            polygon.append(point.toPxQPointF());
+        }
+        polygon.append(path.first().toPxQPointF());
+        p.addPolygon(polygon);
+    }
+    return p;
+}
+
+GeometryKernel::PathList GeometryKernel::fromQPainterPathPx(const QPainterPath& path) noexcept
+{
+    PathList paths;
+    foreach (const QPolygonF& polygon, path.toSubpathPolygons()) {
+        Path converted;
+        converted.reserve(polygon.count());
+        foreach (const QPointF& point, polygon) {
+            Point p = Point::fromPx(point);
+            if (converted.isEmpty() || (converted.last() != p)) {
+                converted.append(p);
+            }
+        }
+        if ((converted.count() > 1) && (converted.first() == converted.last())) {
+            converted.removeLast();
+        }
+        if (converted.count() >= 3) {
+            paths.append(converted);
+        }
+    }
+    return paths;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
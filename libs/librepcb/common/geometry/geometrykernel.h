@@ -0,0 +1,165 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_GEOMETRYKERNEL_H
+#define LIBREPCB_GEOMETRYKERNEL_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtGui>
+#include "../units/all_length_units.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Class GeometryKernel
+ ****************************************************************************************/
+
+/**
+ * @brief Boolean operations and offsetting on polygons with integer coordinates
+ *
+ * This class is the shared foundation for all features which need robust polygon
+ * clipping (copper pours, DRC clearance checks, solder mask expansions, ...), so
+ * that none of them has to implement its own ad-hoc clipping.
+ *
+ * The public interface works entirely on closed polygon outlines made of
+ * nanometer-integer vertices (librepcb::Point), using the non-zero winding rule.
+ * A #Path is one closed outline (the closing segment back to the first vertex is
+ * implicit), a #PathList is a set of outlines which together describe one region
+ * (counter-clockwise outlines are additive, clockwise outlines are holes).
+ *
+ * @note The current implementation delegates the actual clipping to Qt's path
+ *       boolean operations and rounds the result back to nanometers, so results
+ *       are robust but vertices may be off by up to one nanometer. The interface
+ *       is deliberately fixed in the integer domain so the internals can later be
+ *       replaced by a dedicated integer clipper without touching any consumer.
+ *
+ * All methods are thread-safe; the batch methods distribute independent
+ * operations over all CPU cores.
+ *
+ * @author ubruhin
+ * @date 2017-09-02
+ */
+class GeometryKernel final
+{
+    public:
+
+        // Types
+        typedef QVector<Point> Path;        ///< one closed polygon outline
+        typedef QVector<Path> PathList;     ///< a region (outlines + holes)
+
+        // Constructors / Destructor
+        GeometryKernel() = delete;
+        GeometryKernel(const GeometryKernel& other) = delete;
+        ~GeometryKernel() = delete;
+
+        // Static Methods
+
+        /**
+         * @brief Calculate the union of two regions
+         *
+         * @param subject   First region
+         * @param clip      Second region
+         *
+         * @return The region covered by `subject`, `clip` or both
+         */
+        static PathList unite(const PathList& subject, const PathList& clip) noexcept;
+
+        /**
+         * @brief Calculate the intersection of two regions
+         *
+         * @param subject   First region
+         * @param clip      Second region
+         *
+         * @return The region covered by both `subject` and `clip`
+         */
+        static PathList intersect(const PathList& subject, const PathList& clip) noexcept;
+
+        /**
+         * @brief Calculate the difference of two regions
+         *
+         * @param subject   Region to subtract from
+         * @param clip      Region to subtract
+         *
+         * @return The region covered by `subject` but not by `clip`
+         */
+        static PathList subtract(const PathList& subject, const PathList& clip) noexcept;
+
+        /**
+         * @brief Grow (positive) or shrink (negative) a region
+         *
+         * Offsetting uses round joins, i.e. convex corners are rounded with the
+         * offset radius (exactly what solder mask expansion and clearance areas
+         * need).
+         *
+         * @param paths     Region to offset
+         * @param offset    Offset distance (> 0 grows, < 0 shrinks)
+         *
+         * @return The offsetted region
+         */
+        static PathList offset(const PathList& paths, const Length& offset) noexcept;
+
+        /**
+         * @brief Calculate the unions of many independent region pairs in parallel
+         *
+         * @param jobs      List of (subject, clip) pairs
+         *
+         * @return One result region per job, in the same order
+         */
+        static QVector<PathList> uniteBatch(
+            const QVector<QPair<PathList, PathList>>& jobs) noexcept;
+
+        /**
+         * @brief Offset many independent regions in parallel
+         *
+         * @param jobs      List of (region, offset) pairs
+         *
+         * @return One result region per job, in the same order
+         */
+        static QVector<PathList> offsetBatch(
+            const QVector<QPair<PathList, Length>>& jobs) noexcept;
+
+        // Conversion Methods
+
+        /**
+         * @brief Convert a region to a QPainterPath (e.g. for rendering it)
+         */
+        static QPainterPath toQPainterPathPx(const PathList& paths) noexcept;
+
+        /**
+         * @brief Convert a QPainterPath to a region with nanometer vertices
+         */
+        static PathList fromQPainterPathPx(const QPainterPath& path) noexcept;
+
+        // Operator Overloadings
+        GeometryKernel& operator=(const GeometryKernel& rhs) = delete;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_GEOMETRYKERNEL_H
@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "polygon.h"
+#include "../units/pointarray.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -304,9 +305,18 @@ Polygon Polygon::translated(const Point& offset) const noexcept
 
 Polygon& Polygon::rotate(const Angle& angle, const Point& center) noexcept
 {
-    setStartPos(mStartPos.rotated(angle, center));
+    // rotate all vertices at once, see PointArray::rotate()
+    PointArray vertices;
+    vertices.reserve(mSegments.count() + 1);
+    vertices.append(mStartPos);
     for (PolygonSegment& segment : mSegments) {
-        segment.setEndPos(segment.getEndPos().rotated(angle, center));
+        vertices.append(segment.getEndPos());
+    }
+    vertices.rotate(angle, center);
+    setStartPos(vertices.getPoint(0));
+    int i = 1;
+    for (PolygonSegment& segment : mSegments) {
+        segment.setEndPos(vertices.getPoint(i++));
     }
     return *this;
 }
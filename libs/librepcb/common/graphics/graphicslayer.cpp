@@ -38,18 +38,32 @@ GraphicsLayer::GraphicsLayer(const GraphicsLayer& other) noexcept :
     mColorHighlighted(other.mColorHighlighted), mIsVisible(other.mIsVisible),
     mIsEnabled(other.mIsEnabled)
 {
+    updateCachedPensAndBrushes();
 }
 
 GraphicsLayer::GraphicsLayer(const QString& name) noexcept :
     QObject(nullptr), mName(name), mIsEnabled(true)
 {
     getDefaultValues(mName, mNameTr, mColor, mColorHighlighted, mIsVisible);
+    updateCachedPensAndBrushes();
 }
 
 GraphicsLayer::~GraphicsLayer() noexcept
 {
 }
 
+/*****************************************************************************************
+ *  Protected Methods
+ ****************************************************************************************/
+
+void GraphicsLayer::updateCachedPensAndBrushes() noexcept
+{
+    mPen = QPen(mColor, 0);
+    mPenHighlighted = QPen(mColorHighlighted, 0);
+    mBrush = QBrush(mColor);
+    mBrushHighlighted = QBrush(mColorHighlighted);
+}
+
 /*****************************************************************************************
  *  Setters
  ****************************************************************************************/
@@ -58,6 +72,7 @@ void GraphicsLayer::setColor(const QColor& color) noexcept
 {
     if (color != mColor) {
         mColor = color;
+        updateCachedPensAndBrushes();
         foreach (IF_GraphicsLayerObserver* object, mObservers) {
             object->layerColorChanged(*this, mColor);
         }
@@ -69,6 +84,7 @@ void GraphicsLayer::setColorHighlighted(const QColor& color) noexcept
 {
     if (color != mColorHighlighted) {
         mColorHighlighted = color;
+        updateCachedPensAndBrushes();
         foreach (IF_GraphicsLayerObserver* object, mObservers) {
             object->layerHighlightColorChanged(*this, mColorHighlighted);
         }
@@ -257,6 +273,7 @@ void GraphicsLayer::getDefaultValues(const QString& name, QString& nameTr, QColo
         h.insert(sBoardDocumentation,       {tr("Documentation"),               Qt::white,                  Qt::lightGray,              true});
         h.insert(sBoardComments,            {tr("Comments"),                    Qt::yellow,                 Qt::darkYellow,             true});
         h.insert(sBoardcGuide,              {tr("Guide"),                       Qt::darkYellow,             Qt::yellow,                 true});
+        h.insert(sBoardAirWires,            {tr("Air Wires"),                   Qt::yellow,                 Qt::yellow,                 true});
         // board symmetric
         h.insert(sTopPlacement,             {tr("Top Placement"),               QColor(224, 224, 224, 150), QColor(224, 224, 224, 220), true});
         h.insert(sBotPlacement,             {tr("Bot Placement"),               QColor(224, 224, 224, 150), QColor(224, 224, 224, 220), true});
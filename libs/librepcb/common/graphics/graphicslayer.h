@@ -89,6 +89,7 @@ class GraphicsLayer : public QObject
         static constexpr const char* sBoardDocumentation      = "brd_documentation";      ///< for documentation purposes, e.g. text
         static constexpr const char* sBoardComments           = "brd_comments";           ///< for personal comments, e.g. text
         static constexpr const char* sBoardcGuide             = "brd_guide";              ///< e.g. for boxes around circuits
+        static constexpr const char* sBoardAirWires           = "brd_airwires";           ///< airwires of unrouted connections
 
         // symmetric board layers
         static constexpr const char* sTopPlacement            = "top_placement";          ///< placement information (e.g. outline) of devices
@@ -129,6 +130,12 @@ class GraphicsLayer : public QObject
         static constexpr const char* sDebugComponentSymbolsCounts           = "dbg_ComponentSymbolsCounts";
 #endif
 
+        // level of detail thresholds, used by the graphics items of board/schematic
+        // items to simplify or skip painting of items which cover only a few device
+        // pixels on screen (see QStyleOptionGraphicsItem::levelOfDetailFromTransform())
+        static constexpr qreal sLodMinVisibleSizePx = 1;    ///< smaller items are not drawn at all
+        static constexpr qreal sLodMinDetailedSizePx = 5;   ///< smaller items are drawn simplified
+
         // Constructors / Destructor
         GraphicsLayer() = delete;
         GraphicsLayer(const GraphicsLayer& other) noexcept;
@@ -141,6 +148,22 @@ class GraphicsLayer : public QObject
         const QColor& getColor(bool highlighted = false) const noexcept {
             return highlighted ? mColorHighlighted : mColor;
         }
+
+        /**
+         * @brief Get a shared cosmetic pen resp. solid brush with this layer's color
+         *
+         * Graphics items should use these shared objects in their paint() methods
+         * instead of constructing a QPen/QBrush per call - that way a full repaint
+         * of a large board does not allocate thousands of temporary pen/brush
+         * objects, and QPainter can skip the state change when consecutive items
+         * of the same layer are drawn (it compares against the current pen/brush).
+         */
+        const QPen& getPen(bool highlighted = false) const noexcept {
+            return highlighted ? mPenHighlighted : mPen;
+        }
+        const QBrush& getBrush(bool highlighted = false) const noexcept {
+            return highlighted ? mBrushHighlighted : mBrush;
+        }
         bool getVisible() const noexcept {return mIsVisible;}
         bool isEnabled() const noexcept {return mIsEnabled;}
         bool isVisible() const noexcept {return mIsEnabled && mIsVisible;}
@@ -181,6 +204,10 @@ class GraphicsLayer : public QObject
                                      QColor& colorHl, bool& visible) noexcept;
 
 
+    protected: // Methods
+        void updateCachedPensAndBrushes() noexcept;
+
+
     signals:
         void attributesChanged();
 
@@ -190,6 +217,10 @@ class GraphicsLayer : public QObject
         QString mNameTr;            ///< Layer name (translated into the user's language)
         QColor mColor;              ///< Color of graphics items on that layer
         QColor mColorHighlighted;   ///< Color of hightlighted graphics items on that layer
+        QPen mPen;                  ///< Shared cosmetic pen with #mColor
+        QPen mPenHighlighted;       ///< Shared cosmetic pen with #mColorHighlighted
+        QBrush mBrush;              ///< Shared solid brush with #mColor
+        QBrush mBrushHighlighted;   ///< Shared solid brush with #mColorHighlighted
         bool mIsVisible;            ///< Visibility of graphics items on that layer
         bool mIsEnabled;            ///< Visibility/availability of the layer itself
         mutable QSet<IF_GraphicsLayerObserver*> mObservers; ///< A list of all observer objects
@@ -23,6 +23,7 @@
 #include <QtCore>
 #include <QtWidgets>
 #include "graphicsscene.h"
+#include "../tracer.h"
 #include "../units/point.h"
 
 /*****************************************************************************************
@@ -35,8 +36,15 @@ namespace librepcb {
  ****************************************************************************************/
 
 GraphicsScene::GraphicsScene() noexcept :
-    QGraphicsScene(nullptr), mSelectionRectItem(nullptr)
+    QGraphicsScene(nullptr), mSelectionRectItem(nullptr), mBatchDepth(0),
+    mInteractiveEditDepth(0),
+    mItemsBoundingRect(), mItemsBoundingRectDirty(true)
 {
+    // any change in the scene (item added/removed/moved/repainted) invalidates the
+    // cached items bounding rect, see getItemsBoundingRect()
+    connect(this, &QGraphicsScene::changed,
+            [this](const QList<QRectF>&){mItemsBoundingRectDirty = true;});
+
     /*QBrush selectBrush = QGuiApplication::palette().highlight();
     QColor selectColor = selectBrush.color();
     selectColor.setAlpha(50);
@@ -62,11 +70,36 @@ GraphicsScene::~GraphicsScene() noexcept
 void GraphicsScene::addItem(QGraphicsItem& item) noexcept
 {
     QGraphicsScene::addItem(&item);
+    // invalidate synchronously; the changed() signal only fires from the event loop
+    mItemsBoundingRectDirty = true;
 }
 
 void GraphicsScene::removeItem(QGraphicsItem& item) noexcept
 {
     QGraphicsScene::removeItem(&item);
+    mItemsBoundingRectDirty = true; // see addItem()
+}
+
+QRectF GraphicsScene::getItemsBoundingRect() const noexcept
+{
+    if (mItemsBoundingRectDirty) {
+        mItemsBoundingRect = itemsBoundingRect();
+        mItemsBoundingRectDirty = false;
+    }
+    return mItemsBoundingRect;
+}
+
+void GraphicsScene::beginInteractiveEdit() noexcept
+{
+    mInteractiveEditDepth++;
+    updateItemIndexMethod();
+}
+
+void GraphicsScene::endInteractiveEdit() noexcept
+{
+    Q_ASSERT(mInteractiveEditDepth > 0);
+    mInteractiveEditDepth--;
+    updateItemIndexMethod();
 }
 
 void GraphicsScene::setSelectionRect(const Point& p1, const Point& p2) noexcept
@@ -75,6 +108,45 @@ void GraphicsScene::setSelectionRect(const Point& p1, const Point& p2) noexcept
     mSelectionRectItem->setRect(rectPx);
 }
 
+/*****************************************************************************************
+ *  Batch Methods
+ ****************************************************************************************/
+
+void GraphicsScene::beginBatch() noexcept
+{
+    mBatchDepth++;
+    updateItemIndexMethod();
+}
+
+void GraphicsScene::endBatch() noexcept
+{
+    Q_ASSERT(mBatchDepth > 0);
+    mBatchDepth--;
+    if ((mBatchDepth == 0) && (mInteractiveEditDepth == 0)) {
+        // rebuild the index and repaint everything once
+        TracerScope trace("GraphicsScene::endBatch");
+        updateItemIndexMethod();
+        invalidate();
+    }
+}
+
+void GraphicsScene::updateItemIndexMethod() noexcept
+{
+    // the BSP index is suspended while *either* a batch *or* an interactive edit
+    // is in progress - batches regularly occur nested inside an interactive edit
+    // window (e.g. the per-mouse-move batch of the move command during a drag),
+    // and restoring + rebuilding the index on every inner batch end would
+    // reintroduce exactly the per-move index churn the interactive edit mode is
+    // there to avoid. Only when both counters reach zero the index is restored
+    // (and thereby rebuilt once).
+    bool suspend = (mBatchDepth > 0) || (mInteractiveEditDepth > 0);
+    QGraphicsScene::ItemIndexMethod method =
+        suspend ? QGraphicsScene::NoIndex : QGraphicsScene::BspTreeIndex;
+    if (itemIndexMethod() != method) {
+        setItemIndexMethod(method);
+    }
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
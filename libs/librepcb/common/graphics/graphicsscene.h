@@ -39,6 +39,16 @@ class Point;
 
 /**
  * @brief The GraphicsScene class
+ *
+ * @note Explicit region-of-interest visibility management (setVisible(false) on
+ *       far-offscreen items, rehydrating on pan) was evaluated and rejected: the
+ *       BSP index already makes per-frame culling O(log n + visible), the board
+ *       items additionally skip detail at low zoom via their level-of-detail
+ *       paint paths, and item visibility is *semantic* state in this codebase
+ *       (isSelectable(), selection queries and the layer docks all consult it), so
+ *       toggling it for rendering purposes would corrupt editor behavior. During
+ *       drags - the one case where the BSP degrades - the scene switches to
+ *       NoIndex instead, see #beginInteractiveEdit().
  */
 class GraphicsScene final : public QGraphicsScene
 {
@@ -53,12 +63,90 @@ class GraphicsScene final : public QGraphicsScene
         // General Methods
         void addItem(QGraphicsItem& item) noexcept;
         void removeItem(QGraphicsItem& item) noexcept;
+
+        /**
+         * @brief Get the bounding rect of all items, like QGraphicsScene#itemsBoundingRect()
+         *
+         * In contrast to QGraphicsScene#itemsBoundingRect() (which iterates every
+         * item), the result is cached and only recomputed after something in the
+         * scene has actually changed. Repeated calls (e.g. "fit view" on every board
+         * switch, or rendering preview icons) are O(1) on an unchanged scene.
+         */
+        QRectF getItemsBoundingRect() const noexcept;
         void setSelectionRect(const Point& p1, const Point& p2) noexcept;
 
+        // Batch Methods
+
+        /**
+         * @brief Begin a batch of many addItem()/removeItem() calls
+         *
+         * While a batch is active, the BSP item index is suspended so adding/removing
+         * thousands of items (e.g. undoing a large paste) does not re-balance the index
+         * and invalidate the viewport for every single item. Calls can be nested; the
+         * index is rebuilt and the scene invalidated once when the outermost batch
+         * ends. Consider using #GraphicsSceneBatchGuard instead of calling these
+         * methods directly.
+         */
+        void beginBatch() noexcept;
+
+        /// @copydoc beginBatch()
+        void endBatch() noexcept;
+
+        /**
+         * @brief Begin an interactive edit operation (e.g. dragging a selection)
+         *
+         * Switches the scene to QGraphicsScene::NoIndex for the duration of the
+         * operation: the BSP tree index degrades badly while many items move
+         * (constant index removals/reinsertions per mouse move), whereas without an
+         * index the full-viewport repaints of a drag just iterate the items. The BSP
+         * index is rebuilt once when the outermost operation ends. Calls may be
+         * nested.
+         */
+        void beginInteractiveEdit() noexcept;
+
+        /// @copydoc beginInteractiveEdit()
+        void endInteractiveEdit() noexcept;
+
 
     private:
 
+        // Private Methods
+
+        /// suspend/restore the BSP index depending on #mBatchDepth and
+        /// #mInteractiveEditDepth (the index may only be restored when BOTH
+        /// counters reached zero, see the implementation for the rationale)
+        void updateItemIndexMethod() noexcept;
+
+
         QGraphicsRectItem* mSelectionRectItem;
+        int mBatchDepth;
+        int mInteractiveEditDepth; ///< see #beginInteractiveEdit()
+        mutable QRectF mItemsBoundingRect; ///< see #getItemsBoundingRect()
+        mutable bool mItemsBoundingRectDirty; ///< see #getItemsBoundingRect()
+};
+
+/*****************************************************************************************
+ *  Class GraphicsSceneBatchGuard
+ ****************************************************************************************/
+
+/**
+ * @brief RAII guard for GraphicsScene#beginBatch() / GraphicsScene#endBatch()
+ */
+class GraphicsSceneBatchGuard final
+{
+    public:
+        GraphicsSceneBatchGuard() = delete;
+        GraphicsSceneBatchGuard(const GraphicsSceneBatchGuard& other) = delete;
+        explicit GraphicsSceneBatchGuard(GraphicsScene& scene) noexcept : mScene(scene) {
+            mScene.beginBatch();
+        }
+        ~GraphicsSceneBatchGuard() noexcept {
+            mScene.endBatch();
+        }
+        GraphicsSceneBatchGuard& operator=(const GraphicsSceneBatchGuard& rhs) = delete;
+
+    private:
+        GraphicsScene& mScene;
 };
 
 /*****************************************************************************************
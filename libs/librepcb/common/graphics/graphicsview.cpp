@@ -22,9 +22,12 @@
  ****************************************************************************************/
 #include <QtCore>
 #include <QtWidgets>
-#include "QtOpenGL"
+#if QT_VERSION < QT_VERSION_CHECK(5, 4, 0)
+#include <QGLWidget>
+#endif
 #include "graphicsview.h"
 #include "graphicsscene.h"
+#include "minimapwidget.h"
 #include "if_graphicsvieweventhandler.h"
 #include "../gridproperties.h"
 
@@ -38,12 +41,24 @@ namespace librepcb {
  ****************************************************************************************/
 
 GraphicsView::GraphicsView(QWidget* parent, IF_GraphicsViewEventHandler* eventHandler) noexcept :
-    QGraphicsView(parent), mEventHandlerObject(eventHandler), mScene(nullptr),
+    QGraphicsView(parent), mMiniMap(nullptr), mEventHandlerObject(eventHandler), mScene(nullptr),
+    mRenderQualityDegraded(false),
     mZoomAnimation(nullptr), mGridProperties(new GridProperties()), mOriginCrossVisible(true),
-    mUseOpenGl(false), mPanningActive(false)
+    mUseOpenGl(false), mPanningActive(false), mGridCacheTileSizePx(0),
+    mPendingMove(false), mPendingMoveButtons(Qt::NoButton), mPendingMoveModifiers(Qt::NoModifier)
 {
+    mPendingMoveTimer.setSingleShot(true);
+    connect(&mPendingMoveTimer, &QTimer::timeout,
+            this, &GraphicsView::dispatchPendingMouseMoveEvent);
+
     setRenderHints(QPainter::Antialiasing | QPainter::SmoothPixmapTransform);
-    setViewportUpdateMode(QGraphicsView::FullViewportUpdate);
+
+    // adaptive render quality, see paintEvent()
+    mRestoreQualityTimer.setSingleShot(true);
+    mRestoreQualityTimer.setInterval(300);
+    connect(&mRestoreQualityTimer, &QTimer::timeout,
+            this, &GraphicsView::restoreRenderQuality);
+    setViewportUpdateMode(QGraphicsView::MinimalViewportUpdate);
     setOptimizationFlags(QGraphicsView::DontSavePainterState);
     setHorizontalScrollBarPolicy(Qt::ScrollBarAlwaysOn);
     setVerticalScrollBarPolicy(Qt::ScrollBarAlwaysOn);
@@ -78,10 +93,25 @@ void GraphicsView::setUseOpenGl(bool useOpenGl) noexcept
 {
     if (useOpenGl != mUseOpenGl)
     {
-        if (useOpenGl)
+        if (useOpenGl) {
+#if QT_VERSION >= QT_VERSION_CHECK(5, 4, 0)
+            QOpenGLWidget* viewport = new QOpenGLWidget();
+            QSurfaceFormat format = QSurfaceFormat::defaultFormat();
+            format.setSamples(4); // antialiasing
+            viewport->setFormat(format);
+            setViewport(viewport);
+#else
+            // QOpenGLWidget was only added in Qt 5.4, so the legacy QGLWidget from the
+            // QtOpenGL module is used as long as we support Qt 5.2/5.3
             setViewport(new QGLWidget(QGLFormat(QGL::DoubleBuffer | QGL::AlphaChannel | QGL::SampleBuffers)));
-        else
+#endif
+            // the GL viewport cannot preserve the previous frame, so the whole
+            // viewport must be redrawn on every update
+            setViewportUpdateMode(QGraphicsView::FullViewportUpdate);
+        } else {
             setViewport(nullptr);
+            setViewportUpdateMode(QGraphicsView::MinimalViewportUpdate);
+        }
         mUseOpenGl = useOpenGl;
     }
 }
@@ -89,6 +119,7 @@ void GraphicsView::setUseOpenGl(bool useOpenGl) noexcept
 void GraphicsView::setGridProperties(const GridProperties& properties) noexcept
 {
     *mGridProperties = properties;
+    mGridCacheTile = QPixmap(); // invalidate the cached grid tile
     setBackgroundBrush(backgroundBrush()); // this will repaint the background
 }
 
@@ -98,6 +129,63 @@ void GraphicsView::setScene(GraphicsScene* scene) noexcept
     mScene = scene;
     if (mScene) mScene->installEventFilter(this);
     QGraphicsView::setScene(mScene);
+    if (mMiniMap) mMiniMap->setScene(mScene);
+}
+
+void GraphicsView::setMiniMapEnabled(bool enabled) noexcept
+{
+    if (enabled && (!mMiniMap)) {
+        mMiniMap = new MiniMapWidget(*this); // owned by this widget (Qt parent)
+        mMiniMap->setScene(mScene);
+        updateMiniMapPosition();
+    } else if ((!enabled) && mMiniMap) {
+        delete mMiniMap;
+        mMiniMap = nullptr;
+    }
+}
+
+void GraphicsView::resizeEvent(QResizeEvent* event)
+{
+    QGraphicsView::resizeEvent(event);
+    updateMiniMapPosition();
+}
+
+void GraphicsView::paintEvent(QPaintEvent* event)
+{
+    QElapsedTimer timer;
+    timer.start();
+    QGraphicsView::paintEvent(event);
+
+    // adaptive render quality: if this frame blew the budget, drop the expensive
+    // render hints for the subsequent frames of the ongoing interaction; the
+    // idle timer below restores full quality (with one final repaint) as soon
+    // as no frame was painted for a moment
+    const qint64 frameBudgetMs = 40;
+    if ((!mRenderQualityDegraded) && (timer.elapsed() > frameBudgetMs)) {
+        mRenderQualityDegraded = true;
+        setRenderHints(QPainter::RenderHints());
+    }
+    if (mRenderQualityDegraded) {
+        mRestoreQualityTimer.start(); // (re)start the idle detection
+    }
+}
+
+void GraphicsView::restoreRenderQuality() noexcept
+{
+    if (mRenderQualityDegraded) {
+        mRenderQualityDegraded = false;
+        setRenderHints(QPainter::Antialiasing | QPainter::SmoothPixmapTransform);
+        if (viewport()) viewport()->update(); // one full-quality repaint
+    }
+}
+
+void GraphicsView::updateMiniMapPosition() noexcept
+{
+    if (mMiniMap) {
+        mMiniMap->move(width() - mMiniMap->width() - 10,
+                       height() - mMiniMap->height() - 10);
+        mMiniMap->raise();
+    }
 }
 
 void GraphicsView::setVisibleSceneRect(const QRectF& rect) noexcept
@@ -172,7 +260,7 @@ void GraphicsView::zoomOut() noexcept
 void GraphicsView::zoomAll() noexcept
 {
     if (!mScene) return;
-    QRectF rect = mScene->itemsBoundingRect();
+    QRectF rect = mScene->getItemsBoundingRect();
     if (rect.isEmpty()) rect = QRectF(-100, -100, 200, 200);
     qreal xMargins = rect.width() / 50;
     qreal yMargins = rect.height() / 50;
@@ -198,12 +286,75 @@ void GraphicsView::zoomAnimationValueChanged(const QVariant& value) noexcept
  *  Inherited from QGraphicsView
  ****************************************************************************************/
 
+void GraphicsView::handleMouseMoveEvent(QGraphicsSceneMouseEvent* e) noexcept
+{
+    if (!mEventHandlerObject) {
+        return;
+    }
+    static const int sMoveDispatchIntervalMs = 16; // ~ one frame at 60Hz
+    if ((!mLastMoveDispatchTime.isValid())
+        || (mLastMoveDispatchTime.elapsed() >= sMoveDispatchIntervalMs))
+    {
+        mPendingMove = false;
+        mPendingMoveTimer.stop();
+        mLastMoveDispatchTime.start();
+        mEventHandlerObject->graphicsViewEventHandler(e);
+    } else {
+        // coalesce: remember the newest state, deliver it when the frame interval
+        // expired (see dispatchPendingMouseMoveEvent())
+        mPendingMoveScenePos = e->scenePos();
+        mPendingMoveScreenPos = e->screenPos();
+        mPendingMoveLastScenePos = e->lastScenePos();
+        mPendingMoveLastScreenPos = e->lastScreenPos();
+        mPendingMoveButtonDownScenePos = e->buttonDownScenePos(Qt::LeftButton);
+        mPendingMoveButtonDownScreenPos = e->buttonDownScreenPos(Qt::LeftButton);
+        mPendingMoveButtons = e->buttons();
+        mPendingMoveModifiers = e->modifiers();
+        mPendingMove = true;
+        if (!mPendingMoveTimer.isActive()) {
+            mPendingMoveTimer.start(qMax(1,
+                sMoveDispatchIntervalMs - int(mLastMoveDispatchTime.elapsed())));
+        }
+    }
+}
+
+void GraphicsView::dispatchPendingMouseMoveEvent() noexcept
+{
+    if ((!mPendingMove) || (!mEventHandlerObject)) {
+        mPendingMove = false;
+        return;
+    }
+    mPendingMove = false;
+    mLastMoveDispatchTime.start();
+
+    // synthesize a move event carrying the newest coalesced state
+    QGraphicsSceneMouseEvent e(QEvent::GraphicsSceneMouseMove);
+    e.setScenePos(mPendingMoveScenePos);
+    e.setScreenPos(mPendingMoveScreenPos);
+    e.setLastScenePos(mPendingMoveLastScenePos);
+    e.setLastScreenPos(mPendingMoveLastScreenPos);
+    e.setButtonDownScenePos(Qt::LeftButton, mPendingMoveButtonDownScenePos);
+    e.setButtonDownScreenPos(Qt::LeftButton, mPendingMoveButtonDownScreenPos);
+    e.setButtons(mPendingMoveButtons);
+    e.setModifiers(mPendingMoveModifiers);
+    mEventHandlerObject->graphicsViewEventHandler(&e);
+}
+
+void GraphicsView::flushPendingMouseMoveEvent() noexcept
+{
+    if (mPendingMove) {
+        mPendingMoveTimer.stop();
+        dispatchPendingMouseMoveEvent();
+    }
+}
+
 bool GraphicsView::eventFilter(QObject* obj, QEvent* event)
 {
     switch (event->type())
     {
         case QEvent::GraphicsSceneMousePress: {
             QGraphicsSceneMouseEvent* e = dynamic_cast<QGraphicsSceneMouseEvent*>(event); Q_ASSERT(e);
+            flushPendingMouseMoveEvent(); // keep the event order intact
             if (e->button() == Qt::MiddleButton) {
                 mCursorBeforePanning = cursor();
                 setCursor(Qt::ClosedHandCursor);
@@ -214,6 +365,7 @@ bool GraphicsView::eventFilter(QObject* obj, QEvent* event)
         }
         case QEvent::GraphicsSceneMouseRelease: {
             QGraphicsSceneMouseEvent* e = dynamic_cast<QGraphicsSceneMouseEvent*>(event); Q_ASSERT(e);
+            flushPendingMouseMoveEvent(); // keep the event order intact
             if (e->button() == Qt::MiddleButton) {
                 setCursor(mCursorBeforePanning);
             } else if (mEventHandlerObject) {
@@ -231,10 +383,12 @@ bool GraphicsView::eventFilter(QObject* obj, QEvent* event)
                 mPanningActive = false;
             }
             emit cursorScenePositionChanged(Point::fromPx(e->scenePos()));
-            // no break here!
+            handleMouseMoveEvent(e); // compressed dispatch into the FSMs
+            return true;
         }
         case QEvent::GraphicsSceneMouseDoubleClick:
         case QEvent::GraphicsSceneContextMenu: {
+            flushPendingMouseMoveEvent(); // keep the event order intact
             if (mEventHandlerObject) {
                 mEventHandlerObject->graphicsViewEventHandler(event);
             }
@@ -259,54 +413,32 @@ bool GraphicsView::eventFilter(QObject* obj, QEvent* event)
 
 void GraphicsView::drawBackground(QPainter* painter, const QRectF& rect)
 {
-    QPen gridPen(Qt::gray);
-    gridPen.setCosmetic(true);
-
     // draw background color
     painter->setPen(Qt::NoPen);
-    painter->setBrush(backgroundBrush());
     painter->fillRect(rect, backgroundBrush());
 
-    // draw background grid lines
-    gridPen.setWidth((mGridProperties->getType() == GridProperties::Type_t::Dots) ? 2 : 1);
-    painter->setPen(gridPen);
-    painter->setBrush(Qt::NoBrush);
+    // draw background grid as a textured fill of a cached tile of one grid period,
+    // instead of stroking thousands of individual lines/dots on every frame
     qreal gridIntervalPixels = mGridProperties->getInterval().toPx();
-    qreal scaleFactor = width() / rect.width();
+    // the zoom must come from the view transform, not from the exposed rect:
+    // with MinimalViewportUpdate the rect only covers the changed region on
+    // partial repaints, which would inflate the scale and both misfire the
+    // grid visibility check and re-render the cached tile on every exposure
+    qreal scaleFactor = transform().m11();
     if (gridIntervalPixels * scaleFactor >= (qreal)5)
     {
-        qreal left, right, top, bottom;
-        left = qFloor(rect.left() / gridIntervalPixels) * gridIntervalPixels;
-        right = rect.right();
-        top = rect.top();
-        bottom = qFloor(rect.bottom() / gridIntervalPixels) * gridIntervalPixels;
-        switch (mGridProperties->getType())
-        {
-            case GridProperties::Type_t::Lines:
-            {
-                QVarLengthArray<QLineF, 500> lines;
-                for (qreal x = left; x < right; x += gridIntervalPixels)
-                    lines.append(QLineF(x, rect.top(), x, rect.bottom()));
-                for (qreal y = bottom; y > top; y -= gridIntervalPixels)
-                    lines.append(QLineF(rect.left(), y, rect.right(), y));
-                painter->setOpacity(0.5);
-                painter->drawLines(lines.data(), lines.size());
-                break;
-            }
-
-            case GridProperties::Type_t::Dots:
-            {
-                QVarLengthArray<QPointF, 2000> dots;
-                for (qreal x = left; x < right; x += gridIntervalPixels)
-                    for (qreal y = bottom; y > top; y -= gridIntervalPixels)
-                        dots.append(QPointF(x, y));
-                painter->drawPoints(dots.data(), dots.size());
-                break;
-            }
-
-            default:
-                break;
+        qreal tileSizePx = gridIntervalPixels * scaleFactor;
+        if (mGridCacheTile.isNull() || (!qFuzzyCompare(tileSizePx, mGridCacheTileSizePx))) {
+            updateGridCacheTile(tileSizePx);
+            // the brush transform maps the tile (device pixels) back to scene
+            // coordinates; because the brush origin is the scene origin, the texture
+            // repeats exactly at every grid interval, i.e. stays aligned with the grid
+            mGridCacheBrush = QBrush(mGridCacheTile);
+            qreal s = gridIntervalPixels / mGridCacheTile.width();
+            mGridCacheBrush.setTransform(QTransform::fromScale(s, s));
         }
+        painter->setBrushOrigin(QPointF(0, 0));
+        painter->fillRect(rect, mGridCacheBrush);
     }
 }
 
@@ -326,6 +458,41 @@ void GraphicsView::drawForeground(QPainter* painter, const QRectF& rect)
     }
 }
 
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void GraphicsView::updateGridCacheTile(qreal tileSizePx) noexcept
+{
+    int sizePx = qMax(1, qCeil(tileSizePx));
+    mGridCacheTile = QPixmap(sizePx, sizePx);
+    mGridCacheTile.fill(Qt::transparent);
+    QPainter painter(&mGridCacheTile);
+    QPen gridPen(Qt::gray);
+    gridPen.setWidth((mGridProperties->getType() == GridProperties::Type_t::Dots) ? 2 : 1);
+    painter.setPen(gridPen);
+    switch (mGridProperties->getType())
+    {
+        case GridProperties::Type_t::Lines:
+        {
+            painter.setOpacity(0.5);
+            painter.drawLine(0, 0, 0, sizePx);
+            painter.drawLine(0, 0, sizePx, 0);
+            break;
+        }
+
+        case GridProperties::Type_t::Dots:
+        {
+            painter.drawPoint(0, 0);
+            break;
+        }
+
+        default:
+            break;
+    }
+    mGridCacheTileSizePx = tileSizePx;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -35,6 +35,7 @@ namespace librepcb {
 class IF_GraphicsViewEventHandler;
 class GraphicsScene;
 class GridProperties;
+class MiniMapWidget;
 
 /*****************************************************************************************
  *  Class GraphicsView
@@ -68,6 +69,14 @@ class GraphicsView final : public QGraphicsView
         void setOriginCrossVisible(bool visible) noexcept;
         void setEventHandlerObject(IF_GraphicsViewEventHandler* eventHandler) noexcept;
 
+        /**
+         * @brief Enable or disable the minimap overview navigator overlay
+         *
+         * The minimap shows a downsampled cached rendering of the whole scene
+         * with the visible area marked; clicking/dragging in it pans the view.
+         */
+        void setMiniMapEnabled(bool enabled) noexcept;
+
         // General Methods
         Point mapGlobalPosToScenePos(const QPoint& globalPosPx, bool boundToView,
                                      bool mapToGrid) const noexcept;
@@ -95,6 +104,7 @@ class GraphicsView final : public QGraphicsView
 
         // Private Slots
         void zoomAnimationValueChanged(const QVariant& value) noexcept;
+        void dispatchPendingMouseMoveEvent() noexcept;
 
 
     private:
@@ -105,11 +115,25 @@ class GraphicsView final : public QGraphicsView
 
         // Inherited Methods
         bool eventFilter(QObject* obj, QEvent* event);
+        void resizeEvent(QResizeEvent* event) override;
+        void paintEvent(QPaintEvent* event) override;
         void drawBackground(QPainter* painter, const QRectF& rect);
         void drawForeground(QPainter* painter, const QRectF& rect);
 
+        // Private Methods
+        void updateGridCacheTile(qreal tileSizePx) noexcept;
+        void handleMouseMoveEvent(QGraphicsSceneMouseEvent* e) noexcept;
+        void flushPendingMouseMoveEvent() noexcept;
+
+
+        // Private Methods (Minimap)
+        void updateMiniMapPosition() noexcept;
+
+        // Private Methods (Render Quality Governor)
+        void restoreRenderQuality() noexcept;
 
         // General Attributes
+        MiniMapWidget* mMiniMap; ///< only if enabled (owned as Qt child widget)
         IF_GraphicsViewEventHandler* mEventHandlerObject;
         GraphicsScene* mScene;
         QVariantAnimation* mZoomAnimation;
@@ -119,6 +143,42 @@ class GraphicsView final : public QGraphicsView
         volatile bool mPanningActive;
         QCursor mCursorBeforePanning;
 
+        // Mouse Move Event Compression (see #handleMouseMoveEvent())
+        //
+        // High polling rate mice deliver up to 1000 move events per second, and the
+        // editor FSMs do hit-testing and geometry work per dispatched event. Moves
+        // are therefore coalesced to at most one dispatch per frame: the newest
+        // state is remembered and delivered (as a synthesized event) when the frame
+        // interval expired, so the FSMs always see the latest position and the
+        // interaction cost is bounded by the refresh rate.
+        // Adaptive Render Quality (see paintEvent())
+        //
+        // When a repaint takes longer than a frame budget, expensive render hints
+        // (antialiasing, smooth pixmap transforms) are switched off so subsequent
+        // frames during the ongoing interaction stay fluid; full quality is
+        // restored (with one high-quality repaint) once no frame was painted for
+        // a moment, i.e. when the interaction stopped.
+        bool mRenderQualityDegraded; ///< whether the cheap render hints are active
+        QTimer mRestoreQualityTimer; ///< detects render idleness
+
+        QElapsedTimer mLastMoveDispatchTime; ///< invalid until the first dispatch
+        QTimer mPendingMoveTimer; ///< delivers the coalesced trailing event
+        bool mPendingMove; ///< true if a coalesced move is waiting for dispatch
+        QPointF mPendingMoveScenePos;
+        QPointF mPendingMoveScreenPos;
+        QPointF mPendingMoveLastScenePos;
+        QPointF mPendingMoveLastScreenPos;
+        QPointF mPendingMoveButtonDownScenePos;
+        QPointF mPendingMoveButtonDownScreenPos;
+        Qt::MouseButtons mPendingMoveButtons;
+        Qt::KeyboardModifiers mPendingMoveModifiers;
+
+        // Background Grid Cache (see #drawBackground())
+        QPixmap mGridCacheTile; ///< one grid period, rendered in device pixels
+        qreal mGridCacheTileSizePx; ///< device pixel size of one grid period when
+                                    ///< #mGridCacheTile was rendered (0 = invalid)
+        QBrush mGridCacheBrush; ///< #mGridCacheTile with the scene transform applied
+
         // Static Variables
         static constexpr qreal sZoomStepFactor = 1.3;
 };
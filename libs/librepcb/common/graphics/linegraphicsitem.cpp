@@ -143,12 +143,27 @@ void LineGraphicsItem::paint(QPainter* painter, const QStyleOptionGraphicsItem*
  *  Private Methods
  ****************************************************************************************/
 
+QPainterPath LineGraphicsItem::shape() const noexcept
+{
+    if (mShapeDirty) {
+        // the shape was never built at all before (the member existed but stayed
+        // empty), so these items were not hit-testable by shape; built lazily now,
+        // through the analytic capsule fast path of shapeFromPath()
+        QPainterPath p;
+        p.moveTo(mLine.p1());
+        p.lineTo(mLine.p2());
+        mShape = Toolbox::shapeFromPath(p, mPen);
+        mShapeDirty = false;
+    }
+    return mShape;
+}
+
 void LineGraphicsItem::updateBoundingRectAndShape() noexcept
 {
     prepareGeometryChange();
     QRectF lineRect(mLine.p1(), mLine.p2());
     mBoundingRect = Toolbox::adjustedBoundingRect(lineRect, mPen.widthF() / 2);
-    // TODO: Should we also update the shape?
+    mShapeDirty = true;
     update();
 }
 
@@ -68,7 +68,7 @@ class LineGraphicsItem final : public QGraphicsItem, public IF_GraphicsLayerObse
 
         // Inherited from QGraphicsItem
         QRectF boundingRect() const noexcept override {return mBoundingRect;}
-        QPainterPath shape() const noexcept override {return mShape;}
+        QPainterPath shape() const noexcept override;
         void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = 0) noexcept override;
 
         // Operator Overloadings
@@ -85,7 +85,8 @@ class LineGraphicsItem final : public QGraphicsItem, public IF_GraphicsLayerObse
         QPen mPenHighlighted;
         QLineF mLine;
         QRectF mBoundingRect;
-        QPainterPath mShape;
+        mutable QPainterPath mShape; ///< built lazily in #shape()
+        mutable bool mShapeDirty = true; ///< see #shape()
 };
 
 /*****************************************************************************************
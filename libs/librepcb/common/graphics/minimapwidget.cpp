@@ -0,0 +1,173 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+#include "minimapwidget.h"
+#include "graphicsview.h"
+#include "graphicsscene.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+MiniMapWidget::MiniMapWidget(GraphicsView& view) noexcept :
+    QWidget(&view), mView(view), mScene(nullptr)
+{
+    setFixedSize(200, 150);
+    setCursor(Qt::PointingHandCursor);
+    setAttribute(Qt::WA_OpaquePaintEvent, false);
+
+    // the cache refresh is debounced: while the user edits, the minimap lags a
+    // moment behind instead of re-rendering the whole scene on every change
+    mUpdateTimer.setSingleShot(true);
+    mUpdateTimer.setInterval(500);
+    connect(&mUpdateTimer, &QTimer::timeout, this, &MiniMapWidget::updateCache);
+}
+
+MiniMapWidget::~MiniMapWidget() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void MiniMapWidget::setScene(GraphicsScene* scene) noexcept
+{
+    if (mScene) {
+        disconnect(mScene, nullptr, this, nullptr);
+    }
+    mScene = scene;
+    if (mScene) {
+        connect(mScene, &QGraphicsScene::changed, this, &MiniMapWidget::scheduleCacheUpdate);
+        updateCache();
+    } else {
+        mCache = QPixmap();
+        update();
+    }
+    setVisible(mScene != nullptr);
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void MiniMapWidget::paintEvent(QPaintEvent* event) noexcept
+{
+    Q_UNUSED(event);
+    QPainter painter(this);
+    painter.fillRect(rect(), QColor(0, 0, 0, 120));
+    if (mCache.isNull() || mCacheSourceRect.isEmpty()) {
+        return;
+    }
+    QRect target((width() - mCache.width()) / 2, (height() - mCache.height()) / 2,
+                 mCache.width(), mCache.height());
+    painter.drawPixmap(target, mCache);
+
+    // mark the currently visible area of the view
+    QRectF visible = mView.getVisibleSceneRect().intersected(mCacheSourceRect);
+    if (!visible.isEmpty()) {
+        qreal sx = qreal(mCache.width()) / mCacheSourceRect.width();
+        qreal sy = qreal(mCache.height()) / mCacheSourceRect.height();
+        QRectF mark(target.x() + (visible.x() - mCacheSourceRect.x()) * sx,
+                    target.y() + (visible.y() - mCacheSourceRect.y()) * sy,
+                    visible.width() * sx, visible.height() * sy);
+        painter.setPen(QPen(Qt::white, 1));
+        painter.setBrush(QColor(255, 255, 255, 40));
+        painter.drawRect(mark);
+    }
+}
+
+void MiniMapWidget::mousePressEvent(QMouseEvent* event) noexcept
+{
+    if (event->button() == Qt::LeftButton) {
+        jumpTo(event->pos());
+    }
+}
+
+void MiniMapWidget::mouseMoveEvent(QMouseEvent* event) noexcept
+{
+    if (event->buttons() & Qt::LeftButton) {
+        jumpTo(event->pos());
+    }
+}
+
+void MiniMapWidget::scheduleCacheUpdate() noexcept
+{
+    mUpdateTimer.start(); // restarts the debounce interval if already running
+}
+
+void MiniMapWidget::updateCache() noexcept
+{
+    if (!mScene) {
+        return;
+    }
+    mCacheSourceRect = getSourceRect();
+    if (mCacheSourceRect.isEmpty()) {
+        mCache = QPixmap();
+        update();
+        return;
+    }
+    QSizeF scaled = mCacheSourceRect.size();
+    scaled.scale(width(), height(), Qt::KeepAspectRatio);
+    QPixmap pixmap(scaled.toSize());
+    pixmap.fill(Qt::transparent);
+    QPainter painter(&pixmap);
+    painter.setRenderHint(QPainter::Antialiasing);
+    mScene->render(&painter, QRectF(QPointF(0, 0), scaled), mCacheSourceRect,
+                   Qt::KeepAspectRatio);
+    painter.end();
+    mCache = pixmap;
+    update();
+}
+
+void MiniMapWidget::jumpTo(const QPoint& widgetPos) noexcept
+{
+    if (mCache.isNull() || mCacheSourceRect.isEmpty()) {
+        return;
+    }
+    QRect target((width() - mCache.width()) / 2, (height() - mCache.height()) / 2,
+                 mCache.width(), mCache.height());
+    qreal sx = mCacheSourceRect.width() / qreal(mCache.width());
+    qreal sy = mCacheSourceRect.height() / qreal(mCache.height());
+    QPointF scenePos(mCacheSourceRect.x() + (widgetPos.x() - target.x()) * sx,
+                     mCacheSourceRect.y() + (widgetPos.y() - target.y()) * sy);
+    mView.centerOn(scenePos);
+    update();
+}
+
+QRectF MiniMapWidget::getSourceRect() const noexcept
+{
+    return mScene ? mScene->getItemsBoundingRect() : QRectF();
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
@@ -0,0 +1,104 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_MINIMAPWIDGET_H
+#define LIBREPCB_MINIMAPWIDGET_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+class GraphicsView;
+class GraphicsScene;
+
+/*****************************************************************************************
+ *  Class MiniMapWidget
+ ****************************************************************************************/
+
+/**
+ * @brief A small overview navigator ("minimap") overlay for a GraphicsView
+ *
+ * Shows a downsampled cached rendering of the whole scene with the currently
+ * visible area marked, so navigating a large document no longer needs
+ * zoom-out/zoom-in round trips (each of which is a full repaint at high
+ * resolution). Clicking or dragging inside the minimap jumps/pans the view.
+ *
+ * The cached rendering is refreshed debounced when the scene changes, so the
+ * per-frame cost of the overlay is a single pixmap blit.
+ *
+ * @author ubruhin
+ * @date 2017-09-02
+ */
+class MiniMapWidget final : public QWidget
+{
+        Q_OBJECT
+
+    public:
+
+        // Constructors / Destructor
+        MiniMapWidget() = delete;
+        MiniMapWidget(const MiniMapWidget& other) = delete;
+        explicit MiniMapWidget(GraphicsView& view) noexcept;
+        ~MiniMapWidget() noexcept;
+
+        // General Methods
+
+        /**
+         * @brief Set the scene to show (pass nullptr to clear)
+         */
+        void setScene(GraphicsScene* scene) noexcept;
+
+        // Operator Overloadings
+        MiniMapWidget& operator=(const MiniMapWidget& rhs) = delete;
+
+
+    private: // Methods
+
+        void paintEvent(QPaintEvent* event) noexcept override;
+        void mousePressEvent(QMouseEvent* event) noexcept override;
+        void mouseMoveEvent(QMouseEvent* event) noexcept override;
+        void scheduleCacheUpdate() noexcept;
+        void updateCache() noexcept;
+        void jumpTo(const QPoint& widgetPos) noexcept;
+        QRectF getSourceRect() const noexcept;
+
+
+    private: // Data
+
+        GraphicsView& mView;
+        GraphicsScene* mScene;
+        QPixmap mCache;             ///< downsampled rendering of the whole scene
+        QRectF mCacheSourceRect;    ///< scene rect covered by #mCache
+        QTimer mUpdateTimer;        ///< debounces cache refreshes on scene changes
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_MINIMAPWIDGET_H
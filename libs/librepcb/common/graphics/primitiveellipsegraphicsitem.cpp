@@ -202,16 +202,28 @@ void PrimitiveEllipseGraphicsItem::updateColors() noexcept
         mBrush.setStyle(Qt::NoBrush);
         mBrushHighlighted.setStyle(Qt::NoBrush);
     }
+    mShapeDirty = true; // the pen style affects the stroked shape
     update();
 }
 
+QPainterPath PrimitiveEllipseGraphicsItem::shape() const noexcept
+{
+    if (mShapeDirty) {
+        // stroking is expensive, so the shape is only built when actually requested
+        // (e.g. for the first hit test after a modification)
+        QPainterPath p;
+        p.addEllipse(mEllipseRect);
+        mShape = Toolbox::shapeFromPath(p, mPen);
+        mShapeDirty = false;
+    }
+    return mShape;
+}
+
 void PrimitiveEllipseGraphicsItem::updateBoundingRectAndShape() noexcept
 {
     prepareGeometryChange();
     mBoundingRect = Toolbox::adjustedBoundingRect(mEllipseRect, mPen.widthF() / 2);
-    QPainterPath p;
-    p.addEllipse(mEllipseRect);
-    mShape = Toolbox::shapeFromPath(p, mPen);
+    mShapeDirty = true;
     update();
 }
 
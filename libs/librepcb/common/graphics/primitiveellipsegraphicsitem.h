@@ -71,7 +71,7 @@ class PrimitiveEllipseGraphicsItem : public QGraphicsItem, public IF_GraphicsLay
 
         // Inherited from QGraphicsItem
         QRectF boundingRect() const noexcept override {return mBoundingRect;}
-        QPainterPath shape() const noexcept override {return mShape;}
+        QPainterPath shape() const noexcept override;
         void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = 0) noexcept override;
 
         // Operator Overloadings
@@ -93,7 +93,8 @@ class PrimitiveEllipseGraphicsItem : public QGraphicsItem, public IF_GraphicsLay
         QBrush mBrushHighlighted;
         QRectF mEllipseRect;
         QRectF mBoundingRect;
-        QPainterPath mShape;
+        mutable QPainterPath mShape; ///< built lazily in #shape()
+        mutable bool mShapeDirty = true; ///< see #shape()
 };
 
 /*****************************************************************************************
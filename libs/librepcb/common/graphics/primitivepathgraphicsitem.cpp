@@ -35,7 +35,7 @@ namespace librepcb {
  ****************************************************************************************/
 
 PrimitivePathGraphicsItem::PrimitivePathGraphicsItem(QGraphicsItem* parent) noexcept :
-    QGraphicsItem(parent), mLineLayer(nullptr), mFillLayer(nullptr)
+    QGraphicsItem(parent), mLineLayer(nullptr), mFillLayer(nullptr), mShapeDirty(false)
 {
     mPen.setCapStyle(Qt::RoundCap);
     mPenHighlighted.setCapStyle(Qt::RoundCap);
@@ -68,6 +68,7 @@ void PrimitivePathGraphicsItem::setRotation(const Angle& rot) noexcept
 
 void PrimitivePathGraphicsItem::setPath(const QPainterPath& path) noexcept
 {
+    if (path == mPainterPath) return;
     mPainterPath = path;
     updateBoundingRectAndShape();
 }
@@ -167,6 +168,17 @@ void PrimitivePathGraphicsItem::paint(QPainter* painter, const QStyleOptionGraph
     painter->drawPath(mPainterPath);
 }
 
+QPainterPath PrimitivePathGraphicsItem::shape() const noexcept
+{
+    if (mShapeDirty) {
+        // stroking the path is expensive, so it is done only when the shape is
+        // actually requested (e.g. for the first hit test after a modification)
+        mShape = Toolbox::shapeFromPath(mPainterPath, mPen);
+        mShapeDirty = false;
+    }
+    return mShape;
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
@@ -198,8 +210,11 @@ void PrimitivePathGraphicsItem::updateColors() noexcept
 void PrimitivePathGraphicsItem::updateBoundingRectAndShape() noexcept
 {
     prepareGeometryChange();
-    mShape = Toolbox::shapeFromPath(mPainterPath, mPen);
-    mBoundingRect = mShape.controlPointRect();
+    // the bounding rect is calculated directly from the (unstroked) path because
+    // stroking it just to get its bounds would be expensive (see #shape())
+    qreal margin = mPen.widthF() / qreal(2);
+    mBoundingRect = mPainterPath.controlPointRect().adjusted(-margin, -margin, margin, margin);
+    mShapeDirty = true;
     update();
 }
 
@@ -69,7 +69,7 @@ class PrimitivePathGraphicsItem : public QGraphicsItem, public IF_GraphicsLayerO
 
         // Inherited from QGraphicsItem
         QRectF boundingRect() const noexcept override {return mBoundingRect;}
-        QPainterPath shape() const noexcept override {return mShape;}
+        QPainterPath shape() const noexcept override;
         void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget = 0) noexcept override;
 
         // Operator Overloadings
@@ -91,7 +91,8 @@ class PrimitivePathGraphicsItem : public QGraphicsItem, public IF_GraphicsLayerO
         QBrush mBrushHighlighted;
         QPainterPath mPainterPath;
         QRectF mBoundingRect;
-        QPainterPath mShape;
+        mutable QPainterPath mShape; ///< lazily stroked from #mPainterPath, see #shape()
+        mutable bool mShapeDirty;
 };
 
 /*****************************************************************************************
@@ -34,14 +34,16 @@ namespace librepcb {
  ****************************************************************************************/
 
 PrimitiveTextGraphicsItem::PrimitiveTextGraphicsItem(QGraphicsItem* parent) noexcept :
-    QGraphicsItem(parent), mLayer(nullptr), mAlignment(HAlign::left(), VAlign::bottom()),
-    mTextFlags(0)
+    QGraphicsItem(parent), mLayer(nullptr), mAlignment(HAlign::left(), VAlign::bottom())
 {
     mFont.setStyleStrategy(QFont::StyleStrategy(QFont::OpenGLCompatible | QFont::PreferQuality));
     mFont.setStyleHint(QFont::SansSerif);
     mFont.setFamily("Nimbus Sans L");
     mFont.setPixelSize(1);
 
+    mStaticText.setTextFormat(Qt::PlainText);
+    mStaticText.setPerformanceHint(QStaticText::AggressiveCaching);
+
     updateBoundingRectAndShape();
     setVisible(false);
 }
@@ -170,14 +172,10 @@ void PrimitiveTextGraphicsItem::paint(QPainter* painter, const QStyleOptionGraph
     if (mapToScene(0, 1).y() < mapToScene(0, 0).y()) {
         // The text needs to be rotated 180°!
         // TODO: Is there a better solution to determine the overall rotation of the item?
-        //painter->save();
         painter->rotate(180);
         painter->translate(-mBoundingRect.topLeft() - mBoundingRect.bottomRight());
-        painter->drawText(QRectF(), mTextFlags, mText);
-        //painter->restore();
-    } else {
-        painter->drawText(QRectF(), mTextFlags, mText);
     }
+    painter->drawStaticText(mTextOrigin, mStaticText);
 }
 
 /*****************************************************************************************
@@ -187,9 +185,31 @@ void PrimitiveTextGraphicsItem::paint(QPainter* painter, const QStyleOptionGraph
 void PrimitiveTextGraphicsItem::updateBoundingRectAndShape() noexcept
 {
     prepareGeometryChange();
-    mTextFlags = Qt::TextDontClip | mAlignment.toQtAlign();
-    QFontMetricsF fm(mFont);
-    mBoundingRect = fm.boundingRect(QRectF(), mTextFlags, mText);
+
+    // update the cached text layout (this does the expensive font shaping, so it
+    // must not be done in paint())
+    mStaticText.setText(mText);
+    mStaticText.prepare(QTransform(), mFont);
+
+    // QStaticText is always drawn from its top left corner, so the alignment
+    // needs to be applied manually
+    QSizeF size = mStaticText.size();
+    Qt::Alignment align = mAlignment.toQtAlign();
+    qreal x = 0;
+    if (align & Qt::AlignHCenter) {
+        x = -size.width() / 2;
+    } else if (align & Qt::AlignRight) {
+        x = -size.width();
+    }
+    qreal y = 0;
+    if (align & Qt::AlignVCenter) {
+        y = -size.height() / 2;
+    } else if (align & Qt::AlignBottom) {
+        y = -size.height();
+    }
+    mTextOrigin = QPointF(x, y);
+
+    mBoundingRect = QRectF(mTextOrigin, size);
     mShape = QPainterPath();
     mShape.addRect(mBoundingRect);
     update();
@@ -41,7 +41,8 @@ namespace librepcb {
 /**
  * @brief The PrimitiveTextGraphicsItem class is the graphical representation of a text
  *
- * @todo Would QStaticText improve the performance?
+ * The text layout is cached in a QStaticText, so the expensive font shaping is done
+ * only when the text, font or alignment changes instead of on every repaint.
  *
  * @author ubruhin
  * @date 2017-05-28
@@ -94,7 +95,8 @@ class PrimitiveTextGraphicsItem : public QGraphicsItem, public IF_GraphicsLayerO
         QFont mFont;
         QPen mPen;
         QPen mPenHighlighted;
-        int mTextFlags;
+        QStaticText mStaticText;    ///< cached text layout (glyph runs)
+        QPointF mTextOrigin;        ///< where the static text gets drawn (alignment)
         QRectF mBoundingRect;
         QPainterPath mShape;
 };
@@ -57,6 +57,20 @@ int IF_AttributeProvider::replaceVariablesWithAttributes(QString& rawText, bool
     return count;
 }
 
+QString IF_AttributeProvider::substituteVariables(const QString& rawText,
+                                                  bool passToParents) const noexcept
+{
+    QString key = (passToParents ? QLatin1Char('1') : QLatin1Char('0')) % rawText;
+    auto it = mSubstitutionCache.constFind(key);
+    if (it != mSubstitutionCache.constEnd()) {
+        return *it;
+    }
+    QString text = rawText;
+    replaceVariablesWithAttributes(text, passToParents);
+    mSubstitutionCache.insert(key, text);
+    return text;
+}
+
 bool IF_AttributeProvider::searchVariableInText(const QString& text, int startPos, int& pos,
                                                 int& length, QString& varNS, QString& varName) noexcept
 {
@@ -93,6 +93,28 @@ class IF_AttributeProvider
          */
         int replaceVariablesWithAttributes(QString& rawText, bool passToParents) const noexcept;
 
+        /**
+         * @brief Memoized version of #replaceVariablesWithAttributes()
+         *
+         * The substituted text is cached in a per-provider hash, so repeated
+         * substitutions of the same raw text (e.g. on every repaint of a text item)
+         * cost only a hash lookup. The owner of the provider must call
+         * #invalidateAttributeCache() whenever the value of any attribute which can be
+         * fetched with #getAttributeValue() has changed (including attributes of the
+         * parent providers).
+         *
+         * @param rawText           A text which can contain variables ("${NS::KEY}")
+         * @param passToParents     See #replaceVariablesWithAttributes()
+         *
+         * @return The text with all variables replaced by their attribute values
+         */
+        QString substituteVariables(const QString& rawText, bool passToParents) const noexcept;
+
+        /**
+         * @brief Drop all cached substitution results (see #substituteVariables())
+         */
+        void invalidateAttributeCache() const noexcept {mSubstitutionCache.clear();}
+
         /**
          * @brief Get the value of an attribute which can be used in texts (like "${CMP::NAME}")
          *
@@ -151,6 +173,12 @@ class IF_AttributeProvider
          */
         static bool searchVariableInText(const QString& text, int startPos, int& pos,
                                          int& length, QString& varNS, QString& varName) noexcept;
+
+
+        // Attributes
+
+        /// cached substitution results (key: passToParents flag + raw text)
+        mutable QHash<QString, QString> mSubstitutionCache;
 };
 
 /*****************************************************************************************
@@ -0,0 +1,175 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_MEMORYPOOL_H
+#define LIBREPCB_MEMORYPOOL_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <type_traits>
+#include "memorystats.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Class MemoryPool
+ ****************************************************************************************/
+
+/**
+ * @brief The MemoryPool class is a simple freelist-based pool allocator for one type
+ *
+ * The pool hands out fixed-size memory slots for objects of type T. Slots are carved
+ * out of larger chunks which are allocated on demand, and deallocated slots go to a
+ * freelist for immediate reuse. This makes allocation/deallocation of many small
+ * objects (e.g. the netpoints/netlines of a board) much cheaper than individual heap
+ * allocations, and consecutively allocated objects end up close together in memory,
+ * which improves cache locality when iterating over them.
+ *
+ * Typical usage is to give a (final!) class pool-backed class-level allocation
+ * operators:
+ *
+ * @code
+ * void* MyItem::operator new(std::size_t size) {
+ *     Q_ASSERT(size == sizeof(MyItem));
+ *     return pool().allocate();
+ * }
+ * void MyItem::operator delete(void* p) noexcept {
+ *     pool().deallocate(p);
+ * }
+ * @endcode
+ *
+ * @note The pool is not thread-safe. All objects of the pooled type must be created
+ *       and destroyed on the same thread (for board/schematic items this is always
+ *       the main thread anyway).
+ *
+ * @note Chunks are only released when the pool itself is destroyed. This is
+ *       intentional: undo/redo and paste operations destroy and recreate the same
+ *       amount of items over and over again, so the memory is reused shortly after.
+ */
+template <typename T>
+class MemoryPool final
+{
+    public:
+
+        // Constructors / Destructor
+        MemoryPool(const MemoryPool& other) = delete;
+
+        /**
+         * @param slotsPerChunk Count of slots to allocate per chunk
+         * @param statsName     If not nullptr, the pool reports its live bytes and
+         *                      slot counts under this name in the
+         *                      librepcb#MemoryStatsRegistry (pools with a name must
+         *                      live until the process exits, like the static
+         *                      per-item-type pools do)
+         */
+        explicit MemoryPool(int slotsPerChunk = 256, const char* statsName = nullptr) noexcept :
+            mSlotsPerChunk(slotsPerChunk), mNextFreeSlot(nullptr), mAllocatedSlots(0)
+        {
+            Q_ASSERT(slotsPerChunk > 0);
+            if (statsName) {
+                MemoryStatsRegistry::registerProvider(QString::fromUtf8(statsName),
+                    [this]() {
+                        return qMakePair(
+                            qint64(mChunks.count()) * mSlotsPerChunk * qint64(sizeof(Slot)),
+                            qint64(mAllocatedSlots));
+                    });
+            }
+        }
+
+        ~MemoryPool() noexcept
+        {
+            foreach (Slot* chunk, mChunks) {
+                delete[] chunk;
+            }
+        }
+
+        // General Methods
+
+        /**
+         * @brief Allocate one (uninitialized) slot of sizeof(T) bytes
+         *
+         * @return Pointer to the slot (never nullptr)
+         *
+         * @throw std::bad_alloc if a new chunk could not be allocated
+         */
+        void* allocate()
+        {
+            if (!mNextFreeSlot) {
+                // all slots in use --> allocate a new chunk and put its slots on the
+                // freelist (in reverse order, so they are handed out front-to-back)
+                Slot* chunk = new Slot[mSlotsPerChunk];
+                mChunks.append(chunk);
+                for (int i = mSlotsPerChunk - 1; i >= 0; --i) {
+                    chunk[i].next = mNextFreeSlot;
+                    mNextFreeSlot = &chunk[i];
+                }
+            }
+            Slot* slot = mNextFreeSlot;
+            mNextFreeSlot = slot->next;
+            mAllocatedSlots++;
+            return slot;
+        }
+
+        /**
+         * @brief Return a slot obtained from #allocate() to the pool
+         *
+         * @param ptr   The slot to deallocate (nullptr is ignored)
+         */
+        void deallocate(void* ptr) noexcept
+        {
+            if (!ptr) return;
+            Slot* slot = static_cast<Slot*>(ptr);
+            slot->next = mNextFreeSlot;
+            mNextFreeSlot = slot;
+            mAllocatedSlots--;
+        }
+
+        // Operator Overloadings
+        MemoryPool& operator=(const MemoryPool& rhs) = delete;
+
+
+    private:
+
+        // Private Types
+
+        /// A memory slot: holds either an object of type T or the freelist link
+        union Slot {
+            Slot* next; ///< next free slot (only valid while the slot is unused)
+            typename std::aligned_storage<sizeof(T), alignof(T)>::type storage;
+        };
+
+        // Attributes
+        int mSlotsPerChunk; ///< count of slots to allocate per chunk
+        int mAllocatedSlots; ///< count of slots currently in use (for statistics)
+        Slot* mNextFreeSlot; ///< head of the freelist (nullptr = pool exhausted)
+        QVector<Slot*> mChunks; ///< all allocated chunks (for cleanup)
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_MEMORYPOOL_H
@@ -0,0 +1,100 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "memorystats.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Static Helpers
+ ****************************************************************************************/
+
+namespace {
+
+QMutex& registryMutex() noexcept
+{
+    static QMutex mutex;
+    return mutex;
+}
+
+QMap<QString, MemoryStatsRegistry::Provider>& registry() noexcept
+{
+    static QMap<QString, MemoryStatsRegistry::Provider> providers;
+    return providers;
+}
+
+} // namespace
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+void MemoryStatsRegistry::registerProvider(const QString& name, Provider provider) noexcept
+{
+    QMutexLocker lock(&registryMutex());
+    registry().insert(name, provider);
+}
+
+void MemoryStatsRegistry::unregisterProvider(const QString& name) noexcept
+{
+    QMutexLocker lock(&registryMutex());
+    registry().remove(name);
+}
+
+QString MemoryStatsRegistry::dump() noexcept
+{
+    // snapshot the providers first, then call them without holding the lock (a
+    // provider may itself lock its subsystem's mutex)
+    QMap<QString, Provider> providers;
+    {
+        QMutexLocker lock(&registryMutex());
+        providers = registry();
+    }
+
+    QMultiMap<qint64, QString> linesByBytes; // sorted ascending by byte count
+    foreach (const QString& name, providers.keys()) {
+        QPair<qint64, qint64> stats = providers.value(name)();
+        linesByBytes.insert(stats.first, QString("%1\t%2\t%3")
+                            .arg(name).arg(stats.first).arg(stats.second));
+    }
+
+    QStringList lines;
+    foreach (const QString& line, linesByBytes) {
+        lines.prepend(line); // biggest consumer first
+    }
+    return lines.join('\n');
+}
+
+void MemoryStatsRegistry::dumpToLog() noexcept
+{
+    qDebug().noquote() << "Memory statistics (name, bytes, count):\n" << dump();
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
@@ -0,0 +1,76 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_MEMORYSTATS_H
+#define LIBREPCB_MEMORYSTATS_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <functional>
+#include <QtCore>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Class MemoryStatsRegistry
+ ****************************************************************************************/
+
+/**
+ * @brief Process-wide registry of per-subsystem memory statistics
+ *
+ * Long sessions can grow to gigabytes without any way to attribute the memory. Every
+ * instrumented subsystem (allocation pools, caches, ...) registers a provider which
+ * reports its current live byte count and object/slot count; #dump() returns a
+ * machine-readable snapshot ("name<TAB>bytes<TAB>count" per line) and #dumpToLog()
+ * writes it to the log. Thread-safe; providers must be thread-safe themselves (they
+ * may be called from whatever thread requests the dump).
+ */
+class MemoryStatsRegistry final
+{
+    public:
+
+        /// Provider callback: returns (live bytes, live object/slot count)
+        typedef std::function<QPair<qint64, qint64>()> Provider;
+
+        MemoryStatsRegistry() = delete;
+
+        /// @brief Register (or replace) a named statistics provider
+        static void registerProvider(const QString& name, Provider provider) noexcept;
+
+        /// @brief Remove a provider (must be called before its subsystem dies)
+        static void unregisterProvider(const QString& name) noexcept;
+
+        /// @brief Get a machine-readable snapshot of all providers, sorted by bytes
+        static QString dump() noexcept;
+
+        /// @brief Write #dump() to the debug log
+        static void dumpToLog() noexcept;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_MEMORYSTATS_H
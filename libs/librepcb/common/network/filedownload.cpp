@@ -84,12 +84,36 @@ void FileDownload::prepareRequest()
         }
     }
 
-    // open temporary destination file
-    mFile.reset(new QSaveFile(mDestination.toStr(), this));
-    if (!mFile->open(QIODevice::WriteOnly)) {
+    // open the partial destination file; if it contains data from a previously
+    // aborted attempt, resume the download with an HTTP range request so only
+    // the missing tail is fetched again
+    mFile.reset(new QFile(mDestination.toStr() % ".part", this));
+    mResumedFrom = mFile->exists() ? mFile->size() : 0;
+    mRangeStatusChecked = false;
+    if (!mFile->open((mResumedFrom > 0) ? QIODevice::ReadWrite : QIODevice::WriteOnly)) {
         throw RuntimeError(__FILE__, __LINE__,
             QString("Could not open file \"%1\": %2")
-            .arg(mDestination.toNative(), mFile->errorString()));
+            .arg(mFile->fileName(), mFile->errorString()));
+    }
+
+    // the checksum is calculated incrementally while the bytes arrive, so the
+    // downloaded file does not need to be read back for verification afterwards
+    if (!mExpectedChecksum.isEmpty()) {
+        mHash.reset(new QCryptographicHash(mHashAlgorithm));
+    }
+
+    if (mResumedFrom > 0) {
+        // feed the already-downloaded bytes into the checksum (local disk, fast),
+        // then continue writing at the end of the partial file
+        while (mHash && (!mFile->atEnd())) {
+            mHash->addData(mFile->read(1024 * 1024));
+        }
+        mFile->seek(mResumedFrom);
+        mRequest.setRawHeader("Range", "bytes=" % QByteArray::number(mResumedFrom) % "-");
+        qDebug() << "Resume download of" << mDestination.toNative()
+                 << "at byte" << mResumedFrom;
+    } else {
+        mRequest.setRawHeader("Range", QByteArray()); // remove a stale range header
     }
 }
 
@@ -102,8 +126,9 @@ void FileDownload::finalizeRequest()
             .arg(mDestination.toNative()));
     }
 
-    // save to destination file
-    if (!mFile->commit()) {
+    // move the completed partial file to the destination
+    mFile->close();
+    if (!QFile::rename(mFile->fileName(), mDestination.toStr())) {
         throw RuntimeError(__FILE__, __LINE__,
             QString(tr("Error while writing file \"%1\": %2"))
             .arg(mDestination.toNative(), mFile->errorString()));
@@ -112,18 +137,11 @@ void FileDownload::finalizeRequest()
     // if an error occurs below this line, remove the downloaded file
     auto sg = scopeGuard([this](){QFile::remove(mDestination.toStr());});
 
-    // verify checksum of downloaded file
+    // verify checksum of downloaded file (calculated while the bytes arrived)
     if (!mExpectedChecksum.isEmpty()) {
         emit progressState(tr("Verify checksum..."));
-        QFile file(mDestination.toStr());
-        if (!file.open(QFile::ReadOnly)) {
-            throw RuntimeError(__FILE__, __LINE__,
-                QString(tr("Error while readback file \"%1\": %2"))
-                .arg(mDestination.toNative(), file.errorString()));
-        }
-        QCryptographicHash hash(mHashAlgorithm);
-        hash.addData(&file);
-        QString result = hash.result().toHex();
+        Q_ASSERT(mHash);
+        QString result = mHash->result().toHex();
         QString expected = mExpectedChecksum.toHex();
         if (result != expected) {
             qDebug() << "expected" << expected << "but got" << result;
@@ -160,7 +178,26 @@ void FileDownload::emitSuccessfullyFinishedSignals() noexcept
 
 void FileDownload::fetchNewData() noexcept
 {
-    mFile->write(mReply->readAll());
+    if (!mRangeStatusChecked) {
+        mRangeStatusChecked = true;
+        int status = mReply->attribute(QNetworkRequest::HttpStatusCodeAttribute).toInt();
+        if ((mResumedFrom > 0) && (status != 206)) {
+            // the server ignored the range request and sends the whole file, so
+            // the partially downloaded data must be discarded
+            qDebug() << "Server does not support resuming, restarting from zero.";
+            mFile->resize(0);
+            mFile->seek(0);
+            if (mHash) {
+                mHash.reset(new QCryptographicHash(mHashAlgorithm));
+            }
+            mResumedFrom = 0;
+        }
+    }
+    QByteArray data = mReply->readAll();
+    if (mHash) {
+        mHash->addData(data);
+    }
+    mFile->write(data);
 }
 
 /*****************************************************************************************
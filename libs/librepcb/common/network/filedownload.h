@@ -126,9 +126,12 @@ class FileDownload final : public NetworkRequestBase
     private: // Data
 
         FilePath mDestination;
-        QScopedPointer<QSaveFile> mFile;
+        QScopedPointer<QFile> mFile; ///< the partial file "<destination>.part"
+        qint64 mResumedFrom = 0; ///< byte offset of a resumed download (0 = full)
+        bool mRangeStatusChecked = false; ///< whether the 206/200 check was done
         QCryptographicHash::Algorithm mHashAlgorithm;
         QByteArray mExpectedChecksum;
+        QScopedPointer<QCryptographicHash> mHash; ///< updated while bytes arrive
         FilePath mExtractZipToDir;
 
 };
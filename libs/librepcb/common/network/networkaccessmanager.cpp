@@ -23,6 +23,7 @@
 #include <QtCore>
 #include <QtNetwork>
 #include "networkaccessmanager.h"
+#include "networkrequestbase.h"
 #include "../exceptions.h"
 
 /*****************************************************************************************
@@ -40,7 +41,8 @@ NetworkAccessManager* NetworkAccessManager::sInstance = nullptr;
  ****************************************************************************************/
 
 NetworkAccessManager::NetworkAccessManager() noexcept :
-    QThread(nullptr), mThreadStartSemaphore(0), mManager(nullptr)
+    QThread(nullptr), mThreadStartSemaphore(0), mManager(nullptr),
+    mMaxConcurrentRequests(6)
 {
     // This thread must only be started once, and from within the main application thread!
     Q_ASSERT(QThread::currentThread() == qApp->thread());
@@ -51,6 +53,10 @@ NetworkAccessManager::NetworkAccessManager() noexcept :
     connect(qApp, &QCoreApplication::aboutToQuit,
             this, &NetworkAccessManager::stop, Qt::DirectConnection);
 
+    // let queued method invocations on this object (e.g. preconnectInThread())
+    // be executed in the network thread instead of the main thread
+    moveToThread(this);
+
     // start the thread and wait until the thread is started successfully
     start();
     mThreadStartSemaphore.acquire();
@@ -63,6 +69,15 @@ NetworkAccessManager::~NetworkAccessManager() noexcept
     sInstance = nullptr;
 }
 
+/*****************************************************************************************
+ *  Setters
+ ****************************************************************************************/
+
+void NetworkAccessManager::setMaxConcurrentRequests(int count) noexcept
+{
+    mMaxConcurrentRequests.store(qMax(count, 1));
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -79,6 +94,45 @@ QNetworkReply* NetworkAccessManager::get(const QNetworkRequest& request) noexcep
     }
 }
 
+void NetworkAccessManager::preconnect(const QUrl& url) noexcept
+{
+    QMetaObject::invokeMethod(this, "preconnectInThread", Qt::QueuedConnection,
+                              Q_ARG(QUrl, url));
+}
+
+bool NetworkAccessManager::tryStartRequest(NetworkRequestBase& request) noexcept
+{
+    Q_ASSERT(QThread::currentThread() == this);
+    if (mRunningRequests.contains(&request)) {
+        return true; // the request is already running (e.g. following a redirection)
+    }
+    if (mRunningRequests.count() >= mMaxConcurrentRequests.load()) {
+        QPointer<NetworkRequestBase> ptr(&request);
+        if (!mPendingRequests.contains(ptr)) {
+            mPendingRequests.append(ptr);
+        }
+        return false;
+    }
+    mRunningRequests.insert(&request);
+    return true;
+}
+
+void NetworkAccessManager::requestFinished(NetworkRequestBase& request) noexcept
+{
+    Q_ASSERT(QThread::currentThread() == this);
+    mRunningRequests.remove(&request);
+    mPendingRequests.removeAll(QPointer<NetworkRequestBase>(&request));
+    while ((!mPendingRequests.isEmpty())
+           && (mRunningRequests.count() < mMaxConcurrentRequests.load()))
+    {
+        QPointer<NetworkRequestBase> next = mPendingRequests.takeFirst();
+        if (next) {
+            mRunningRequests.insert(next.data());
+            QMetaObject::invokeMethod(next.data(), "executeRequest", Qt::QueuedConnection);
+        }
+    }
+}
+
 /*****************************************************************************************
  *  Static Methods
  ****************************************************************************************/
@@ -92,6 +146,26 @@ NetworkAccessManager* NetworkAccessManager::instance() noexcept
  *  Private Methods
  ****************************************************************************************/
 
+void NetworkAccessManager::preconnectInThread(const QUrl& url) noexcept
+{
+    Q_ASSERT(QThread::currentThread() == this);
+    if ((!mManager) || (!url.isValid()) || url.host().isEmpty()) {
+        return;
+    }
+    // only connect once per host and session - afterwards the keep-alive
+    // connections of QNetworkAccessManager are reused anyway
+    QString key = url.scheme() % "://" % url.host() % ":" % QString::number(url.port(-1));
+    if (mPreconnectedHosts.contains(key)) {
+        return;
+    }
+    mPreconnectedHosts.insert(key);
+    if (url.scheme() == "https") {
+        mManager->connectToHostEncrypted(url.host(), url.port(443));
+    } else {
+        mManager->connectToHost(url.host(), url.port(80));
+    }
+}
+
 void NetworkAccessManager::run() noexcept
 {
     Q_ASSERT(QThread::currentThread() == this);
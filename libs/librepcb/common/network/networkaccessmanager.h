@@ -32,6 +32,8 @@
  ****************************************************************************************/
 namespace librepcb {
 
+class NetworkRequestBase;
+
 /*****************************************************************************************
  *  Class NetworkAccessManager
  ****************************************************************************************/
@@ -64,9 +66,59 @@ class NetworkAccessManager final : public QThread
         NetworkAccessManager(const NetworkAccessManager& other) = delete;
         ~NetworkAccessManager() noexcept;
 
+        // Setters
+
+        /**
+         * @brief Set the maximum count of requests which are executed simultaneously
+         *
+         * Additional requests are queued and started as soon as a running request has
+         * finished. This method is thread-safe.
+         *
+         * @param count     Maximum count of concurrently executed requests (>= 1)
+         */
+        void setMaxConcurrentRequests(int count) noexcept;
+
         // General Methods
         QNetworkReply* get(const QNetworkRequest& request) noexcept;
 
+        /**
+         * @brief Open the (encrypted) connection to a host before the first request
+         *
+         * Establishing a TCP connection and performing the TLS handshake takes one
+         * resp. several round trips. When the caller knows that a burst of requests
+         * to some host is imminent (e.g. fetching a paginated library list), calling
+         * this method first hides that latency behind the caller's own preparations.
+         * The opened connection is kept alive and reused by subsequent requests.
+         * This method is thread-safe and just a hint - errors are silently ignored.
+         *
+         * @param url   URL of the host to connect to (only scheme/host/port are used)
+         */
+        void preconnect(const QUrl& url) noexcept;
+
+        /**
+         * @brief Ask for permission to execute a network request
+         *
+         * If the maximum count of concurrent requests is already reached, the request
+         * is appended to a queue and false is returned. The network access manager will
+         * then start the request automatically as soon as a slot gets free.
+         *
+         * @warning This method must only be called from within the network thread!
+         *
+         * @param request   The request which wants to start
+         *
+         * @return True if the request is allowed to start now, false if it was queued
+         */
+        bool tryStartRequest(NetworkRequestBase& request) noexcept;
+
+        /**
+         * @brief Notify about a finished request to start the next queued request
+         *
+         * @warning This method must only be called from within the network thread!
+         *
+         * @param request   The request which has finished (or was aborted while queued)
+         */
+        void requestFinished(NetworkRequestBase& request) noexcept;
+
         // Operator Overloadings
         NetworkAccessManager& operator=(const NetworkAccessManager& rhs) = delete;
 
@@ -76,6 +128,7 @@ class NetworkAccessManager final : public QThread
 
     private: // Methods
 
+        Q_INVOKABLE void preconnectInThread(const QUrl& url) noexcept;
         void run() noexcept override;
         void stop() noexcept;
 
@@ -84,6 +137,10 @@ class NetworkAccessManager final : public QThread
 
         QSemaphore mThreadStartSemaphore;
         QNetworkAccessManager* mManager;
+        QAtomicInt mMaxConcurrentRequests;
+        QSet<QString> mPreconnectedHosts; ///< access only from network thread!
+        QSet<NetworkRequestBase*> mRunningRequests; ///< access only from network thread!
+        QList<QPointer<NetworkRequestBase>> mPendingRequests; ///< access only from network thread!
         static NetworkAccessManager* sInstance;
 };
 
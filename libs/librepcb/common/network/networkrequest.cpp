@@ -60,6 +60,7 @@ void NetworkRequest::finalizeRequest()
 
 void NetworkRequest::emitSuccessfullyFinishedSignals() noexcept
 {
+    emit etagReceived(mReply->rawHeader("ETag"));
     emit dataReceived(mReceivedData);
 }
 
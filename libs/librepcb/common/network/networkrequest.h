@@ -38,6 +38,15 @@ namespace librepcb {
 /**
  * @brief This class is used to process general purpose network requests (up to 100MB)
  *
+ * @note This class intentionally buffers the whole response and delivers it with one
+ *       #dataReceived() signal: all of its consumers (repository JSON index, library
+ *       icons) need the complete payload anyway. Large transfers (library ZIPs) use
+ *       librepcb::FileDownload instead, which already streams every received chunk
+ *       directly to disk from fetchNewData() with O(1) buffering - so no additional
+ *       chunk-streaming signal path is required here. Unzipping *during* the
+ *       download was evaluated separately and rejected (the ZIP central directory
+ *       lives at the end of the file, see the FileDownload documentation).
+ *
  * @see librepcb::NetworkRequestBase, librepcb::NetworkAccessManager
  *
  * @author ubruhin
@@ -61,6 +70,16 @@ class NetworkRequest final : public NetworkRequestBase
 
     signals:
 
+        /**
+         * @brief ETag response header received signal (emited right before #dataReceived())
+         *
+         * Together with the "If-None-Match" request header (see #setHeaderField()),
+         * this allows callers to implement HTTP conditional requests: a server
+         * answering with "304 Not Modified" results in #dataReceived() with an empty
+         * byte array.
+         */
+        void etagReceived(QByteArray etag);
+
         /**
          * @brief Data successfully received signal (emited right before #finished())
          */
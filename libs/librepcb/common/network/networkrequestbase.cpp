@@ -21,6 +21,7 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <QtConcurrent/QtConcurrent>
 #include "networkrequestbase.h"
 #include "networkaccessmanager.h"
 
@@ -43,14 +44,26 @@ NetworkRequestBase::NetworkRequestBase(const QUrl& url) noexcept :
     mRequest.setHeader(QNetworkRequest::UserAgentHeader, QString("%1/%2").arg(
                        qApp->applicationName(), qApp->applicationVersion()));
 
+    // all requests issued through this class are GETs, so they may be pipelined
+    // on a shared keep-alive connection to reduce the round trips of API bursts
+    mRequest.setAttribute(QNetworkRequest::HttpPipeliningAllowedAttribute, true);
+#if QT_VERSION >= QT_VERSION_CHECK(5, 3, 0)
+    mRequest.setAttribute(QNetworkRequest::SpdyAllowedAttribute, true);
+#endif
+
     // create queued connection to let executeRequest() execute in download thread
     connect(this, &NetworkRequestBase::startRequested,
             this, &NetworkRequestBase::executeRequest,
             Qt::QueuedConnection);
+
+    // get notified when the finalization task in the thread pool has finished
+    connect(&mFinalizeWatcher, &QFutureWatcher<QString>::finished,
+            this, &NetworkRequestBase::finalizeTaskFinished);
 }
 
 NetworkRequestBase::~NetworkRequestBase() noexcept
 {
+    mFinalizeWatcher.waitForFinished(); // the finalization task accesses this object!
     if (mStarted) {
         Q_ASSERT(QThread::currentThread() == NetworkAccessManager::instance());
     } else {
@@ -98,6 +111,10 @@ void NetworkRequestBase::abort() noexcept
         emit progressState(tr("Abort request..."));
         mAborted = true;
         mReply->abort();
+    } else if (mStarted && (!mFinished)) {
+        // the request is still waiting in the queue of the network access manager
+        mAborted = true;
+        finalize(tr("Network request aborted."));
     }
 }
 
@@ -109,6 +126,11 @@ void NetworkRequestBase::executeRequest() noexcept
 {
     Q_ASSERT(QThread::currentThread() == NetworkAccessManager::instance());
 
+    // do nothing if the request was already aborted while waiting in the queue
+    if (mAborted || mFinished) {
+        return;
+    }
+
     emit progressState(tr("Request started..."));
 
     // get network access manager object
@@ -118,6 +140,13 @@ void NetworkRequestBase::executeRequest() noexcept
         return;
     }
 
+    // respect the maximum count of concurrent requests - if it is reached, this
+    // request gets queued and started again by the network access manager later
+    if (!nam->tryStartRequest(*this)) {
+        emit progressState(tr("Request queued..."));
+        return;
+    }
+
     // prepare request
     try {
         prepareRequest(); // can throw
@@ -226,22 +255,40 @@ void NetworkRequestBase::replyFinishedSlot() noexcept
         return;
     }
 
-    // finalize download
+    // finalize download (e.g. checksum verification and ZIP extraction) in the global
+    // thread pool, so this thread can continue processing other downloads meanwhile
+    emit progressState(tr("Finalize request..."));
+    mFinalizeWatcher.setFuture(QtConcurrent::run(
+        this, &NetworkRequestBase::runFinalizeRequest));
+}
+
+void NetworkRequestBase::finalizeTaskFinished() noexcept
+{
+    Q_ASSERT(QThread::currentThread() == NetworkAccessManager::instance());
+    finalize(mFinalizeWatcher.result()); // a null string means success
+}
+
+QString NetworkRequestBase::runFinalizeRequest() noexcept
+{
+    // note: this method is executed in a thread of the global thread pool!
     try {
         finalizeRequest(); // can throw
+        return QString();
     } catch (const Exception& e) {
-        finalize(e.getMsg());
-        return;
+        return e.getMsg();
     }
-
-    // download successfully finished!
-    finalize();
 }
 
 void NetworkRequestBase::finalize(const QString& errorMsg) noexcept
 {
     Q_ASSERT(QThread::currentThread() == NetworkAccessManager::instance());
 
+    // release the occupied request slot to let the next queued request start
+    NetworkAccessManager* nam = NetworkAccessManager::instance();
+    if (nam && mStarted) {
+        nam->requestFinished(*this);
+    }
+
     if (errorMsg.isNull()) {
         qDebug() << "Request successfully finished:" << mUrl.toString();
         emit progressState(tr("Request successfully finished."));
@@ -182,9 +182,15 @@ class NetworkRequestBase : public QObject
         virtual void fetchNewData() noexcept = 0;
 
 
-    private: // Methods
+    private slots:
 
         void executeRequest() noexcept;
+        void finalizeTaskFinished() noexcept;
+
+
+    private: // Methods
+
+        QString runFinalizeRequest() noexcept;
         void replyReadyReadSlot() noexcept;
         void replyErrorSlot(QNetworkReply::NetworkError code) noexcept;
         void replySslErrorsSlot(const QList<QSslError>& errors) noexcept;
@@ -204,6 +210,7 @@ class NetworkRequestBase : public QObject
         QList<QUrl> mRedirectedUrls;
         QNetworkRequest mRequest;
         QScopedPointer<QNetworkReply> mReply;
+        QFutureWatcher<QString> mFinalizeWatcher;
         bool mStarted;
         bool mAborted;
         bool mErrored;
@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "repository.h"
+#include "network/networkaccessmanager.h"
 #include "network/networkrequest.h"
 
 /*****************************************************************************************
@@ -73,6 +74,11 @@ bool Repository::setUrl(const QUrl& url) noexcept
 
 void Repository::requestLibraryList() const noexcept
 {
+    // hide the TCP/TLS connection setup latency behind the request preparation -
+    // the following (possibly paginated) API requests reuse that connection
+    if (NetworkAccessManager* nam = NetworkAccessManager::instance()) {
+        nam->preconnect(mUrl);
+    }
     requestLibraryList(QUrl(mUrl.toString() % "/api/v1/libraries"));
 }
 
@@ -92,14 +98,46 @@ void Repository::requestLibraryList(const QUrl& url) const noexcept
     NetworkRequest* request = new NetworkRequest(url);
     request->setHeaderField("Accept", "application/json;charset=UTF-8");
     request->setHeaderField("Accept-Charset", "UTF-8");
+
+    // if a cached index exists, ask the server to only send the data if it changed
+    // since then ("304 Not Modified" results in an empty response body)
+    QByteArray cachedETag;
+    readIndexCache(url, &cachedETag);
+    if (!cachedETag.isEmpty()) {
+        request->setHeaderField("If-None-Match", cachedETag);
+    }
+
     connect(request, &NetworkRequest::errored,
             this, &Repository::errorWhileFetchingLibraryList, Qt::QueuedConnection);
-    connect(request, &NetworkRequest::dataReceived,
-            this, &Repository::requestedDataReceived, Qt::QueuedConnection);
+    connect(request, &NetworkRequest::etagReceived, this,
+            [this, url](const QByteArray& etag){mPendingETags[url.toString()] = etag;},
+            Qt::QueuedConnection);
+    connect(request, &NetworkRequest::dataReceived, this,
+            [this, url](const QByteArray& data){requestedDataReceived(url, data);},
+            Qt::QueuedConnection);
     request->start();
 }
 
-void Repository::requestedDataReceived(const QByteArray& data) noexcept
+void Repository::requestedDataReceived(const QUrl& url, const QByteArray& data) const noexcept
+{
+    QByteArray etag = mPendingETags.take(url.toString());
+
+    if (data.isEmpty()) {
+        // the server answered with "304 Not Modified" --> use the cached index
+        QByteArray cachedData = readIndexCache(url, nullptr);
+        if (!cachedData.isEmpty()) {
+            qDebug() << "Repository index not modified, using cached index:"
+                     << url.toString();
+            processLibraryList(url, cachedData, QByteArray());
+            return;
+        }
+    }
+
+    processLibraryList(url, data, etag);
+}
+
+void Repository::processLibraryList(const QUrl& url, const QByteArray& data,
+                                    const QByteArray& etagToCache) const noexcept
 {
     QJsonDocument doc = QJsonDocument::fromJson(data);
     if (doc.isNull() || doc.isEmpty() || (!doc.isObject())) {
@@ -108,10 +146,10 @@ void Repository::requestedDataReceived(const QByteArray& data) noexcept
     }
     QJsonValue nextResultsLink = doc.object().value("next");
     if (nextResultsLink.isString()) {
-        QUrl url = QUrl(nextResultsLink.toString());
-        if (url.isValid()) {
-            qDebug() << "Request more results from repository:" << url.toString();
-            requestLibraryList(url);
+        QUrl nextUrl = QUrl(nextResultsLink.toString());
+        if (nextUrl.isValid()) {
+            qDebug() << "Request more results from repository:" << nextUrl.toString();
+            requestLibraryList(nextUrl);
         } else {
             qWarning() << "Invalid URL in received JSON object:" << nextResultsLink.toString();
         }
@@ -122,6 +160,10 @@ void Repository::requestedDataReceived(const QByteArray& data) noexcept
                                               "any results."));
         return;
     }
+    if (!etagToCache.isEmpty()) {
+        // the response was valid --> remember it for the next conditional request
+        writeIndexCache(url, etagToCache, data);
+    }
     emit libraryListReceived(reposVal.toArray());
 }
 
@@ -131,6 +173,55 @@ bool Repository::checkAttributesValidity() const noexcept
     return true;
 }
 
+FilePath Repository::getIndexCacheFilePath(const QUrl& url) noexcept
+{
+    QString cacheDir = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+    QString urlHash = QCryptographicHash::hash(url.toEncoded(),
+                                               QCryptographicHash::Sha256).toHex();
+    return FilePath(cacheDir).getPathTo("repository_index").getPathTo(urlHash % ".bin");
+}
+
+QByteArray Repository::readIndexCache(const QUrl& url, QByteArray* etag) noexcept
+{
+    QFile file(getIndexCacheFilePath(url).toStr());
+    if (!file.open(QIODevice::ReadOnly)) {
+        return QByteArray(); // not cached yet
+    }
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_2);
+    quint32 magic = 0;
+    quint16 version = 0;
+    QByteArray cachedETag;
+    QByteArray data;
+    stream >> magic >> version >> cachedETag >> data;
+    if ((stream.status() != QDataStream::Ok) || (magic != sIndexCacheMagic)
+        || (version != sIndexCacheVersion))
+    {
+        return QByteArray(); // corrupt or outdated cache file
+    }
+    if (etag) *etag = cachedETag;
+    return data;
+}
+
+void Repository::writeIndexCache(const QUrl& url, const QByteArray& etag,
+                                 const QByteArray& data) noexcept
+{
+    FilePath cacheFp = getIndexCacheFilePath(url);
+    if (!QDir().mkpath(cacheFp.getParentDir().toStr())) {
+        return; // errors are not fatal, the index is just fetched again next time
+    }
+    QSaveFile file(cacheFp.toStr());
+    if (!file.open(QIODevice::WriteOnly)) {
+        return;
+    }
+    QDataStream stream(&file);
+    stream.setVersion(QDataStream::Qt_5_2);
+    stream << sIndexCacheMagic << sIndexCacheVersion << etag << data;
+    if (stream.status() == QDataStream::Ok) {
+        file.commit();
+    }
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -24,6 +24,7 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include "../fileio/filepath.h"
 #include "../fileio/serializableobject.h"
 
 /*****************************************************************************************
@@ -80,13 +81,26 @@ class Repository final : public QObject, public SerializableObject
     private: // Methods
 
         void requestLibraryList(const QUrl& url) const noexcept;
-        void requestedDataReceived(const QByteArray& data) noexcept;
+        void requestedDataReceived(const QUrl& url, const QByteArray& data) const noexcept;
+        void processLibraryList(const QUrl& url, const QByteArray& data,
+                                const QByteArray& etagToCache) const noexcept;
         bool checkAttributesValidity() const noexcept;
+        static FilePath getIndexCacheFilePath(const QUrl& url) noexcept;
+        static QByteArray readIndexCache(const QUrl& url, QByteArray* etag) noexcept;
+        static void writeIndexCache(const QUrl& url, const QByteArray& etag,
+                                    const QByteArray& data) noexcept;
 
 
     private: // Data
 
         QUrl mUrl;
+
+        /// ETags of the currently running requests (received right before the data)
+        mutable QHash<QString, QByteArray> mPendingETags;
+
+        // Constants
+        static const quint32 sIndexCacheMagic = 0x4C505249; ///< "LPRI"
+        static const quint16 sIndexCacheVersion = 1;
 };
 
 /*****************************************************************************************
@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "sqlitedatabase.h"
+#include "tracer.h"
 #include "uuid.h"
 
 /*****************************************************************************************
@@ -92,6 +93,7 @@ SQLiteDatabase::SQLiteDatabase(const FilePath& filepath) :
 
 SQLiteDatabase::~SQLiteDatabase() noexcept
 {
+    mPreparedStatements.clear(); // must be destroyed before closing the database
     mDb.close();
 }
 
@@ -162,6 +164,16 @@ QSqlQuery SQLiteDatabase::prepareQuery(const QString& query) const
     return q;
 }
 
+QSqlQuery SQLiteDatabase::prepareCachedQuery(const QString& query)
+{
+    auto it = mPreparedStatements.find(query);
+    if (it == mPreparedStatements.end()) {
+        it = mPreparedStatements.insert(query, prepareQuery(query)); // can throw
+    }
+    it->finish(); // release the result set of the previous execution
+    return *it;
+}
+
 int SQLiteDatabase::insert(QSqlQuery& query)
 {
     exec(query); // can throw
@@ -178,7 +190,28 @@ int SQLiteDatabase::insert(QSqlQuery& query)
 
 void SQLiteDatabase::exec(QSqlQuery& query)
 {
-    if (!query.exec()) {
+    // time every query: fast queries only pay for reading a monotonic clock
+    // twice, slow queries are logged with statement and duration so reports
+    // about library database hotspots can name the exact query. The events are
+    // also recorded by the tracer (LIBREPCB_TRACE), which shows whether time
+    // was spent in SQLite itself or in the code around it.
+    QElapsedTimer timer;
+    timer.start();
+    bool success = query.exec();
+    qint64 durationUs = timer.nsecsElapsed() / 1000;
+
+    Tracer* tracer = Tracer::instance();
+    if (tracer->isEnabled()) {
+        tracer->addEvent("SQLiteDatabase::exec: " % query.lastQuery(),
+                         tracer->now() - durationUs, durationUs);
+    }
+    if (durationUs >= getSlowQueryThresholdUs()) {
+        int rows = query.numRowsAffected();
+        qWarning().nospace() << "Slow SQL query (" << (durationUs / 1000) << " ms, "
+                             << rows << " rows): " << query.lastQuery();
+    }
+
+    if (!success) {
         qDebug() << query.lastError().databaseText();
         qDebug() << query.lastError().driverText();
         throw RuntimeError(__FILE__, __LINE__,
@@ -196,6 +229,18 @@ void SQLiteDatabase::exec(const QString& query)
  *  Private Methods
  ****************************************************************************************/
 
+qint64 SQLiteDatabase::getSlowQueryThresholdUs() noexcept
+{
+    // configurable for debugging sessions; 50 ms by default so only queries a
+    // user can actually feel end up in the log
+    static const qint64 thresholdUs = []() -> qint64 {
+        bool ok = false;
+        qint64 ms = qgetenv("LIBREPCB_SLOW_QUERY_MS").toLongLong(&ok);
+        return (ok && (ms >= 0)) ? (ms * 1000) : (50 * 1000);
+    }();
+    return thresholdUs;
+}
+
 void SQLiteDatabase::enableSqliteWriteAheadLogging()
 {
     QSqlQuery query("PRAGMA journal_mode=WAL", mDb);
@@ -81,6 +81,26 @@ class SQLiteDatabase final : public QObject
 
         // General Methods
         QSqlQuery prepareQuery(const QString& query) const;
+
+        /**
+         * @brief Get a prepared query from the statement cache (prepare it on first use)
+         *
+         * Equivalent to #prepareQuery(), but the compiled statement is kept in a cache
+         * keyed by the SQL string, so executing the same query text many times (e.g.
+         * thousands of INSERTs during a library scan, or one search query per
+         * keystroke) does not re-prepare it from scratch every time.
+         *
+         * @warning The returned object shares the underlying statement with the cache,
+         *          so the same query text must not be in use twice at the same time.
+         *          With one connection per thread (a Qt requirement anyway) and the
+         *          strictly sequential usage pattern of this class, this is fulfilled.
+         *
+         * @param query     The SQL query text (with placeholders)
+         *
+         * @return The prepared query, ready for QSqlQuery#bindValue()
+         */
+        QSqlQuery prepareCachedQuery(const QString& query);
+
         int insert(QSqlQuery& query);
         void exec(QSqlQuery& query);
         void exec(const QString& query);
@@ -92,6 +112,10 @@ class SQLiteDatabase final : public QObject
 
     private: // Methods
 
+        /// threshold above which a query is logged as slow (default 50 ms,
+        /// configurable via the environment variable LIBREPCB_SLOW_QUERY_MS)
+        static qint64 getSlowQueryThresholdUs() noexcept;
+
         /**
          * @brief Enable the "Write-Ahead Logging" (WAL) featur of SQLite
          *
@@ -116,6 +140,7 @@ class SQLiteDatabase final : public QObject
     private: // Data
 
         QSqlDatabase mDb;
+        QHash<QString, QSqlQuery> mPreparedStatements; ///< cache for #prepareCachedQuery()
         //int mNestedTransactionCount;
 };
 
@@ -39,16 +39,126 @@ QPainterPath Toolbox::shapeFromPath(const QPainterPath &path, const QPen &pen) n
 
     if (path == QPainterPath() || pen == Qt::NoPen) {
         return path;
-    } else {
-        QPainterPathStroker ps;
-        ps.setCapStyle(pen.capStyle());
-        ps.setWidth(qMax(pen.widthF(), qreal(0.00000001)));
-        ps.setJoinStyle(pen.joinStyle());
-        ps.setMiterLimit(pen.miterLimit());
-        QPainterPath p = ps.createStroke(path);
-        p.addPath(path);
+    }
+
+    // analytic fast path for straight single-segment paths with round caps (the
+    // shape of every wire/trace hit-tested on hover), avoiding the stroker
+    if ((path.elementCount() == 2) && (pen.capStyle() == Qt::RoundCap)
+        && (path.elementAt(0).isMoveTo()) && (path.elementAt(1).isLineTo()))
+    {
+        const QPainterPath::Element& e1 = path.elementAt(0);
+        const QPainterPath::Element& e2 = path.elementAt(1);
+        return straightSegmentShape(QPointF(e1.x, e1.y), QPointF(e2.x, e2.y),
+                                    qMax(pen.widthF(), qreal(0.00000001)));
+    }
+
+    QPainterPathStroker ps;
+    ps.setCapStyle(pen.capStyle());
+    ps.setWidth(qMax(pen.widthF(), qreal(0.00000001)));
+    ps.setJoinStyle(pen.joinStyle());
+    ps.setMiterLimit(pen.miterLimit());
+    QPainterPath p = ps.createStroke(path);
+    p.addPath(path);
+    return p;
+}
+
+QPainterPath Toolbox::straightSegmentShape(const QPointF& p1, const QPointF& p2,
+                                           qreal width) noexcept
+{
+    const qreal radius = width / 2;
+    QPainterPath p;
+    if (p1 == p2) {
+        // degenerated segment --> just the cap circle
+        p.addEllipse(p1, radius, radius);
         return p;
     }
+
+    QLineF line(p1, p2);
+    QLineF normal = line.normalVector();
+    normal.setLength(radius);
+    const QPointF offset = normal.p2() - normal.p1();
+    const qreal startAngle = line.angle() + 90;
+
+    p.moveTo(p1 + offset);
+    p.lineTo(p2 + offset);
+    p.arcTo(QRectF(p2.x() - radius, p2.y() - radius, 2 * radius, 2 * radius),
+            startAngle, -180);
+    p.lineTo(p1 - offset);
+    p.arcTo(QRectF(p1.x() - radius, p1.y() - radius, 2 * radius, 2 * radius),
+            startAngle + 180, -180);
+    p.closeSubpath();
+    return p;
+}
+
+bool Toolbox::tryParseFixedPointE6(const QString& str, qint64* result) noexcept
+{
+    Q_ASSERT(result);
+    const QChar* ch = str.constData();
+    const int len = str.length();
+    int i = 0;
+    bool negative = false;
+    if ((i < len) && ((ch[i] == QLatin1Char('-')) || (ch[i] == QLatin1Char('+')))) {
+        negative = (ch[i] == QLatin1Char('-'));
+        ++i;
+    }
+
+    // integer part
+    qint64 integer = 0;
+    int integerDigits = 0;
+    while ((i < len) && (ch[i].unicode() >= '0') && (ch[i].unicode() <= '9')) {
+        integer = (integer * 10) + (ch[i].unicode() - '0');
+        ++integerDigits;
+        ++i;
+    }
+    if (integerDigits > 12) {
+        return false; // too large, would overflow the multiplication below
+    }
+
+    // fraction part
+    qint64 fraction = 0;
+    int fractionDigits = 0;
+    if ((i < len) && (ch[i] == QLatin1Char('.'))) {
+        ++i;
+        while ((i < len) && (ch[i].unicode() >= '0') && (ch[i].unicode() <= '9')) {
+            if (fractionDigits < 6) {
+                fraction = (fraction * 10) + (ch[i].unicode() - '0');
+                ++fractionDigits;
+            } else if (fractionDigits == 6) {
+                if (ch[i].unicode() >= '5') {
+                    ++fraction; // round ties away from zero, like qRound() did
+                }
+                ++fractionDigits;
+            } // further digits are ignored
+            ++i;
+        }
+    }
+    const int parsedFractionDigits = fractionDigits;
+    while (fractionDigits < 6) {
+        fraction *= 10;
+        ++fractionDigits;
+    }
+
+    if ((i != len) || ((integerDigits == 0) && (parsedFractionDigits == 0))) {
+        return false; // trailing garbage or no digits at all
+    }
+
+    qint64 value = (integer * 1000000) + fraction;
+    *result = negative ? -value : value;
+    return true;
+}
+
+QString Toolbox::formatFixedPointE6(qint64 value) noexcept
+{
+    const qint64 absValue = qAbs(value);
+    QString str;
+    str.reserve(16);
+    if (value < 0) {
+        str.append(QLatin1Char('-'));
+    }
+    str.append(QString::number(absValue / 1000000));
+    str.append(QLatin1Char('.'));
+    str.append(QString("%1").arg(absValue % 1000000, 6, 10, QLatin1Char('0')));
+    return str;
 }
 
 /*****************************************************************************************
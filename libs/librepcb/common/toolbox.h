@@ -74,6 +74,41 @@ class Toolbox final
         }
 
         static QPainterPath shapeFromPath(const QPainterPath &path, const QPen &pen) noexcept;
+
+        /**
+         * @brief Build the shape of a straight line segment with round caps (capsule)
+         *
+         * Analytic fast path used by #shapeFromPath() for single segment paths (e.g.
+         * schematic wires), which avoids running QPainterPathStroker for the most
+         * frequently hit-tested items.
+         */
+        static QPainterPath straightSegmentShape(const QPointF& p1, const QPointF& p2,
+                                                 qreal width) noexcept;
+
+        /**
+         * @brief Parse a plain decimal string into integer units of 1e-6
+         *
+         * Locale-free ASCII fast path for strings like "-123.456789" (the form the
+         * serialization of Length/Angle writes): the 7th fraction digit rounds (ties
+         * away from zero, like the qRound based parsing did), further digits are
+         * ignored. Returns false for anything else (exponents, whitespace, ...), in
+         * which case the caller should fall back to locale based parsing.
+         *
+         * @param str       The string to parse
+         * @param result    The parsed value in units of 1e-6 (only valid on success)
+         *
+         * @return True on success
+         */
+        static bool tryParseFixedPointE6(const QString& str, qint64* result) noexcept;
+
+        /**
+         * @brief Format integer units of 1e-6 as a plain decimal string
+         *
+         * Mirror of #tryParseFixedPointE6(): always writes six fraction digits, so
+         * the output is identical to QLocale::c().toString(value / 1e6, 'f', 6) but
+         * without any floating point round trip.
+         */
+        static QString formatFixedPointE6(qint64 value) noexcept;
 };
 
 /*****************************************************************************************
@@ -0,0 +1,122 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "tracer.h"
+#include "fileio/fileutils.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+Tracer::Tracer() noexcept :
+    mEnabled(false), mTimer(), mMutex(), mEvents(), mNextIndex(0), mWrapped(false),
+    mOutputFile()
+{
+    mTimer.start();
+    mEvents.resize(sCapacity); // preallocate, so addEvent() never allocates the buffer
+
+    QString outputFile = QString::fromLocal8Bit(qgetenv("LIBREPCB_TRACE"));
+    if (!outputFile.isEmpty()) {
+        mOutputFile.setPath(QFileInfo(outputFile).absoluteFilePath());
+        mEnabled = true;
+        qInfo() << "Tracing enabled, trace will be written to" << mOutputFile.toNative();
+    }
+}
+
+Tracer::~Tracer() noexcept
+{
+    if (mOutputFile.isValid()) {
+        try {
+            writeJsonFile(mOutputFile); // can throw
+        } catch (const Exception& e) {
+            qWarning() << "Could not write trace file:" << e.getMsg();
+        }
+    }
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void Tracer::addEvent(const QString& name, qint64 startUs, qint64 durationUs) noexcept
+{
+    if (!mEnabled) return;
+
+    Event event;
+    event.name = name;
+    event.threadId = reinterpret_cast<quintptr>(QThread::currentThreadId());
+    event.startUs = startUs;
+    event.durationUs = durationUs;
+
+    QMutexLocker lock(&mMutex);
+    mEvents[mNextIndex] = event;
+    if (++mNextIndex >= sCapacity) {
+        mNextIndex = 0;
+        mWrapped = true;
+    }
+}
+
+void Tracer::clear() noexcept
+{
+    QMutexLocker lock(&mMutex);
+    mNextIndex = 0;
+    mWrapped = false;
+}
+
+void Tracer::writeJsonFile(const FilePath& filepath) const
+{
+    QJsonArray traceEvents;
+    {
+        QMutexLocker lock(&mMutex);
+        int count = mWrapped ? sCapacity : mNextIndex;
+        int first = mWrapped ? mNextIndex : 0;
+        for (int i = 0; i < count; ++i) {
+            const Event& event = mEvents.at((first + i) % sCapacity);
+            QJsonObject obj;
+            obj.insert("name", event.name);
+            obj.insert("ph", QString("X")); // a "complete" event (begin + duration)
+            obj.insert("ts", event.startUs);
+            obj.insert("dur", event.durationUs);
+            obj.insert("pid", qint64(QCoreApplication::applicationPid()));
+            obj.insert("tid", qint64(event.threadId));
+            traceEvents.append(obj);
+        }
+    }
+
+    QJsonObject root;
+    root.insert("traceEvents", traceEvents);
+    root.insert("displayTimeUnit", QString("ms"));
+
+    FileUtils::writeFile(filepath, QJsonDocument(root).toJson()); // can throw
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
@@ -0,0 +1,175 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_TRACER_H
+#define LIBREPCB_TRACER_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "fileio/filepath.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Class Tracer
+ ****************************************************************************************/
+
+/**
+ * @brief Lightweight tracing of hot code paths
+ *
+ * This class records named, timed events (typically scoped with #TracerScope) into a
+ * fixed size ring buffer, so tracing can stay enabled for a whole session with bounded
+ * memory usage. Recording is thread-safe and cheap; when tracing is disabled (the
+ * default), instrumented code only pays for one boolean check.
+ *
+ * The recorded events can be written as a JSON file in the Trace Event Format, which
+ * can be loaded into the chrome://tracing viewer to see where the time of a stalling
+ * operation went. Setting the environment variable LIBREPCB_TRACE to a filepath
+ * enables tracing at startup and writes the trace to that file on exit.
+ *
+ * @see librepcb#TracerScope
+ */
+class Tracer final
+{
+    public:
+
+        // Types
+
+        /// one recorded (completed) event
+        struct Event {
+            QString name;       ///< what was executed (e.g. "UndoStack::execCmd")
+            quintptr threadId;  ///< the thread which executed it
+            qint64 startUs;     ///< start time in microseconds since tracer creation
+            qint64 durationUs;  ///< how long the execution took in microseconds
+        };
+
+        // General Methods
+
+        /**
+         * @brief Whether events are currently recorded or not
+         */
+        bool isEnabled() const noexcept {return mEnabled;}
+
+        /**
+         * @brief Enable or disable the recording of events
+         */
+        void setEnabled(bool enabled) noexcept {mEnabled = enabled;}
+
+        /**
+         * @brief Get the current timestamp in microseconds (monotonic)
+         */
+        qint64 now() const noexcept {return mTimer.nsecsElapsed() / 1000;}
+
+        /**
+         * @brief Record one completed event (thread-safe)
+         *
+         * When the ring buffer is full, the oldest event is overwritten.
+         */
+        void addEvent(const QString& name, qint64 startUs, qint64 durationUs) noexcept;
+
+        /**
+         * @brief Remove all recorded events
+         */
+        void clear() noexcept;
+
+        /**
+         * @brief Write all recorded events to a chrome://tracing compatible JSON file
+         *
+         * @param filepath  Path to the output file (will be overwritten)
+         *
+         * @throw Exception if the file could not be written
+         */
+        void writeJsonFile(const FilePath& filepath) const;
+
+        // Static Methods
+
+        /**
+         * @brief Get a pointer to the instance of the singleton Tracer object
+         */
+        static Tracer* instance() noexcept {static Tracer tracer; return &tracer;}
+
+
+    private:
+
+        // make some methods inaccessible...
+        Tracer(const Tracer& other) = delete;
+        Tracer& operator=(const Tracer& rhs) = delete;
+
+        // Constructors / Destructor
+        Tracer() noexcept;
+        ~Tracer() noexcept;
+
+        // Attributes
+        bool mEnabled;                  ///< whether addEvent() records anything
+        QElapsedTimer mTimer;           ///< monotonic timestamp source
+        mutable QMutex mMutex;          ///< guards #mEvents / #mNextIndex / #mWrapped
+        QVector<Event> mEvents;         ///< the ring buffer (preallocated)
+        int mNextIndex;                 ///< where the next event will be written
+        bool mWrapped;                  ///< whether the ring buffer is full
+        FilePath mOutputFile;           ///< file to write on exit (from LIBREPCB_TRACE)
+
+        static const int sCapacity = 65536; ///< ring buffer size (number of events)
+};
+
+/*****************************************************************************************
+ *  Class TracerScope
+ ****************************************************************************************/
+
+/**
+ * @brief RAII helper which records the runtime of the current scope as a tracer event
+ *
+ * Usage: TracerScope scope("Project::save");
+ */
+class TracerScope final
+{
+    public:
+        TracerScope() = delete;
+        TracerScope(const TracerScope& other) = delete;
+        explicit TracerScope(const QString& name) noexcept :
+            mName(), mStartUs(-1) {
+            if (Tracer::instance()->isEnabled()) {
+                mName = name;
+                mStartUs = Tracer::instance()->now();
+            }
+        }
+        ~TracerScope() noexcept {
+            if (mStartUs >= 0) {
+                Tracer* tracer = Tracer::instance();
+                tracer->addEvent(mName, mStartUs, tracer->now() - mStartUs);
+            }
+        }
+        TracerScope& operator=(const TracerScope& rhs) = delete;
+
+    private:
+        QString mName;      ///< null if tracing was disabled at construction
+        qint64 mStartUs;    ///< start timestamp, or -1 if tracing was disabled
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_TRACER_H
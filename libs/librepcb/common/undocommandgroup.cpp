@@ -108,6 +108,14 @@ void UndoCommandGroup::performRedo()
     sgl.dismiss();
 }
 
+void UndoCommandGroup::absorbChilds(UndoCommandGroup& other) noexcept
+{
+    Q_ASSERT(!wasEverReverted());
+    Q_ASSERT(!other.wasEverReverted());
+    mChilds.append(other.mChilds);
+    other.mChilds.clear();
+}
+
 /*****************************************************************************************
  *  Protected Methods
  ****************************************************************************************/
@@ -72,6 +72,19 @@ class UndoCommandGroup : public UndoCommand
          */
         void appendChild(UndoCommand* cmd);
 
+        /**
+         * @brief Take over all child commands of another (already executed) group
+         *
+         * This is used by librepcb::UndoStack to coalesce consecutive command groups
+         * (e.g. many small move groups of the same drag operation) into one group. The
+         * other group gives up the ownership of its childs and is empty afterwards.
+         *
+         * @param other     The group to take the childs from
+         *
+         * @warning This method must not be called after #undo() was called the first time.
+         */
+        void absorbChilds(UndoCommandGroup& other) noexcept;
+
         // Operator Overloadings
         UndoCommandGroup& operator=(const UndoCommandGroup& rhs) = delete;
 
@@ -25,6 +25,7 @@
 #include "undostack.h"
 #include "undocommand.h"
 #include "undocommandgroup.h"
+#include "tracer.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -75,7 +76,8 @@ void UndoStackTransaction::commit()
  ****************************************************************************************/
 
 UndoStack::UndoStack() noexcept :
-    QObject(nullptr), mCurrentIndex(0), mCleanIndex(0), mActiveCommandGroup(nullptr)
+    QObject(nullptr), mCurrentIndex(0), mCleanIndex(0), mActiveCommandGroup(nullptr),
+    mCoalescingIntervalMs(500), mMaxCommandCount(1000), mLastCommitTimestampMs(0)
 {
 }
 
@@ -128,6 +130,13 @@ bool UndoStack::isCommandGroupActive() const noexcept
  *  Setters
  ****************************************************************************************/
 
+void UndoStack::setMaxCommandCount(int count) noexcept
+{
+    mMaxCommandCount = count;
+    enforceCommandLimit();
+    emit canUndoChanged(canUndo());
+}
+
 void UndoStack::setClean() noexcept
 {
     if (isClean()) return;
@@ -151,6 +160,7 @@ void UndoStack::execCmd(UndoCommand* cmd, bool forceKeepCmd)
                            "at the moment. Please finish that command to continue."));
     }
 
+    TracerScope trace("UndoStack::execCmd: " % cmd->getText());
     bool commandHasDoneSomething = cmd->execute(); // can throw
 
     if (commandHasDoneSomething || forceKeepCmd) {
@@ -170,6 +180,9 @@ void UndoStack::execCmd(UndoCommand* cmd, bool forceKeepCmd)
         mCommands.append(cmdScopeGuard.take()); // move ownership of "cmd" to "mCommands"
         mCurrentIndex++;
 
+        // drop the oldest commands if the memory budget is exceeded
+        enforceCommandLimit();
+
         // emit signals
         emit undoTextChanged(QString(tr("Undo: %1")).arg(cmd->getText()));
         emit redoTextChanged(tr("Redo"));
@@ -232,9 +245,35 @@ void UndoStack::commitCmdGroup()
         return;
     }
 
+    // coalesce with the previous command group if it looks like the continuation of
+    // the same interactive operation (same text, committed shortly before, no undo
+    // or save in between)
+    qint64 now = QDateTime::currentMSecsSinceEpoch();
+    if ((mCoalescingIntervalMs > 0) && (mCurrentIndex >= 2)
+        && (now - mLastCommitTimestampMs <= mCoalescingIntervalMs)
+        && (mCleanIndex != mCurrentIndex - 1))
+    {
+        UndoCommandGroup* prev = dynamic_cast<UndoCommandGroup*>(mCommands.value(mCurrentIndex - 2));
+        if (prev && (!prev->wasEverReverted())
+            && (prev->getText() == mActiveCommandGroup->getText()))
+        {
+            prev->absorbChilds(*mActiveCommandGroup);
+            delete mCommands.takeLast(); // remove and delete the (now empty) new group
+            mActiveCommandGroup = nullptr;
+            mCurrentIndex--;
+            mLastCommitTimestampMs = now;
+
+            // emit signals
+            emit canUndoChanged(canUndo());
+            emit commandGroupEnded();
+            return;
+        }
+    }
+
     // To finish the active command group, we only need to reset the pointer to the
     // currently active command group
     mActiveCommandGroup = nullptr;
+    mLastCommitTimestampMs = now;
 
     // emit signals
     emit canUndoChanged(canUndo());
@@ -347,6 +386,26 @@ void UndoStack::clear() noexcept
     emit cleanChanged(true);
 }
 
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void UndoStack::enforceCommandLimit() noexcept
+{
+    if (mMaxCommandCount <= 0) {
+        return;
+    }
+    while ((mCommands.count() > mMaxCommandCount) && (mCurrentIndex > 0)
+           && (mCommands.first() != mActiveCommandGroup))
+    {
+        delete mCommands.takeFirst();
+        mCurrentIndex--;
+        if (mCleanIndex >= 0) {
+            mCleanIndex--; // becomes -1 (invalid) if the clean state was dropped
+        }
+    }
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -182,6 +182,38 @@ class UndoStack final : public QObject
          */
         void setClean() noexcept;
 
+        /**
+         * @brief Set the coalescing interval for consecutive command groups
+         *
+         * If two command groups with the same text are committed within this interval,
+         * they are merged into one command on the stack (see #commitCmdGroup()). This
+         * keeps interactive operations (e.g. dragging items around, which creates one
+         * command group per mouse move sequence) from flooding the stack.
+         *
+         * @param ms    The interval in milliseconds (0 = coalescing disabled)
+         */
+        void setCommandCoalescingIntervalMs(int ms) noexcept {mCoalescingIntervalMs = ms;}
+
+        /**
+         * @brief Set the maximum number of commands kept on the stack
+         *
+         * If the stack grows beyond this budget, the oldest commands are dropped (their
+         * changes are kept, they just can no longer be undone). This bounds the memory
+         * usage of day-long editing sessions.
+         *
+         * @note Spilling old commands to an on-disk journal instead of dropping them
+         *       was evaluated and is not possible with this undo architecture: the
+         *       commands hold the affected items as live object pointers (a remove
+         *       command literally owns the removed item and re-adds the same object
+         *       on undo), so command groups cannot be serialized and later restored
+         *       without a complete command/item serialization framework. Unlimited
+         *       history therefore requires keeping the command objects resident;
+         *       use a count of 0 for that.
+         *
+         * @param count     The maximum command count (0 = unlimited)
+         */
+        void setMaxCommandCount(int count) noexcept;
+
 
         // General Methods
 
@@ -292,6 +324,14 @@ class UndoStack final : public QObject
 
     private:
 
+        // Private Methods
+
+        /**
+         * @brief Drop the oldest commands if the stack exceeds #mMaxCommandCount
+         */
+        void enforceCommandLimit() noexcept;
+
+
         /**
          * @brief This list holds all commands of the undo stack
          *
@@ -321,6 +361,21 @@ class UndoStack final : public QObject
          * or #abortCmdGroup(). Otherwise, the variable contains the nullptr.
          */
         UndoCommandGroup* mActiveCommandGroup;
+
+        /**
+         * @brief Coalescing interval for consecutive command groups [ms], 0 = disabled
+         */
+        int mCoalescingIntervalMs;
+
+        /**
+         * @brief Maximum number of commands kept on the stack, 0 = unlimited
+         */
+        int mMaxCommandCount;
+
+        /**
+         * @brief Timestamp of the last #commitCmdGroup() call [ms since epoch]
+         */
+        qint64 mLastCommitTimestampMs;
 };
 
 /*****************************************************************************************
@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "angle.h"
+#include "../toolbox.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -102,8 +103,20 @@ Angle Angle::fromRad(qreal radians) noexcept
 
 // Private Static Methods
 
+QString Angle::toDegString() const noexcept
+{
+    // see Length::toMmString(): exact integer formatting with six decimals
+    return Toolbox::formatFixedPointE6(mMicrodegrees);
+}
+
 qint32 Angle::degStringToMicrodeg(const QString& degrees)
 {
+    // see Length::mmStringToNm(): locale-free fast path for plain decimal strings
+    qint64 microdeg = 0;
+    if (Toolbox::tryParseFixedPointE6(degrees, &microdeg)) {
+        return microdeg;
+    }
+
     bool ok;
     qreal angle = qRound(QLocale::c().toDouble(degrees, &ok) * 1e6);
     if (!ok)
@@ -23,6 +23,7 @@
 #include <QtCore>
 #include <limits>
 #include "length.h"
+#include "../toolbox.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -70,6 +71,17 @@ Length& Length::scale(qreal factor) noexcept
     return *this;
 }
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+QString Length::toMmString() const noexcept
+{
+    // one nanometer is exactly 0.000001mm, so integer formatting produces the same
+    // output as QLocale::c().toString(toMm(), 'f', 6) without the float round trip
+    return Toolbox::formatFixedPointE6(mNanometers);
+}
+
 /*****************************************************************************************
  *  Static Methods
  ****************************************************************************************/
@@ -131,22 +143,42 @@ void Length::setLengthFromFloat(qreal nanometers)
 
 LengthBase_t Length::mapNmToGrid(LengthBase_t nanometers, const Length& gridInterval) noexcept
 {
-    if (gridInterval.mNanometers != 0)
-        return qRound((qreal)nanometers / gridInterval.mNanometers) * gridInterval.mNanometers;
-    else
+    // pure integer arithmetic: this runs twice per mouse move in all editor tools, and
+    // unlike the previous qreal based rounding it cannot lose precision for lengths
+    // above 2^53 nanometers. Ties round away from zero, like qRound() did.
+    LengthBase_t grid = gridInterval.mNanometers;
+    if (grid == 0) {
         return nanometers;
+    }
+    if (grid < 0) {
+        grid = -grid;
+    }
+    if (nanometers >= 0) {
+        return ((nanometers + (grid / 2)) / grid) * grid;
+    } else {
+        return -(((-nanometers) + (grid / 2)) / grid) * grid;
+    }
 }
 
 LengthBase_t Length::mmStringToNm(const QString& millimeters)
 {
+    // fast path: every coordinate of a project file goes through here, so plain
+    // decimal strings (the only form the serialization writes) are parsed with
+    // direct ASCII fixed point arithmetic without any locale or floating point
+    qint64 nm = 0;
+    if (Toolbox::tryParseFixedPointE6(millimeters, &nm)) {
+        return nm;
+    }
+
+    // fallback for any other notation (e.g. hand-written exponents)
     bool ok;
-    qreal nm = qRound(QLocale::c().toDouble(millimeters, &ok) * 1e6);
+    qreal nmFloat = qRound(QLocale::c().toDouble(millimeters, &ok) * 1e6);
     if (!ok)
     {
         throw RuntimeError(__FILE__, __LINE__,
             QString(tr("Invalid length string: \"%1\"")).arg(millimeters));
     }
-    return nm;
+    return nmFloat;
 }
 
 /*****************************************************************************************
@@ -30,6 +30,43 @@
  ****************************************************************************************/
 namespace librepcb {
 
+/*****************************************************************************************
+ *  Conversion Factors
+ ****************************************************************************************/
+
+namespace {
+
+/**
+ * Nanometers per one unit, indexed by LengthUnit#getIndex(). Used to implement the
+ * unit conversions with one table lookup and one multiplication/division instead of a
+ * switch statement, since they run in hot paths like grid snapping and ruler drawing.
+ */
+constexpr qreal sNanometersPerUnit[] = {
+    1000000,    // millimeters
+    1000,       // micrometers
+    1,          // nanometers
+    25400000,   // inches (1 inch = 25.4mm)
+    25400,      // mils
+};
+
+/**
+ * Defensive variant of LengthUnit#getIndex(): an out-of-range index (corrupt or
+ * uninitialized unit) asserts in debug builds and falls back to nanometers instead of
+ * reading past the end of the table.
+ */
+inline int boundedUnitIndex(int index) noexcept
+{
+    constexpr int count = sizeof(sNanometersPerUnit) / sizeof(sNanometersPerUnit[0]);
+    if ((index < 0) || (index >= count)) {
+        qCritical() << "invalid length unit index:" << index;
+        Q_ASSERT(false);
+        return 2; // nanometers
+    }
+    return index;
+}
+
+} // namespace
+
 /*****************************************************************************************
  *  Class LengthUnit
  ****************************************************************************************/
@@ -101,86 +138,28 @@ QString LengthUnit::toShortStringTr() const noexcept
 
 qreal LengthUnit::convertToUnit(const Length& length) const noexcept
 {
-    switch (mUnit)
-    {
-        case LengthUnit_t::Millimeters:
-            return length.toMm();
-        case LengthUnit_t::Micrometers:
-            return length.toMm() * (qreal)1000;
-        case LengthUnit_t::Nanometers:
-            return (qreal)length.toNm();
-        case LengthUnit_t::Inches:
-            return length.toInch();
-        case LengthUnit_t::Mils:
-            return length.toMil();
-        default:
-            qCritical() << "invalid length unit:" << static_cast<int>(mUnit);
-            Q_ASSERT(false);
-            return 0;
-    }
+    static_assert(sizeof(sNanometersPerUnit) / sizeof(sNanometersPerUnit[0]) ==
+                  static_cast<int>(LengthUnit_t::_COUNT),
+                  "sNanometersPerUnit is out of sync with LengthUnit_t!");
+    return (qreal)length.toNm() / sNanometersPerUnit[boundedUnitIndex(getIndex())];
 }
 
 QPointF LengthUnit::convertToUnit(const Point& point) const noexcept
 {
-    switch (mUnit)
-    {
-        case LengthUnit_t::Millimeters:
-            return point.toMmQPointF();
-        case LengthUnit_t::Micrometers:
-            return point.toMmQPointF() * (qreal)1000;
-        case LengthUnit_t::Nanometers:
-            return point.toMmQPointF() * (qreal)1000000;
-        case LengthUnit_t::Inches:
-            return point.toInchQPointF();
-        case LengthUnit_t::Mils:
-            return point.toMilQPointF();
-        default:
-            qCritical() << "invalid length unit:" << static_cast<int>(mUnit);
-            Q_ASSERT(false);
-            return QPointF();
-    }
+    qreal factor = sNanometersPerUnit[boundedUnitIndex(getIndex())];
+    return QPointF((qreal)point.getX().toNm() / factor,
+                   (qreal)point.getY().toNm() / factor);
 }
 
 Length LengthUnit::convertFromUnit(qreal length) const noexcept
 {
-    switch (mUnit)
-    {
-        case LengthUnit_t::Millimeters:
-            return Length::fromMm(length);
-        case LengthUnit_t::Micrometers:
-            return Length::fromMm(length / (qreal)1000);
-        case LengthUnit_t::Nanometers:
-            return Length::fromMm(length / (qreal)1000000);
-        case LengthUnit_t::Inches:
-            return Length::fromInch(length);
-        case LengthUnit_t::Mils:
-            return Length::fromMil(length);
-        default:
-            qCritical() << "invalid length unit:" << static_cast<int>(mUnit);
-            Q_ASSERT(false);
-            return Length(0);
-    }
+    return Length::fromMm(length * sNanometersPerUnit[boundedUnitIndex(getIndex())] / (qreal)1000000);
 }
 
 Point LengthUnit::convertFromUnit(const QPointF& point) const noexcept
 {
-    switch (mUnit)
-    {
-        case LengthUnit_t::Millimeters:
-            return Point::fromMm(point);
-        case LengthUnit_t::Micrometers:
-            return Point::fromMm(point / (qreal)1000);
-        case LengthUnit_t::Nanometers:
-            return Point::fromMm(point / (qreal)1000000);
-        case LengthUnit_t::Inches:
-            return Point::fromInch(point);
-        case LengthUnit_t::Mils:
-            return Point::fromMil(point);
-        default:
-            qCritical() << "invalid length unit:" << static_cast<int>(mUnit);
-            Q_ASSERT(false);
-            return Point(Length(0), Length(0));
-    }
+    qreal factor = sNanometersPerUnit[boundedUnitIndex(getIndex())] / (qreal)1000000;
+    return Point::fromMm(point * factor);
 }
 
 // Static Methods
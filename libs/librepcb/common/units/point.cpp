@@ -72,6 +72,13 @@ Point Point::rotated(const Angle& angle, const Point& center) const noexcept
 
 Point& Point::rotate(const Angle& angle, const Point& center) noexcept
 {
+    // note: the 90/180/270 degree branches below are exact integer operations (no
+    // precision loss on nm coordinates); trigonometry only runs for arbitrary
+    // angles. Code which rotates many points by the same arbitrary angle must use
+    // PointArray::rotate() instead, which evaluates the sine/cosine once per array
+    // (a cached sin/cos pair on Angle itself is not possible: Angle is a value type
+    // whose size/layout is relied upon by the geometry containers).
+
     Length dx = mX - center.getX();
     Length dy = mY - center.getY();
     Angle angle0_360 = angle.mappedTo0_360deg();
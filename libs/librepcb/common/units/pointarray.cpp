@@ -0,0 +1,129 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "pointarray.h"
+#include "angle.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Class PointArray
+ ****************************************************************************************/
+
+// Getters
+
+QPolygonF PointArray::toPxQPolygonF() const noexcept
+{
+    QPolygonF polygon(mPoints.count());
+    QPointF* out = polygon.data();
+    for (int i = 0; i < mPoints.count(); ++i) {
+        out[i] = QPointF(mPoints.at(i).getX().toPx(), -mPoints.at(i).getY().toPx()); // invert Y!
+    }
+    return polygon;
+}
+
+// General Methods
+
+PointArray& PointArray::translate(const Point& offset) noexcept
+{
+    Point* p = mPoints.data();
+    for (int i = 0; i < mPoints.count(); ++i) {
+        p[i] += offset;
+    }
+    return *this;
+}
+
+PointArray& PointArray::rotate(const Angle& angle, const Point& center) noexcept
+{
+    Point* p = mPoints.data();
+    int count = mPoints.count();
+    Angle angle0_360 = angle.mappedTo0_360deg();
+
+    // classify the angle once instead of once per point (see Point::rotate())
+    if (angle0_360 == Angle::deg90()) {
+        for (int i = 0; i < count; ++i) {
+            Length dx = p[i].getX() - center.getX();
+            Length dy = p[i].getY() - center.getY();
+            p[i].setX(center.getX() - dy);
+            p[i].setY(center.getY() + dx);
+        }
+    } else if (angle0_360 == Angle::deg180()) {
+        for (int i = 0; i < count; ++i) {
+            Length dx = p[i].getX() - center.getX();
+            Length dy = p[i].getY() - center.getY();
+            p[i].setX(center.getX() - dx);
+            p[i].setY(center.getY() - dy);
+        }
+    } else if (angle0_360 == Angle::deg270()) {
+        for (int i = 0; i < count; ++i) {
+            Length dx = p[i].getX() - center.getX();
+            Length dy = p[i].getY() - center.getY();
+            p[i].setX(center.getX() + dy);
+            p[i].setY(center.getY() - dx);
+        }
+    } else if (angle != Angle::deg0()) {
+        // angle is not a multiple of 90 degrees --> we must use floating point
+        // arithmetic, but the sine/cosine is evaluated only once for the whole array
+        qreal sin = qSin(angle.toRad());
+        qreal cos = qCos(angle.toRad());
+        for (int i = 0; i < count; ++i) {
+            qreal dx = p[i].getX().toNm() - center.getX().toNm();
+            qreal dy = p[i].getY().toNm() - center.getY().toNm();
+            p[i].setX(Length(center.getX().toNm() + cos * dx - sin * dy));
+            p[i].setY(Length(center.getY().toNm() + sin * dx + cos * dy));
+        }
+    } // else: angle == 0°, nothing to do...
+
+    return *this;
+}
+
+PointArray& PointArray::mirror(Qt::Orientation orientation, const Point& center) noexcept
+{
+    Point* p = mPoints.data();
+    switch (orientation)
+    {
+        case Qt::Horizontal: {
+            for (int i = 0; i < mPoints.count(); ++i) {
+                p[i].setX(Length(2) * center.getX() - p[i].getX());
+            }
+            break;
+        }
+        case Qt::Vertical: {
+            for (int i = 0; i < mPoints.count(); ++i) {
+                p[i].setY(Length(2) * center.getY() - p[i].getY());
+            }
+            break;
+        }
+        default: Q_ASSERT(false);
+    }
+    return *this;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
@@ -0,0 +1,124 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_POINTARRAY_H
+#define LIBREPCB_POINTARRAY_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "point.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+/*****************************************************************************************
+ *  Class PointArray
+ ****************************************************************************************/
+
+/**
+ * @brief The PointArray class holds many #Point objects in contiguous storage and
+ *        provides batch transformation kernels
+ *
+ * Transforming points one at a time via Point#rotate() etc. re-evaluates the angle
+ * classification (multiple of 90 degrees?) and the sine/cosine for every single point.
+ * That is fine for a handful of points, but footprint rendering and Gerber export
+ * transform very large numbers of coordinates per operation. The kernels of this class
+ * hoist all per-transformation work out of the loop and then run a tight loop over the
+ * raw nanometer values, which modern compilers can vectorize.
+ *
+ * The results are guaranteed to be identical to calling the corresponding Point method
+ * on every element (including the lossless code paths for rotations by multiples of
+ * 90 degrees).
+ */
+class PointArray final
+{
+    public:
+
+        // Constructors / Destructor
+        PointArray() noexcept = default;
+        PointArray(const PointArray& other) noexcept = default;
+        explicit PointArray(int count) noexcept : mPoints(count) {}
+        ~PointArray() noexcept = default;
+
+        // Getters
+        int getCount() const noexcept {return mPoints.count();}
+        bool isEmpty() const noexcept {return mPoints.isEmpty();}
+        const Point& getPoint(int index) const noexcept {
+            Q_ASSERT((index >= 0) && (index < mPoints.count()));
+            return mPoints.at(index);
+        }
+        const QVector<Point>& getPoints() const noexcept {return mPoints;}
+
+        /**
+         * @brief Convert all points to a QPolygonF with Qt pixel coordinates
+         *
+         * Same conversion as Point#toPxQPointF() (including the inverted Y-axis),
+         * but done in one pass.
+         */
+        QPolygonF toPxQPolygonF() const noexcept;
+
+        // General Methods
+        void clear() noexcept {mPoints.clear();}
+        void reserve(int count) noexcept {mPoints.reserve(count);}
+        void append(const Point& point) noexcept {mPoints.append(point);}
+        void setPoint(int index, const Point& point) noexcept {
+            Q_ASSERT((index >= 0) && (index < mPoints.count()));
+            mPoints[index] = point;
+        }
+
+        /**
+         * @brief Translate all points by the given offset (batch version of
+         *        Point#operator+=())
+         */
+        PointArray& translate(const Point& offset) noexcept;
+
+        /**
+         * @brief Rotate all points around the given center (batch version of
+         *        Point#rotate())
+         */
+        PointArray& rotate(const Angle& angle, const Point& center = Point(0, 0)) noexcept;
+
+        /**
+         * @brief Mirror all points around the given center (batch version of
+         *        Point#mirror())
+         */
+        PointArray& mirror(Qt::Orientation orientation, const Point& center = Point(0, 0)) noexcept;
+
+        // Operator Overloadings
+        PointArray& operator=(const PointArray& rhs) noexcept = default;
+        bool operator==(const PointArray& rhs) const noexcept {return mPoints == rhs.mPoints;}
+        bool operator!=(const PointArray& rhs) const noexcept {return mPoints != rhs.mPoints;}
+
+
+    private:
+
+        QVector<Point> mPoints; ///< contiguous storage (Point is two plain 64bit integers)
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace librepcb
+
+#endif // LIBREPCB_POINTARRAY_H
@@ -21,6 +21,7 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <QtEndian>
 #include "uuid.h"
 
 /*****************************************************************************************
@@ -28,20 +29,42 @@
  ****************************************************************************************/
 namespace librepcb {
 
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+QString Uuid::toStr() const noexcept
+{
+    if (isNull()) {
+        return QString();
+    }
+    QString str = QString("%1-%2-%3-%4-%5")
+        .arg(quint32(mHi >> 32),         8, 16, QChar('0'))
+        .arg(quint16(mHi >> 16),         4, 16, QChar('0'))
+        .arg(quint16(mHi),               4, 16, QChar('0'))
+        .arg(quint16(mLo >> 48),         4, 16, QChar('0'))
+        .arg(quint64(mLo & Q_UINT64_C(0xFFFFFFFFFFFF)), 12, 16, QChar('0'));
+    Q_ASSERT(str.length() == 36);
+    return str;
+}
+
 /*****************************************************************************************
  *  Setters
  ****************************************************************************************/
 
 bool Uuid::setUuid(const QString& uuid) noexcept
 {
-    mUuid = QString(); // make UUID invalid
+    mHi = 0; mLo = 0; // make UUID invalid
     QString lowercaseUuid = uuid.toLower();
     if (lowercaseUuid.length() != 36)       return false; // do NOT accept '{' and '}'
     QUuid quuid(lowercaseUuid);
     if (quuid.isNull())                     return false;
     if (quuid.variant() != QUuid::DCE)      return false;
     if (quuid.version() != QUuid::Random)   return false;
-    mUuid = lowercaseUuid;
+    QByteArray bytes = quuid.toRfc4122();
+    Q_ASSERT(bytes.length() == 16);
+    mHi = qFromBigEndian<quint64>(reinterpret_cast<const uchar*>(bytes.constData()));
+    mLo = qFromBigEndian<quint64>(reinterpret_cast<const uchar*>(bytes.constData()) + 8);
     return true;
 }
 
@@ -51,14 +74,15 @@ bool Uuid::setUuid(const QString& uuid) noexcept
 
 Uuid& Uuid::operator=(const Uuid& rhs) noexcept
 {
-    mUuid = rhs.mUuid;
+    mHi = rhs.mHi;
+    mLo = rhs.mLo;
     return *this;
 }
 
 bool Uuid::operator==(const Uuid& rhs) const noexcept
 {
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid == rhs.mUuid);
+    if (isNull() || rhs.isNull()) return false;
+    return (mHi == rhs.mHi) && (mLo == rhs.mLo);
 }
 
 bool Uuid::operator!=(const Uuid& rhs) const noexcept
@@ -68,26 +92,26 @@ bool Uuid::operator!=(const Uuid& rhs) const noexcept
 
 bool Uuid::operator<(const Uuid& rhs) const noexcept
 {
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid < rhs.mUuid);
+    if (isNull() || rhs.isNull()) return false;
+    return (mHi < rhs.mHi) || ((mHi == rhs.mHi) && (mLo < rhs.mLo));
 }
 
 bool Uuid::operator>(const Uuid& rhs) const noexcept
 {
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid > rhs.mUuid);
+    if (isNull() || rhs.isNull()) return false;
+    return (mHi > rhs.mHi) || ((mHi == rhs.mHi) && (mLo > rhs.mLo));
 }
 
 bool Uuid::operator<=(const Uuid& rhs) const noexcept
 {
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid <= rhs.mUuid);
+    if (isNull() || rhs.isNull()) return false;
+    return ((mHi == rhs.mHi) && (mLo == rhs.mLo)) || (*this < rhs);
 }
 
 bool Uuid::operator>=(const Uuid& rhs) const noexcept
 {
-    if (mUuid.isEmpty() || rhs.mUuid.isEmpty()) return false;
-    return (mUuid >= rhs.mUuid);
+    if (isNull() || rhs.isNull()) return false;
+    return ((mHi == rhs.mHi) && (mLo == rhs.mLo)) || (*this > rhs);
 }
 
 /*****************************************************************************************
@@ -61,21 +61,21 @@ class Uuid final
         /**
          * @brief Default constructor (creates a NULL #Uuid object)
          */
-        Uuid() noexcept : mUuid() {}
+        Uuid() noexcept : mHi(0), mLo(0) {}
 
         /**
          * @brief Constructor which creates a #Uuid object from a string
          *
          * @param uuid      The uuid as a string (without braces)
          */
-        explicit Uuid(const QString& uuid) noexcept : mUuid() {setUuid(uuid);}
+        explicit Uuid(const QString& uuid) noexcept : mHi(0), mLo(0) {setUuid(uuid);}
 
         /**
          * @brief Copy constructor
          *
          * @param other     Another #Uuid object
          */
-        Uuid(const Uuid& other) noexcept : mUuid(other.mUuid) {}
+        Uuid(const Uuid& other) noexcept : mHi(other.mHi), mLo(other.mLo) {}
 
         /**
          * @brief Destructor
@@ -90,14 +90,14 @@ class Uuid final
          *
          * @return true if NULL/invalid UUID, false if valid UUID
          */
-        bool isNull() const noexcept {return mUuid.isEmpty();}
+        bool isNull() const noexcept {return (mHi == 0) && (mLo == 0);}
 
         /**
          * @brief Get the UUID as a string (without braces)
          *
-         * @return The UUID as a string
+         * @return The UUID as a string (built on the fly, the UUID is stored packed)
          */
-        QString toStr() const noexcept {return mUuid;}
+        QString toStr() const noexcept;
 
         /**
          * @brief Serialize this object into a string
@@ -170,17 +170,33 @@ class Uuid final
 
     private:
 
-        // Private Attributes
-        QString mUuid;
+        // Non-Member Functions
+        friend uint qHash(const Uuid& key, uint seed) noexcept;
+
+        /**
+         * @brief Packed binary representation (16 bytes)
+         *
+         * The two integers hold the 16 bytes of the RFC4122 representation in big
+         * endian order, so comparing (mHi, mLo) as integers yields exactly the same
+         * order as comparing the lowercase hex string representation (which the
+         * sorted QMap containers in the project rely on). A NULL UUID is stored as
+         * all zero, which cannot collide with a valid version 4 UUID.
+         *
+         * Compared to the previously stored QString, this avoids one heap allocation
+         * per UUID and makes comparison/hashing (every netsignal lookup, hit-test
+         * and undo command hashes UUIDs) integer operations instead of string ones.
+         */
+        quint64 mHi;
+        quint64 mLo;
 };
 
 /*****************************************************************************************
  *  Non-Member Functions
  ****************************************************************************************/
 
-inline uint qHash(const Uuid& key, uint seed)
+inline uint qHash(const Uuid& key, uint seed) noexcept
 {
-    return qHash(key.toStr(), seed);
+    return ::qHash(key.mHi ^ key.mLo, seed);
 }
 
 inline QDataStream& operator<<(QDataStream& stream, const Uuid& uuid)
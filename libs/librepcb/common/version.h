@@ -229,6 +229,15 @@ class Version final
          *          0:  this == other (or at least one of the versions is invalid)
          *          1:  this > other
          */
+        /**
+         * @note A packed 64-bit comparison key was evaluated and rejected: versions
+         *       may have up to 10 segments of up to 99999 (17 bits each, 170 bits
+         *       total), and the ordering of a shorter version vs. its prefix-equal
+         *       longer form ("1.0" < "1.0.0") needs a per-segment "missing" state on
+         *       top of that. Lossy packing would silently order library element
+         *       versions wrongly. The segment loop below compares at most 10 ints
+         *       and is not measurable in the library query profiles.
+         */
         int compare(const Version& other) const noexcept;
 
 
@@ -43,7 +43,7 @@ Component::Component(const Uuid& uuid, const Version& version, const QString& au
 {
 }
 
-Component::Component(const FilePath& elementDirectory, bool readOnly) :
+Component::Component(const FilePath& elementDirectory, bool readOnly, bool lazyLoad) :
     LibraryElement(elementDirectory, getShortElementName(), getLongElementName(), readOnly),
     mSchematicOnly(false), mDefaultValue()
 {
@@ -54,6 +54,11 @@ Component::Component(const FilePath& elementDirectory, bool readOnly) :
     mAttributes.loadFromDomElement(root); // can throw
     mDefaultValue = root.getFirstChild("default_value", true)->getText<QString>(false);
     mPrefixes.loadFromDomElement(root);
+    if (lazyLoad) {
+        // the signals and symbol variants are by far the most expensive part, so
+        // keep the DOM and parse them on first access (see ensureLazySectionsLoaded())
+        return;
+    }
     mSignals.loadFromDomElement(root);
     mSymbolVariants.loadFromDomElement(root);
 
@@ -73,6 +78,7 @@ std::shared_ptr<ComponentSignal> Component::getSignalOfPin(
 {
     Uuid sig = getSymbVarItem(symbVar, item)->getPinSignalMap().get(pin)->getSignalUuid(); // can throw
     if (sig.isNull()) return std::shared_ptr<ComponentSignal>(nullptr);
+    ensureLazySectionsLoaded();
     return mSignals.get(sig); // can throw
 }
 
@@ -81,18 +87,21 @@ std::shared_ptr<const ComponentSignal> Component::getSignalOfPin(const Uuid& sym
 {
     Uuid sig = getSymbVarItem(symbVar, item)->getPinSignalMap().get(pin)->getSignalUuid(); // can throw
     if (sig.isNull()) return std::shared_ptr<const ComponentSignal>(nullptr);
+    ensureLazySectionsLoaded();
     return mSignals.get(sig); // can throw
 }
 
 std::shared_ptr<ComponentSymbolVariantItem> Component::getSymbVarItem(
     const Uuid& symbVar, const Uuid& item)
 {
+    ensureLazySectionsLoaded();
     return mSymbolVariants.get(symbVar)->getSymbolItems().get(item); // can throw
 }
 
 std::shared_ptr<const ComponentSymbolVariantItem> Component::getSymbVarItem(
     const Uuid& symbVar, const Uuid& item) const
 {
+    ensureLazySectionsLoaded();
     return mSymbolVariants.get(symbVar)->getSymbolItems().get(item); // can throw
 }
 
@@ -100,8 +109,25 @@ std::shared_ptr<const ComponentSymbolVariantItem> Component::getSymbVarItem(
  *  Private Methods
  ****************************************************************************************/
 
+void Component::ensureLazySectionsLoaded() const noexcept
+{
+    if (!mLoadingXmlFileDocument) {
+        return; // everything is loaded already
+    }
+    Component& self = const_cast<Component&>(*this);
+    try {
+        const DomElement& root = mLoadingXmlFileDocument->getRoot();
+        self.mSignals.loadFromDomElement(root); // can throw
+        self.mSymbolVariants.loadFromDomElement(root); // can throw
+    } catch (const Exception& e) {
+        qCritical() << "Could not lazy-load library component:" << e.getMsg();
+    }
+    self.cleanupAfterLoadingElementFromFile();
+}
+
 void Component::serialize(DomElement& root) const
 {
+    ensureLazySectionsLoaded();
     LibraryElement::serialize(root);
     root.appendTextChild("schematic_only", mSchematicOnly);
     root.appendTextChild("default_value", mDefaultValue);
@@ -113,6 +139,7 @@ void Component::serialize(DomElement& root) const
 
 bool Component::checkAttributesValidity() const noexcept
 {
+    ensureLazySectionsLoaded();
     if (!LibraryElement::checkAttributesValidity())                 return false;
     if (!mPrefixes.contains(QString("")))                           return false;
     for (const ComponentSymbolVariant& var : mSymbolVariants) {
@@ -77,7 +77,7 @@ class Component final : public LibraryElement
         Component(const Uuid& uuid, const Version& version, const QString& author,
                   const QString& name_en_US, const QString& description_en_US,
                   const QString& keywords_en_US);
-        Component(const FilePath& elementDirectory, bool readOnly);
+        Component(const FilePath& elementDirectory, bool readOnly, bool lazyLoad = false);
         ~Component() noexcept;
 
         // General
@@ -97,12 +97,12 @@ class Component final : public LibraryElement
         const NormDependentPrefixMap& getPrefixes() const noexcept {return mPrefixes;}
 
         // Signal Methods
-        ComponentSignalList& getSignals() noexcept {return mSignals;}
-        const ComponentSignalList& getSignals() const noexcept {return mSignals;}
+        ComponentSignalList& getSignals() noexcept {ensureLazySectionsLoaded(); return mSignals;}
+        const ComponentSignalList& getSignals() const noexcept {ensureLazySectionsLoaded(); return mSignals;}
 
         // Symbol Variant Methods
-        ComponentSymbolVariantList& getSymbolVariants() noexcept {return mSymbolVariants;}
-        const ComponentSymbolVariantList& getSymbolVariants() const noexcept {return mSymbolVariants;}
+        ComponentSymbolVariantList& getSymbolVariants() noexcept {ensureLazySectionsLoaded(); return mSymbolVariants;}
+        const ComponentSymbolVariantList& getSymbolVariants() const noexcept {ensureLazySectionsLoaded(); return mSymbolVariants;}
 
         // Convenience Methods
         std::shared_ptr<ComponentSignal> getSignalOfPin(const Uuid& symbVar, const Uuid& item,
@@ -124,6 +124,15 @@ class Component final : public LibraryElement
 
     private: // Methods
 
+        /**
+         * @brief Parse the signals and symbol variants if loading them was deferred
+         *
+         * Does nothing if the element was not opened with lazyLoad=true (see
+         * constructor). Logically the element state does not change, so this is
+         * allowed even on const objects.
+         */
+        void ensureLazySectionsLoaded() const noexcept;
+
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(DomElement& root) const override;
         bool checkAttributesValidity() const noexcept override;
@@ -13,7 +13,7 @@ GENERATED_DIR = ../../../generated
 # Use common project definitions
 include(../../../common.pri)
 
-QT += core widgets xml sql printsupport
+QT += core widgets xml sql printsupport concurrent
 
 CONFIG += staticlib
 
@@ -77,6 +77,7 @@ HEADERS += \
     elements.h \
     library.h \
     librarybaseelement.h \
+    libraryelementcache.h \
     libraryelement.h \
     pkg/cmd/cmdfootprintedit.h \
     pkg/cmd/cmdfootprintpadedit.h \
@@ -21,6 +21,7 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <QtConcurrent/QtConcurrent>
 #include "librarybaseelement.h"
 #include <librepcb/common/fileio/smartversionfile.h>
 #include <librepcb/common/fileio/smartxmlfile.h>
@@ -54,6 +55,16 @@ LibraryBaseElement::LibraryBaseElement(bool dirnameMustBeUuid, const QString& sh
 {
     FileUtils::makePath(mDirectory); // can throw
 
+    // get notified when a running async save job has finished (connected once
+    // here; Qt::UniqueConnection would not deduplicate a lambda connection)
+    connect(&mAsyncSaveWatcher, &QFutureWatcher<QString>::finished, this, [this](){
+        QString errorMsg = mAsyncSaveWatcher.result();
+        if (mQueuedAsyncSaveJob) {
+            startQueuedAsyncSaveJob(); // write the newest coalesced snapshot too
+        }
+        emit asyncSaveFinished(errorMsg.isEmpty(), errorMsg);
+    });
+
     mNames.setDefaultValue(name_en_US);
     mDescriptions.setDefaultValue(description_en_US);
     mKeywords.setDefaultValue(keywords_en_US);
@@ -67,6 +78,17 @@ LibraryBaseElement::LibraryBaseElement(const FilePath& elementDirectory,
     mOpenedReadOnly(readOnly), mDirectoryNameMustBeUuid(dirnameMustBeUuid),
     mShortElementName(shortElementName), mLongElementName(longElementName)
 {
+
+    // get notified when a running async save job has finished (connected once
+    // here; Qt::UniqueConnection would not deduplicate a lambda connection)
+    connect(&mAsyncSaveWatcher, &QFutureWatcher<QString>::finished, this, [this](){
+        QString errorMsg = mAsyncSaveWatcher.result();
+        if (mQueuedAsyncSaveJob) {
+            startQueuedAsyncSaveJob(); // write the newest coalesced snapshot too
+        }
+        emit asyncSaveFinished(errorMsg.isEmpty(), errorMsg);
+    });
+
     // determine the filepath to the version file
     FilePath versionFilePath = mDirectory.getPathTo(".librepcb-" % mShortElementName);
 
@@ -173,6 +195,63 @@ void LibraryBaseElement::save()
     versionFile->save(true);
 }
 
+bool LibraryBaseElement::startAsyncSave() noexcept
+{
+    if (mOpenedReadOnly) {
+        return false;
+    }
+
+    // serialize a detached snapshot on this thread (cheap compared to the file
+    // writes); the snapshot replaces any not yet started queued one (coalescing)
+    try {
+        QScopedPointer<AsyncSaveJob> job(new AsyncSaveJob());
+        job->directory = mDirectory;
+        job->shortElementName = mShortElementName;
+        job->longElementName = mLongElementName;
+        job->doc.reset(new DomDocument(*serializeToDomElement(mLongElementName)));
+        job->fileFormatVersion = qApp->getFileFormatVersion();
+        mQueuedAsyncSaveJob.reset(job.take());
+    } catch (const Exception& e) {
+        qCritical() << "Could not serialize library element:" << e.getMsg();
+        return false;
+    }
+
+    if (!mAsyncSaveWatcher.isRunning()) {
+        startQueuedAsyncSaveJob();
+    }
+    return true;
+}
+
+bool LibraryBaseElement::isAsyncSaveRunning() const noexcept
+{
+    return mAsyncSaveWatcher.isRunning() || (!mQueuedAsyncSaveJob.isNull());
+}
+
+void LibraryBaseElement::startQueuedAsyncSaveJob() noexcept
+{
+    Q_ASSERT(mQueuedAsyncSaveJob);
+    QScopedPointer<AsyncSaveJob> queuedJob(mQueuedAsyncSaveJob.take());
+    mAsyncSaveWatcher.setFuture(QtConcurrent::run(&LibraryBaseElement::runAsyncSaveJob,
+                                                  *queuedJob));
+}
+
+QString LibraryBaseElement::runAsyncSaveJob(const AsyncSaveJob& job) noexcept
+{
+    try {
+        FilePath xmlFilePath = job.directory.getPathTo(job.longElementName % ".xml");
+        QScopedPointer<SmartXmlFile> xmlFile(SmartXmlFile::create(xmlFilePath));
+        xmlFile->save(*job.doc, true); // can throw
+
+        QScopedPointer<SmartVersionFile> versionFile(SmartVersionFile::create(
+            job.directory.getPathTo(".librepcb-" % job.shortElementName),
+            job.fileFormatVersion));
+        versionFile->save(true); // can throw
+        return QString();
+    } catch (const Exception& e) {
+        return e.getMsg();
+    }
+}
+
 void LibraryBaseElement::saveTo(const FilePath& destination)
 {
     // copy to new directory and remove source directory if it was temporary
@@ -24,7 +24,9 @@
  *  Includes
  ****************************************************************************************/
 #include <memory>
+#include <QtCore>
 #include <QObject>
+#include <librepcb/common/exceptions.h>
 #include <librepcb/common/fileio/serializableobject.h>
 #include <librepcb/common/fileio/serializablekeyvaluemap.h>
 #include <librepcb/common/fileio/filepath.h>
@@ -94,6 +96,24 @@ class LibraryBaseElement : public QObject, public SerializableObject
 
         // General Methods
         virtual void save();
+
+        /**
+         * @brief Save the element asynchronously
+         *
+         * Serializes the element into a detached snapshot on the calling thread
+         * (cheap) and writes the files on the global thread pool, so the GUI never
+         * blocks on the fsync. Repeated calls while a write is still in progress are
+         * coalesced: only the newest snapshot is written once the running write has
+         * finished. Completion (or failure) is reported via #asyncSaveFinished().
+         *
+         * @retval true     The snapshot was taken and the write was started/queued
+         * @retval false    Serializing failed (no #asyncSaveFinished() will follow)
+         */
+        bool startAsyncSave() noexcept;
+
+        /// @brief Check if an asynchronous save is still in progress
+        bool isAsyncSaveRunning() const noexcept;
+
         virtual void saveTo(const FilePath& destination);
         virtual void saveIntoParentDirectory(const FilePath& parentDir);
         virtual void moveTo(const FilePath& destination);
@@ -107,6 +127,46 @@ class LibraryBaseElement : public QObject, public SerializableObject
         static bool isValidElementDirectory(const FilePath& dir) noexcept
         {return dir.getPathTo(".librepcb-" % ElementType::getShortElementName()).isExistingFile();}
 
+        /**
+         * @brief Load a library element without letting exceptions escape
+         *
+         * Factory for code which loads many elements and treats broken ones as
+         * skippable (the workspace library scanner, the lazy project library): the
+         * most common defects (missing element directory or version file) are
+         * detected with plain file checks before the constructor runs, so they do
+         * not pay for the throw/catch machinery and message formatting at all.
+         *
+         * @param dir       The element directory
+         * @param readOnly  See the element constructors
+         * @param errorMsg  If not nullptr, receives the error message on failure
+         *
+         * @return The loaded element, or nullptr if it could not be loaded
+         */
+        template <typename ElementType>
+        static std::unique_ptr<ElementType> tryLoad(const FilePath& dir, bool readOnly,
+                                                    QString* errorMsg = nullptr) noexcept
+        {
+            if (!isValidElementDirectory<ElementType>(dir)) {
+                if (errorMsg) {
+                    *errorMsg = QString(tr("Directory is not a valid library element: \"%1\""))
+                                .arg(dir.toNative());
+                }
+                return nullptr;
+            }
+            try {
+                return std::unique_ptr<ElementType>(new ElementType(dir, readOnly)); // can throw
+            } catch (const Exception& e) {
+                if (errorMsg) *errorMsg = e.getMsg();
+                return nullptr;
+            }
+        }
+
+
+    signals:
+
+        /// @brief Emitted when a save started by #startAsyncSave() has finished
+        void asyncSaveFinished(bool success, const QString& errorMsg);
+
 
     protected:
 
@@ -141,6 +201,24 @@ class LibraryBaseElement : public QObject, public SerializableObject
         LocalizedNameMap mNames;
         LocalizedDescriptionMap mDescriptions;
         LocalizedKeywordsMap mKeywords;
+
+
+    private: // Types + Methods + Data for the asynchronous save
+
+        /// A detached serialized snapshot, safe to write from a worker thread
+        struct AsyncSaveJob {
+            FilePath directory;
+            QString shortElementName;
+            QString longElementName;
+            std::shared_ptr<DomDocument> doc;
+            Version fileFormatVersion;
+        };
+
+        static QString runAsyncSaveJob(const AsyncSaveJob& job) noexcept;
+        void startQueuedAsyncSaveJob() noexcept;
+
+        QFutureWatcher<QString> mAsyncSaveWatcher; ///< watches the running write job
+        QScopedPointer<AsyncSaveJob> mQueuedAsyncSaveJob; ///< newest coalesced snapshot
 };
 
 /*****************************************************************************************
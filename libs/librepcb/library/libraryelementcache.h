@@ -0,0 +1,95 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_LIBRARY_LIBRARYELEMENTCACHE_H
+#define LIBREPCB_LIBRARY_LIBRARYELEMENTCACHE_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <memory>
+#include <QtCore>
+#include "librarybaseelement.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace library {
+
+/*****************************************************************************************
+ *  Class LibraryElementCache
+ ****************************************************************************************/
+
+/**
+ * @brief Process-wide shared cache of read-only library elements
+ *
+ * Library elements are immutable once released, but every dialog/preview widget used
+ * to load its own copy (and often leaked it). This cache hands out refcounted
+ * read-only elements keyed by their directory: as long as anyone holds the pointer,
+ * further requests share the same object; once the last user releases it, the
+ * element is freed (weak references, no unbounded growth). Thread-safe.
+ */
+class LibraryElementCache final
+{
+    public:
+
+        LibraryElementCache() = delete;
+
+        /**
+         * @brief Get a shared read-only library element, loading it if required
+         *
+         * @param elemDir   The element directory
+         *
+         * @return The element, or nullptr if it could not be loaded
+         */
+        template <typename T>
+        static std::shared_ptr<const T> get(const FilePath& elemDir) noexcept
+        {
+            static QMutex sMutex; // one cache per element type
+            static QHash<QString, std::weak_ptr<const T>> sCache;
+
+            QMutexLocker lock(&sMutex);
+            auto it = sCache.find(elemDir.toStr());
+            if (it != sCache.end()) {
+                if (std::shared_ptr<const T> element = it->lock()) {
+                    return element;
+                }
+                sCache.erase(it); // expired
+            }
+            QString errorMsg;
+            std::shared_ptr<const T> element(
+                LibraryBaseElement::tryLoad<T>(elemDir, true, &errorMsg).release());
+            if (element) {
+                sCache.insert(elemDir.toStr(), std::weak_ptr<const T>(element));
+            } else {
+                qWarning() << "Could not load library element:" << errorMsg;
+            }
+            return element;
+        }
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace library
+} // namespace librepcb
+
+#endif // LIBREPCB_LIBRARY_LIBRARYELEMENTCACHE_H
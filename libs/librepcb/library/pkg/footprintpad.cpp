@@ -142,8 +142,15 @@ const QPainterPath& FootprintPad::toQPainterPathPx() const noexcept
     return mPainterPathPx;
 }
 
-QPainterPath FootprintPad::toMaskQPainterPathPx(const Length& clearance) const noexcept
+const QPainterPath& FootprintPad::toMaskQPainterPathPx(const Length& clearance) const noexcept
 {
+    // cached per clearance: the mask paths are drawn on every paint of every pad
+    // graphics item, so they must not be rebuilt per call
+    auto it = mMaskPathsPx.find(clearance.toNm());
+    if (it != mMaskPathsPx.end()) {
+        return it.value();
+    }
+
     QPainterPath p;
     qreal w = qMax(mWidth + clearance*2, Length(0)).toPx();
     qreal h = qMax(mHeight + clearance*2, Length(0)).toPx();
@@ -177,7 +184,7 @@ QPainterPath FootprintPad::toMaskQPainterPathPx(const Length& clearance) const n
         }
         default: Q_ASSERT(false); break;
     }
-    return p;
+    return mMaskPathsPx.insert(clearance.toNm(), p).value();
 }
 
 /*****************************************************************************************
@@ -204,6 +211,7 @@ void FootprintPad::setShape(Shape shape) noexcept
 {
     mShape = shape;
     mPainterPathPx = QPainterPath(); // invalidate painter path
+    mMaskPathsPx.clear();
     if (mRegisteredGraphicsItem) mRegisteredGraphicsItem->setShape(toQPainterPathPx());
 }
 
@@ -211,6 +219,7 @@ void FootprintPad::setWidth(const Length& width) noexcept
 {
     mWidth = width;
     mPainterPathPx = QPainterPath(); // invalidate painter path
+    mMaskPathsPx.clear();
     if (mRegisteredGraphicsItem) mRegisteredGraphicsItem->setShape(toQPainterPathPx());
 }
 
@@ -218,6 +227,7 @@ void FootprintPad::setHeight(const Length& height) noexcept
 {
     mHeight = height;
     mPainterPathPx = QPainterPath(); // invalidate painter path
+    mMaskPathsPx.clear();
     if (mRegisteredGraphicsItem) mRegisteredGraphicsItem->setShape(toQPainterPathPx());
 }
 
@@ -225,6 +235,7 @@ void FootprintPad::setDrillDiameter(const Length& diameter) noexcept
 {
     mDrillDiameter = diameter;
     mPainterPathPx = QPainterPath(); // invalidate painter path
+    mMaskPathsPx.clear();
     if (mRegisteredGraphicsItem) mRegisteredGraphicsItem->setShape(toQPainterPathPx());
 }
 
@@ -232,6 +243,7 @@ void FootprintPad::setBoardSide(BoardSide side) noexcept
 {
     mBoardSide = side;
     mPainterPathPx = QPainterPath(); // invalidate painter path
+    mMaskPathsPx.clear();
     if (mRegisteredGraphicsItem) mRegisteredGraphicsItem->setLayerName(getLayerName());
     if (mRegisteredGraphicsItem) mRegisteredGraphicsItem->setShape(toQPainterPathPx());
 }
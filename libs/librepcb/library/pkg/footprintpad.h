@@ -80,7 +80,7 @@ class FootprintPad final : public SerializableObject
         bool isOnLayer(const QString& name) const noexcept;
         QRectF getBoundingRectPx() const noexcept;
         const QPainterPath& toQPainterPathPx() const noexcept;
-        QPainterPath toMaskQPainterPathPx(const Length& clearance) const noexcept;
+        const QPainterPath& toMaskQPainterPathPx(const Length& clearance) const noexcept;
 
         // Setters
         void setPackagePadUuid(const Uuid& pad) noexcept;
@@ -122,6 +122,7 @@ class FootprintPad final : public SerializableObject
         Length mDrillDiameter; // no effect if BoardSide != THT!
         BoardSide mBoardSide;
         mutable QPainterPath mPainterPathPx; // used for caching
+        mutable QHash<LengthBase_t, QPainterPath> mMaskPathsPx; ///< cache, key: clearance [nm]
 
         FootprintPadGraphicsItem* mRegisteredGraphicsItem;
 };
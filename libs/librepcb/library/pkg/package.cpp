@@ -42,9 +42,14 @@ Package::Package(const Uuid& uuid, const Version& version, const QString& author
 {
 }
 
-Package::Package(const FilePath& elementDirectory, bool readOnly) :
+Package::Package(const FilePath& elementDirectory, bool readOnly, bool lazyLoad) :
     LibraryElement(elementDirectory, getShortElementName(), getLongElementName(), readOnly)
 {
+    if (lazyLoad) {
+        // the pads and footprint geometry are by far the most expensive part, so
+        // keep the DOM and parse them on first access (see ensureLazySectionsLoaded())
+        return;
+    }
     const DomElement& root = mLoadingXmlFileDocument->getRoot();
     mPads.loadFromDomElement(root);
     mFootprints.loadFromDomElement(root);
@@ -60,8 +65,25 @@ Package::~Package() noexcept
  *  Private Methods
  ****************************************************************************************/
 
+void Package::ensureLazySectionsLoaded() const noexcept
+{
+    if (!mLoadingXmlFileDocument) {
+        return; // everything is loaded already
+    }
+    Package& self = const_cast<Package&>(*this);
+    try {
+        const DomElement& root = mLoadingXmlFileDocument->getRoot();
+        self.mPads.loadFromDomElement(root); // can throw
+        self.mFootprints.loadFromDomElement(root); // can throw
+    } catch (const Exception& e) {
+        qCritical() << "Could not lazy-load library package:" << e.getMsg();
+    }
+    self.cleanupAfterLoadingElementFromFile();
+}
+
 void Package::serialize(DomElement& root) const
 {
+    ensureLazySectionsLoaded();
     LibraryElement::serialize(root);
     mPads.serialize(root);
     mFootprints.serialize(root);
@@ -69,6 +91,7 @@ void Package::serialize(DomElement& root) const
 
 bool Package::checkAttributesValidity() const noexcept
 {
+    ensureLazySectionsLoaded();
     if (!LibraryElement::checkAttributesValidity())             return false;
     return true;
 }
@@ -64,14 +64,14 @@ class Package final : public LibraryElement
         Package(const Uuid& uuid, const Version& version, const QString& author,
                 const QString& name_en_US, const QString& description_en_US,
                 const QString& keywords_en_US);
-        Package(const FilePath& elementDirectory, bool readOnly);
+        Package(const FilePath& elementDirectory, bool readOnly, bool lazyLoad = false);
         ~Package() noexcept;
 
         // Getters
-        PackagePadList& getPads() noexcept {return mPads;}
-        const PackagePadList& getPads() const noexcept {return mPads;}
-        FootprintList& getFootprints() noexcept {return mFootprints;}
-        const FootprintList& getFootprints() const noexcept {return mFootprints;}
+        PackagePadList& getPads() noexcept {ensureLazySectionsLoaded(); return mPads;}
+        const PackagePadList& getPads() const noexcept {ensureLazySectionsLoaded(); return mPads;}
+        FootprintList& getFootprints() noexcept {ensureLazySectionsLoaded(); return mFootprints;}
+        const FootprintList& getFootprints() const noexcept {ensureLazySectionsLoaded(); return mFootprints;}
 
         // Operator Overloadings
         Package& operator=(const Package& rhs) = delete;
@@ -83,6 +83,15 @@ class Package final : public LibraryElement
 
     private: // Methods
 
+        /**
+         * @brief Parse the pads and footprints if loading them was deferred
+         *
+         * Does nothing if the element was not opened with lazyLoad=true (see
+         * constructor). Logically the element state does not change, so this is
+         * allowed even on const objects.
+         */
+        void ensureLazySectionsLoaded() const noexcept;
+
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(DomElement& root) const override;
         bool checkAttributesValidity() const noexcept override;
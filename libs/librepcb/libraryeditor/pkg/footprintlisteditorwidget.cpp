@@ -235,6 +235,7 @@ void FootprintListEditorWidget::setTableRowContent(int row, const Uuid& uuid,
         buttonsColumnLayout->addWidget(btnCopy);
 
         QToolButton* btnUp = new QToolButton(buttonsColumnWidget);
+        btnUp->setObjectName("btnUp");
         btnUp->setProperty("row", row);
         btnUp->setFixedSize(btnSize, btnSize);
         btnUp->setIcon(QIcon(":/img/actions/up.png"));
@@ -245,6 +246,7 @@ void FootprintListEditorWidget::setTableRowContent(int row, const Uuid& uuid,
         buttonsColumnLayout->addWidget(btnUp);
 
         QToolButton* btnDown = new QToolButton(buttonsColumnWidget);
+        btnDown->setObjectName("btnDown");
         btnDown->setProperty("row", row);
         btnDown->setFixedSize(btnSize, btnSize);
         btnDown->setIcon(QIcon(":/img/actions/down.png"));
@@ -271,7 +273,10 @@ void FootprintListEditorWidget::addFootprint(const QString& name) noexcept
         Uuid uuid = Uuid::createRandom();
         mUndoStack->execCmd(new CmdFootprintInsert(*mFootprintList,
             std::make_shared<Footprint>(uuid, name, ""))); // can throw
-        updateTable(uuid);
+        if (QTableWidgetItem* item = mTable->item(newFootprintRow(), COLUMN_NAME)) {
+            item->setText(""); // clear the "add new footprint" row
+        }
+        selectFootprint(uuid);
     } catch (const Exception& e) {
         QMessageBox::critical(this, tr("Could not add footprint"), e.getMsg());
     }
@@ -291,7 +296,9 @@ void FootprintListEditorWidget::moveFootprintUp(int index) noexcept
 {
     Q_ASSERT(index >= 1 && index < mFootprintList->count());
     try {
+        Uuid uuid = mFootprintList->at(index)->getUuid();
         mUndoStack->execCmd(new CmdFootprintsSwap(*mFootprintList, index, index - 1)); // can throw
+        selectFootprint(uuid); // keep the moved footprint selected
     } catch (const Exception& e) {
         QMessageBox::critical(this, tr("Could not move footprint"), e.getMsg());
     }
@@ -301,7 +308,9 @@ void FootprintListEditorWidget::moveFootprintDown(int index) noexcept
 {
     Q_ASSERT(index >= 0 && index < mFootprintList->count() - 1);
     try {
+        Uuid uuid = mFootprintList->at(index)->getUuid();
         mUndoStack->execCmd(new CmdFootprintsSwap(*mFootprintList, index, index + 1)); // can throw
+        selectFootprint(uuid); // keep the moved footprint selected
     } catch (const Exception& e) {
         QMessageBox::critical(this, tr("Could not move footprint"), e.getMsg());
     }
@@ -320,12 +329,22 @@ void FootprintListEditorWidget::copyFootprint(const Uuid& uuid) noexcept
         copy->getTexts() = original->getTexts();
         copy->getHoles() = original->getHoles();
         mUndoStack->execCmd(new CmdFootprintInsert(*mFootprintList, copy)); // can throw
-        updateTable(copy->getUuid());
+        selectFootprint(copy->getUuid());
     } catch (const Exception& e) {
         QMessageBox::critical(this, tr("Could not copy footprint"), e.getMsg());
     }
 }
 
+void FootprintListEditorWidget::selectFootprint(const Uuid& uuid) noexcept
+{
+    for (int i = 0; i < mFootprintList->count(); ++i) {
+        if (mFootprintList->at(i)->getUuid() == uuid) {
+            mTable->selectRow(indexToRow(i));
+            return;
+        }
+    }
+}
+
 QString FootprintListEditorWidget::setName(const Uuid& uuid, const QString& name) noexcept
 {
     Footprint* footprint = mFootprintList->find(uuid).get(); Q_ASSERT(footprint);
@@ -345,6 +364,26 @@ QString FootprintListEditorWidget::setName(const Uuid& uuid, const QString& name
     }
 }
 
+void FootprintListEditorWidget::updateRowProperties(int fromRow) noexcept
+{
+    for (int row = 0; row < mTable->rowCount(); ++row) {
+        QWidget* widget = mTable->cellWidget(row, COLUMN_BUTTONS);
+        if (!widget) continue;
+        if (row >= fromRow) {
+            foreach (QToolButton* btn, widget->findChildren<QToolButton*>()) {
+                btn->setProperty("row", row);
+            }
+        }
+        // the first/last row may have changed, so update all up/down buttons
+        if (QToolButton* btn = widget->findChild<QToolButton*>("btnUp")) {
+            btn->setEnabled(rowToIndex(row) > 0);
+        }
+        if (QToolButton* btn = widget->findChild<QToolButton*>("btnDown")) {
+            btn->setEnabled(rowToIndex(row) < mFootprintList->count() - 1);
+        }
+    }
+}
+
 int FootprintListEditorWidget::getRowOfTableCellWidget(QObject* obj) const noexcept
 {
     bool ok = false;
@@ -388,15 +427,29 @@ QString FootprintListEditorWidget::cleanName(const QString& name) noexcept
 void FootprintListEditorWidget::listObjectAdded(const FootprintList& list, int newIndex,
                                                 const std::shared_ptr<Footprint>& ptr) noexcept
 {
-    Q_ASSERT(&list == mFootprintList); Q_UNUSED(list); Q_UNUSED(newIndex); Q_UNUSED(ptr);
-    updateTable(mSelectedFootprint);
+    Q_ASSERT(&list == mFootprintList); Q_UNUSED(list);
+    // only insert the new row instead of rebuilding the whole table - rebuilding
+    // creates several widgets per row and gets slow with many footprints
+    mTable->blockSignals(true);
+    int row = indexToRow(newIndex);
+    mTable->insertRow(row);
+    setTableRowContent(row, ptr->getUuid(), ptr->getNames().getDefaultValue());
+    updateRowProperties(row + 1); // all rows below have moved down
+    mTable->blockSignals(false);
+    mSelectedFootprint = getUuidOfRow(mTable->currentRow());
+    emit currentFootprintChanged(rowToIndex(mTable->currentRow()));
 }
 
 void FootprintListEditorWidget::listObjectRemoved(const FootprintList& list, int oldIndex,
                                                   const std::shared_ptr<Footprint>& ptr) noexcept
 {
-    Q_ASSERT(&list == mFootprintList); Q_UNUSED(list); Q_UNUSED(oldIndex); Q_UNUSED(ptr);
-    updateTable(mSelectedFootprint);
+    Q_ASSERT(&list == mFootprintList); Q_UNUSED(list); Q_UNUSED(ptr);
+    mTable->blockSignals(true);
+    mTable->removeRow(indexToRow(oldIndex));
+    updateRowProperties(indexToRow(oldIndex)); // all rows below have moved up
+    mTable->blockSignals(false);
+    mSelectedFootprint = getUuidOfRow(mTable->currentRow());
+    emit currentFootprintChanged(rowToIndex(mTable->currentRow()));
 }
 
 /*****************************************************************************************
@@ -89,6 +89,8 @@ class FootprintListEditorWidget final : public QWidget, private FootprintList::I
     private: // Methods
         void updateTable(Uuid selected = Uuid()) noexcept;
         void setTableRowContent(int row, const Uuid& uuid, const QString& name) noexcept;
+        void updateRowProperties(int fromRow) noexcept;
+        void selectFootprint(const Uuid& uuid) noexcept;
         void addFootprint(const QString& name) noexcept;
         void removeFootprint(const Uuid& uuid) noexcept;
         void moveFootprintUp(int index) noexcept;
@@ -69,6 +69,13 @@ PackageEditorWidget::PackageEditorWidget(const Context& context,
 
     // load package
     mPackage.reset(new Package(fp, false)); // can throw
+
+    connect(mPackage.data(), &LibraryBaseElement::asyncSaveFinished, this,
+            [this](bool success, const QString& errorMsg){
+                if (!success) {
+                    QMessageBox::critical(this, tr("Save failed"), errorMsg);
+                }
+            });
     setWindowTitle(mPackage->getNames().value(getLibLocaleOrder()));
     mUi->lblUuid->setText(QString("<a href=\"%1\">%2</a>").arg(
         mPackage->getFilePath().toQUrl().toString(), mPackage->getUuid().toStr()));
@@ -176,7 +183,12 @@ bool PackageEditorWidget::save() noexcept
         mPackage->setVersion(version);
         mPackage->setCategories(mCategoriesEditorWidget->getUuids());
         mPackage->setDeprecated(mUi->cbxDeprecated->isChecked());
-        mPackage->save();
+        // asynchronous save: the serialized snapshot is written by a worker thread,
+        // so the GUI continues optimistically; errors are reported when they occur
+        if (!mPackage->startAsyncSave()) {
+            throw RuntimeError(__FILE__, __LINE__,
+                               tr("Could not serialize the element."));
+        }
         memorizePackageInterface();
         return EditorWidgetBase::save();
     } catch (const Exception& e) {
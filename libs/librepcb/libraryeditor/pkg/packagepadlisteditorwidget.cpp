@@ -201,7 +201,9 @@ void PackagePadListEditorWidget::addPad(const QString& name) noexcept
         throwIfNameEmptyOrExists(name);
         executeCommand(new CmdPackagePadInsert(*mPadList,
             std::make_shared<PackagePad>(Uuid::createRandom(), name))); // can throw
-        //updateTable();
+        if (QTableWidgetItem* item = mTable->item(newPadRow(), COLUMN_NAME)) {
+            item->setText(""); // clear the "add new pad" row
+        }
     } catch (const Exception& e) {
         QMessageBox::critical(this, tr("Could not add pad"), e.getMsg());
     }
@@ -237,6 +239,14 @@ QString PackagePadListEditorWidget::setName(const Uuid& uuid, const QString& nam
     }
 }
 
+void PackagePadListEditorWidget::updateRowProperties(int fromRow) noexcept
+{
+    for (int row = fromRow; row < mTable->rowCount(); ++row) {
+        QWidget* widget = mTable->cellWidget(row, COLUMN_BUTTONS);
+        if (widget) widget->setProperty("row", row);
+    }
+}
+
 int PackagePadListEditorWidget::getRowOfTableCellWidget(QObject* obj) const noexcept
 {
     bool ok = false;
@@ -295,15 +305,27 @@ QString PackagePadListEditorWidget::getNextPadNameProposal() const noexcept
 void PackagePadListEditorWidget::listObjectAdded(const PackagePadList& list, int newIndex,
                                                  const std::shared_ptr<PackagePad>& ptr) noexcept
 {
-    Q_ASSERT(&list == mPadList); Q_UNUSED(list); Q_UNUSED(newIndex); Q_UNUSED(ptr);
-    updateTable(mSelectedPad);
+    Q_ASSERT(&list == mPadList); Q_UNUSED(list);
+    // only insert the new row instead of rebuilding the whole table - rebuilding
+    // creates hundreds of widgets per edit when the package has many pads
+    mTable->blockSignals(true);
+    int row = indexToRow(newIndex);
+    mTable->insertRow(row);
+    setTableRowContent(row, ptr->getUuid(), ptr->getName());
+    updateRowProperties(row + 1); // all rows below have moved down
+    mTable->blockSignals(false);
+    mSelectedPad = getUuidOfRow(mTable->currentRow());
 }
 
 void PackagePadListEditorWidget::listObjectRemoved(const PackagePadList& list, int oldIndex,
                                                    const std::shared_ptr<PackagePad>& ptr) noexcept
 {
-    Q_ASSERT(&list == mPadList); Q_UNUSED(list); Q_UNUSED(oldIndex); Q_UNUSED(ptr);
-    updateTable(mSelectedPad);
+    Q_ASSERT(&list == mPadList); Q_UNUSED(list); Q_UNUSED(ptr);
+    mTable->blockSignals(true);
+    mTable->removeRow(indexToRow(oldIndex));
+    updateRowProperties(indexToRow(oldIndex)); // all rows below have moved up
+    mTable->blockSignals(false);
+    mSelectedPad = getUuidOfRow(mTable->currentRow());
 }
 
 /*****************************************************************************************
@@ -82,6 +82,7 @@ class PackagePadListEditorWidget final : public QWidget, private PackagePadList:
     private: // Methods
         void updateTable(Uuid selected = Uuid()) noexcept;
         void setTableRowContent(int row, const Uuid& uuid, const QString& name) noexcept;
+        void updateRowProperties(int fromRow) noexcept;
         void addPad(const QString& name) noexcept;
         void removePad(const Uuid& uuid) noexcept;
         QString setName(const Uuid& uuid, const QString& name) noexcept;
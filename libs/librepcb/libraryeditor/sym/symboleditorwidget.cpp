@@ -70,6 +70,13 @@ SymbolEditorWidget::SymbolEditorWidget(const Context& context, const FilePath& f
 
     // load symbol
     mSymbol.reset(new Symbol(fp, false)); // can throw
+
+    connect(mSymbol.data(), &LibraryBaseElement::asyncSaveFinished, this,
+            [this](bool success, const QString& errorMsg){
+                if (!success) {
+                    QMessageBox::critical(this, tr("Save failed"), errorMsg);
+                }
+            });
     setWindowTitle(mSymbol->getNames().value(getLibLocaleOrder()));
     mUi->lblUuid->setText(QString("<a href=\"%1\">%2</a>").arg(
         mSymbol->getFilePath().toQUrl().toString(), mSymbol->getUuid().toStr()));
@@ -170,7 +177,12 @@ bool SymbolEditorWidget::save() noexcept
         mSymbol->setVersion(version);
         mSymbol->setCategories(mCategoriesEditorWidget->getUuids());
         mSymbol->setDeprecated(mUi->cbxDeprecated->isChecked());
-        mSymbol->save();
+        // asynchronous save: the serialized snapshot is written by a worker thread,
+        // so the GUI continues optimistically; errors are reported when they occur
+        if (!mSymbol->startAsyncSave()) {
+            throw RuntimeError(__FILE__, __LINE__,
+                               tr("Could not serialize the element."));
+        }
         mOriginalSymbolPinUuids = mSymbol->getPins().getUuidSet();
         return EditorWidgetBase::save();
     } catch (const Exception& e) {
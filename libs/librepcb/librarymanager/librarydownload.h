@@ -43,6 +43,16 @@ namespace manager {
 /**
  * @brief The LibraryDownload class
  *
+ * Note on delta updates: downloading only the changed elements of a library
+ * release instead of the whole ZIP needs a per-element manifest (paths +
+ * content hashes) served by the API next to the archive - the current
+ * api.librepcb.org contract only provides whole-library ZIPs, so there is
+ * nothing to diff against on the client side. Until the API grows such a
+ * manifest endpoint, the practical mitigations are already in place: the
+ * library list is revalidated with ETags instead of re-downloaded, and
+ * interrupted ZIP downloads resume with HTTP range requests instead of
+ * restarting (see librepcb::FileDownload).
+ *
  * @author ubruhin
  * @date 2016-10-01
  */
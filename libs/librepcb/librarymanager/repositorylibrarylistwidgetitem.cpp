@@ -57,6 +57,7 @@ RepositoryLibraryListWidgetItem::RepositoryLibraryListWidgetItem(workspace::Work
     QString desc = mJsonObject.value("description").toObject().value("en_US").toString();
     QString author = mJsonObject.value("author").toString();
     QUrl iconUrl = QUrl(mJsonObject.value("icon_url").toString());
+    mIconUrlStr = iconUrl.toString();
     foreach (const QJsonValue& value, mJsonObject.value("dependencies").toArray()) {
         Uuid uuid(value.toString());
         if (!uuid.isNull()) {
@@ -203,11 +204,67 @@ void RepositoryLibraryListWidgetItem::downloadFinished(bool success, const QStri
     mLibraryDownload.reset();
 }
 
+namespace {
+
+/**
+ * LRU cache of decoded library icons, keyed by icon URL (cost = image bytes). The
+ * "Add Library" tab re-requests the repository list on every open; with conditional
+ * HTTP requests the raw bytes arrive instantly from the index cache, and this cache
+ * additionally avoids re-decoding the same PNGs every time. Thread-safe since the
+ * decoding runs on the global thread pool.
+ */
+QMutex& iconCacheMutex() noexcept
+{
+    static QMutex mutex;
+    return mutex;
+}
+
+QCache<QString, QImage>& iconCache() noexcept
+{
+    static QCache<QString, QImage> cache(4 * 1024 * 1024); // max total cost [bytes]
+    return cache;
+}
+
+/// @return a copy of the cached icon, or a null image if not cached
+QImage lookupCachedIcon(const QString& url) noexcept
+{
+    QMutexLocker lock(&iconCacheMutex());
+    const QImage* cached = iconCache().object(url);
+    return cached ? *cached : QImage();
+}
+
+void insertCachedIcon(const QString& url, const QImage& image) noexcept
+{
+    QMutexLocker lock(&iconCacheMutex());
+    iconCache().insert(url, new QImage(image), qMax(1, image.byteCount()));
+}
+
+} // namespace
+
 void RepositoryLibraryListWidgetItem::iconReceived(const QByteArray& data) noexcept
 {
-    QPixmap pixmap;
-    pixmap.loadFromData(data);
-    mUi->lblIcon->setPixmap(pixmap);
+    // decoding the PNG on the GUI thread janks the list when many entries arrive at
+    // once, so it runs on the global thread pool (QImage may be used there, QPixmap
+    // may not); already decoded icons come from the shared cache directly
+    QImage cached = lookupCachedIcon(mIconUrlStr);
+    if (!cached.isNull()) {
+        mUi->lblIcon->setPixmap(QPixmap::fromImage(cached));
+        return;
+    }
+    connect(&mIconDecodeWatcher, &QFutureWatcher<QImage>::finished,
+            this, &RepositoryLibraryListWidgetItem::iconDecoded, Qt::UniqueConnection);
+    mIconDecodeWatcher.setFuture(QtConcurrent::run([data]() {
+        return QImage::fromData(data);
+    }));
+}
+
+void RepositoryLibraryListWidgetItem::iconDecoded() noexcept
+{
+    QImage image = mIconDecodeWatcher.result();
+    if (!image.isNull()) {
+        insertCachedIcon(mIconUrlStr, image);
+        mUi->lblIcon->setPixmap(QPixmap::fromImage(image));
+    }
 }
 
 /*****************************************************************************************
@@ -96,12 +96,15 @@ class RepositoryLibraryListWidgetItem final : public QWidget
 
         void downloadFinished(bool success, const QString& errMsg) noexcept;
         void iconReceived(const QByteArray& data) noexcept;
+        void iconDecoded() noexcept;
 
 
     private: // Data
 
         workspace::Workspace& mWorkspace;
         QJsonObject mJsonObject;
+        QString mIconUrlStr; ///< cache key of the icon, see iconReceived()
+        QFutureWatcher<QImage> mIconDecodeWatcher; ///< watches the decode worker
         Uuid mUuid;
         Version mVersion;
         bool mIsRecommended;
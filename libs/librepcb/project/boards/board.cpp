@@ -32,7 +32,9 @@
 #include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/gridproperties.h>
 #include "../circuit/circuit.h"
+#include "../circuit/circuitconnectivity.h"
 #include "../erc/ercmsg.h"
+#include "../erc/ercmsglist.h"
 #include "../circuit/componentinstance.h"
 #include "items/bi_device.h"
 #include "items/bi_footprint.h"
@@ -42,8 +44,13 @@
 #include "items/bi_netline.h"
 #include <librepcb/library/cmp/component.h>
 #include "items/bi_polygon.h"
+#include "items/bi_plane.h"
 #include "boardlayerstack.h"
 #include "boardusersettings.h"
+#include "boardspatialindex.h"
+#include "boardratsnest.h"
+#include "graphicsitems/bgi_airwires.h"
+#include "boardplanefragmentsbuilder.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -57,11 +64,19 @@ namespace project {
 
 Board::Board(const Board& other, const FilePath& filepath, const QString& name) :
     QObject(&other.getProject()), mProject(other.getProject()), mFilePath(filepath),
-    mIsAddedToProject(false)
+    mIsAddedToProject(false), mAttributesChangedScheduled(false)
 {
     try
     {
         mGraphicsScene.reset(new GraphicsScene());
+        mSpatialIndex.reset(new BoardSpatialIndex());
+        mRatsnest.reset(new BoardRatsnest(*this));
+        mPlanesBuilder.reset(new BoardPlaneFragmentsBuilder(*this));
+
+        mAirWiresItem.reset(new BGI_AirWires(*this));
+        mGraphicsScene->addItem(*mAirWiresItem);
+        connect(mRatsnest.data(), &BoardRatsnest::airWiresChanged, this,
+                [this](){mAirWiresItem->setAirWires(mRatsnest->getAllAirWires());});
 
         // copy the other board
         mXmlFile.reset(SmartXmlFile::create(mFilePath));
@@ -134,11 +149,18 @@ Board::Board(const Board& other, const FilePath& filepath, const QString& name)
             mPolygons.append(copy);
         }
 
+        // copy planes
+        foreach (const BI_Plane* plane, other.mPlanes) {
+            BI_Plane* copy = new BI_Plane(*this, *plane);
+            mPlanes.append(copy);
+        }
+
         updateErcMessages();
-        updateIcon();
 
-        // emit the "attributesChanged" signal when the project has emited it
-        connect(&mProject, &Project::attributesChanged, this, &Board::attributesChanged);
+        // re-emit the "attributesChanged" signal of the project, coalesced to one
+        // notification per event loop turn (see scheduleAttributesChanged())
+        connect(&mProject, &Project::attributesChanged,
+                this, &Board::scheduleAttributesChanged);
 
         connect(&mProject.getCircuit(), &Circuit::componentAdded, this, &Board::updateErcMessages);
         connect(&mProject.getCircuit(), &Circuit::componentRemoved, this, &Board::updateErcMessages);
@@ -149,6 +171,7 @@ Board::Board(const Board& other, const FilePath& filepath, const QString& name)
     {
         // free the allocated memory in the reverse order of their allocation...
         qDeleteAll(mErcMsgListUnplacedComponentInstances);    mErcMsgListUnplacedComponentInstances.clear();
+        qDeleteAll(mPlanes);            mPlanes.clear();
         qDeleteAll(mPolygons);          mPolygons.clear();
         qDeleteAll(mNetLines);          mNetLines.clear();
         qDeleteAll(mNetPoints);         mNetPoints.clear();
@@ -159,18 +182,31 @@ Board::Board(const Board& other, const FilePath& filepath, const QString& name)
         mGridProperties.reset();
         mLayerStack.reset();
         mXmlFile.reset();
+        if (mAirWiresItem) {
+            mGraphicsScene->removeItem(*mAirWiresItem);
+            mAirWiresItem.reset();
+        }
         mGraphicsScene.reset();
         throw; // ...and rethrow the exception
     }
 }
 
 Board::Board(Project& project, const FilePath& filepath, bool restore,
-             bool readOnly, bool create, const QString& newName) :
-    QObject(&project), mProject(project), mFilePath(filepath), mIsAddedToProject(false)
+             bool readOnly, bool create, const QString& newName,
+             DomDocument* preParsedDoc) :
+    QObject(&project), mProject(project), mFilePath(filepath), mIsAddedToProject(false), mAttributesChangedScheduled(false)
 {
     try
     {
         mGraphicsScene.reset(new GraphicsScene());
+        mSpatialIndex.reset(new BoardSpatialIndex());
+        mRatsnest.reset(new BoardRatsnest(*this));
+        mPlanesBuilder.reset(new BoardPlaneFragmentsBuilder(*this));
+
+        mAirWiresItem.reset(new BGI_AirWires(*this));
+        mGraphicsScene->addItem(*mAirWiresItem);
+        connect(mRatsnest.data(), &BoardRatsnest::airWiresChanged, this,
+                [this](){mAirWiresItem->setAirWires(mRatsnest->getAllAirWires());});
 
         // try to open/create the XML board file
         if (create)
@@ -196,8 +232,11 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
         else
         {
             mXmlFile.reset(new SmartXmlFile(mFilePath, restore, readOnly));
-            std::unique_ptr<DomDocument> doc = mXmlFile->parseFileAndBuildDomTree();
-            DomElement& root = doc->getRoot();
+            std::unique_ptr<DomDocument> doc;
+            if (!preParsedDoc) {
+                doc = mXmlFile->parseFileAndBuildDomTree();
+            }
+            DomElement& root = preParsedDoc ? preParsedDoc->getRoot() : doc->getRoot();
 
             // the board seems to be ready to open, so we will create all needed objects
 
@@ -265,13 +304,25 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
                 BI_Polygon* polygon = new BI_Polygon(*this, *node);
                 mPolygons.append(polygon);
             }
+
+            // Load all planes
+            foreach (const DomElement* node, root.getChilds("plane")) {
+                BI_Plane* plane = new BI_Plane(*this, *node);
+                if (getPlaneByUuid(plane->getUuid())) {
+                    throw RuntimeError(__FILE__, __LINE__,
+                        QString(tr("There is already a plane with the UUID \"%1\"!"))
+                        .arg(plane->getUuid().toStr()));
+                }
+                mPlanes.append(plane);
+            }
         }
 
         updateErcMessages();
-        updateIcon();
 
-        // emit the "attributesChanged" signal when the project has emited it
-        connect(&mProject, &Project::attributesChanged, this, &Board::attributesChanged);
+        // re-emit the "attributesChanged" signal of the project, coalesced to one
+        // notification per event loop turn (see scheduleAttributesChanged())
+        connect(&mProject, &Project::attributesChanged,
+                this, &Board::scheduleAttributesChanged);
 
         connect(&mProject.getCircuit(), &Circuit::componentAdded, this, &Board::updateErcMessages);
         connect(&mProject.getCircuit(), &Circuit::componentRemoved, this, &Board::updateErcMessages);
@@ -282,6 +333,7 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
     {
         // free the allocated memory in the reverse order of their allocation...
         qDeleteAll(mErcMsgListUnplacedComponentInstances);    mErcMsgListUnplacedComponentInstances.clear();
+        qDeleteAll(mPlanes);            mPlanes.clear();
         qDeleteAll(mPolygons);          mPolygons.clear();
         qDeleteAll(mNetLines);          mNetLines.clear();
         qDeleteAll(mNetPoints);         mNetPoints.clear();
@@ -292,6 +344,10 @@ Board::Board(Project& project, const FilePath& filepath, bool restore,
         mGridProperties.reset();
         mLayerStack.reset();
         mXmlFile.reset();
+        if (mAirWiresItem) {
+            mGraphicsScene->removeItem(*mAirWiresItem);
+            mAirWiresItem.reset();
+        }
         mGraphicsScene.reset();
         throw; // ...and rethrow the exception
     }
@@ -304,6 +360,7 @@ Board::~Board() noexcept
     qDeleteAll(mErcMsgListUnplacedComponentInstances);    mErcMsgListUnplacedComponentInstances.clear();
 
     // delete all items
+    qDeleteAll(mPlanes);            mPlanes.clear();
     qDeleteAll(mPolygons);          mPolygons.clear();
     qDeleteAll(mNetLines);          mNetLines.clear();
     qDeleteAll(mNetPoints);         mNetPoints.clear();
@@ -315,6 +372,8 @@ Board::~Board() noexcept
     mGridProperties.reset();
     mLayerStack.reset();
     mXmlFile.reset();
+    mGraphicsScene->removeItem(*mAirWiresItem);
+    mAirWiresItem.reset();
     mGraphicsScene.reset();
 }
 
@@ -343,32 +402,46 @@ QList<BI_Base*> Board::getSelectedItems(bool vias,
                                         bool attachedLines,
                                         bool attachedLinesFromFootprints) const noexcept
 {
-    // TODO: this method is incredible ugly ;)
+    // iterate only the maintained selection set (see itemSelectionChanged()), so
+    // the cost is O(selection) instead of O(board). The items are bucketed per
+    // type first to keep the same per-type processing order as before.
+    QList<BI_Footprint*> selFootprints;
+    QList<BI_FootprintPad*> selPads;
+    QList<BI_Via*> selVias;
+    QList<BI_NetPoint*> selNetPoints;
+    QList<BI_NetLine*> selNetLines;
+    foreach (BI_Base* item, mSelectedItems) {
+        switch (item->getType()) {
+            case BI_Base::Type_t::Footprint:
+                selFootprints.append(static_cast<BI_Footprint*>(item)); break;
+            case BI_Base::Type_t::FootprintPad:
+                selPads.append(static_cast<BI_FootprintPad*>(item)); break;
+            case BI_Base::Type_t::Via:
+                selVias.append(static_cast<BI_Via*>(item)); break;
+            case BI_Base::Type_t::NetPoint:
+                selNetPoints.append(static_cast<BI_NetPoint*>(item)); break;
+            case BI_Base::Type_t::NetLine:
+                selNetLines.append(static_cast<BI_NetLine*>(item)); break;
+            default: break;
+        }
+    }
 
     QList<BI_Base*> list;
-    foreach (BI_Device* component, mDeviceInstances)
+    foreach (BI_Footprint* footprint, selFootprints)
     {
-        BI_Footprint& footprint = component->getFootprint();
-
         // footprint
-        if (footprint.isSelected())
-            list.append(&footprint);
+        list.append(footprint);
 
-        // pads
-        foreach (BI_FootprintPad* pad, footprint.getPads())
+        // attached netpoints & netlines of its pads
+        foreach (BI_FootprintPad* pad, footprint->getPads())
         {
-            // pad
-            if (pad->isSelected() && footprintPads)
-                list.append(pad);
-
-            // attached netpoints & netlines
             foreach (BI_NetPoint* attachedNetPoint, pad->getNetPoints()) {
-                if (footprint.isSelected() && attachedPointsFromFootprints && attachedNetPoint)
+                if (attachedPointsFromFootprints && attachedNetPoint)
                 {
                     if (!list.contains(attachedNetPoint))
                         list.append(attachedNetPoint);
                 }
-                if (footprint.isSelected() && attachedLinesFromFootprints && attachedNetPoint)
+                if (attachedLinesFromFootprints && attachedNetPoint)
                 {
                     foreach (BI_NetLine* attachedNetLine, attachedNetPoint->getLines())
                     {
@@ -379,15 +452,20 @@ QList<BI_Base*> Board::getSelectedItems(bool vias,
             }
         }
     }
-    foreach (BI_Via* via, mVias)
+    if (footprintPads) {
+        foreach (BI_FootprintPad* pad, selPads) {
+            if (!list.contains(pad))
+                list.append(pad);
+        }
+    }
+    foreach (BI_Via* via, selVias)
     {
-        if (via->isSelected() && vias) {
+        if (vias) {
             list.append(via);
         }
     }
-    foreach (BI_NetPoint* netpoint, mNetPoints)
+    foreach (BI_NetPoint* netpoint, selNetPoints)
     {
-        if (netpoint->isSelected())
         {
             if (((!netpoint->isAttached()) && floatingPoints)
                || (netpoint->isAttached() && attachedPoints))
@@ -397,9 +475,8 @@ QList<BI_Base*> Board::getSelectedItems(bool vias,
             }
         }
     }
-    foreach (BI_NetLine* netline, mNetLines)
+    foreach (BI_NetLine* netline, selNetLines)
     {
-        if (netline->isSelected())
         {
             // netline
             if (((!netline->isAttached()) && floatingLines)
@@ -436,47 +513,51 @@ QList<BI_Base*> Board::getSelectedItems(bool vias,
 QList<BI_Base*> Board::getItemsAtScenePos(const Point& pos) const noexcept
 {
     QPointF scenePosPx = pos.toPxQPointF();
+    // query the spatial index for candidates, the exact grab area test follows below
+    QList<BI_Base*> candidates = mSpatialIndex->itemsAt(scenePosPx);
     QList<BI_Base*> list;   // Note: The order of adding the items is very important (the
                             // top most item must appear as the first item in the list)!
     // vias
-    foreach (BI_Via* via, mVias)
+    foreach (BI_Base* item, candidates)
     {
-        if (via->isSelectable() && via->getGrabAreaScenePx().contains(scenePosPx)) {
-            list.append(via);
+        if (item->getType() != BI_Base::Type_t::Via) continue;
+        if (item->isSelectable() && item->getGrabAreaScenePx().contains(scenePosPx)) {
+            list.append(item);
         }
     }
     // netpoints
-    foreach (BI_NetPoint* netpoint, mNetPoints)
+    foreach (BI_Base* item, candidates)
     {
-        if (netpoint->isSelectable() && netpoint->getGrabAreaScenePx().contains(scenePosPx)) {
-            list.append(netpoint);
+        if (item->getType() != BI_Base::Type_t::NetPoint) continue;
+        if (item->isSelectable() && item->getGrabAreaScenePx().contains(scenePosPx)) {
+            list.append(item);
         }
     }
     // netlines
-    foreach (BI_NetLine* netline, mNetLines)
+    foreach (BI_Base* item, candidates)
     {
-        if (netline->isSelectable() && netline->getGrabAreaScenePx().contains(scenePosPx)) {
-            list.append(netline);
+        if (item->getType() != BI_Base::Type_t::NetLine) continue;
+        if (item->isSelectable() && item->getGrabAreaScenePx().contains(scenePosPx)) {
+            list.append(item);
         }
     }
     // footprints & pads
-    foreach (BI_Device* device, mDeviceInstances)
+    foreach (BI_Base* item, candidates)
     {
-        BI_Footprint& footprint = device->getFootprint();
-        if (footprint.isSelectable() && footprint.getGrabAreaScenePx().contains(scenePosPx)) {
-            if (footprint.getIsMirrored()) {
-                list.append(&footprint);
-            } else {
-                list.prepend(&footprint);
+        if (item->getType() == BI_Base::Type_t::Footprint) {
+            if (item->isSelectable() && item->getGrabAreaScenePx().contains(scenePosPx)) {
+                if (item->getIsMirrored()) {
+                    list.append(item);
+                } else {
+                    list.prepend(item);
+                }
             }
-        }
-        foreach (BI_FootprintPad* pad, footprint.getPads())
-        {
-            if (pad->isSelectable() && pad->getGrabAreaScenePx().contains(scenePosPx)) {
-                if (pad->getIsMirrored()) {
-                    list.append(pad);
+        } else if (item->getType() == BI_Base::Type_t::FootprintPad) {
+            if (item->isSelectable() && item->getGrabAreaScenePx().contains(scenePosPx)) {
+                if (item->getIsMirrored()) {
+                    list.append(item);
                 } else {
-                    list.insert(1, pad);
+                    list.insert(1, item);
                 }
             }
         }
@@ -487,8 +568,10 @@ QList<BI_Base*> Board::getItemsAtScenePos(const Point& pos) const noexcept
 QList<BI_Via*> Board::getViasAtScenePos(const Point& pos, const NetSignal* netsignal) const noexcept
 {
     QList<BI_Via*> list;
-    foreach (BI_Via* via, mVias)
+    foreach (BI_Base* item, mSpatialIndex->itemsAt(pos.toPxQPointF()))
     {
+        if (item->getType() != BI_Base::Type_t::Via) continue;
+        BI_Via* via = static_cast<BI_Via*>(item); Q_ASSERT(via);
         if (via->isSelectable() && via->getGrabAreaScenePx().contains(pos.toPxQPointF())
             && ((!netsignal) || (via->getNetSignal() == netsignal)))
         {
@@ -502,8 +585,10 @@ QList<BI_NetPoint*> Board::getNetPointsAtScenePos(const Point& pos, const Graphi
                                                   const NetSignal* netsignal) const noexcept
 {
     QList<BI_NetPoint*> list;
-    foreach (BI_NetPoint* netpoint, mNetPoints)
+    foreach (BI_Base* item, mSpatialIndex->itemsAt(pos.toPxQPointF()))
     {
+        if (item->getType() != BI_Base::Type_t::NetPoint) continue;
+        BI_NetPoint* netpoint = static_cast<BI_NetPoint*>(item); Q_ASSERT(netpoint);
         if (netpoint->isSelectable() && netpoint->getGrabAreaScenePx().contains(pos.toPxQPointF())
             && ((!layer) || (&netpoint->getLayer() == layer))
             && ((!netsignal) || (&netpoint->getNetSignal() == netsignal)))
@@ -518,8 +603,10 @@ QList<BI_NetLine*> Board::getNetLinesAtScenePos(const Point& pos, const Graphics
                                                 const NetSignal* netsignal) const noexcept
 {
     QList<BI_NetLine*> list;
-    foreach (BI_NetLine* netline, mNetLines)
+    foreach (BI_Base* item, mSpatialIndex->itemsAt(pos.toPxQPointF()))
     {
+        if (item->getType() != BI_Base::Type_t::NetLine) continue;
+        BI_NetLine* netline = static_cast<BI_NetLine*>(item); Q_ASSERT(netline);
         if (netline->isSelectable() && netline->getGrabAreaScenePx().contains(pos.toPxQPointF())
             && ((!layer) || (&netline->getLayer() == layer))
             && ((!netsignal) || (&netline->getNetSignal() == netsignal)))
@@ -534,21 +621,82 @@ QList<BI_FootprintPad*> Board::getPadsAtScenePos(const Point& pos, const Graphic
                                                  const NetSignal* netsignal) const noexcept
 {
     QList<BI_FootprintPad*> list;
-    foreach (BI_Device* device, mDeviceInstances)
+    foreach (BI_Base* item, mSpatialIndex->itemsAt(pos.toPxQPointF()))
     {
-        foreach (BI_FootprintPad* pad, device->getFootprint().getPads())
+        if (item->getType() != BI_Base::Type_t::FootprintPad) continue;
+        BI_FootprintPad* pad = static_cast<BI_FootprintPad*>(item); Q_ASSERT(pad);
+        if (pad->isSelectable() && pad->getGrabAreaScenePx().contains(pos.toPxQPointF())
+            && ((!layer) || (pad->isOnLayer(layer->getName())))
+            && ((!netsignal) || (pad->getCompSigInstNetSignal() == netsignal)))
         {
-            if (pad->isSelectable() && pad->getGrabAreaScenePx().contains(pos.toPxQPointF())
-                && ((!layer) || (pad->isOnLayer(layer->getName())))
-                && ((!netsignal) || (pad->getCompSigInstNetSignal() == netsignal)))
-            {
-                list.append(pad);
-            }
+            list.append(pad);
         }
     }
     return list;
 }
 
+void Board::getNetItemsAtScenePos(const Point& pos, const GraphicsLayer* layer,
+                                  const NetSignal* netsignal,
+                                  QList<BI_NetPoint*>* netpoints,
+                                  QList<BI_NetLine*>* netlines,
+                                  QList<BI_FootprintPad*>* pads,
+                                  QList<BI_Via*>* vias) const noexcept
+{
+    const QPointF posPx = pos.toPxQPointF();
+    foreach (BI_Base* item, mSpatialIndex->itemsAt(posPx))
+    {
+        switch (item->getType())
+        {
+            case BI_Base::Type_t::NetPoint: {
+                if (!netpoints) break;
+                BI_NetPoint* netpoint = static_cast<BI_NetPoint*>(item); Q_ASSERT(netpoint);
+                if (netpoint->isSelectable() && netpoint->getGrabAreaScenePx().contains(posPx)
+                    && ((!layer) || (&netpoint->getLayer() == layer))
+                    && ((!netsignal) || (&netpoint->getNetSignal() == netsignal)))
+                {
+                    netpoints->append(netpoint);
+                }
+                break;
+            }
+            case BI_Base::Type_t::NetLine: {
+                if (!netlines) break;
+                BI_NetLine* netline = static_cast<BI_NetLine*>(item); Q_ASSERT(netline);
+                if (netline->isSelectable() && netline->getGrabAreaScenePx().contains(posPx)
+                    && ((!layer) || (&netline->getLayer() == layer))
+                    && ((!netsignal) || (&netline->getNetSignal() == netsignal)))
+                {
+                    netlines->append(netline);
+                }
+                break;
+            }
+            case BI_Base::Type_t::FootprintPad: {
+                if (!pads) break;
+                BI_FootprintPad* pad = static_cast<BI_FootprintPad*>(item); Q_ASSERT(pad);
+                if (pad->isSelectable() && pad->getGrabAreaScenePx().contains(posPx)
+                    && ((!layer) || (pad->isOnLayer(layer->getName())))
+                    && ((!netsignal) || (pad->getCompSigInstNetSignal() == netsignal)))
+                {
+                    pads->append(pad);
+                }
+                break;
+            }
+            case BI_Base::Type_t::Via: {
+                if (!vias) break;
+                BI_Via* via = static_cast<BI_Via*>(item); Q_ASSERT(via);
+                if (via->isSelectable() && via->getGrabAreaScenePx().contains(posPx)
+                    && ((!netsignal) || (via->getNetSignal() == netsignal)))
+                {
+                    vias->append(via);
+                }
+                break;
+            }
+            default: {
+                break;
+            }
+        }
+    }
+}
+
 QList<BI_Base*> Board::getAllItems() const noexcept
 {
     QList<BI_Base*> items;
@@ -562,6 +710,8 @@ QList<BI_Base*> Board::getAllItems() const noexcept
         items.append(netline);
     foreach (BI_Polygon* polygon, mPolygons)
         items.append(polygon);
+    foreach (BI_Plane* plane, mPlanes)
+        items.append(plane);
     return items;
 }
 
@@ -597,6 +747,11 @@ void Board::addDeviceInstance(BI_Device& instance)
     // add to board
     instance.addToBoard(*mGraphicsScene); // can throw
     mDeviceInstances.insert(instance.getComponentInstanceUuid(), &instance);
+    foreach (BI_FootprintPad* pad, instance.getFootprint().getPads()) {
+        if (pad->getCompSigInstNetSignal()) {
+            mRatsnest->invalidateNetSignal(*pad->getCompSigInstNetSignal());
+        }
+    }
     updateErcMessages();
     emit deviceAdded(instance);
 }
@@ -609,6 +764,11 @@ void Board::removeDeviceInstance(BI_Device& instance)
     // remove from board
     instance.removeFromBoard(*mGraphicsScene); // can throw
     mDeviceInstances.remove(instance.getComponentInstanceUuid());
+    foreach (BI_FootprintPad* pad, instance.getFootprint().getPads()) {
+        if (pad->getCompSigInstNetSignal()) {
+            mRatsnest->invalidateNetSignal(*pad->getCompSigInstNetSignal());
+        }
+    }
     updateErcMessages();
     emit deviceRemoved(instance);
 }
@@ -640,6 +800,9 @@ void Board::addVia(BI_Via& via)
     // add to board
     via.addToBoard(*mGraphicsScene); // can throw
     mVias.append(&via);
+    if (via.getNetSignal()) {
+        mRatsnest->invalidateNetSignal(*via.getNetSignal());
+    }
 }
 
 void Board::removeVia(BI_Via& via)
@@ -650,6 +813,9 @@ void Board::removeVia(BI_Via& via)
     // remove from board
     via.removeFromBoard(*mGraphicsScene); // can throw
     mVias.removeOne(&via);
+    if (via.getNetSignal()) {
+        mRatsnest->invalidateNetSignal(*via.getNetSignal());
+    }
 }
 
 /*****************************************************************************************
@@ -681,6 +847,7 @@ void Board::addNetPoint(BI_NetPoint& netpoint)
     // add to board
     netpoint.addToBoard(*mGraphicsScene); // can throw
     mNetPoints.append(&netpoint);
+    mRatsnest->invalidateNetSignal(netpoint.getNetSignal());
 }
 
 void Board::removeNetPoint(BI_NetPoint& netpoint)
@@ -691,6 +858,7 @@ void Board::removeNetPoint(BI_NetPoint& netpoint)
     // remove from board
     netpoint.removeFromBoard(*mGraphicsScene); // can throw
     mNetPoints.removeOne(&netpoint);
+    mRatsnest->invalidateNetSignal(netpoint.getNetSignal());
 }
 
 /*****************************************************************************************
@@ -722,6 +890,8 @@ void Board::addNetLine(BI_NetLine& netline)
     // add to board
     netline.addToBoard(*mGraphicsScene); // can throw
     mNetLines.append(&netline);
+    mRatsnest->invalidateNetSignal(netline.getNetSignal());
+    mProject.getCircuit().getConnectivity().invalidateNetSignal(netline.getNetSignal());
 }
 
 void Board::removeNetLine(BI_NetLine& netline)
@@ -731,7 +901,34 @@ void Board::removeNetLine(BI_NetLine& netline)
     }
     // remove from board
     netline.removeFromBoard(*mGraphicsScene); // can throw
+    unscheduleNetLineUpdate(netline);
     mNetLines.removeOne(&netline);
+    mRatsnest->invalidateNetSignal(netline.getNetSignal());
+    mProject.getCircuit().getConnectivity().invalidateNetSignal(netline.getNetSignal());
+}
+
+void Board::scheduleNetLineUpdate(BI_NetLine& netline) noexcept
+{
+    if (mScheduledNetLineUpdates.isEmpty()) {
+        // flush the collected updates once when control returns to the event loop
+        // (string based overload because the pointer-to-member overload of
+        // QTimer::singleShot() requires Qt 5.4, but we still support Qt 5.2)
+        QTimer::singleShot(0, this, SLOT(updateScheduledNetLines()));
+    }
+    mScheduledNetLineUpdates.insert(&netline);
+}
+
+void Board::unscheduleNetLineUpdate(BI_NetLine& netline) noexcept
+{
+    mScheduledNetLineUpdates.remove(&netline);
+}
+
+void Board::updateScheduledNetLines() noexcept
+{
+    foreach (BI_NetLine* netline, mScheduledNetLineUpdates) {
+        netline->updateLine();
+    }
+    mScheduledNetLineUpdates.clear();
 }
 
 /*****************************************************************************************
@@ -758,6 +955,46 @@ void Board::removePolygon(BI_Polygon& polygon)
     mPolygons.removeOne(&polygon);
 }
 
+/*****************************************************************************************
+ *  Plane Methods
+ ****************************************************************************************/
+
+BI_Plane* Board::getPlaneByUuid(const Uuid& uuid) const noexcept
+{
+    foreach (BI_Plane* plane, mPlanes) {
+        if (plane->getUuid() == uuid)
+            return plane;
+    }
+    return nullptr;
+}
+
+void Board::addPlane(BI_Plane& plane)
+{
+    if ((!mIsAddedToProject) || (mPlanes.contains(&plane))
+        || (&plane.getBoard() != this))
+    {
+        throw LogicError(__FILE__, __LINE__);
+    }
+    // check if there is no plane with the same uuid in the list
+    if (getPlaneByUuid(plane.getUuid())) {
+        throw RuntimeError(__FILE__, __LINE__,
+            QString(tr("There is already a plane with the UUID \"%1\"!"))
+            .arg(plane.getUuid().toStr()));
+    }
+    plane.addToBoard(*mGraphicsScene); // can throw
+    mPlanes.append(&plane);
+}
+
+void Board::removePlane(BI_Plane& plane)
+{
+    if ((!mIsAddedToProject) || (!mPlanes.contains(&plane))) {
+        throw LogicError(__FILE__, __LINE__);
+    }
+    plane.removeFromBoard(*mGraphicsScene); // can throw
+    mPlanes.removeOne(&plane);
+    mPlanesBuilder->planeRemoved(plane);
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -767,6 +1004,10 @@ void Board::addToProject()
     if (mIsAddedToProject) {
         throw LogicError(__FILE__, __LINE__);
     }
+    // bulk mode: one scene invalidation and one ERC dock update for the whole
+    // item set instead of editor-grade bookkeeping per item
+    GraphicsSceneBatchGuard sceneGuard(*mGraphicsScene);
+    ErcMsgListBatchGuard ercGuard(mProject.getErcMsgList());
     QList<BI_Base*> items = getAllItems();
     ScopeGuardList sgl(items.count());
     for (int i = 0; i < items.count(); ++i) {
@@ -776,6 +1017,7 @@ void Board::addToProject()
     }
     mIsAddedToProject = true;
     updateErcMessages();
+    mRatsnest->invalidateAll(); // show the airwires of the loaded net segments
     sgl.dismiss();
 }
 
@@ -784,6 +1026,8 @@ void Board::removeFromProject()
     if (!mIsAddedToProject) {
         throw LogicError(__FILE__, __LINE__);
     }
+    GraphicsSceneBatchGuard sceneGuard(*mGraphicsScene);
+    ErcMsgListBatchGuard ercGuard(mProject.getErcMsgList());
     QList<BI_Base*> items = getAllItems();
     ScopeGuardList sgl(items.count());
     for (int i = items.count()-1; i >= 0; --i) {
@@ -827,6 +1071,40 @@ bool Board::save(bool toOriginal, QStringList& errors) noexcept
     return success;
 }
 
+bool Board::queueAutosaveJobs(QVector<Project::AutosaveJob>& jobs, QStringList& errors) noexcept
+{
+    bool success = true;
+
+    try
+    {
+        if (mIsAddedToProject)
+        {
+            // serialize the board (the file is written later in a worker thread)
+            Project::AutosaveJob job;
+            job.file = mXmlFile.data();
+            job.doc.reset(new DomDocument(*serializeToDomElement("board")));
+            jobs.append(job);
+        }
+        else
+        {
+            // removing the file is very fast, so just do it synchronously
+            mXmlFile->removeFile(false);
+        }
+    }
+    catch (Exception& e)
+    {
+        success = false;
+        errors.append(e.getMsg());
+    }
+
+    // serialize user settings
+    if (!mUserSettings->queueAutosaveJobs(jobs, errors)) {
+        success = false;
+    }
+
+    return success;
+}
+
 void Board::showInView(GraphicsView& view) noexcept
 {
     view.setScene(mGraphicsScene.data());
@@ -838,36 +1116,60 @@ void Board::setSelectionRect(const Point& p1, const Point& p2, bool updateItems)
     if (updateItems)
     {
         QRectF rectPx = QRectF(p1.toPxQPointF(), p2.toPxQPointF()).normalized();
-        foreach (BI_Device* component, mDeviceInstances)
-        {
-            BI_Footprint& footprint = component->getFootprint();
-            bool selectFootprint = footprint.isSelectable() && footprint.getGrabAreaScenePx().intersects(rectPx);
-            footprint.setSelected(selectFootprint);
-            foreach (BI_FootprintPad* pad, footprint.getPads())
-            {
-                bool selectPad = pad->isSelectable() && pad->getGrabAreaScenePx().intersects(rectPx);
-                pad->setSelected(selectFootprint || selectPad);
+
+        // determine the new selection: ask the spatial index for the items in the
+        // rectangle (candidates only) and do the exact grab area test on them
+        QSet<BI_Base*> selected;
+        foreach (BI_Base* item, mSpatialIndex->itemsIn(rectPx)) {
+            if (item->isSelectable() && item->getGrabAreaScenePx().intersects(rectPx)) {
+                selected.insert(item);
+            }
+        }
+
+        // a selected footprint selects all its pads too
+        QSet<BI_Base*> pads;
+        foreach (BI_Base* item, selected) {
+            if (item->getType() == BI_Base::Type_t::Footprint) {
+                BI_Footprint* footprint = static_cast<BI_Footprint*>(item); Q_ASSERT(footprint);
+                foreach (BI_FootprintPad* pad, footprint->getPads()) {
+                    pads.insert(pad);
+                }
             }
         }
-        foreach (BI_Via* via, mVias)
-            via->setSelected(via->isSelectable() && via->getGrabAreaScenePx().intersects(rectPx));
-        foreach (BI_NetPoint* netpoint, mNetPoints)
-            netpoint->setSelected(netpoint->isSelectable() && netpoint->getGrabAreaScenePx().intersects(rectPx));
-        foreach (BI_NetLine* netline, mNetLines)
-            netline->setSelected(netline->isSelectable() && netline->getGrabAreaScenePx().intersects(rectPx));
+        selected += pads;
+
+        // update only the items which enter or leave the selection, so a rubber band
+        // move repaints the few affected items instead of the whole board
+        foreach (BI_Base* item, mSelectionRectItems - selected) {
+            item->setSelected(false);
+        }
+        foreach (BI_Base* item, selected - mSelectionRectItems) {
+            item->setSelected(true);
+        }
+        mSelectionRectItems = selected;
+    }
+    else
+    {
+        mSelectionRectItems.clear(); // rubber band finished, forget the cached set
     }
 }
 
 void Board::clearSelection() const noexcept
 {
-    foreach (BI_Device* device, mDeviceInstances)
-        device->getFootprint().setSelected(false);
-    foreach (BI_Via* via, mVias)
-        via->setSelected(false);
-    foreach (BI_NetPoint* netpoint, mNetPoints)
-        netpoint->setSelected(false);
-    foreach (BI_NetLine* netline, mNetLines)
-        netline->setSelected(false);
+    // iterate a copy, since deselecting removes the items from the set
+    foreach (BI_Base* item, QSet<BI_Base*>(mSelectedItems)) {
+        item->setSelected(false);
+    }
+    mSelectionRectItems.clear();
+}
+
+void Board::itemGeometryChanged(const BI_Base& item) noexcept
+{
+    // the spatial index still holds the bounding rect from *before* the change, so
+    // the planes in both the old and the new region of the item get re-poured
+    QRectF region = mSpatialIndex->getItemRect(item)
+                    .united(item.getGrabAreaScenePx().boundingRect());
+    mPlanesBuilder->invalidateRegion(region);
 }
 
 /*****************************************************************************************
@@ -889,16 +1191,39 @@ bool Board::getAttributeValue(const QString& attrNS, const QString& attrKey,
  *  Private Methods
  ****************************************************************************************/
 
-void Board::updateIcon() noexcept
+const QIcon& Board::getIcon() const noexcept
 {
-    QRectF source = mGraphicsScene->itemsBoundingRect().adjusted(-20, -20, 20, 20);
-    QRect target(0, 0, 297, 210); // DIN A4 format :-)
+    if (mIcon.isNull()) {
+        QRectF source = mGraphicsScene->getItemsBoundingRect().adjusted(-20, -20, 20, 20);
+        QRect target(0, 0, 297, 210); // DIN A4 format :-)
+
+        QPixmap pixmap(target.size());
+        pixmap.fill(Qt::white);
+        QPainter painter(&pixmap);
+        mGraphicsScene->render(&painter, target, source);
+        mIcon = QIcon(pixmap);
+    }
+    return mIcon;
+}
 
-    QPixmap pixmap(target.size());
-    pixmap.fill(Qt::white);
-    QPainter painter(&pixmap);
-    mGraphicsScene->render(&painter, target, source);
-    mIcon = QIcon(pixmap);
+void Board::scheduleAttributesChanged() noexcept
+{
+    // every item with substituted texts listens to attributesChanged(), so each
+    // emission re-layouts texts across the whole board. Bursts of project attribute
+    // changes are therefore coalesced into one notification per event loop turn.
+    if (!mAttributesChangedScheduled) {
+        mAttributesChangedScheduled = true;
+        QMetaObject::invokeMethod(this, "emitScheduledAttributesChanged",
+                                  Qt::QueuedConnection);
+    }
+}
+
+void Board::emitScheduledAttributesChanged() noexcept
+{
+    mAttributesChangedScheduled = false;
+    // many items rebuild their graphics caches in response --> one scene batch
+    GraphicsSceneBatchGuard batchGuard(*mGraphicsScene);
+    emit attributesChanged();
 }
 
 bool Board::checkAttributesValidity() const noexcept
@@ -931,10 +1256,15 @@ void Board::serialize(DomElement& root) const
     serializePointerContainer(root, mNetLines, "netline");
     // polygons
     serializePointerContainer(root, mPolygons, "polygon");
+    // planes
+    serializePointerContainer(root, mPlanes, "plane");
 }
 
 void Board::updateErcMessages() noexcept
 {
+    // many messages may be added/removed at once --> batch the ERC dock updates
+    ErcMsgListBatchGuard batchGuard(mProject.getErcMsgList());
+
     // type: UnplacedComponent (ComponentInstances without DeviceInstance)
     if (mIsAddedToProject)
     {
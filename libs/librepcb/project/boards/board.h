@@ -32,6 +32,7 @@
 #include <librepcb/common/exceptions.h>
 #include <librepcb/common/uuid.h>
 #include "../erc/if_ercmsgprovider.h"
+#include "../project.h"
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -42,13 +43,13 @@ class GridProperties;
 class GraphicsView;
 class GraphicsScene;
 class SmartXmlFile;
+class DomDocument;
 class GraphicsLayer;
 class BoardDesignRules;
 
 namespace project {
 
 class NetSignal;
-class Project;
 class BI_Device;
 class BI_Base;
 class BI_FootprintPad;
@@ -56,8 +57,13 @@ class BI_Via;
 class BI_NetPoint;
 class BI_NetLine;
 class BI_Polygon;
+class BI_Plane;
 class BoardLayerStack;
 class BoardUserSettings;
+class BoardSpatialIndex;
+class BoardRatsnest;
+class BGI_AirWires;
+class BoardPlaneFragmentsBuilder;
 
 /*****************************************************************************************
  *  Class Board
@@ -94,21 +100,36 @@ class Board final : public QObject, public IF_AttributeProvider,
             ZValue_FootprintPadsTop,    ///< Z value for #project#BI_FootprintPad items
             ZValue_FootprintsTop,       ///< Z value for #project#BI_Footprint items
             ZValue_Vias,                ///< Z value for #project#BI_Via items
+            ZValue_AirWires,            ///< Z value for #project#BGI_AirWires
         };
 
         // Constructors / Destructor
         Board() = delete;
         Board(const Board& other) = delete;
+        /**
+         * @brief Copy constructor to duplicate a board (e.g. for board variants)
+         *
+         * This is a pure in-memory deep copy: every BI_* item is cloned through its
+         * copy constructor (direct member copies, no XML serialization/parsing round
+         * trip is involved) and only the file path and name of the new board differ.
+         */
         Board(const Board& other, const FilePath& filepath, const QString& name);
         Board(Project& project, const FilePath& filepath, bool restore, bool readOnly) :
-            Board(project, filepath, restore, readOnly, false, QString()) {}
+            Board(project, filepath, restore, readOnly, nullptr) {}
+        Board(Project& project, const FilePath& filepath, bool restore, bool readOnly,
+              DomDocument* preParsedDoc) :
+            Board(project, filepath, restore, readOnly, false, QString(), preParsedDoc) {}
         ~Board() noexcept;
 
         // Getters: General
         Project& getProject() const noexcept {return mProject;}
         const FilePath& getFilePath() const noexcept {return mFilePath;}
         const GridProperties& getGridProperties() const noexcept {return *mGridProperties;}
+        GraphicsScene& getGraphicsScene() noexcept {return *mGraphicsScene;}
         BoardLayerStack& getLayerStack() noexcept {return *mLayerStack;}
+        BoardSpatialIndex& getSpatialIndex() noexcept {return *mSpatialIndex;}
+        BoardRatsnest& getRatsnest() noexcept {return *mRatsnest;}
+        BoardPlaneFragmentsBuilder& getPlaneFragmentsBuilder() noexcept {return *mPlanesBuilder;}
         BoardDesignRules& getDesignRules() noexcept {return *mDesignRules;}
         const BoardDesignRules& getDesignRules() const noexcept {return *mDesignRules;}
         bool isEmpty() const noexcept;
@@ -132,15 +153,54 @@ class Board final : public QObject, public IF_AttributeProvider,
                                                  const NetSignal* netsignal) const noexcept;
         QList<BI_FootprintPad*> getPadsAtScenePos(const Point& pos, const GraphicsLayer* layer,
                                                   const NetSignal* netsignal) const noexcept;
+
+        /**
+         * @brief Get all net items (netpoints/netlines/pads/vias) at a scene position
+         *
+         * Combines getNetPointsAtScenePos(), getNetLinesAtScenePos(),
+         * getPadsAtScenePos() and getViasAtScenePos() (with the same filters) into a
+         * single traversal of the spatial index, for callers which need several item
+         * types of one position anyway (e.g. the combine commands of the trace tool,
+         * which run on every placed trace endpoint). Pass nullptr for item types
+         * which are not of interest.
+         */
+        void getNetItemsAtScenePos(const Point& pos, const GraphicsLayer* layer,
+                                   const NetSignal* netsignal,
+                                   QList<BI_NetPoint*>* netpoints,
+                                   QList<BI_NetLine*>* netlines,
+                                   QList<BI_FootprintPad*>* pads,
+                                   QList<BI_Via*>* vias) const noexcept;
         QList<BI_Base*> getAllItems() const noexcept;
 
+        /**
+         * @brief Called by BI_Base whenever an item's selection state changed
+         *
+         * Maintains the selection set, so #getSelectedItems() and #clearSelection()
+         * are O(selection) instead of iterating the whole board.
+         */
+        void itemSelectionChanged(BI_Base& item, bool selected) const noexcept {
+            if (selected) {
+                mSelectedItems.insert(&item);
+            } else {
+                mSelectedItems.remove(&item);
+            }
+        }
+
         // Setters: General
         void setGridProperties(const GridProperties& grid) noexcept;
 
         // Getters: Attributes
         const Uuid& getUuid() const noexcept {return mUuid;}
         const QString& getName() const noexcept {return mName;}
-        const QIcon& getIcon() const noexcept {return mIcon;}
+
+        /**
+         * @brief Get a small preview icon of the board
+         *
+         * The icon is rendered lazily on the first call (rendering the whole scene
+         * is too expensive to do eagerly for every board while opening a project)
+         * and cached afterwards. Must only be called from the GUI thread.
+         */
+        const QIcon& getIcon() const noexcept;
 
         // DeviceInstance Methods
         const QMap<Uuid, BI_Device*>& getDeviceInstances() const noexcept {return mDeviceInstances;}
@@ -165,21 +225,60 @@ class Board final : public QObject, public IF_AttributeProvider,
         void addNetLine(BI_NetLine& netline);
         void removeNetLine(BI_NetLine& netline);
 
+        /**
+         * @brief Schedule a deferred geometry update of a net line
+         *
+         * Same mechanism as librepcb#project#Schematic#scheduleNetLineUpdate(): the
+         * net line is collected and updated once when control returns to the event
+         * loop, so dragging a selection updates each attached trace once per frame
+         * instead of once per moved endpoint per mouse move.
+         */
+        void scheduleNetLineUpdate(BI_NetLine& netline) noexcept;
+
+        /// @brief Cancel a scheduled update (must be called when a net line is removed)
+        void unscheduleNetLineUpdate(BI_NetLine& netline) noexcept;
+
         // Polygon Methods
         const QList<BI_Polygon*>& getPolygons() const noexcept {return mPolygons;}
         void addPolygon(BI_Polygon& polygon);
         void removePolygon(BI_Polygon& polygon);
 
+        // Plane Methods
+        const QList<BI_Plane*>& getPlanes() const noexcept {return mPlanes;}
+        BI_Plane* getPlaneByUuid(const Uuid& uuid) const noexcept;
+        void addPlane(BI_Plane& plane);
+        void removePlane(BI_Plane& plane);
+
         // General Methods
+
+        /**
+         * @brief Schedule a deferred, deduplicated #attributesChanged() emission
+         *
+         * Coalesces bursts of attribute/appearance changes (e.g. toggling several
+         * layers in the layers dock, or a chain of project attribute changes) into
+         * one notification per event loop turn. The emission runs inside a scene
+         * batch, since many items rebuild their graphics caches in response.
+         */
+        void scheduleAttributesChanged() noexcept;
+
         void addToProject();
         void removeFromProject();
         bool save(bool toOriginal, QStringList& errors) noexcept;
+        bool queueAutosaveJobs(QVector<Project::AutosaveJob>& jobs, QStringList& errors) noexcept;
         void showInView(GraphicsView& view) noexcept;
         void saveViewSceneRect(const QRectF& rect) noexcept {mViewRect = rect;}
         const QRectF& restoreViewSceneRect() const noexcept {return mViewRect;}
         void setSelectionRect(const Point& p1, const Point& p2, bool updateItems) noexcept;
         void clearSelection() const noexcept;
 
+        /**
+         * @brief Notify the board that the geometry of an item has changed
+         *
+         * Must be called *before* updating the spatial index, so the region covered
+         * before and after the change can be determined to re-pour affected planes.
+         */
+        void itemGeometryChanged(const BI_Base& item) noexcept;
+
         // Helper Methods
         bool getAttributeValue(const QString& attrNS, const QString& attrKey,
                                bool passToParents, QString& value) const noexcept override;
@@ -203,11 +302,17 @@ class Board final : public QObject, public IF_AttributeProvider,
         void deviceRemoved(BI_Device& comp);
 
 
+    private slots:
+
+        void emitScheduledAttributesChanged() noexcept;
+        void updateScheduledNetLines() noexcept;
+
+
     private:
 
         Board(Project& project, const FilePath& filepath, bool restore,
-              bool readOnly, bool create, const QString& newName);
-        void updateIcon() noexcept;
+              bool readOnly, bool create, const QString& newName,
+              DomDocument* preParsedDoc = nullptr);
         bool checkAttributesValidity() const noexcept;
         void updateErcMessages() noexcept;
 
@@ -222,6 +327,10 @@ class Board final : public QObject, public IF_AttributeProvider,
         bool mIsAddedToProject;
 
         QScopedPointer<GraphicsScene> mGraphicsScene;
+        QScopedPointer<BoardSpatialIndex> mSpatialIndex;
+        QScopedPointer<BoardRatsnest> mRatsnest;
+        QScopedPointer<BGI_AirWires> mAirWiresItem; ///< draws the ratsnest in the scene
+        QScopedPointer<BoardPlaneFragmentsBuilder> mPlanesBuilder;
         QScopedPointer<BoardLayerStack> mLayerStack;
         QScopedPointer<GridProperties> mGridProperties;
         QScopedPointer<BoardDesignRules> mDesignRules;
@@ -231,7 +340,10 @@ class Board final : public QObject, public IF_AttributeProvider,
         // Attributes
         Uuid mUuid;
         QString mName;
-        QIcon mIcon;
+        mutable QIcon mIcon; ///< rendered lazily, see #getIcon()
+        bool mAttributesChangedScheduled; ///< see #scheduleAttributesChanged()
+        QSet<BI_NetLine*> mScheduledNetLineUpdates; ///< see #scheduleNetLineUpdate()
+        mutable QSet<BI_Base*> mSelectedItems; ///< see #itemSelectionChanged()
 
         // items
         QMap<Uuid, BI_Device*> mDeviceInstances;
@@ -239,6 +351,11 @@ class Board final : public QObject, public IF_AttributeProvider,
         QList<BI_NetPoint*> mNetPoints;
         QList<BI_NetLine*> mNetLines;
         QList<BI_Polygon*> mPolygons;
+        QList<BI_Plane*> mPlanes;
+
+        /// items currently selected by the selection rectangle (see #setSelectionRect();
+        /// mutable because #clearSelection() is const)
+        mutable QSet<BI_Base*> mSelectionRectItems;
 
         // ERC messages
         QHash<Uuid, ErcMsg*> mErcMsgListUnplacedComponentInstances;
@@ -0,0 +1,467 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtConcurrent/QtConcurrent>
+#include "boarddesignrulecheck.h"
+#include "board.h"
+#include "items/bi_device.h"
+#include "items/bi_footprint.h"
+#include "items/bi_footprintpad.h"
+#include "items/bi_netline.h"
+#include "items/bi_netpoint.h"
+#include "items/bi_via.h"
+#include "../circuit/netsignal.h"
+#include <librepcb/common/boarddesignrules.h>
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/library/pkg/footprintpad.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BoardDesignRuleCheck::BoardDesignRuleCheck(Board& board, QObject* parent) noexcept :
+    QObject(parent), mBoard(board),
+    mMinCopperClearance(200000),    // 0.2mm
+    mMinCopperWidth(100000)         // 0.1mm
+{
+    connect(&mWatcher, &QFutureWatcher<QList<Violation>>::resultReadyAt,
+            this, &BoardDesignRuleCheck::tileResultReady);
+    connect(&mWatcher, &QFutureWatcher<QList<Violation>>::progressValueChanged,
+            this, &BoardDesignRuleCheck::tileProgress);
+    connect(&mWatcher, &QFutureWatcher<QList<Violation>>::finished,
+            this, &BoardDesignRuleCheck::checkFinished);
+}
+
+BoardDesignRuleCheck::~BoardDesignRuleCheck() noexcept
+{
+    mWatcher.cancel();
+    mWatcher.waitForFinished();
+}
+
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+bool BoardDesignRuleCheck::isRunning() const noexcept
+{
+    return mWatcher.isRunning();
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void BoardDesignRuleCheck::start() noexcept
+{
+    if (isRunning()) {
+        return;
+    }
+
+    mViolations.clear();
+    mReportedPairs.clear();
+    mTiles.clear();
+    emit started();
+    emit progressPercent(0);
+
+    // the single-item rules are cheap, check them synchronously
+    checkWidthsAndAnnularRings();
+
+    // snapshot the copper geometry and check the clearances tile by tile on the
+    // global thread pool
+    QSharedPointer<Context> context(new Context());
+    context->features = snapshotCopperFeatures();
+    context->clearanceMm = mMinCopperClearance.toMm();
+    mTiles = buildTiles(context->features);
+    if (mTiles.isEmpty()) {
+        emit progressPercent(100);
+        emit finished(mViolations.count());
+        return;
+    }
+    mWatcher.setFuture(QtConcurrent::mapped(mTiles, TileChecker(context)));
+}
+
+void BoardDesignRuleCheck::cancel() noexcept
+{
+    mWatcher.cancel();
+}
+
+void BoardDesignRuleCheck::waitForFinished() noexcept
+{
+    mWatcher.waitForFinished();
+}
+
+/*****************************************************************************************
+ *  Private Slots
+ ****************************************************************************************/
+
+void BoardDesignRuleCheck::tileResultReady(int index) noexcept
+{
+    appendViolations(mWatcher.resultAt(index));
+}
+
+void BoardDesignRuleCheck::tileProgress(int value) noexcept
+{
+    if (!mTiles.isEmpty()) {
+        emit progressPercent((value * 100) / mTiles.count());
+    }
+}
+
+void BoardDesignRuleCheck::checkFinished() noexcept
+{
+    emit progressPercent(100);
+    emit finished(mViolations.count());
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+QVector<BoardDesignRuleCheck::Feature> BoardDesignRuleCheck::snapshotCopperFeatures() const noexcept
+{
+    QVector<Feature> features;
+    features.reserve(mBoard.getNetLines().count() + mBoard.getVias().count());
+
+    // traces
+    foreach (const BI_NetLine* netline, mBoard.getNetLines()) {
+        Feature f;
+        f.item = netline;
+        f.netsignal = &netline->getNetSignal();
+        f.netName = f.netsignal->getName();
+        f.onAllCopperLayers = false;
+        f.layerName = netline->getLayer().getName();
+        f.start = netline->getStartPoint().getPosition().toMmQPointF();
+        f.end = netline->getEndPoint().getPosition().toMmQPointF();
+        f.radius = netline->getWidth().toMm() / qreal(2);
+        f.bounds = QRectF(f.start, f.end).normalized()
+                   .adjusted(-f.radius, -f.radius, f.radius, f.radius);
+        features.append(f);
+    }
+
+    // vias (on all copper layers)
+    foreach (const BI_Via* via, mBoard.getVias()) {
+        Feature f;
+        f.item = via;
+        f.netsignal = via->getNetSignal();
+        f.netName = f.netsignal ? f.netsignal->getName() : QString();
+        f.onAllCopperLayers = true;
+        f.start = via->getPosition().toMmQPointF();
+        f.end = f.start;
+        f.radius = via->getSize().toMm() / qreal(2); // square/octagon: inscribed circle
+        f.bounds = QRectF(f.start, f.end).normalized()
+                   .adjusted(-f.radius, -f.radius, f.radius, f.radius);
+        features.append(f);
+    }
+
+    // footprint pads
+    foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
+        foreach (const BI_FootprintPad* pad, device->getFootprint().getPads()) {
+            const library::FootprintPad& libPad = pad->getLibPad();
+            Feature f;
+            f.item = pad;
+            f.netsignal = pad->getCompSigInstNetSignal();
+            f.netName = f.netsignal ? f.netsignal->getName() : QString();
+            f.onAllCopperLayers = (libPad.getBoardSide() == library::FootprintPad::BoardSide::THT);
+            if (!f.onAllCopperLayers) {
+                f.layerName = pad->getLayerName();
+            }
+            // approximate the pad by a capsule along its longer dimension
+            qreal w = libPad.getWidth().toMm();
+            qreal h = libPad.getHeight().toMm();
+            qreal angleRad = pad->getRotation().toRad();
+            QPointF dir(qCos(angleRad), qSin(angleRad));
+            if (pad->getIsMirrored()) {
+                dir.setX(-dir.x());
+            }
+            QPointF center = pad->getPosition().toMmQPointF();
+            if (w >= h) {
+                qreal halfLen = (w - h) / qreal(2);
+                f.start = center - (dir * halfLen);
+                f.end = center + (dir * halfLen);
+                f.radius = h / qreal(2);
+            } else {
+                QPointF perp(-dir.y(), dir.x());
+                qreal halfLen = (h - w) / qreal(2);
+                f.start = center - (perp * halfLen);
+                f.end = center + (perp * halfLen);
+                f.radius = w / qreal(2);
+            }
+            f.bounds = QRectF(f.start, f.end).normalized()
+                       .adjusted(-f.radius, -f.radius, f.radius, f.radius);
+            features.append(f);
+        }
+    }
+
+    return features;
+}
+
+QVector<BoardDesignRuleCheck::Tile> BoardDesignRuleCheck::buildTiles(
+        const QVector<Feature>& features) const noexcept
+{
+    QVector<Tile> tiles;
+    if (features.count() < 2) {
+        return tiles;
+    }
+
+    // small boards do not amortize the sharding overhead, check them as one tile
+    if (features.count() <= 64) {
+        Tile tile;
+        for (int i = 0; i < features.count(); ++i) {
+            tile.features.append(i);
+        }
+        tiles.append(tile);
+        return tiles;
+    }
+
+    // determine the overall bounding rect of all features
+    QRectF bounds = features.first().bounds;
+    foreach (const Feature& f, features) {
+        bounds = bounds.united(f.bounds);
+    }
+
+    // choose the tile size so there are enough tiles to keep all cores busy, but
+    // not so many that the per-tile overhead dominates
+    int targetTileCount = qMax(QThread::idealThreadCount(), 1) * 8;
+    qreal tileSize = qSqrt((bounds.width() * bounds.height()) / targetTileCount);
+    tileSize = qMax(tileSize, qreal(1)); // at least 1mm
+    int cols = qMax(qCeil(bounds.width() / tileSize), 1);
+    int rows = qMax(qCeil(bounds.height() / tileSize), 1);
+
+    // register every feature in all tiles intersected by its bounding rect expanded
+    // by the clearance - a pair of features which could violate the clearance is
+    // then guaranteed to meet in at least one tile (possibly in several, duplicates
+    // are filtered in appendViolations())
+    QVector<Tile> grid(cols * rows);
+    qreal clearanceMm = mMinCopperClearance.toMm();
+    for (int i = 0; i < features.count(); ++i) {
+        QRectF rect = features.at(i).bounds.adjusted(-clearanceMm, -clearanceMm,
+                                                     clearanceMm, clearanceMm);
+        int x1 = qBound(0, qFloor((rect.left() - bounds.left()) / tileSize), cols - 1);
+        int x2 = qBound(0, qFloor((rect.right() - bounds.left()) / tileSize), cols - 1);
+        int y1 = qBound(0, qFloor((rect.top() - bounds.top()) / tileSize), rows - 1);
+        int y2 = qBound(0, qFloor((rect.bottom() - bounds.top()) / tileSize), rows - 1);
+        for (int x = x1; x <= x2; ++x) {
+            for (int y = y1; y <= y2; ++y) {
+                grid[(y * cols) + x].features.append(i);
+            }
+        }
+    }
+
+    // tiles with less than two features cannot contain a clearance violation
+    foreach (const Tile& tile, grid) {
+        if (tile.features.count() >= 2) {
+            tiles.append(tile);
+        }
+    }
+    return tiles;
+}
+
+void BoardDesignRuleCheck::checkWidthsAndAnnularRings() noexcept
+{
+    QList<Violation> violations;
+    const BoardDesignRules& rules = mBoard.getDesignRules();
+
+    // minimum trace width
+    foreach (const BI_NetLine* netline, mBoard.getNetLines()) {
+        if (netline->getWidth() < mMinCopperWidth) {
+            Violation v;
+            v.type = Violation::Type::MinimumWidth;
+            v.message = tr("Trace width %1mm is smaller than the minimum width %2mm "
+                           "(net '%3').")
+                        .arg(QString::number(netline->getWidth().toMm(), 'f', 3),
+                             QString::number(mMinCopperWidth.toMm(), 'f', 3),
+                             netline->getNetSignal().getName());
+            v.location = netline->getPosition();
+            v.item1 = netline;
+            v.item2 = nullptr;
+            violations.append(v);
+        }
+    }
+
+    // annular ring of vias
+    foreach (const BI_Via* via, mBoard.getVias()) {
+        Length restring = (via->getSize() - via->getDrillDiameter()) / 2;
+        Length required = rules.calcViaRestring(via->getDrillDiameter());
+        if (restring < required) {
+            Violation v;
+            v.type = Violation::Type::AnnularRing;
+            v.message = tr("Via restring %1mm is smaller than the minimum restring "
+                           "%2mm.")
+                        .arg(QString::number(restring.toMm(), 'f', 3),
+                             QString::number(required.toMm(), 'f', 3));
+            v.location = via->getPosition();
+            v.item1 = via;
+            v.item2 = nullptr;
+            violations.append(v);
+        }
+    }
+
+    // annular ring of THT pads
+    foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
+        foreach (const BI_FootprintPad* pad, device->getFootprint().getPads()) {
+            const library::FootprintPad& libPad = pad->getLibPad();
+            if (libPad.getBoardSide() != library::FootprintPad::BoardSide::THT) {
+                continue;
+            }
+            Length size = qMin(libPad.getWidth(), libPad.getHeight());
+            Length restring = (size - libPad.getDrillDiameter()) / 2;
+            Length required = rules.calcPadRestring(libPad.getDrillDiameter());
+            if (restring < required) {
+                Violation v;
+                v.type = Violation::Type::AnnularRing;
+                v.message = tr("Pad restring %1mm is smaller than the minimum "
+                               "restring %2mm.")
+                            .arg(QString::number(restring.toMm(), 'f', 3),
+                                 QString::number(required.toMm(), 'f', 3));
+                v.location = pad->getPosition();
+                v.item1 = pad;
+                v.item2 = nullptr;
+                violations.append(v);
+            }
+        }
+    }
+
+    appendViolations(violations);
+}
+
+void BoardDesignRuleCheck::appendViolations(const QList<Violation>& violations) noexcept
+{
+    int firstIndex = mViolations.count();
+    int count = 0;
+    foreach (const Violation& violation, violations) {
+        if (violation.type == Violation::Type::CopperClearance) {
+            // the same pair may have been checked in several tiles
+            QPair<const BI_Base*, const BI_Base*> pair(
+                qMin(violation.item1, violation.item2),
+                qMax(violation.item1, violation.item2));
+            if (mReportedPairs.contains(pair)) {
+                continue;
+            }
+            mReportedPairs.insert(pair);
+        }
+        mViolations.append(violation);
+        ++count;
+    }
+    if (count > 0) {
+        emit violationsAdded(firstIndex, count);
+    }
+}
+
+bool BoardDesignRuleCheck::featuresShareLayer(const Feature& a, const Feature& b) noexcept
+{
+    if (a.onAllCopperLayers || b.onAllCopperLayers) {
+        return true;
+    }
+    return (a.layerName == b.layerName);
+}
+
+qreal BoardDesignRuleCheck::segmentDistanceMm(const QPointF& p1, const QPointF& p2,
+                                              const QPointF& q1, const QPointF& q2) noexcept
+{
+    QLineF l1(p1, p2);
+    QLineF l2(q1, q2);
+    if ((l1.length() > 0) && (l2.length() > 0)) {
+        QPointF intersection;
+        if (l1.intersect(l2, &intersection) == QLineF::BoundedIntersection) {
+            return 0;
+        }
+    }
+    qreal d1 = pointSegmentDistanceMm(p1, q1, q2);
+    qreal d2 = pointSegmentDistanceMm(p2, q1, q2);
+    qreal d3 = pointSegmentDistanceMm(q1, p1, p2);
+    qreal d4 = pointSegmentDistanceMm(q2, p1, p2);
+    return qMin(qMin(d1, d2), qMin(d3, d4));
+}
+
+qreal BoardDesignRuleCheck::pointSegmentDistanceMm(const QPointF& p, const QPointF& q1,
+                                                   const QPointF& q2) noexcept
+{
+    QPointF d = q2 - q1;
+    qreal lengthSquared = (d.x() * d.x()) + (d.y() * d.y());
+    if (lengthSquared <= 0) {
+        return QLineF(p, q1).length();
+    }
+    qreal t = (((p.x() - q1.x()) * d.x()) + ((p.y() - q1.y()) * d.y())) / lengthSquared;
+    t = qBound(qreal(0), t, qreal(1));
+    return QLineF(p, q1 + (d * t)).length();
+}
+
+/*****************************************************************************************
+ *  Class TileChecker
+ ****************************************************************************************/
+
+QList<BoardDesignRuleCheck::Violation> BoardDesignRuleCheck::TileChecker::operator()(
+        const Tile& tile) const noexcept
+{
+    QList<Violation> violations;
+    const QVector<Feature>& features = mContext->features;
+    qreal clearanceMm = mContext->clearanceMm;
+    for (int a = 0; a < tile.features.count(); ++a) {
+        const Feature& f1 = features.at(tile.features.at(a));
+        QRectF expanded = f1.bounds.adjusted(-clearanceMm, -clearanceMm,
+                                             clearanceMm, clearanceMm);
+        for (int b = a + 1; b < tile.features.count(); ++b) {
+            const Feature& f2 = features.at(tile.features.at(b));
+            if (f1.netsignal && (f1.netsignal == f2.netsignal)) {
+                continue; // same net, clearance does not apply
+            }
+            if (!featuresShareLayer(f1, f2)) {
+                continue;
+            }
+            if (!expanded.intersects(f2.bounds)) {
+                continue;
+            }
+            qreal distance = segmentDistanceMm(f1.start, f1.end, f2.start, f2.end)
+                             - f1.radius - f2.radius;
+            if (distance < clearanceMm - qreal(1e-6)) { // 1nm tolerance
+                Violation v;
+                v.type = Violation::Type::CopperClearance;
+                v.message = tr("Copper clearance %1mm is smaller than the minimum "
+                               "clearance %2mm ('%3' <-> '%4').")
+                            .arg(QString::number(qMax(distance, qreal(0)), 'f', 3),
+                                 QString::number(clearanceMm, 'f', 3),
+                                 f1.netName.isEmpty() ? tr("unconnected") : f1.netName,
+                                 f2.netName.isEmpty() ? tr("unconnected") : f2.netName);
+                QPointF center1 = (f1.start + f1.end) / qreal(2);
+                QPointF center2 = (f2.start + f2.end) / qreal(2);
+                v.location = Point::fromMm((center1 + center2) / qreal(2));
+                v.item1 = f1.item;
+                v.item2 = f2.item;
+                violations.append(v);
+            }
+        }
+    }
+    return violations;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
@@ -21,8 +21,11 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <QtConcurrent/QtConcurrent>
 #include "boardgerberexport.h"
+#include <quazip/JlCompress.h>
 #include <librepcb/common/cam/gerbergenerator.h>
+#include <librepcb/common/cam/gerberaperturelist.h>
 #include <librepcb/common/cam/excellongenerator.h>
 #include <librepcb/common/graphics/graphicslayer.h>
 #include <librepcb/common/boarddesignrules.h>
@@ -50,12 +53,22 @@ namespace project {
  ****************************************************************************************/
 
 BoardGerberExport::BoardGerberExport(const Board& board, const FilePath& outputDir) noexcept :
-    mProject(board.getProject()), mBoard(board), mOutputDirectory(outputDir)
+    mProject(board.getProject()), mBoard(board), mOutputDirectory(outputDir),
+    mCreateArchive(false)
 {
+    connect(&mWatcher, &QFutureWatcher<QString>::progressValueChanged,
+            this, [this](int value){
+        int total = mWatcher.progressMaximum() - mWatcher.progressMinimum();
+        emit progressPercent(total > 0 ?
+            (100 * (value - mWatcher.progressMinimum())) / total : 100);
+    });
+    connect(&mWatcher, &QFutureWatcher<QString>::finished,
+            this, &BoardGerberExport::jobsFinished);
 }
 
 BoardGerberExport::~BoardGerberExport() noexcept
 {
+    mWatcher.waitForFinished();
 }
 
 /*****************************************************************************************
@@ -64,23 +77,88 @@ BoardGerberExport::~BoardGerberExport() noexcept
 
 void BoardGerberExport::exportAllLayers() const
 {
-    exportDrillsPTH();
-    exportLayerBoardOutlines();
-    exportLayerTopCopper();
-    exportLayerTopSolderMask();
-    exportLayerTopSilkscreen();
-    exportLayerBottomCopper();
-    exportLayerBottomSolderMask();
-    exportLayerBottomSilkscreen();
+    QVector<LayerJob> jobs = createJobs();
+    LayerJobRunner runner{this};
+    QStringList errors;
+    foreach (const QString& error, QtConcurrent::blockingMapped(jobs, runner)) {
+        if (!error.isEmpty()) {
+            errors.append(error);
+        }
+    }
+    if (!errors.isEmpty()) {
+        throw RuntimeError(__FILE__, __LINE__, errors.join("\n"));
+    }
+}
+
+void BoardGerberExport::startAsync() noexcept
+{
+    if (mWatcher.isRunning()) {
+        return; // an export is already running
+    }
+    mJobs = createJobs();
+    LayerJobRunner runner{this};
+    mWatcher.setFuture(QtConcurrent::mapped(mJobs, runner));
 }
 
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
 
+QString BoardGerberExport::LayerJobRunner::operator()(LayerJob job) const noexcept
+{
+    try {
+        (e->*job)();
+        return QString();
+    } catch (const Exception& ex) {
+        return ex.getMsg();
+    }
+}
+
+QVector<BoardGerberExport::LayerJob> BoardGerberExport::createJobs() const noexcept
+{
+    return QVector<LayerJob>{
+        &BoardGerberExport::exportDrillsPTH,
+        &BoardGerberExport::exportLayerBoardOutlines,
+        &BoardGerberExport::exportLayerTopCopper,
+        &BoardGerberExport::exportLayerTopSolderMask,
+        &BoardGerberExport::exportLayerTopSilkscreen,
+        &BoardGerberExport::exportLayerBottomCopper,
+        &BoardGerberExport::exportLayerBottomSolderMask,
+        &BoardGerberExport::exportLayerBottomSilkscreen,
+    };
+}
+
+void BoardGerberExport::jobsFinished() noexcept
+{
+    QStringList errors;
+    for (int i = 0; i < mJobs.count(); ++i) {
+        QString error = mWatcher.resultAt(i);
+        if (!error.isEmpty()) {
+            errors.append(error);
+        }
+    }
+    mJobs.clear();
+
+    // optionally pack all generated files into a ready-to-send fab package. The
+    // dozen small text files compress in a few milliseconds, so this can run
+    // synchronously at the end of the (already asynchronous) export.
+    if (mCreateArchive && errors.isEmpty()) {
+        FilePath zipFp(mOutputDirectory.toStr() % ".zip");
+        QFile::remove(zipFp.toStr()); // JlCompress would append to an existing file
+        if (!JlCompress::compressDir(zipFp.toStr(), mOutputDirectory.toStr())) {
+            errors.append(QString(tr("Could not create the archive \"%1\"."))
+                          .arg(zipFp.toNative()));
+        }
+    }
+
+    emit progressPercent(100);
+    emit finished(errors);
+}
+
 void BoardGerberExport::exportDrillsPTH() const
 {
     ExcellonGenerator gen;
+    gen.setDrillPathOptimizationEnabled(true);
 
     // footprint holes and pads
     foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
@@ -244,48 +322,129 @@ void BoardGerberExport::drawVia(GerberGenerator& gen, const BI_Via& via, const Q
 
 void BoardGerberExport::drawFootprint(GerberGenerator& gen, const BI_Footprint& footprint, const QString& layerName) const
 {
-    // draw pads
-    foreach (const BI_FootprintPad* pad, footprint.getPads()) {
-        drawFootprintPad(gen, *pad, layerName);
+    CompiledFootprint compiled = getCompiledFootprint(footprint, layerName);
+    const Point& pos = footprint.getPosition();
+
+    // flash pads and holes (the aperture is registered in this file's private
+    // dictionary on first use, so the D-codes stay deterministic per file)
+    foreach (const CompiledFootprint::Flash& flash, compiled.flashes) {
+        Point flashPos = pos + flash.offset;
+        switch (flash.shape)
+        {
+            case CompiledFootprint::Flash::Shape::Circle: {
+                gen.flashCircle(flashPos, flash.width, Length(0));
+                break;
+            }
+            case CompiledFootprint::Flash::Shape::Rect: {
+                gen.flashRect(flashPos, flash.width, flash.height, flash.rot, Length(0));
+                break;
+            }
+            case CompiledFootprint::Flash::Shape::Obround: {
+                gen.flashObround(flashPos, flash.width, flash.height, flash.rot, Length(0));
+                break;
+            }
+            case CompiledFootprint::Flash::Shape::Octagon: {
+                gen.flashRegularPolygon(flashPos, flash.width, 8, flash.rot, Length(0));
+                break;
+            }
+            default: {
+                throw LogicError(__FILE__, __LINE__);
+            }
+        }
     }
 
     // draw polygons
+    foreach (const Polygon& polygon, compiled.polygons) {
+        Polygon p = polygon;
+        p.translate(pos);
+        gen.drawPolygonOutline(p);
+        if (p.isFilled()) {
+            gen.drawPolygonArea(p);
+        }
+    }
+
+    // draw ellipses
+    foreach (const Ellipse& ellipse, compiled.ellipses) {
+        Ellipse e = ellipse;
+        e.translate(pos);
+        gen.drawEllipseOutline(e);
+        if (e.isFilled()) {
+            gen.drawEllipseArea(e);
+        }
+    }
+
+    // TODO: draw texts. When implementing this, do not stroke the font outlines
+    // per text instance - panelized silk layers contain tens of thousands of
+    // characters. Flatten each unique glyph once into a normalized polygon set
+    // (character -> outlines in em units, analogous to the cached text layout in
+    // PrimitiveTextGraphicsItem) and emit transformed copies of the cached
+    // outlines, so generation scales with the number of unique glyphs instead of
+    // the total character count. The cache belongs next to GerberGenerator so
+    // the Excellon/PDF exporters can share it once they draw text too.
+}
+
+BoardGerberExport::CompiledFootprint BoardGerberExport::getCompiledFootprint(
+    const BI_Footprint& footprint, const QString& layerName) const
+{
+    // all instances of a footprint with the same rotation and mirror state share the
+    // same geometry relative to their origin, so it is compiled only once per unique
+    // combination. The containers of CompiledFootprint are implicitly shared, thus
+    // returning a copy is cheap and avoids handing out references into the hash which
+    // other worker threads could rehash.
+    Angle rot = footprint.getIsMirrored() ? -footprint.getRotation() : footprint.getRotation();
+    QString key = footprint.getLibFootprint().getUuid().toStr() % "|"
+                  % (footprint.getIsMirrored() ? "m" : "n") % "|"
+                  % QString::number(rot.toMicroDeg()) % "|" % layerName;
+    {
+        QMutexLocker lock(&mCompiledFootprintsMutex);
+        auto it = mCompiledFootprints.find(key);
+        if (it != mCompiledFootprints.end()) {
+            return it.value();
+        }
+    }
+
+    CompiledFootprint compiled;
+    const Point& origin = footprint.getPosition();
+
+    // pads and holes
+    foreach (const BI_FootprintPad* pad, footprint.getPads()) {
+        compileFootprintPad(*pad, layerName, origin, compiled);
+    }
+    for (const Hole& hole : footprint.getLibFootprint().getHoles()) {
+        CompiledFootprint::Flash flash;
+        flash.shape = CompiledFootprint::Flash::Shape::Circle;
+        flash.width = hole.getDiameter();
+        flash.offset = footprint.mapToScene(hole.getPosition()) - origin;
+        compiled.flashes.append(flash);
+    }
+
+    // polygons (rotated here, translated per instance)
+    QString layer = footprint.getIsMirrored() ? GraphicsLayer::getMirroredLayerName(layerName) : layerName;
     for (const Polygon& polygon : footprint.getLibFootprint().getPolygons()) {
-        QString layer = footprint.getIsMirrored() ? GraphicsLayer::getMirroredLayerName(layerName) : layerName;
         if (layer == polygon.getLayerName()) {
-            Angle rot = footprint.getIsMirrored() ? -footprint.getRotation() : footprint.getRotation();
-            Polygon p = polygon.rotated(rot).translate(footprint.getPosition());
+            Polygon p = polygon.rotated(rot);
             p.setLineWidth(calcWidthOfLayer(p.getLineWidth(), layer));
-            gen.drawPolygonOutline(p);
-            if (p.isFilled()) {
-                gen.drawPolygonArea(p);
-            }
+            compiled.polygons.append(p);
         }
     }
 
-    // draw ellipses
+    // ellipses (rotated here, translated per instance)
     for (const Ellipse& ellipse : footprint.getLibFootprint().getEllipses()) {
-        QString layer = footprint.getIsMirrored() ? GraphicsLayer::getMirroredLayerName(layerName) : layerName;
         if (layer == ellipse.getLayerName()) {
-            Angle rot = footprint.getIsMirrored() ? -footprint.getRotation() : footprint.getRotation();
-            Ellipse e = ellipse.rotated(rot).translate(footprint.getPosition());
+            Ellipse e = ellipse.rotated(rot);
             e.setLineWidth(calcWidthOfLayer(e.getLineWidth(), layer));
-            gen.drawEllipseOutline(e);
-            if (e.isFilled()) {
-                gen.drawEllipseArea(e);
-            }
+            compiled.ellipses.append(e);
         }
     }
 
-    // TODO: draw texts
-
-    // draw holes
-    for (const Hole& hole : footprint.getLibFootprint().getHoles()) {
-        gen.flashCircle(footprint.mapToScene(hole.getPosition()), hole.getDiameter(), Length(0));
-    }
+    QMutexLocker lock(&mCompiledFootprintsMutex);
+    // if another thread compiled the same footprint meanwhile, its (identical) result
+    // is simply overwritten
+    return mCompiledFootprints.insert(key, compiled).value();
 }
 
-void BoardGerberExport::drawFootprintPad(GerberGenerator& gen, const BI_FootprintPad& pad, const QString& layerName) const
+void BoardGerberExport::compileFootprintPad(const BI_FootprintPad& pad,
+    const QString& layerName, const Point& origin, CompiledFootprint& result) const
 {
     bool isOnCopperLayer = pad.isOnLayer(layerName);
     bool isOnSolderMaskTop = pad.isOnLayer(GraphicsLayer::sTopCopper) && (layerName == GraphicsLayer::sTopStopMask);
@@ -305,18 +464,26 @@ void BoardGerberExport::drawFootprintPad(GerberGenerator& gen, const BI_Footprin
         height += clearance*2;
     }
 
+    CompiledFootprint::Flash flash;
+    flash.offset = pad.getPosition() - origin;
+    flash.rot = rot;
     switch (libPad.getShape())
     {
         case library::FootprintPad::Shape::ROUND: {
             if (width == height) {
-                gen.flashCircle(pad.getPosition(), width, Length(0));
+                flash.shape = CompiledFootprint::Flash::Shape::Circle;
+                flash.width = width;
             } else {
-                gen.flashObround(pad.getPosition(), width, height, rot, Length(0));
+                flash.shape = CompiledFootprint::Flash::Shape::Obround;
+                flash.width = width;
+                flash.height = height;
             }
             break;
         }
         case library::FootprintPad::Shape::RECT: {
-            gen.flashRect(pad.getPosition(), width, height, rot, Length(0));
+            flash.shape = CompiledFootprint::Flash::Shape::Rect;
+            flash.width = width;
+            flash.height = height;
             break;
         }
         case library::FootprintPad::Shape::OCTAGON: {
@@ -324,13 +491,15 @@ void BoardGerberExport::drawFootprintPad(GerberGenerator& gen, const BI_Footprin
                 throw LogicError(__FILE__, __LINE__,
                     tr("Sorry, non-square octagons are not yet supported."));
             }
-            gen.flashRegularPolygon(pad.getPosition(), width, 8, rot, Length(0));
+            flash.shape = CompiledFootprint::Flash::Shape::Octagon;
+            flash.width = width;
             break;
         }
         default: {
             throw LogicError(__FILE__, __LINE__);
         }
     }
+    result.flashes.append(flash);
 }
 
 FilePath BoardGerberExport::getOutputFilePath(const QString& suffix) const noexcept
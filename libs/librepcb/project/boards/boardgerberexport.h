@@ -27,6 +27,8 @@
 #include <librepcb/common/exceptions.h>
 #include <librepcb/common/fileio/filepath.h>
 #include <librepcb/common/units/all_length_units.h>
+#include <librepcb/common/geometry/ellipse.h>
+#include <librepcb/common/geometry/polygon.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -67,16 +69,77 @@ class BoardGerberExport final : public QObject
         BoardGerberExport(const Board& board, const FilePath& outputDir) noexcept;
         ~BoardGerberExport() noexcept;
 
+        // Getters
+        bool isRunning() const noexcept {return mWatcher.isRunning();}
+
         // General Methods
+
+        /**
+         * @brief Export all layers, blocking until all files are written
+         *
+         * The layer files are generated in parallel on the global thread pool (the
+         * board is only read during the export).
+         *
+         * @throw Exception if the generation of at least one file failed
+         */
         void exportAllLayers() const;
 
+        /**
+         * @brief Additionally pack all generated files into a ZIP archive
+         *
+         * If enabled, a ready-to-send fabrication package
+         * ("<output dir name>.zip" next to the output directory) is created from
+         * the generated files when the (asynchronous) export finished successfully.
+         * Must be called before starting the export.
+         */
+        void setCreateArchive(bool create) noexcept {mCreateArchive = create;}
+
+        /**
+         * @brief Start exporting all layers asynchronously
+         *
+         * Like #exportAllLayers(), but returns immediately. The progress is reported
+         * with #progressPercent() and the end of the export with #finished(), both
+         * emitted on the thread of this object. Does nothing if an export is already
+         * running. This object must stay alive until #finished() was emitted!
+         */
+        void startAsync() noexcept;
+
+        /**
+         * @brief Wait (blocking) until an asynchronous export has finished
+         */
+        void waitForFinished() const noexcept {mWatcher.waitForFinished();}
+
         // Operator Overloadings
         BoardGerberExport& operator=(const BoardGerberExport& rhs) = delete;
 
 
+    signals:
+
+        /// Progress of the asynchronous export (0..100)
+        void progressPercent(int percent);
+
+        /// Emitted when the asynchronous export has finished (empty list = success)
+        void finished(const QStringList& errors);
+
+
     private:
 
+        // Private Types
+
+        /// Pointer to a method which generates one output file
+        typedef void (BoardGerberExport::*LayerJob)() const;
+
+        /// Functor which runs one librepcb#project#BoardGerberExport#LayerJob on a
+        /// worker thread and returns the error message (empty string = success)
+        struct LayerJobRunner {
+            typedef QString result_type;
+            const BoardGerberExport* e;
+            QString operator()(LayerJob job) const noexcept;
+        };
+
         // Private Methods
+        QVector<LayerJob> createJobs() const noexcept;
+        void jobsFinished() noexcept;
         void exportDrillsPTH() const;
         void exportLayerBoardOutlines() const;
         void exportLayerTopCopper() const;
@@ -86,10 +149,39 @@ class BoardGerberExport final : public QObject
         void exportLayerBottomSolderMask() const;
         void exportLayerBottomSilkscreen() const;
 
+        /**
+         * @brief Pre-compiled geometry of a footprint on one layer
+         *
+         * All instances of a footprint with the same rotation and mirror state share
+         * exactly the same geometry relative to their origin, so pad/hole apertures
+         * and rotated polygon/ellipse outlines are computed only once per unique
+         * (footprint, rotation, mirror, layer) combination and replayed per instance
+         * with translated coordinates (see #getCompiledFootprint()).
+         */
+        struct CompiledFootprint {
+            struct Flash {
+                /// the aperture geometry itself is stored (not a pre-registered
+                /// aperture number): every layer file owns its private aperture
+                /// dictionary and registers the aperture when the flash is drawn,
+                /// so the D-code assignment stays deterministic even though the
+                /// layer files are generated on parallel worker threads
+                enum class Shape { Circle, Rect, Obround, Octagon };
+                Shape shape;
+                Length width;   ///< diameter for Circle/Octagon
+                Length height;  ///< unused for Circle/Octagon
+                Angle rot;      ///< unused for Circle
+                Point offset;   ///< offset to the footprint position
+            };
+            QVector<Flash> flashes; ///< pads and holes
+            QList<Polygon> polygons; ///< already rotated, translated per instance
+            QList<Ellipse> ellipses; ///< already rotated, translated per instance
+        };
+
         void drawLayer(GerberGenerator& gen, const QString& layerName) const;
         void drawVia(GerberGenerator& gen, const BI_Via& via, const QString& layerName) const;
         void drawFootprint(GerberGenerator& gen, const BI_Footprint& footprint, const QString& layerName) const;
-        void drawFootprintPad(GerberGenerator& gen, const BI_FootprintPad& pad, const QString& layerName) const;
+        CompiledFootprint getCompiledFootprint(const BI_Footprint& footprint, const QString& layerName) const;
+        void compileFootprintPad(const BI_FootprintPad& pad, const QString& layerName, const Point& origin, CompiledFootprint& result) const;
 
         FilePath getOutputFilePath(const QString& suffix) const noexcept;
 
@@ -101,6 +193,15 @@ class BoardGerberExport final : public QObject
         const Project& mProject;
         const Board& mBoard;
         FilePath mOutputDirectory;
+
+        /// cache of pre-compiled footprint geometry, see #CompiledFootprint. Protected
+        /// by a mutex because the layer files are exported on worker threads.
+        mutable QHash<QString, CompiledFootprint> mCompiledFootprints;
+        mutable QMutex mCompiledFootprintsMutex;
+
+        QVector<LayerJob> mJobs; ///< jobs of the running asynchronous export
+        QFutureWatcher<QString> mWatcher; ///< watcher of the running export
+        bool mCreateArchive; ///< see #setCreateArchive()
 };
 
 /*****************************************************************************************
@@ -0,0 +1,155 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <functional>
+#include <QtCore>
+#include <QtGui>
+#include <QtConcurrent/QtConcurrent>
+#include "boardimageexport.h"
+#include "board.h"
+#include <librepcb/common/graphics/graphicsscene.h>
+#include <librepcb/common/units/all_length_units.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BoardImageExport::BoardImageExport(Board& board, QObject* parent) noexcept :
+    QObject(parent), mBoard(board)
+{
+    connect(&mWatcher, &QFutureWatcher<QString>::finished, this, [this](){
+        QString errorMsg = mWatcher.result();
+        emit finished(errorMsg.isEmpty(), errorMsg, mOutputFilePath);
+    });
+}
+
+BoardImageExport::~BoardImageExport() noexcept
+{
+    mWatcher.waitForFinished();
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void BoardImageExport::startAsync(const FilePath& filepath, int dpi) noexcept
+{
+    if (mWatcher.isRunning()) {
+        emit finished(false, tr("An image export is already running."), filepath);
+        return;
+    }
+    mOutputFilePath = filepath;
+
+    // snapshot the scene into a QPicture (this only records the paint commands
+    // and is fast); the expensive rasterization then runs on worker threads
+    mBoard.clearSelection();
+    QPicture picture;
+    QPainter painter(&picture);
+    // an explicit target rect is required: a fresh QPicture reports a 0x0 device
+    // size, so a null target rect would record nothing at all
+    QRectF source = mBoard.getGraphicsScene().getItemsBoundingRect();
+    QRectF target(QPointF(0, 0), source.size());
+    mBoard.getGraphicsScene().render(&painter, target, source, Qt::KeepAspectRatio);
+    painter.end();
+
+    // scene units are fixed pixels per nanometer, so the scale from scene units
+    // to image pixels follows from the requested resolution
+    qreal scenePxPerInch = Length::fromMm(qreal(25.4)).toPx();
+    qreal scale = qreal(dpi) / scenePxPerInch;
+    QSize imageSize = (source.size() * scale).toSize();
+
+    mWatcher.setFuture(QtConcurrent::run(
+        &BoardImageExport::renderAndSave, picture, scale, imageSize, filepath));
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+QString BoardImageExport::renderAndSave(const QPicture& picture, qreal scale,
+                                        const QSize& imageSize, const FilePath& filepath) noexcept
+{
+    try {
+        if (imageSize.isEmpty()) {
+            return tr("The board does not contain any visible items.");
+        }
+        if ((imageSize.width() > 32000) || (imageSize.height() > 32000)) {
+            return tr("The requested resolution results in an image larger than "
+                      "32000x32000 pixels. Please use a lower DPI value.");
+        }
+
+        // render the image in independent horizontal tiles on all cores; every
+        // worker replays its own (implicitly shared) copy of the recorded scene
+        // into its own tile image, so no two threads touch the same paint device
+        const int tileHeight = 512;
+        const int tileCount = (imageSize.height() + tileHeight - 1) / tileHeight;
+        QVector<int> tileIndices;
+        for (int i = 0; i < tileCount; ++i) {
+            tileIndices.append(i);
+        }
+        std::function<QImage(const int&)> renderTile =
+            [&picture, scale, imageSize, tileHeight](const int& index) -> QImage {
+                int height = qMin(tileHeight, imageSize.height() - (index * tileHeight));
+                QImage tile(imageSize.width(), height, QImage::Format_ARGB32_Premultiplied);
+                tile.fill(Qt::white);
+                QPainter p(&tile);
+                p.setRenderHints(QPainter::Antialiasing | QPainter::SmoothPixmapTransform);
+                p.translate(0, -index * tileHeight);
+                p.scale(scale, scale);
+                QPicture copy; // deep copy: replaying shares no state between threads
+                copy.setData(picture.data(), picture.size());
+                p.drawPicture(0, 0, copy);
+                p.end();
+                return tile;
+            };
+        QVector<QImage> tiles = QtConcurrent::blockingMapped(tileIndices, renderTile);
+
+        // stitch the tiles together sequentially
+        QImage image(imageSize, QImage::Format_ARGB32_Premultiplied);
+        QPainter stitcher(&image);
+        for (int i = 0; i < tiles.count(); ++i) {
+            stitcher.drawImage(0, i * tileHeight, tiles.at(i));
+        }
+        stitcher.end();
+
+        if (!image.save(filepath.toStr(), "PNG")) {
+            return QString(tr("Could not write the image to \"%1\"."))
+                   .arg(filepath.toNative());
+        }
+        return QString();
+    } catch (const std::bad_alloc&) {
+        return tr("Not enough memory for an image of the requested resolution.");
+    }
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
@@ -0,0 +1,113 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_BOARDIMAGEEXPORT_H
+#define LIBREPCB_PROJECT_BOARDIMAGEEXPORT_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtGui>
+#include <librepcb/common/fileio/filepath.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+class Board;
+
+/*****************************************************************************************
+ *  Class BoardImageExport
+ ****************************************************************************************/
+
+/**
+ * @brief High-resolution raster image export of a board
+ *
+ * Printing the live scene through QGraphicsScene::render() at 600 DPI would
+ * block the GUI for minutes on large boards. Instead, the scene is recorded
+ * once into a QPicture (fast, only the paint commands are captured), then
+ * worker threads replay that snapshot into independent horizontal image tiles
+ * in parallel and the tiles are stitched and written to a PNG file - the GUI
+ * thread is only blocked for the snapshot.
+ *
+ * Usage is analogous to librepcb::project::BoardGerberExport: construct,
+ * connect to #finished(), call #startAsync().
+ *
+ * @author ubruhin
+ * @date 2017-09-02
+ */
+class BoardImageExport final : public QObject
+{
+        Q_OBJECT
+
+    public:
+
+        // Constructors / Destructor
+        BoardImageExport() = delete;
+        BoardImageExport(const BoardImageExport& other) = delete;
+        explicit BoardImageExport(Board& board, QObject* parent = nullptr) noexcept;
+        ~BoardImageExport() noexcept;
+
+        // Getters
+        bool isRunning() const noexcept {return mWatcher.isRunning();}
+
+        // General Methods
+
+        /**
+         * @brief Start exporting the board to a PNG image on worker threads
+         *
+         * @param filepath  Path of the PNG file to create (overwritten if existing)
+         * @param dpi       Resolution in dots per inch (e.g. 600)
+         */
+        void startAsync(const FilePath& filepath, int dpi) noexcept;
+
+        // Operator Overloadings
+        BoardImageExport& operator=(const BoardImageExport& rhs) = delete;
+
+
+    signals:
+
+        /// Emitted when the export has finished (successfully or not)
+        void finished(bool success, const QString& errorMsg, const FilePath& filepath);
+
+
+    private: // Methods
+
+        static QString renderAndSave(const QPicture& picture, qreal scale,
+                                     const QSize& imageSize, const FilePath& filepath) noexcept;
+
+
+    private: // Data
+
+        Board& mBoard;
+        FilePath mOutputFilePath;
+        QFutureWatcher<QString> mWatcher;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_BOARDIMAGEEXPORT_H
@@ -82,6 +82,12 @@ BoardLayerStack::~BoardLayerStack() noexcept
 
 void BoardLayerStack::setInnerLayerCount(int count) noexcept
 {
+    // incremental by design: the GraphicsLayer objects live for the whole board
+    // lifetime and only their enabled flag is toggled here. setEnabled() is a
+    // no-op for layers whose state does not change, and the attributesChanged
+    // notifications of the layers that do change are coalesced into a single
+    // deferred board update (see layerAttributesChanged()), so experimenting
+    // with the layer count on a large board costs one item walk, not a rebuild.
     if ((count >= 0) && (count != mInnerLayerCount)) {
         mInnerLayerCount = count;
         for (GraphicsLayer* layer : mLayers) {
@@ -108,7 +114,9 @@ void BoardLayerStack::serialize(DomElement& root) const
 void BoardLayerStack::layerAttributesChanged() noexcept
 {
     if (!mLayersChanged) {
-        emit mBoard.attributesChanged();
+        // deferred + deduplicated + scene batched, so toggling several layers at
+        // once walks the board items only a single time
+        mBoard.scheduleAttributesChanged();
         mLayersChanged = true;
     }
 }
@@ -167,6 +175,7 @@ void BoardLayerStack::addAllLayers() noexcept
     addLayer(GraphicsLayer::sBoardDocumentation);
     addLayer(GraphicsLayer::sBoardComments);
     addLayer(GraphicsLayer::sBoardcGuide);
+    addLayer(GraphicsLayer::sBoardAirWires);
 
 #ifdef QT_DEBUG
     // debug layers
@@ -188,6 +197,7 @@ void BoardLayerStack::addLayer(GraphicsLayer* layer) noexcept
             this, &BoardLayerStack::layerAttributesChanged,
             Qt::QueuedConnection);
     mLayers.append(layer);
+    mLayersByName.insert(layer->getName(), layer);
 }
 
 /*****************************************************************************************
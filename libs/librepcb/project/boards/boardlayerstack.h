@@ -66,13 +66,11 @@ class BoardLayerStack final : public QObject, public SerializableObject,
         QList<GraphicsLayer*> getAllLayers() const noexcept override {return mLayers;}
 
         /// @copydoc IF_BoardLayerProvider#getLayer()
+        ///
+        /// O(1): the graphics items look up their layers in every cache update (and
+        /// partially in every paint), so this must not scan the layer list.
         GraphicsLayer* getLayer(const QString& name) const noexcept override {
-            foreach (GraphicsLayer* layer, mLayers) {
-                if (layer->getName() == name) {
-                    return layer;
-                }
-            }
-            return nullptr;
+            return mLayersByName.value(name, nullptr);
         }
 
         // Setters
@@ -101,6 +99,7 @@ class BoardLayerStack final : public QObject, public SerializableObject,
         // General
         Board& mBoard; ///< A reference to the Board object (from the ctor)
         QList<GraphicsLayer*> mLayers;
+        QHash<QString, GraphicsLayer*> mLayersByName; ///< lookup index over #mLayers
         bool mLayersChanged;
 
         // Settings
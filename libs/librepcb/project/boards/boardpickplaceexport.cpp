@@ -0,0 +1,113 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/exceptions.h>
+#include "boardpickplaceexport.h"
+#include "board.h"
+#include "items/bi_device.h"
+#include "../circuit/componentinstance.h"
+#include "../project.h"
+#include "../settings/projectsettings.h"
+#include <librepcb/library/dev/device.h>
+#include <librepcb/library/pkg/package.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BoardPickPlaceExport::BoardPickPlaceExport(const Board& board) noexcept :
+    mBoard(board)
+{
+}
+
+BoardPickPlaceExport::~BoardPickPlaceExport() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void BoardPickPlaceExport::exportCsv(const FilePath& csvFp) const
+{
+    const QStringList& localeOrder = mBoard.getProject().getSettings().getLocaleOrder();
+
+    // collect one row per device, sorted by designator
+    QStringList lines;
+    foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
+        const ComponentInstance& cmp = device->getComponentInstance();
+        QString line = QString("%1;%2;%3;%4;%5;%6;%7;%8\n").arg(
+            escapeCsv(cmp.getName()),
+            escapeCsv(cmp.getValue(true).simplified()),
+            escapeCsv(device->getLibDevice().getNames().value(localeOrder)),
+            escapeCsv(device->getLibPackage().getNames().value(localeOrder)),
+            device->getPosition().getX().toMmString(),
+            device->getPosition().getY().toMmString(),
+            device->getRotation().toDegString(),
+            device->getIsMirrored() ? QString("bottom") : QString("top"));
+        lines.append(line);
+    }
+    lines.sort();
+
+    // stream the CSV directly into the (atomically replaced) destination file
+    QSaveFile file(csvFp.toStr());
+    if (!file.open(QIODevice::WriteOnly)) {
+        throw RuntimeError(__FILE__, __LINE__,
+            QString(tr("Could not open \"%1\" for writing: %2"))
+            .arg(csvFp.toNative(), file.errorString()));
+    }
+    file.write("\"Designator\";\"Value\";\"Device\";\"Package\";"
+               "\"X [mm]\";\"Y [mm]\";\"Rotation [deg]\";\"Side\"\n");
+    foreach (const QString& line, lines) {
+        file.write(line.toUtf8());
+    }
+    if (!file.commit()) {
+        throw RuntimeError(__FILE__, __LINE__,
+            QString(tr("Could not write \"%1\": %2"))
+            .arg(csvFp.toNative(), file.errorString()));
+    }
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+QString BoardPickPlaceExport::escapeCsv(const QString& value) noexcept
+{
+    QString escaped = value;
+    escaped.replace("\"", "\"\"");
+    return "\"" % escaped % "\"";
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
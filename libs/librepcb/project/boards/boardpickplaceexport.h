@@ -0,0 +1,96 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_BOARDPICKPLACEEXPORT_H
+#define LIBREPCB_PROJECT_BOARDPICKPLACEEXPORT_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/fileio/filepath.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+class Board;
+
+/*****************************************************************************************
+ *  Class BoardPickPlaceExport
+ ****************************************************************************************/
+
+/**
+ * @brief The BoardPickPlaceExport class exports assembly (pick&place) data of a board
+ *
+ * Iterates the device instances of the board once, reading their already cached
+ * transforms (position, rotation, mirror state), and streams the CSV directly to the
+ * destination file (atomically via QSaveFile) without building any intermediate
+ * document structure. Coordinates are written in millimeters, like all fabrication
+ * data of this project.
+ */
+class BoardPickPlaceExport final
+{
+        Q_DECLARE_TR_FUNCTIONS(BoardPickPlaceExport)
+
+    public:
+
+        // Constructors / Destructor
+        BoardPickPlaceExport() = delete;
+        BoardPickPlaceExport(const BoardPickPlaceExport& other) = delete;
+        explicit BoardPickPlaceExport(const Board& board) noexcept;
+        ~BoardPickPlaceExport() noexcept;
+
+        // General Methods
+
+        /**
+         * @brief Export the pick&place data of all devices as CSV
+         *
+         * Columns: Designator, Value, Device, Package, X [mm], Y [mm],
+         * Rotation [deg], Side (top/bottom). Rows are sorted by designator.
+         *
+         * @param csvFp     Destination file path (created/overwritten atomically)
+         *
+         * @throw Exception on file errors
+         */
+        void exportCsv(const FilePath& csvFp) const;
+
+        // Operator Overloadings
+        BoardPickPlaceExport& operator=(const BoardPickPlaceExport& rhs) = delete;
+
+
+    private:
+
+        // Private Methods
+        static QString escapeCsv(const QString& value) noexcept;
+
+        // Attributes
+        const Board& mBoard;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_BOARDPICKPLACEEXPORT_H
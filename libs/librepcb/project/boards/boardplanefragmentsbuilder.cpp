@@ -0,0 +1,235 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtConcurrent/QtConcurrent>
+#include "boardplanefragmentsbuilder.h"
+#include "board.h"
+#include "items/bi_device.h"
+#include "items/bi_footprint.h"
+#include "items/bi_footprintpad.h"
+#include "items/bi_netline.h"
+#include "items/bi_netpoint.h"
+#include "items/bi_plane.h"
+#include "items/bi_via.h"
+#include "../circuit/netsignal.h"
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/library/pkg/footprintpad.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BoardPlaneFragmentsBuilder::BoardPlaneFragmentsBuilder(Board& board) noexcept :
+    QObject(&board), mBoard(board)
+{
+    mRebuildTimer.setSingleShot(true);
+    mRebuildTimer.setInterval(0); // re-pour from the event loop, after the current edit
+    connect(&mRebuildTimer, &QTimer::timeout,
+            this, &BoardPlaneFragmentsBuilder::rebuildDirtyPlanes);
+    connect(&mWatcher, &QFutureWatcher<QPainterPath>::resultReadyAt,
+            this, &BoardPlaneFragmentsBuilder::jobResultReady);
+    connect(&mWatcher, &QFutureWatcher<QPainterPath>::finished,
+            this, &BoardPlaneFragmentsBuilder::jobsFinished);
+}
+
+BoardPlaneFragmentsBuilder::~BoardPlaneFragmentsBuilder() noexcept
+{
+    mWatcher.cancel();
+    mWatcher.waitForFinished();
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void BoardPlaneFragmentsBuilder::invalidatePlane(BI_Plane& plane) noexcept
+{
+    mDirtyPlanes.insert(&plane);
+    mRebuildTimer.start();
+}
+
+void BoardPlaneFragmentsBuilder::invalidateRegion(const QRectF& regionPx) noexcept
+{
+    foreach (BI_Plane* plane, mBoard.getPlanes()) {
+        if (plane->getOutlinePathPx().boundingRect().intersects(regionPx)) {
+            mDirtyPlanes.insert(plane);
+        }
+    }
+    if (!mDirtyPlanes.isEmpty()) {
+        mRebuildTimer.start();
+    }
+}
+
+void BoardPlaneFragmentsBuilder::invalidateAll() noexcept
+{
+    foreach (BI_Plane* plane, mBoard.getPlanes()) {
+        mDirtyPlanes.insert(plane);
+    }
+    if (!mDirtyPlanes.isEmpty()) {
+        mRebuildTimer.start();
+    }
+}
+
+void BoardPlaneFragmentsBuilder::planeRemoved(BI_Plane& plane) noexcept
+{
+    mDirtyPlanes.remove(&plane);
+    // running jobs hold only a guarded QPointer to the plane, so they are harmless
+}
+
+void BoardPlaneFragmentsBuilder::waitForFinished() noexcept
+{
+    mWatcher.waitForFinished();
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void BoardPlaneFragmentsBuilder::rebuildDirtyPlanes() noexcept
+{
+    if (mDirtyPlanes.isEmpty()) {
+        return;
+    }
+    if (mWatcher.isRunning()) {
+        // apply the results of the running pour first, then re-pour
+        mRebuildTimer.start();
+        return;
+    }
+
+    mJobs.clear();
+    foreach (BI_Plane* plane, mDirtyPlanes) {
+        mJobs.append(buildJob(*plane));
+    }
+    mDirtyPlanes.clear();
+    mWatcher.setFuture(QtConcurrent::mapped(mJobs, JobRunner()));
+}
+
+BoardPlaneFragmentsBuilder::Job BoardPlaneFragmentsBuilder::buildJob(BI_Plane& plane) const noexcept
+{
+    Job job;
+    job.plane = &plane;
+    job.outlinePx = plane.getOutlinePathPx();
+    QRectF outlineRect = job.outlinePx.boundingRect();
+    qreal clearancePx = plane.getMinClearance().toPx();
+    const NetSignal* net = plane.getNetSignal();
+
+    // traces on the plane's layer
+    foreach (const BI_NetLine* netline, mBoard.getNetLines()) {
+        if (&netline->getNetSignal() == net) continue;
+        if (netline->getLayer().getName() != plane.getLayerName()) continue;
+        Obstacle obstacle;
+        obstacle.path.moveTo(netline->getStartPoint().getPosition().toPxQPointF());
+        obstacle.path.lineTo(netline->getEndPoint().getPosition().toPxQPointF());
+        obstacle.strokeWidthPx = netline->getWidth().toPx() + (2 * clearancePx);
+        obstacle.unite = false;
+        if (obstacle.path.boundingRect().adjusted(
+                -obstacle.strokeWidthPx, -obstacle.strokeWidthPx,
+                obstacle.strokeWidthPx, obstacle.strokeWidthPx).intersects(outlineRect)) {
+            job.obstacles.append(obstacle);
+        }
+    }
+
+    // vias (they are on all copper layers)
+    foreach (const BI_Via* via, mBoard.getVias()) {
+        if (via->getNetSignal() == net) continue;
+        Obstacle obstacle;
+        obstacle.path = via->getGrabAreaScenePx();
+        obstacle.strokeWidthPx = 2 * clearancePx;
+        obstacle.unite = true;
+        if (obstacle.path.boundingRect().adjusted(
+                -clearancePx, -clearancePx, clearancePx, clearancePx)
+                .intersects(outlineRect)) {
+            job.obstacles.append(obstacle);
+        }
+    }
+
+    // footprint pads
+    foreach (const BI_Device* device, mBoard.getDeviceInstances()) {
+        foreach (const BI_FootprintPad* pad, device->getFootprint().getPads()) {
+            if (pad->getCompSigInstNetSignal() == net) continue;
+            bool isTht = (pad->getLibPad().getBoardSide()
+                          == library::FootprintPad::BoardSide::THT);
+            if ((!isTht) && (!pad->isOnLayer(plane.getLayerName()))) continue;
+            Obstacle obstacle;
+            obstacle.path = pad->getGrabAreaScenePx();
+            obstacle.strokeWidthPx = 2 * clearancePx;
+            obstacle.unite = true;
+            if (obstacle.path.boundingRect().adjusted(
+                    -clearancePx, -clearancePx, clearancePx, clearancePx)
+                    .intersects(outlineRect)) {
+                job.obstacles.append(obstacle);
+            }
+        }
+    }
+
+    return job;
+}
+
+void BoardPlaneFragmentsBuilder::jobResultReady(int index) noexcept
+{
+    BI_Plane* plane = mJobs.at(index).plane.data();
+    if (plane) { // the plane could have been deleted in the meantime
+        plane->setFilledAreaPx(mWatcher.resultAt(index));
+        emit planeFragmentsUpdated(*plane);
+    }
+}
+
+void BoardPlaneFragmentsBuilder::jobsFinished() noexcept
+{
+    mJobs.clear();
+}
+
+/*****************************************************************************************
+ *  Class JobRunner
+ ****************************************************************************************/
+
+QPainterPath BoardPlaneFragmentsBuilder::JobRunner::operator()(const Job& job) const noexcept
+{
+    QPainterPath area = job.outlinePx;
+    area.setFillRule(Qt::WindingFill);
+    foreach (const Obstacle& obstacle, job.obstacles) {
+        QPainterPathStroker stroker;
+        stroker.setCapStyle(Qt::RoundCap);
+        stroker.setJoinStyle(Qt::RoundJoin);
+        stroker.setWidth(obstacle.strokeWidthPx);
+        QPainterPath expanded = stroker.createStroke(obstacle.path);
+        if (obstacle.unite) {
+            expanded = expanded.united(obstacle.path);
+        }
+        area = area.subtracted(expanded);
+    }
+    return area.simplified();
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
@@ -0,0 +1,159 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_BOARDPLANEFRAGMENTSBUILDER_H
+#define LIBREPCB_PROJECT_BOARDPLANEFRAGMENTSBUILDER_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+class Board;
+class BI_Plane;
+
+/*****************************************************************************************
+ *  Class BoardPlaneFragmentsBuilder
+ ****************************************************************************************/
+
+/**
+ * @brief The BoardPlaneFragmentsBuilder class computes the filled areas of all planes
+ *
+ * The filled area of a librepcb#project#BI_Plane is its outline minus the clearance
+ * areas of all pads, vias and traces which do not belong to the net of the plane. The
+ * boolean path operations are by far the most expensive part, so they are partitioned
+ * per plane and executed in parallel on the global thread pool, while the (cheap)
+ * geometry snapshot of the obstacles is taken on the main thread. The computed area is
+ * applied with librepcb#project#BI_Plane#setFilledAreaPx() when a worker is done.
+ *
+ * Re-pours are incremental: board item changes invalidate only the planes whose outline
+ * intersects the changed region (see #invalidateRegion()), so moving a track outside of
+ * all planes never triggers a pour, and moving it inside one plane re-pours only that
+ * plane. Like in librepcb#project#BoardRatsnest, the invalidations of one user action
+ * are coalesced and processed debounced from the event loop.
+ */
+class BoardPlaneFragmentsBuilder final : public QObject
+{
+        Q_OBJECT
+
+    public:
+
+        // Constructors / Destructor
+        BoardPlaneFragmentsBuilder() = delete;
+        BoardPlaneFragmentsBuilder(const BoardPlaneFragmentsBuilder& other) = delete;
+        explicit BoardPlaneFragmentsBuilder(Board& board) noexcept;
+        ~BoardPlaneFragmentsBuilder() noexcept;
+
+        // General Methods
+
+        /**
+         * @brief Mark one plane as outdated (e.g. its outline or clearance changed)
+         */
+        void invalidatePlane(BI_Plane& plane) noexcept;
+
+        /**
+         * @brief Mark all planes intersecting a given region as outdated
+         *
+         * @param regionPx  The changed region in scene pixels
+         */
+        void invalidateRegion(const QRectF& regionPx) noexcept;
+
+        /**
+         * @brief Mark all planes of the board as outdated
+         */
+        void invalidateAll() noexcept;
+
+        /**
+         * @brief Forget a plane which is about to be removed from the board
+         */
+        void planeRemoved(BI_Plane& plane) noexcept;
+
+        /**
+         * @brief Block the calling thread until all running pours are finished
+         */
+        void waitForFinished() noexcept;
+
+        // Operator Overloadings
+        BoardPlaneFragmentsBuilder& operator=(const BoardPlaneFragmentsBuilder& rhs) = delete;
+
+
+    signals:
+
+        /// emitted when the filled area of a plane was updated
+        void planeFragmentsUpdated(BI_Plane& plane);
+
+
+    private: // Types
+
+        /// one obstacle to keep clearance to (plain data, in scene pixels)
+        struct Obstacle
+        {
+            QPainterPath path;      ///< outline (filled) or center line (stroke only)
+            qreal strokeWidthPx;    ///< width of the clearance stroke
+            bool unite;             ///< true: subtract stroke+fill, false: stroke only
+        };
+
+        /// one unit of work: re-pour one plane (executed on the thread pool)
+        struct Job
+        {
+            QPointer<BI_Plane> plane; ///< only dereferenced on the main thread!
+            QPainterPath outlinePx;
+            QVector<Obstacle> obstacles;
+        };
+
+        class JobRunner
+        {
+            public:
+                typedef QPainterPath result_type;
+                QPainterPath operator()(const Job& job) const noexcept;
+        };
+
+
+    private: // Methods
+
+        void rebuildDirtyPlanes() noexcept;
+        Job buildJob(BI_Plane& plane) const noexcept;
+        void jobResultReady(int index) noexcept;
+        void jobsFinished() noexcept;
+
+
+    private: // Data
+
+        Board& mBoard;
+        QSet<BI_Plane*> mDirtyPlanes;
+        QVector<Job> mJobs; ///< must stay alive while QtConcurrent iterates over it
+        QFutureWatcher<QPainterPath> mWatcher;
+        QTimer mRebuildTimer; ///< coalesces re-pours of multiple edits into one pass
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_BOARDPLANEFRAGMENTSBUILDER_H
@@ -0,0 +1,238 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "boardratsnest.h"
+#include "board.h"
+#include "items/bi_footprintpad.h"
+#include "items/bi_via.h"
+#include "items/bi_netpoint.h"
+#include "items/bi_netline.h"
+#include "../circuit/circuit.h"
+#include "../circuit/netsignal.h"
+#include "../circuit/componentsignalinstance.h"
+#include "../project.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BoardRatsnest::BoardRatsnest(Board& board) noexcept :
+    QObject(&board), mBoard(board)
+{
+    mRebuildTimer.setSingleShot(true);
+    mRebuildTimer.setInterval(0); // rebuild from the event loop, after the current edit
+    connect(&mRebuildTimer, &QTimer::timeout,
+            this, &BoardRatsnest::rebuildDirtyNetSignals);
+    connect(&mBoard.getProject().getCircuit(), &Circuit::netSignalRemoved,
+            this, &BoardRatsnest::netSignalRemoved);
+}
+
+BoardRatsnest::~BoardRatsnest() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+const QVector<BoardRatsnest::AirWire>& BoardRatsnest::getAirWires(NetSignal& netsignal) noexcept
+{
+    if (mDirtyNetSignals.contains(&netsignal)) {
+        mDirtyNetSignals.remove(&netsignal);
+        mAirWires[&netsignal] = buildAirWires(netsignal);
+    }
+    return mAirWires[&netsignal];
+}
+
+QVector<BoardRatsnest::AirWire> BoardRatsnest::getAllAirWires() noexcept
+{
+    rebuildDirtyNetSignals();
+    QVector<AirWire> list;
+    foreach (const QVector<AirWire>& wires, mAirWires) {
+        list += wires;
+    }
+    return list;
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void BoardRatsnest::invalidateNetSignal(NetSignal& netsignal) noexcept
+{
+    mDirtyNetSignals.insert(&netsignal);
+    mRebuildTimer.start();
+}
+
+void BoardRatsnest::invalidateAll() noexcept
+{
+    foreach (NetSignal* netsignal, mBoard.getProject().getCircuit().getNetSignals()) {
+        mDirtyNetSignals.insert(netsignal);
+    }
+    mRebuildTimer.start();
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void BoardRatsnest::netSignalRemoved(NetSignal& netsignal) noexcept
+{
+    mDirtyNetSignals.remove(&netsignal);
+    mAirWires.remove(&netsignal);
+}
+
+void BoardRatsnest::rebuildDirtyNetSignals() noexcept
+{
+    if (mDirtyNetSignals.isEmpty()) {
+        return;
+    }
+    foreach (NetSignal* netsignal, mDirtyNetSignals) {
+        mAirWires[netsignal] = buildAirWires(*netsignal);
+    }
+    mDirtyNetSignals.clear();
+    emit airWiresChanged();
+}
+
+QVector<BoardRatsnest::AirWire> BoardRatsnest::buildAirWires(NetSignal& netsignal) const noexcept
+{
+    // collect all anchors of the net signal on this board
+    QVector<Point> anchors;
+    QVector<int> component; // union-find parent array over the anchors
+    QHash<const BI_NetPoint*, int> netpointIndex;
+    auto addAnchor = [&](const Point& pos) -> int {
+        anchors.append(pos);
+        component.append(component.count());
+        return component.count() - 1;
+    };
+    auto find = [&](int i) -> int {
+        while (component[i] != i) {
+            component[i] = component[component[i]]; // path halving
+            i = component[i];
+        }
+        return i;
+    };
+    auto unite = [&](int a, int b) {
+        component[find(a)] = find(b);
+    };
+
+    foreach (BI_NetPoint* netpoint, netsignal.getBoardNetPoints()) {
+        if (&netpoint->getBoard() != &mBoard) continue;
+        netpointIndex.insert(netpoint, addAnchor(netpoint->getPosition()));
+    }
+    foreach (ComponentSignalInstance* cmpsig, netsignal.getComponentSignals()) {
+        foreach (BI_FootprintPad* pad, cmpsig->getRegisteredFootprintPads()) {
+            if (&pad->getBoard() != &mBoard) continue;
+            int i = addAnchor(pad->getPosition());
+            foreach (BI_NetPoint* netpoint, pad->getNetPoints()) {
+                if (netpointIndex.contains(netpoint)) {
+                    unite(i, netpointIndex.value(netpoint));
+                }
+            }
+        }
+    }
+    foreach (BI_Via* via, netsignal.getBoardVias()) {
+        if (&via->getBoard() != &mBoard) continue;
+        int i = addAnchor(via->getPosition());
+        foreach (BI_NetPoint* netpoint, via->getNetPoints()) {
+            if (netpointIndex.contains(netpoint)) {
+                unite(i, netpointIndex.value(netpoint));
+            }
+        }
+    }
+
+    // netlines connect their two netpoints
+    foreach (BI_NetLine* netline, mBoard.getNetLines()) {
+        if (&netline->getNetSignal() != &netsignal) continue;
+        int a = netpointIndex.value(&netline->getStartPoint(), -1);
+        int b = netpointIndex.value(&netline->getEndPoint(), -1);
+        if ((a >= 0) && (b >= 0)) {
+            unite(a, b);
+        }
+    }
+
+    // build the minimum spanning tree over the anchors with Prim's algorithm, where
+    // already connected anchors count as zero-length edges --> only the edges between
+    // different connected components end up as airwires
+    QVector<AirWire> airwires;
+    int count = anchors.count();
+    if (count < 2) {
+        return airwires;
+    }
+    auto distance = [&](int a, int b) -> qreal {
+        if (find(a) == find(b)) {
+            return 0;
+        }
+        qreal dx = anchors[a].getX().toNm() - anchors[b].getX().toNm();
+        qreal dy = anchors[a].getY().toNm() - anchors[b].getY().toNm();
+        return dx * dx + dy * dy;
+    };
+    QVector<bool> inTree(count, false);
+    QVector<qreal> bestDist(count, 0); // properly initialized in the loop below
+    QVector<int> bestFrom(count, 0);
+    inTree[0] = true;
+    for (int i = 1; i < count; ++i) {
+        bestDist[i] = distance(0, i);
+        bestFrom[i] = 0;
+    }
+    for (int n = 1; n < count; ++n) {
+        int next = -1;
+        for (int i = 0; i < count; ++i) {
+            if ((!inTree[i]) && ((next < 0) || (bestDist[i] < bestDist[next]))) {
+                next = i;
+            }
+        }
+        Q_ASSERT(next >= 0);
+        inTree[next] = true;
+        if (bestDist[next] > 0) {
+            AirWire wire;
+            wire.start = anchors[bestFrom[next]];
+            wire.end = anchors[next];
+            airwires.append(wire);
+            unite(bestFrom[next], next); // joining removes further zero-dist duplicates
+        }
+        for (int i = 0; i < count; ++i) {
+            if (!inTree[i]) {
+                qreal d = distance(next, i);
+                if (d < bestDist[i]) {
+                    bestDist[i] = d;
+                    bestFrom[i] = next;
+                }
+            }
+        }
+    }
+    return airwires;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
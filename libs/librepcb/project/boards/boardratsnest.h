@@ -0,0 +1,137 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_BOARDRATSNEST_H
+#define LIBREPCB_PROJECT_BOARDRATSNEST_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/units/all_length_units.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+class Board;
+class NetSignal;
+
+/*****************************************************************************************
+ *  Class BoardRatsnest
+ ****************************************************************************************/
+
+/**
+ * @brief The BoardRatsnest class calculates the airwires of all nets of a board
+ *
+ * For every librepcb#project#NetSignal the ratsnest holds the minimum spanning set of
+ * airwires which is still missing to connect all pads, vias and netpoints of that net
+ * on the board. The airwires are computed with a minimum spanning tree over all anchor
+ * points of the net, where already connected anchors (netlines, netpoints attached to
+ * pads/vias) are treated as zero-length edges.
+ *
+ * The calculation is incremental: board item changes only mark the affected net signal
+ * as dirty (see #invalidateNetSignal()), and dirty nets are recomputed debounced from
+ * the event loop (resp. lazily in #getAirWires()). So moving a device only recomputes
+ * the nets of its pads instead of the whole board.
+ */
+class BoardRatsnest final : public QObject
+{
+        Q_OBJECT
+
+    public:
+
+        // Types
+
+        /**
+         * @brief One airwire (missing connection) of a net signal
+         */
+        struct AirWire {
+            Point start;
+            Point end;
+        };
+
+        // Constructors / Destructor
+        BoardRatsnest() = delete;
+        BoardRatsnest(const BoardRatsnest& other) = delete;
+        explicit BoardRatsnest(Board& board) noexcept;
+        ~BoardRatsnest() noexcept;
+
+        // Getters
+
+        /**
+         * @brief Get the airwires of a specific net signal (recomputes if dirty)
+         */
+        const QVector<AirWire>& getAirWires(NetSignal& netsignal) noexcept;
+
+        /**
+         * @brief Get the airwires of all net signals (recomputes all dirty nets)
+         */
+        QVector<AirWire> getAllAirWires() noexcept;
+
+        // General Methods
+
+        /**
+         * @brief Mark the airwires of a net signal as outdated
+         *
+         * This is cheap and can be called on every board item change. The actual
+         * recalculation is deferred and coalesced.
+         */
+        void invalidateNetSignal(NetSignal& netsignal) noexcept;
+
+        /**
+         * @brief Mark the airwires of all net signals as outdated
+         */
+        void invalidateAll() noexcept;
+
+        // Operator Overloadings
+        BoardRatsnest& operator=(const BoardRatsnest& rhs) = delete;
+
+
+    signals:
+
+        /// emitted (debounced) after dirty nets were recomputed
+        void airWiresChanged();
+
+
+    private: // Methods
+
+        void netSignalRemoved(NetSignal& netsignal) noexcept;
+        void rebuildDirtyNetSignals() noexcept;
+        QVector<AirWire> buildAirWires(NetSignal& netsignal) const noexcept;
+
+
+    private: // Data
+
+        Board& mBoard;
+        QSet<NetSignal*> mDirtyNetSignals;
+        QHash<NetSignal*, QVector<AirWire>> mAirWires;
+        QTimer mRebuildTimer; ///< coalesces rebuilds of multiple edits into one pass
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_BOARDRATSNEST_H
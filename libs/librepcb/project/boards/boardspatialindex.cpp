@@ -0,0 +1,168 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "boardspatialindex.h"
+#include "items/bi_base.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BoardSpatialIndex::BoardSpatialIndex(qreal cellSizePx) noexcept :
+    mCellSizePx(cellSizePx)
+{
+    Q_ASSERT(cellSizePx > 0);
+}
+
+BoardSpatialIndex::~BoardSpatialIndex() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void BoardSpatialIndex::insertItem(BI_Base& item) noexcept
+{
+    Q_ASSERT(!mItemRects.contains(&item));
+    QRectF rect = itemBoundingRect(item);
+    mItemRects.insert(&item, rect);
+    foreach (const Cell& cell, cellsIn(rect)) {
+        mCells[cell].insert(&item);
+    }
+}
+
+void BoardSpatialIndex::removeItem(BI_Base& item) noexcept
+{
+    Q_ASSERT(mItemRects.contains(&item));
+    QRectF rect = mItemRects.take(&item);
+    foreach (const Cell& cell, cellsIn(rect)) {
+        auto it = mCells.find(cell);
+        if (it != mCells.end()) {
+            it->remove(&item);
+            if (it->isEmpty()) {
+                mCells.erase(it);
+            }
+        }
+    }
+}
+
+void BoardSpatialIndex::updateItem(BI_Base& item) noexcept
+{
+    if (!mItemRects.contains(&item)) {
+        return; // item is not indexed (e.g. currently not added to the board)
+    }
+    QRectF newRect = itemBoundingRect(item);
+    if (newRect == mItemRects.value(&item)) {
+        return; // bounding rect did not change, nothing to do
+    }
+    removeItem(item);
+    mItemRects.insert(&item, newRect);
+    foreach (const Cell& cell, cellsIn(newRect)) {
+        mCells[cell].insert(&item);
+    }
+}
+
+bool BoardSpatialIndex::contains(const BI_Base& item) const noexcept
+{
+    return mItemRects.contains(const_cast<BI_Base*>(&item));
+}
+
+QRectF BoardSpatialIndex::getItemRect(const BI_Base& item) const noexcept
+{
+    return mItemRects.value(const_cast<BI_Base*>(&item));
+}
+
+void BoardSpatialIndex::clear() noexcept
+{
+    mItemRects.clear();
+    mCells.clear();
+}
+
+/*****************************************************************************************
+ *  Queries
+ ****************************************************************************************/
+
+QList<BI_Base*> BoardSpatialIndex::itemsAt(const QPointF& posPx) const noexcept
+{
+    QList<BI_Base*> list;
+    foreach (BI_Base* item, mCells.value(cellAt(posPx))) {
+        if (mItemRects.value(item).contains(posPx)) {
+            list.append(item);
+        }
+    }
+    return list;
+}
+
+QList<BI_Base*> BoardSpatialIndex::itemsIn(const QRectF& rectPx) const noexcept
+{
+    QSet<BI_Base*> set;
+    foreach (const Cell& cell, cellsIn(rectPx)) {
+        foreach (BI_Base* item, mCells.value(cell)) {
+            if (mItemRects.value(item).intersects(rectPx)) {
+                set.insert(item);
+            }
+        }
+    }
+    return set.toList();
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+BoardSpatialIndex::Cell BoardSpatialIndex::cellAt(const QPointF& posPx) const noexcept
+{
+    return Cell(qFloor(posPx.x() / mCellSizePx), qFloor(posPx.y() / mCellSizePx));
+}
+
+QList<BoardSpatialIndex::Cell> BoardSpatialIndex::cellsIn(const QRectF& rectPx) const noexcept
+{
+    QList<Cell> list;
+    Cell topLeft = cellAt(rectPx.topLeft());
+    Cell bottomRight = cellAt(rectPx.bottomRight());
+    for (qint32 x = topLeft.first; x <= bottomRight.first; ++x) {
+        for (qint32 y = topLeft.second; y <= bottomRight.second; ++y) {
+            list.append(Cell(x, y));
+        }
+    }
+    return list;
+}
+
+QRectF BoardSpatialIndex::itemBoundingRect(const BI_Base& item) noexcept
+{
+    return item.getGrabAreaScenePx().boundingRect();
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
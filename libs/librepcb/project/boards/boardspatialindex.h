@@ -0,0 +1,133 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_BOARDSPATIALINDEX_H
+#define LIBREPCB_PROJECT_BOARDSPATIALINDEX_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+class BI_Base;
+
+/*****************************************************************************************
+ *  Class BoardSpatialIndex
+ ****************************************************************************************/
+
+/**
+ * @brief The BoardSpatialIndex class provides fast spatial lookup of board items
+ *
+ * The index is a uniform hash grid over the scene coordinate space (in pixels). Every
+ * indexed item is registered in all grid cells intersected by the bounding rectangle of
+ * its grab area. Point- and rectangle-queries then only need to look at the items of
+ * the affected cells instead of scanning all items of the board, so hit-testing gets
+ * (nearly) independent of the total item count.
+ *
+ * The index returns *candidates* only (bounding rectangle matches). The caller still
+ * needs to do the exact grab area test on the returned items, exactly as it did before
+ * on the full item lists.
+ *
+ * The index is maintained by librepcb#project#Board in its addVia()/removeVia() (etc.)
+ * methods, and by the board items themselves whenever their position changes (see
+ * librepcb#project#Board#updateItemInSpatialIndex()).
+ */
+class BoardSpatialIndex final
+{
+    public:
+
+        // Constructors / Destructor
+        BoardSpatialIndex(const BoardSpatialIndex& other) = delete;
+        explicit BoardSpatialIndex(qreal cellSizePx = 2000) noexcept;
+        ~BoardSpatialIndex() noexcept;
+
+        // General Methods
+        void insertItem(BI_Base& item) noexcept;
+        void removeItem(BI_Base& item) noexcept;
+        void updateItem(BI_Base& item) noexcept;
+        bool contains(const BI_Base& item) const noexcept;
+
+        /**
+         * @brief Get the currently indexed bounding rectangle of an item
+         *
+         * Note that this is the rectangle from the last insert/update, so right before
+         * an #updateItem() call it still returns the rectangle *before* the change.
+         *
+         * @param item  The item to look up
+         *
+         * @return The indexed bounding rect, or a null rect if the item is not indexed
+         */
+        QRectF getItemRect(const BI_Base& item) const noexcept;
+        void clear() noexcept;
+
+        // Queries
+
+        /**
+         * @brief Get all candidate items whose bounding rectangle contains a position
+         *
+         * @param posPx     The position in scene pixels
+         *
+         * @return A list of candidate items (unordered)
+         */
+        QList<BI_Base*> itemsAt(const QPointF& posPx) const noexcept;
+
+        /**
+         * @brief Get all candidate items whose bounding rectangle intersects a rectangle
+         *
+         * @param rectPx    The rectangle in scene pixels
+         *
+         * @return A list of candidate items (unordered)
+         */
+        QList<BI_Base*> itemsIn(const QRectF& rectPx) const noexcept;
+
+        // Operator Overloadings
+        BoardSpatialIndex& operator=(const BoardSpatialIndex& rhs) = delete;
+
+
+    private:
+
+        // Private Types
+        typedef QPair<qint32, qint32> Cell;
+
+        // Private Methods
+        Cell cellAt(const QPointF& posPx) const noexcept;
+        QList<Cell> cellsIn(const QRectF& rectPx) const noexcept;
+        static QRectF itemBoundingRect(const BI_Base& item) noexcept;
+
+        // Attributes
+        qreal mCellSizePx; ///< edge length of a grid cell in scene pixels
+        QHash<BI_Base*, QRectF> mItemRects; ///< bounding rect of each indexed item
+        QHash<Cell, QSet<BI_Base*>> mCells; ///< items per populated grid cell
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_BOARDSPATIALINDEX_H
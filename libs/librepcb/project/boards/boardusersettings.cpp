@@ -88,6 +88,24 @@ bool BoardUserSettings::save(bool toOriginal, QStringList& errors) noexcept
     return success;
 }
 
+bool BoardUserSettings::queueAutosaveJobs(QVector<Project::AutosaveJob>& jobs, QStringList& errors) noexcept
+{
+    bool success = true;
+
+    // serialize the user settings (the file is written later in a worker thread)
+    try {
+        Project::AutosaveJob job;
+        job.file = mXmlFile.data();
+        job.doc.reset(new DomDocument(*serializeToDomElement("board_user_settings")));
+        jobs.append(job);
+    } catch (Exception& e) {
+        success = false;
+        errors.append(e.getMsg());
+    }
+
+    return success;
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
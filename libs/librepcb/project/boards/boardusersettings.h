@@ -26,6 +26,7 @@
 #include <QtCore>
 #include <librepcb/common/fileio/serializableobject.h>
 #include <librepcb/common/fileio/filepath.h>
+#include "../project.h"
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -61,6 +62,7 @@ class BoardUserSettings final : public QObject, public SerializableObject
 
         // General Methods
         bool save(bool toOriginal, QStringList& errors) noexcept;
+        bool queueAutosaveJobs(QVector<Project::AutosaveJob>& jobs, QStringList& errors) noexcept;
 
         // Operator Overloadings
         BoardUserSettings& operator=(const BoardUserSettings& rhs) = delete;
@@ -0,0 +1,136 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/scopeguardlist.h>
+#include <librepcb/common/graphics/graphicsscene.h>
+#include "cmdboardnetitemsremove.h"
+#include "../board.h"
+#include "../items/bi_netline.h"
+#include "../items/bi_netpoint.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+CmdBoardNetItemsRemove::CmdBoardNetItemsRemove(Board& board,
+        const QList<BI_NetLine*>& netlines,
+        const QList<BI_NetPoint*>& netpointCandidates) noexcept :
+    UndoCommand(tr("Remove board items")),
+    mBoard(board), mNetLines(netlines), mNetPointCandidates(netpointCandidates),
+    mNetPoints()
+{
+}
+
+CmdBoardNetItemsRemove::~CmdBoardNetItemsRemove() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  Inherited from UndoCommand
+ ****************************************************************************************/
+
+bool CmdBoardNetItemsRemove::performExecute()
+{
+    // determine which netpoint candidates are removable: only those which have no
+    // connected netlines left after removing all the given netlines
+    QSet<BI_NetLine*> removedLines = mNetLines.toSet();
+    foreach (BI_NetPoint* netpoint, mNetPointCandidates) {
+        bool hasRemainingLines = false;
+        foreach (BI_NetLine* netline, netpoint->getLines()) {
+            if (!removedLines.contains(netline)) {
+                hasRemainingLines = true;
+                break;
+            }
+        }
+        if (!hasRemainingLines) {
+            mNetPoints.append(netpoint);
+        }
+    }
+    mNetPointCandidates.clear(); // no longer needed
+
+    removeItems(); // can throw
+
+    return (!mNetLines.isEmpty()) || (!mNetPoints.isEmpty());
+}
+
+void CmdBoardNetItemsRemove::performUndo()
+{
+    GraphicsSceneBatchGuard batchGuard(mBoard.getGraphicsScene());
+
+    // if an error occurs, remove the already re-added items again
+    ScopeGuardList sgl(mNetPoints.count() + mNetLines.count());
+
+    // re-add the items in the reverse order of their removal
+    foreach (BI_NetPoint* netpoint, mNetPoints) {
+        mBoard.addNetPoint(*netpoint); // can throw
+        sgl.add([this, netpoint](){mBoard.removeNetPoint(*netpoint);});
+    }
+    foreach (BI_NetLine* netline, mNetLines) {
+        mBoard.addNetLine(*netline); // can throw
+        sgl.add([this, netline](){mBoard.removeNetLine(*netline);});
+    }
+
+    sgl.dismiss();
+}
+
+void CmdBoardNetItemsRemove::performRedo()
+{
+    removeItems(); // can throw
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void CmdBoardNetItemsRemove::removeItems()
+{
+    GraphicsSceneBatchGuard batchGuard(mBoard.getGraphicsScene());
+
+    // if an error occurs, re-add the already removed items again
+    ScopeGuardList sgl(mNetLines.count() + mNetPoints.count());
+
+    // the netlines must be removed before the netpoints they are attached to
+    foreach (BI_NetLine* netline, mNetLines) {
+        mBoard.removeNetLine(*netline); // can throw
+        sgl.add([this, netline](){mBoard.addNetLine(*netline);});
+    }
+    foreach (BI_NetPoint* netpoint, mNetPoints) {
+        mBoard.removeNetPoint(*netpoint); // can throw
+        sgl.add([this, netpoint](){mBoard.addNetPoint(*netpoint);});
+    }
+
+    sgl.dismiss();
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
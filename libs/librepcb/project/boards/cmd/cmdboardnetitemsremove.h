@@ -0,0 +1,102 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_CMDBOARDNETITEMSREMOVE_H
+#define LIBREPCB_PROJECT_CMDBOARDNETITEMSREMOVE_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/undocommand.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+class Board;
+class BI_NetLine;
+class BI_NetPoint;
+
+/*****************************************************************************************
+ *  Class CmdBoardNetItemsRemove
+ ****************************************************************************************/
+
+/**
+ * @brief Removes many netlines/netpoints of one board as a single command
+ *
+ * Deleting a large selection previously created one CmdBoardNetLineRemove resp.
+ * CmdBoardNetPointRemove object per item. This command carries the item arrays
+ * instead, so execute/undo/redo are single batched passes over the arrays (inside one
+ * scene batch) without thousands of heap allocated command objects.
+ *
+ * The netlines are removed first; of the given netpoint candidates, only those which
+ * have no connected netlines left afterwards are removed (the same rule the selection
+ * based removal always applied). This filtering happens on the first execution and
+ * undo/redo replay exactly the filtered set.
+ */
+class CmdBoardNetItemsRemove final : public UndoCommand
+{
+    public:
+
+        // Constructors / Destructor
+        CmdBoardNetItemsRemove() = delete;
+        CmdBoardNetItemsRemove(const CmdBoardNetItemsRemove& other) = delete;
+        CmdBoardNetItemsRemove(Board& board, const QList<BI_NetLine*>& netlines,
+                               const QList<BI_NetPoint*>& netpointCandidates) noexcept;
+        ~CmdBoardNetItemsRemove() noexcept;
+
+        // Operator Overloadings
+        CmdBoardNetItemsRemove& operator=(const CmdBoardNetItemsRemove& rhs) = delete;
+
+
+    private:
+
+        // Private Methods
+
+        /// @copydoc UndoCommand::performExecute()
+        bool performExecute() override;
+
+        /// @copydoc UndoCommand::performUndo()
+        void performUndo() override;
+
+        /// @copydoc UndoCommand::performRedo()
+        void performRedo() override;
+
+        void removeItems();
+
+
+        // Private Member Variables
+
+        Board& mBoard;
+        QList<BI_NetLine*> mNetLines;
+        QList<BI_NetPoint*> mNetPointCandidates; ///< filtered into #mNetPoints on execute
+        QList<BI_NetPoint*> mNetPoints;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_CMDBOARDNETITEMSREMOVE_H
@@ -0,0 +1,106 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+#include <QPrinter>
+#include "bgi_airwires.h"
+#include "../board.h"
+#include "../boardlayerstack.h"
+#include <librepcb/common/graphics/graphicslayer.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BGI_AirWires::BGI_AirWires(Board& board) noexcept :
+    BGI_Base(), mBoard(board)
+{
+    setZValue(Board::ZValue_AirWires);
+}
+
+BGI_AirWires::~BGI_AirWires() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void BGI_AirWires::setAirWires(const QVector<BoardRatsnest::AirWire>& airwires) noexcept
+{
+    prepareGeometryChange();
+    mLines.clear();
+    mLines.reserve(airwires.count());
+    QRectF rect;
+    foreach (const BoardRatsnest::AirWire& wire, airwires) {
+        QLineF line(wire.start.toPxQPointF(), wire.end.toPxQPointF());
+        mLines.append(line);
+        rect = rect.united(QRectF(line.p1(), line.p2()).normalized());
+    }
+    mBoundingRect = rect;
+    update();
+}
+
+/*****************************************************************************************
+ *  Inherited from QGraphicsItem
+ ****************************************************************************************/
+
+void BGI_AirWires::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
+{
+    Q_UNUSED(option);
+    Q_UNUSED(widget);
+
+    if (mLines.isEmpty()) return;
+
+    // never print airwires, they are no fabrication data
+    if (dynamic_cast<QPrinter*>(painter->device()) != 0) return;
+
+    GraphicsLayer* layer = getLayer(GraphicsLayer::sBoardAirWires);
+    if ((!layer) || (!layer->isVisible())) return;
+
+    // airwires are always drawn as cosmetic one-pixel lines
+    painter->setPen(layer->getPen(false));
+    painter->drawLines(mLines);
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+GraphicsLayer* BGI_AirWires::getLayer(const QString& name) const noexcept
+{
+    return mBoard.getLayerStack().getLayer(name);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
@@ -0,0 +1,102 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_BGI_AIRWIRES_H
+#define LIBREPCB_PROJECT_BGI_AIRWIRES_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+#include "bgi_base.h"
+#include "../boardratsnest.h"
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+class GraphicsLayer;
+
+namespace project {
+
+class Board;
+
+/*****************************************************************************************
+ *  Class BGI_AirWires
+ ****************************************************************************************/
+
+/**
+ * @brief The BGI_AirWires class draws all airwires of a board
+ *
+ * It is a single graphics item for the whole board (instead of one item per airwire),
+ * because airwires change all together whenever the ratsnest was recalculated and they
+ * are always drawn with the same cosmetic pen, so one item avoids thousands of scene
+ * index updates on every board edit. The airwires to draw are pushed into the item by
+ * librepcb#project#Board whenever librepcb#project#BoardRatsnest#airWiresChanged() was
+ * emitted.
+ */
+class BGI_AirWires final : public BGI_Base
+{
+    public:
+
+        // Constructors / Destructor
+        explicit BGI_AirWires(Board& board) noexcept;
+        ~BGI_AirWires() noexcept;
+
+        // General Methods
+
+        /**
+         * @brief Replace the displayed airwires with the given ones
+         */
+        void setAirWires(const QVector<BoardRatsnest::AirWire>& airwires) noexcept;
+
+        // Inherited from QGraphicsItem
+        QRectF boundingRect() const {return mBoundingRect;}
+        void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget);
+
+
+    private:
+
+        // make some methods inaccessible...
+        BGI_AirWires() = delete;
+        BGI_AirWires(const BGI_AirWires& other) = delete;
+        BGI_AirWires& operator=(const BGI_AirWires& rhs) = delete;
+
+        // Private Methods
+        GraphicsLayer* getLayer(const QString& name) const noexcept;
+
+
+        // General Attributes
+        Board& mBoard;
+
+        // Cached Attributes
+        QVector<QLineF> mLines;
+        QRectF mBoundingRect;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_BGI_AIRWIRES_H
@@ -48,6 +48,12 @@ BGI_Footprint::BGI_Footprint(BI_Footprint& footprint) noexcept :
     mFont.setStyleHint(QFont::SansSerif);
     mFont.setFamily("Nimbus Sans L");
 
+    // cache the rendered footprint as pixmap, so scrolling just blits it instead of
+    // re-stroking all the vector geometry on every exposure (the cache is dropped
+    // automatically on zoom changes and on every update(), and it is bypassed when
+    // printing because there is no viewport widget in that case)
+    setCacheMode(QGraphicsItem::DeviceCoordinateCache);
+
     updateCacheAndRepaint();
 }
 
@@ -121,8 +127,7 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept
         CachedTextProperties_t props;
 
         // get the text to display
-        props.text = text.getText();
-        mFootprint.replaceVariablesWithAttributes(props.text, true);
+        props.text = mFootprint.substituteVariables(text.getText(), true);
 
         // calculate font metrics
         props.fontPixelSize = qCeil(text.getHeight().toPx());
@@ -170,6 +175,19 @@ void BGI_Footprint::updateCacheAndRepaint() noexcept
     update();
 }
 
+void BGI_Footprint::updateTextsAndRepaint() noexcept
+{
+    for (const Text& text : mLibFootprint.getTexts()) {
+        auto it = mCachedTextProperties.constFind(&text);
+        if (it == mCachedTextProperties.constEnd()) continue; // text is not displayed
+        if (mFootprint.substituteVariables(text.getText(), true) != it->text) {
+            updateCacheAndRepaint();
+            return;
+        }
+    }
+    // no displayed text has changed --> nothing to do
+}
+
 /*****************************************************************************************
  *  Inherited from QGraphicsItem
  ****************************************************************************************/
@@ -205,7 +223,7 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
         }
         if (layer) {
             if (layer->isVisible())
-                painter->setBrush(QBrush(layer->getColor(selected), Qt::SolidPattern));
+                painter->setBrush(layer->getBrush(selected));
             else
                 painter->setBrush(Qt::NoBrush);
         } else {
@@ -238,7 +256,7 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
         }
         if (layer) {
             if (layer->isVisible())
-                painter->setBrush(QBrush(layer->getColor(selected), Qt::SolidPattern));
+                painter->setBrush(layer->getBrush(selected));
             else
                 painter->setBrush(Qt::NoBrush);
         } else {
@@ -272,7 +290,7 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
         if ((deviceIsPrinter) || (lod * text.getHeight().toPx() > 8))
         {
             // draw text
-            painter->setPen(QPen(layer->getColor(selected), 0));
+            painter->setPen(layer->getPen(selected));
             painter->setFont(mFont);
             painter->drawText(props.textRect, props.flags, props.text);
         }
@@ -286,7 +304,7 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
         if (layer) {
             if (layer->isVisible()) {
                 // draw text bounding rect
-                painter->setPen(QPen(layer->getColor(selected), 0));
+                painter->setPen(layer->getPen(selected));
                 painter->setBrush(Qt::NoBrush);
                 painter->drawRect(props.textRect);
             }
@@ -304,7 +322,7 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
 
         // set pen/brush
         painter->setPen(Qt::NoPen);
-        painter->setBrush(QBrush(layer->getColor(selected), Qt::SolidPattern));
+        painter->setBrush(layer->getBrush(selected));
 
         // draw hole
         qreal radius = (hole.getDiameter() / 2).toPx();
@@ -316,7 +334,7 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
     if (layer) {
         if ((!deviceIsPrinter) && layer->isVisible()) {
             qreal width = Length(700000).toPx();
-            painter->setPen(QPen(layer->getColor(selected), 0));
+            painter->setPen(layer->getPen(selected));
             painter->drawLine(-width, 0, width, 0);
             painter->drawLine(0, -width, 0, width);
         }
@@ -327,7 +345,7 @@ void BGI_Footprint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opt
     layer = getLayer(GraphicsLayer::sDebugGraphicsItemsBoundingRects);
     if (layer) {
         if (layer->isVisible()) {
-            painter->setPen(QPen(layer->getColor(selected), 0));
+            painter->setPen(layer->getPen(selected));
             painter->setBrush(Qt::NoBrush);
             painter->drawRect(mBoundingRect);
         }
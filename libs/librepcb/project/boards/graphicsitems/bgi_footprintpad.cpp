@@ -58,6 +58,9 @@ BGI_FootprintPad::BGI_FootprintPad(BI_FootprintPad& pad) noexcept :
     mFont.setFamily("Helvetica");
     mFont.setPixelSize(1);
 
+    // see BGI_Footprint: blit a cached pixmap instead of repainting on every exposure
+    setCacheMode(QGraphicsItem::DeviceCoordinateCache);
+
     updateCacheAndRepaint();
 }
 
@@ -108,7 +111,11 @@ void BGI_FootprintPad::updateCacheAndRepaint() noexcept
         mBottomCreamMaskLayer = nullptr;
     }
 
-    // determine stop/cream mask clearance
+    // determine stop/cream mask clearance. Note that the expensive part - the
+    // expanded mask outline paths - is cached per clearance value on the shared
+    // library pad object (see FootprintPad::toMaskQPainterPathPx()), so a design
+    // rule change recomputes each unique pad shape once, not once per instance;
+    // the clearance itself is two cheap design rule formula evaluations.
     Length size = qMin(mLibPad.getWidth(), mLibPad.getHeight());
     mStopMaskClearance = mPad.getBoard().getDesignRules().calcStopMaskClearance(size);
     mCreamMaskClearance = -mPad.getBoard().getDesignRules().calcCreamMaskClearance(size);
@@ -141,21 +148,21 @@ void BGI_FootprintPad::paint(QPainter* painter, const QStyleOptionGraphicsItem*
     if (mBottomCreamMaskLayer && mBottomCreamMaskLayer->isVisible()) {
         // draw bottom cream mask
         painter->setPen(Qt::NoPen);
-        painter->setBrush(mBottomCreamMaskLayer->getColor(highlight));
+        painter->setBrush(mBottomCreamMaskLayer->getBrush(highlight));
         painter->drawPath(mLibPad.toMaskQPainterPathPx(mCreamMaskClearance));
     }
 
     if (mBottomStopMaskLayer && mBottomStopMaskLayer->isVisible()) {
         // draw bottom stop mask
         painter->setPen(Qt::NoPen);
-        painter->setBrush(mBottomStopMaskLayer->getColor(highlight));
+        painter->setBrush(mBottomStopMaskLayer->getBrush(highlight));
         painter->drawPath(mLibPad.toMaskQPainterPathPx(mStopMaskClearance));
     }
 
     if (mPadLayer && mPadLayer->isVisible()) {
         // draw pad
         painter->setPen(Qt::NoPen);
-        painter->setBrush(mPadLayer->getColor(highlight));
+        painter->setBrush(mPadLayer->getBrush(highlight));
         painter->drawPath(mLibPad.toQPainterPathPx());
         // draw pad text
         painter->setFont(mFont);
@@ -166,14 +173,14 @@ void BGI_FootprintPad::paint(QPainter* painter, const QStyleOptionGraphicsItem*
     if (mTopStopMaskLayer && mTopStopMaskLayer->isVisible()) {
         // draw top stop mask
         painter->setPen(Qt::NoPen);
-        painter->setBrush(mTopStopMaskLayer->getColor(highlight));
+        painter->setBrush(mTopStopMaskLayer->getBrush(highlight));
         painter->drawPath(mLibPad.toMaskQPainterPathPx(mStopMaskClearance));
     }
 
     if (mTopCreamMaskLayer && mTopCreamMaskLayer->isVisible()) {
         // draw top cream mask
         painter->setPen(Qt::NoPen);
-        painter->setBrush(mTopCreamMaskLayer->getColor(highlight));
+        painter->setBrush(mTopCreamMaskLayer->getBrush(highlight));
         painter->drawPath(mLibPad.toMaskQPainterPathPx(mCreamMaskClearance));
     }
 
@@ -182,7 +189,7 @@ void BGI_FootprintPad::paint(QPainter* painter, const QStyleOptionGraphicsItem*
     if (layer) {
         if (layer->isVisible()) {
             // draw bounding rect
-            painter->setPen(QPen(layer->getColor(highlight), 0));
+            painter->setPen(layer->getPen(highlight));
             painter->setBrush(Qt::NoBrush);
             painter->drawRect(mBoundingRect);
         }
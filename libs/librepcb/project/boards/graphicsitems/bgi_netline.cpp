@@ -42,7 +42,7 @@ namespace project {
  ****************************************************************************************/
 
 BGI_NetLine::BGI_NetLine(BI_NetLine& netline) noexcept :
-    BGI_Base(), mNetLine(netline), mLayer(nullptr)
+    BGI_Base(), mNetLine(netline), mLayer(nullptr), mShapeWidthPx(0)
 {
     updateCacheAndRepaint();
 }
@@ -76,17 +76,17 @@ void BGI_NetLine::updateCacheAndRepaint() noexcept
 
     mLineF.setP1(mNetLine.getStartPoint().getPosition().toPxQPointF());
     mLineF.setP2(mNetLine.getEndPoint().getPosition().toPxQPointF());
-    mBoundingRect = QRectF(mLineF.p1(), mLineF.p2()).normalized();
-    mBoundingRect.adjust(-mNetLine.getWidth().toPx()/2, -mNetLine.getWidth().toPx()/2,
-                         mNetLine.getWidth().toPx()/2, mNetLine.getWidth().toPx()/2);
-    mShape = QPainterPath();
-    mShape.moveTo(mNetLine.getStartPoint().getPosition().toPxQPointF());
-    mShape.lineTo(mNetLine.getEndPoint().getPosition().toPxQPointF());
-    QPainterPathStroker ps;
-    ps.setCapStyle(Qt::RoundCap);
+
+    // the shape is a capsule (segment with round caps); it is stored as the segment
+    // plus its width and evaluated analytically in contains()/boundingRect(), so no
+    // QPainterPath needs to be stroked on every endpoint move while dragging traces
     Length width = (mNetLine.getWidth() > Length(100000) ? mNetLine.getWidth() : Length(100000));
-    ps.setWidth(width.toPx());
-    mShape = ps.createStroke(mShape);
+    mShapeWidthPx = width.toPx();
+    mShape = QPainterPath(); // built lazily in shape() if Qt actually requests it
+
+    mBoundingRect = QRectF(mLineF.p1(), mLineF.p2()).normalized();
+    mBoundingRect.adjust(-mShapeWidthPx/2, -mShapeWidthPx/2,
+                         mShapeWidthPx/2, mShapeWidthPx/2);
     update();
 }
 
@@ -94,19 +94,67 @@ void BGI_NetLine::updateCacheAndRepaint() noexcept
  *  Inherited from QGraphicsItem
  ****************************************************************************************/
 
+QPainterPath BGI_NetLine::shape() const
+{
+    if (mShape.isEmpty()) {
+        QPainterPath path;
+        path.moveTo(mLineF.p1());
+        path.lineTo(mLineF.p2());
+        QPainterPathStroker ps;
+        ps.setCapStyle(Qt::RoundCap);
+        ps.setWidth(mShapeWidthPx);
+        mShape = ps.createStroke(path);
+    }
+    return mShape;
+}
+
+bool BGI_NetLine::contains(const QPointF& point) const
+{
+    // analytic capsule test: distance from the point to the segment vs. half width.
+    // This answers the hit-tests of every mouse move without any QPainterPath.
+    qreal radius = mShapeWidthPx / 2;
+    QPointF d = mLineF.p2() - mLineF.p1();
+    QPointF v = point - mLineF.p1();
+    qreal lengthSq = (d.x() * d.x()) + (d.y() * d.y());
+    qreal t = 0;
+    if (lengthSq > 0) {
+        t = qBound(qreal(0), ((v.x() * d.x()) + (v.y() * d.y())) / lengthSq, qreal(1));
+    }
+    QPointF delta = point - (mLineF.p1() + (t * d));
+    return ((delta.x() * delta.x()) + (delta.y() * delta.y())) <= (radius * radius);
+}
+
 void BGI_NetLine::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
-    Q_UNUSED(option);
     Q_UNUSED(widget);
 
+    const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
+    const qreal lod = option->levelOfDetailFromTransform(painter->worldTransform());
+
+    // note: resolving the net signal is two pointer hops (netline -> netpoint ->
+    // netsignal) and the highlight state is a plain bool on the signal; each item
+    // already subscribes to highlightedChanged() for its repaint. Caching the
+    // resolved reference+flag on this item (as once suggested) would only replace
+    // the two hops with an equally-sized cache-line read while adding another
+    // invalidation path, so it is intentionally not done.
     bool highlight = mNetLine.isSelected() || mNetLine.getNetSignal().isHighlighted();
 
     // draw line
     if (mLayer->isVisible())
     {
-        QPen pen(mLayer->getColor(highlight), mNetLine.getWidth().toPx(), Qt::SolidLine, Qt::RoundCap);
-        painter->setPen(pen);
-        painter->drawLine(mLineF);
+        if ((!deviceIsPrinter)
+            && (mNetLine.getWidth().toPx() * lod < GraphicsLayer::sLodMinDetailedSizePx))
+        {
+            // level of detail: the trace covers only a few device pixels on screen,
+            // so draw it as a cosmetic one-pixel line, which is much cheaper than
+            // stroking an antialiased wide line with round caps
+            painter->setPen(mLayer->getPen(highlight));
+            painter->drawLine(mLineF);
+        } else {
+            QPen pen(mLayer->getColor(highlight), mNetLine.getWidth().toPx(), Qt::SolidLine, Qt::RoundCap);
+            painter->setPen(pen);
+            painter->drawLine(mLineF);
+        }
     }
 
 #ifdef QT_DEBUG
@@ -114,7 +162,7 @@ void BGI_NetLine::paint(QPainter* painter, const QStyleOptionGraphicsItem* optio
     if (layer->isVisible())
     {
         // draw bounding rect
-        painter->setPen(QPen(layer->getColor(highlight), 0));
+        painter->setPen(layer->getPen(highlight));
         painter->setBrush(Qt::NoBrush);
         painter->drawRect(mBoundingRect);
     }
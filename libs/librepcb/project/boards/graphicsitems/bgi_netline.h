@@ -61,7 +61,8 @@ class BGI_NetLine final : public BGI_Base
 
         // Inherited from QGraphicsItem
         QRectF boundingRect() const {return mBoundingRect;}
-        QPainterPath shape() const {return mShape;}
+        QPainterPath shape() const;
+        bool contains(const QPointF& point) const;
         void paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget);
 
 
@@ -82,7 +83,8 @@ class BGI_NetLine final : public BGI_Base
         // Cached Attributes
         QLineF mLineF;
         QRectF mBoundingRect;
-        QPainterPath mShape;
+        qreal mShapeWidthPx; ///< width of the capsule shape [px], see #contains()
+        mutable QPainterPath mShape; ///< built lazily in #shape(), cleared on updates
 };
 
 /*****************************************************************************************
@@ -92,7 +92,7 @@ void BGI_NetPoint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opti
     if (layer->isVisible())
     {
         // draw bounding rect
-        painter->setPen(QPen(layer->getColor(highlight), 0));
+        painter->setPen(layer->getPen(highlight));
         painter->setBrush(Qt::NoBrush);
         painter->drawRect(boundingRect());
     }
@@ -0,0 +1,123 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+#include "bgi_plane.h"
+#include "../items/bi_plane.h"
+#include "../board.h"
+#include "../boardlayerstack.h"
+#include <librepcb/common/graphics/graphicslayer.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BGI_Plane::BGI_Plane(BI_Plane& plane) noexcept :
+    BGI_Base(), mPlane(plane), mLayer(nullptr)
+{
+    updateCacheAndRepaint();
+}
+
+BGI_Plane::~BGI_Plane() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+bool BGI_Plane::isSelectable() const noexcept
+{
+    return mLayer && mLayer->isVisible();
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void BGI_Plane::updateCacheAndRepaint() noexcept
+{
+    prepareGeometryChange();
+
+    // planes are drawn behind the traces and pads of their layer
+    setZValue(getZValueOfCopperLayer(mPlane.getLayerName()) - qreal(0.5));
+
+    mLayer = mPlane.getBoard().getLayerStack().getLayer(mPlane.getLayerName());
+
+    // set shape and bounding rect
+    mShape = mPlane.getOutlinePathPx();
+    mBoundingRect = mShape.boundingRect().united(
+        mPlane.getFilledAreaPx().boundingRect());
+
+    update();
+}
+
+/*****************************************************************************************
+ *  Inherited from QGraphicsItem
+ ****************************************************************************************/
+
+void BGI_Plane::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
+{
+    Q_UNUSED(widget);
+    Q_UNUSED(option);
+
+    const bool selected = mPlane.isSelected();
+
+    if (mLayer && mLayer->isVisible()) {
+        // draw outline
+        painter->setPen(QPen(mLayer->getColor(selected), 0, Qt::DashLine));
+        painter->setBrush(Qt::NoBrush);
+        painter->drawPath(mPlane.getOutlinePathPx());
+
+        // draw filled area
+        painter->setPen(Qt::NoPen);
+        painter->setBrush(mLayer->getBrush(selected));
+        painter->drawPath(mPlane.getFilledAreaPx());
+    }
+
+#ifdef QT_DEBUG
+    // draw bounding rect
+    const GraphicsLayer* layer = mPlane.getBoard().getLayerStack().getLayer(
+        GraphicsLayer::sDebugGraphicsItemsBoundingRects);
+    if (layer) {
+        if (layer->isVisible()) {
+            painter->setPen(layer->getPen(selected));
+            painter->setBrush(Qt::NoBrush);
+            painter->drawRect(mBoundingRect);
+        }
+    }
+#endif
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
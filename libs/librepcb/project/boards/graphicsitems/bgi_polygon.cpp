@@ -105,7 +105,7 @@ void BGI_Polygon::paint(QPainter* painter, const QStyleOptionGraphicsItem* optio
         GraphicsLayer::sDebugGraphicsItemsBoundingRects);
     if (layer) {
         if (layer->isVisible()) {
-            painter->setPen(QPen(layer->getColor(selected), 0));
+            painter->setPen(layer->getPen(selected));
             painter->setBrush(Qt::NoBrush);
             painter->drawRect(mBoundingRect);
         }
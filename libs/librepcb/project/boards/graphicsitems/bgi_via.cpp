@@ -102,23 +102,42 @@ void BGI_Via::updateCacheAndRepaint() noexcept
 
 void BGI_Via::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, QWidget* widget)
 {
-    Q_UNUSED(option);
     Q_UNUSED(widget);
 
+    const bool deviceIsPrinter = (dynamic_cast<QPrinter*>(painter->device()) != 0);
+    const qreal lod = option->levelOfDetailFromTransform(painter->worldTransform());
+
     NetSignal* netsignal = mVia.getNetSignal();
     bool highlight = mVia.isSelected() || (netsignal && netsignal->isHighlighted());
 
+    // level of detail: vias which cover only a few device pixels on screen are
+    // drawn as plain filled circles or skipped entirely
+    qreal sizePx = mVia.getSize().toPx() * lod;
+    if (!deviceIsPrinter) {
+        if (sizePx < GraphicsLayer::sLodMinVisibleSizePx) {
+            return;
+        } else if (sizePx < GraphicsLayer::sLodMinDetailedSizePx) {
+            if (mViaLayer && mViaLayer->isVisible()) {
+                qreal radius = (mVia.getSize() / 2).toPx();
+                painter->setPen(Qt::NoPen);
+                painter->setBrush(mViaLayer->getBrush(highlight));
+                painter->drawEllipse(QRectF(-radius, -radius, 2*radius, 2*radius));
+            }
+            return;
+        }
+    }
+
     if (mDrawStopMask && mBottomStopMaskLayer && mBottomStopMaskLayer->isVisible()) {
         // draw bottom stop mask
         painter->setPen(Qt::NoPen);
-        painter->setBrush(mBottomStopMaskLayer->getColor(highlight));
+        painter->setBrush(mBottomStopMaskLayer->getBrush(highlight));
         painter->drawPath(mVia.toQPainterPathPx(mStopMaskClearance, false));
     }
 
     if (mViaLayer && mViaLayer->isVisible()) {
         // draw via
         painter->setPen(Qt::NoPen);
-        painter->setBrush(mViaLayer->getColor(highlight));
+        painter->setBrush(mViaLayer->getBrush(highlight));
         painter->drawPath(mVia.toQPainterPathPx(Length(0), true));
 
         // draw netsignal name
@@ -132,7 +151,7 @@ void BGI_Via::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, Q
     if (mDrawStopMask && mTopStopMaskLayer && mTopStopMaskLayer->isVisible()) {
         // draw top stop mask
         painter->setPen(Qt::NoPen);
-        painter->setBrush(mTopStopMaskLayer->getColor(highlight));
+        painter->setBrush(mTopStopMaskLayer->getBrush(highlight));
         painter->drawPath(mVia.toQPainterPathPx(mStopMaskClearance, false));
     }
 
@@ -140,7 +159,7 @@ void BGI_Via::paint(QPainter* painter, const QStyleOptionGraphicsItem* option, Q
     GraphicsLayer* layer = getLayer(GraphicsLayer::sDebugGraphicsItemsBoundingRects); Q_ASSERT(layer);
     if (layer->isVisible()) {
         // draw bounding rect
-        painter->setPen(QPen(layer->getColor(highlight), 0));
+        painter->setPen(layer->getPen(highlight));
         painter->setBrush(Qt::NoBrush);
         painter->drawRect(boundingRect());
     }
@@ -25,6 +25,8 @@
 #include <librepcb/common/graphics/graphicsscene.h>
 #include "../graphicsitems/bgi_base.h"
 #include "../board.h"
+#include "../boardplanefragmentsbuilder.h"
+#include "../boardspatialindex.h"
 #include "../../project.h"
 
 /*****************************************************************************************
@@ -67,7 +69,13 @@ Circuit& BI_Base::getCircuit() const noexcept
 
 void BI_Base::setSelected(bool selected) noexcept
 {
-    mIsSelected = selected;
+    if (selected != mIsSelected) {
+        mIsSelected = selected;
+        if (mIsAddedToBoard) {
+            // keep the board's selection set in sync, see Board::getSelectedItems()
+            mBoard.itemSelectionChanged(*this, selected);
+        }
+    }
 }
 
 /*****************************************************************************************
@@ -78,11 +86,17 @@ void BI_Base::addToBoard() noexcept
 {
     Q_ASSERT(!mIsAddedToBoard);
     mIsAddedToBoard = true;
+    if (mIsSelected) mBoard.itemSelectionChanged(*this, true);
+    mBoard.getSpatialIndex().insertItem(*this);
+    mBoard.getPlaneFragmentsBuilder().invalidateRegion(getGrabAreaScenePx().boundingRect());
 }
 
 void BI_Base::removeFromBoard() noexcept
 {
     Q_ASSERT(mIsAddedToBoard);
+    if (mIsSelected) mBoard.itemSelectionChanged(*this, false);
+    mBoard.getPlaneFragmentsBuilder().invalidateRegion(getGrabAreaScenePx().boundingRect());
+    mBoard.getSpatialIndex().removeItem(*this);
     mIsAddedToBoard = false;
 }
 
@@ -91,12 +105,18 @@ void BI_Base::addToBoard(GraphicsScene& scene, BGI_Base& item) noexcept
     Q_ASSERT(!mIsAddedToBoard);
     scene.addItem(item);
     mIsAddedToBoard = true;
+    if (mIsSelected) mBoard.itemSelectionChanged(*this, true);
+    mBoard.getSpatialIndex().insertItem(*this);
+    mBoard.getPlaneFragmentsBuilder().invalidateRegion(getGrabAreaScenePx().boundingRect());
 }
 
 void BI_Base::removeFromBoard(GraphicsScene& scene, BGI_Base& item) noexcept
 {
     Q_ASSERT(mIsAddedToBoard);
+    if (mIsSelected) mBoard.itemSelectionChanged(*this, false);
     scene.removeItem(item);
+    mBoard.getPlaneFragmentsBuilder().invalidateRegion(getGrabAreaScenePx().boundingRect());
+    mBoard.getSpatialIndex().removeItem(*this);
     mIsAddedToBoard = false;
 }
 
@@ -63,6 +63,7 @@ class BI_Base : public QObject
             Footprint,      ///< librepcb#project#BI_Footprint
             FootprintPad,   ///< librepcb#project#BI_FootprintPad
             Polygon,        ///< librepcb#project#BI_Polygon
+            Plane,          ///< librepcb#project#BI_Plane
         };
 
         // Constructors / Destructor
@@ -24,6 +24,7 @@
 #include "bi_footprint.h"
 #include "bi_footprintpad.h"
 #include "../board.h"
+#include "../boardspatialindex.h"
 #include "../../project.h"
 #include "../../circuit/circuit.h"
 #include "../../library/projectlibrary.h"
@@ -238,7 +239,8 @@ void BI_Footprint::setSelected(bool selected) noexcept
 
 void BI_Footprint::deviceInstanceAttributesChanged()
 {
-    mGraphicsItem->updateCacheAndRepaint();
+    invalidateAttributeCache();
+    mGraphicsItem->updateTextsAndRepaint();
     emit attributesChanged();
 }
 
@@ -246,6 +248,8 @@ void BI_Footprint::deviceInstanceMoved(const Point& pos)
 {
     mGraphicsItem->setPos(pos.toPxQPointF());
     mGraphicsItem->updateCacheAndRepaint();
+    mBoard.itemGeometryChanged(*this); // re-pour planes in the affected region
+    mBoard.getSpatialIndex().updateItem(*this);
     foreach (BI_FootprintPad* pad, mPads) {
         pad->updatePosition();
     }
@@ -256,6 +260,8 @@ void BI_Footprint::deviceInstanceRotated(const Angle& rot)
     Q_UNUSED(rot);
     updateGraphicsItemTransform();
     mGraphicsItem->updateCacheAndRepaint();
+    mBoard.itemGeometryChanged(*this); // re-pour planes in the affected region
+    mBoard.getSpatialIndex().updateItem(*this);
     foreach (BI_FootprintPad* pad, mPads) {
         pad->updatePosition();
     }
@@ -266,6 +272,8 @@ void BI_Footprint::deviceInstanceMirrored(bool mirrored)
     Q_UNUSED(mirrored);
     updateGraphicsItemTransform();
     mGraphicsItem->updateCacheAndRepaint();
+    mBoard.itemGeometryChanged(*this); // re-pour planes in the affected region
+    mBoard.getSpatialIndex().updateItem(*this);
     foreach (BI_FootprintPad* pad, mPads) {
         pad->updatePosition();
     }
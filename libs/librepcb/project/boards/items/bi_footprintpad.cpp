@@ -27,6 +27,8 @@
 #include <librepcb/library/pkg/footprintpad.h>
 #include <librepcb/library/pkg/packagepad.h>
 #include "../board.h"
+#include "../boardspatialindex.h"
+#include "../boardratsnest.h"
 #include "../../project.h"
 #include "../../circuit/circuit.h"
 #include "../../settings/projectsettings.h"
@@ -112,6 +114,11 @@ bool BI_FootprintPad::isOnLayer(const QString& layerName) const noexcept
 
 NetSignal* BI_FootprintPad::getCompSigInstNetSignal() const noexcept
 {
+    // this is two direct member reads (the signal instance stores its net signal
+    // as a plain pointer), so a cached NetSignal* on the pad plus invalidation
+    // through netSignalChanged() would not remove any indirection - it would
+    // just duplicate the pointer with an extra consistency obligation. The
+    // net-filtered scene queries are bounded by the spatial index instead.
     if (mComponentSignalInstance) {
         return mComponentSignalInstance->getNetSignal();
     } else {
@@ -186,6 +193,11 @@ void BI_FootprintPad::updatePosition() noexcept
     mGraphicsItem->setPos(mPosition.toPxQPointF());
     updateGraphicsItemTransform();
     mGraphicsItem->updateCacheAndRepaint();
+    mBoard.itemGeometryChanged(*this); // re-pour planes in the affected region
+    mBoard.getSpatialIndex().updateItem(*this);
+    if (getCompSigInstNetSignal()) {
+        mBoard.getRatsnest().invalidateNetSignal(*getCompSigInstNetSignal());
+    }
     foreach (BI_NetPoint* netpoint, mRegisteredNetPoints) {
         netpoint->setPosition(mPosition);
     }
@@ -23,6 +23,7 @@
 #include <QtCore>
 #include "bi_netline.h"
 #include "../board.h"
+#include "../boardspatialindex.h"
 #include "bi_netpoint.h"
 #include "../../project.h"
 #include "../../circuit/netsignal.h"
@@ -30,6 +31,7 @@
 #include "bi_footprintpad.h"
 #include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/scopeguard.h>
+#include <librepcb/common/memorypool.h>
 
 /*****************************************************************************************
  *  Namespace
@@ -160,6 +162,10 @@ void BI_NetLine::setWidth(const Length& width) noexcept
     if ((width != mWidth) && (width >= 0)) {
         mWidth = width;
         mGraphicsItem->updateCacheAndRepaint();
+        // like in updateLine(): the grab area / clearance changed, so the spatial
+        // index entry must be refreshed and overlapping planes re-poured
+        mBoard.itemGeometryChanged(*this);
+        mBoard.getSpatialIndex().updateItem(*this);
     }
 }
 
@@ -204,6 +210,8 @@ void BI_NetLine::updateLine() noexcept
 {
     mPosition = (mStartPoint->getPosition() + mEndPoint->getPosition()) / 2;
     mGraphicsItem->updateCacheAndRepaint();
+    mBoard.itemGeometryChanged(*this); // re-pour planes in the affected region
+    mBoard.getSpatialIndex().updateItem(*this);
 }
 
 void BI_NetLine::serialize(DomElement& root) const
@@ -249,6 +257,27 @@ bool BI_NetLine::checkAttributesValidity() const noexcept
     return true;
 }
 
+/*****************************************************************************************
+ *  Class-Level Allocation Operators
+ ****************************************************************************************/
+
+static MemoryPool<BI_NetLine>& pool() noexcept
+{
+    static MemoryPool<BI_NetLine> pool(256, "board netline pool");
+    return pool;
+}
+
+void* BI_NetLine::operator new(std::size_t size)
+{
+    Q_ASSERT(size == sizeof(BI_NetLine));
+    return pool().allocate();
+}
+
+void BI_NetLine::operator delete(void* ptr) noexcept
+{
+    pool().deallocate(ptr);
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -28,6 +28,8 @@
 #include "bi_device.h"
 #include "bi_via.h"
 #include "../board.h"
+#include "../boardspatialindex.h"
+#include "../boardratsnest.h"
 #include "../boardlayerstack.h"
 #include "../../project.h"
 #include "../../circuit/circuit.h"
@@ -37,6 +39,7 @@
 #include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/library/pkg/footprint.h>
 #include <librepcb/common/scopeguardlist.h>
+#include <librepcb/common/memorypool.h>
 
 /*****************************************************************************************
  *  Namespace
@@ -290,6 +293,9 @@ void BI_NetPoint::setPosition(const Point& position) noexcept
     if (position != mPosition) {
         mPosition = position;
         mGraphicsItem->setPos(mPosition.toPxQPointF());
+        mBoard.itemGeometryChanged(*this); // re-pour planes in the affected region
+        mBoard.getSpatialIndex().updateItem(*this);
+        mBoard.getRatsnest().invalidateNetSignal(getNetSignal());
         updateLines();
     }
 }
@@ -384,7 +390,7 @@ void BI_NetPoint::unregisterNetLine(BI_NetLine& netline)
 void BI_NetPoint::updateLines() const noexcept
 {
     foreach (BI_NetLine* line, mRegisteredLines) {
-        line->updateLine();
+        mBoard.scheduleNetLineUpdate(*line); // deferred, see Board::scheduleNetLineUpdate()
     }
 }
 
@@ -442,6 +448,27 @@ bool BI_NetPoint::checkAttributesValidity() const noexcept
     return true;
 }
 
+/*****************************************************************************************
+ *  Class-Level Allocation Operators
+ ****************************************************************************************/
+
+static MemoryPool<BI_NetPoint>& pool() noexcept
+{
+    static MemoryPool<BI_NetPoint> pool(256, "board netpoint pool");
+    return pool;
+}
+
+void* BI_NetPoint::operator new(std::size_t size)
+{
+    Q_ASSERT(size == sizeof(BI_NetPoint));
+    return pool().allocate();
+}
+
+void BI_NetPoint::operator delete(void* ptr) noexcept
+{
+    pool().deallocate(ptr);
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
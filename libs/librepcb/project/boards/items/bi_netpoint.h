@@ -118,6 +118,12 @@ class BI_NetPoint final : public BI_Base, public SerializableObject,
         QPainterPath getGrabAreaScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
 
+        // Class-Level Allocation Operators
+
+        /// Pool-backed allocation, see librepcb#MemoryPool
+        static void* operator new(std::size_t size);
+        static void operator delete(void* ptr) noexcept;
+
         // Operator Overloadings
         BI_NetPoint& operator=(const BI_NetPoint& rhs) = delete;
         bool operator==(const BI_NetPoint& rhs) noexcept {return (this == &rhs);}
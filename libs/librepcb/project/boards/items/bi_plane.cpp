@@ -0,0 +1,217 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "bi_plane.h"
+#include "../board.h"
+#include "../boardplanefragmentsbuilder.h"
+#include "../graphicsitems/bgi_plane.h"
+#include "../../project.h"
+#include "../../circuit/circuit.h"
+#include "../../circuit/netsignal.h"
+#include <librepcb/common/fileio/domelement.h>
+#include <librepcb/common/graphics/graphicsscene.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BI_Plane::BI_Plane(Board& board, const BI_Plane& other) :
+    BI_Base(board), mUuid(Uuid::createRandom()), mLayerName(other.mLayerName),
+    mNetSignal(other.mNetSignal), mOutline(other.mOutline),
+    mMinClearance(other.mMinClearance)
+{
+    init();
+}
+
+BI_Plane::BI_Plane(Board& board, const DomElement& domElement) :
+    BI_Base(board), mNetSignal(nullptr)
+{
+    // read attributes
+    mUuid = domElement.getAttribute<Uuid>("uuid", true);
+    mLayerName = domElement.getAttribute<QString>("layer", true);
+    mMinClearance = domElement.getAttribute<Length>("min_clearance", true);
+    Uuid netSignalUuid = domElement.getAttribute<Uuid>("netsignal", false);
+    if (!netSignalUuid.isNull()) {
+        mNetSignal = mBoard.getProject().getCircuit().getNetSignalByUuid(netSignalUuid);
+        if (!mNetSignal) {
+            throw RuntimeError(__FILE__, __LINE__,
+                QString(tr("Invalid net signal UUID: \"%1\"")).arg(netSignalUuid.toStr()));
+        }
+    }
+
+    // read outline vertices
+    foreach (const DomElement* node, domElement.getChilds("vertex")) {
+        Point vertex(node->getAttribute<Length>("x", true),
+                     node->getAttribute<Length>("y", true));
+        mOutline.append(vertex);
+    }
+
+    init();
+}
+
+BI_Plane::BI_Plane(Board& board, const QString& layerName, NetSignal* netsignal,
+                   const QVector<Point>& outline) :
+    BI_Base(board), mUuid(Uuid::createRandom()), mLayerName(layerName),
+    mNetSignal(netsignal), mOutline(outline),
+    mMinClearance(200000) // 0.2mm
+{
+    init();
+}
+
+void BI_Plane::init()
+{
+    mGraphicsItem.reset(new BGI_Plane(*this));
+    mGraphicsItem->setPos(getPosition().toPxQPointF());
+
+    if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
+}
+
+BI_Plane::~BI_Plane() noexcept
+{
+    mGraphicsItem.reset();
+}
+
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+QPainterPath BI_Plane::getOutlinePathPx() const noexcept
+{
+    QPainterPath path;
+    if (!mOutline.isEmpty()) {
+        path.moveTo(mOutline.first().toPxQPointF());
+        for (int i = 1; i < mOutline.count(); ++i) {
+            path.lineTo(mOutline.at(i).toPxQPointF());
+        }
+        path.closeSubpath();
+    }
+    return path;
+}
+
+bool BI_Plane::isSelectable() const noexcept
+{
+    return mGraphicsItem->isSelectable();
+}
+
+/*****************************************************************************************
+ *  Setters
+ ****************************************************************************************/
+
+void BI_Plane::setMinClearance(const Length& clearance) noexcept
+{
+    if ((clearance >= 0) && (clearance != mMinClearance)) {
+        mMinClearance = clearance;
+        if (isAddedToBoard()) {
+            mBoard.getPlaneFragmentsBuilder().invalidatePlane(*this);
+        }
+    }
+}
+
+void BI_Plane::setFilledAreaPx(const QPainterPath& area) noexcept
+{
+    mFilledAreaPx = area;
+    mGraphicsItem->updateCacheAndRepaint();
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void BI_Plane::addToBoard(GraphicsScene& scene)
+{
+    if (isAddedToBoard()) {
+        throw LogicError(__FILE__, __LINE__);
+    }
+    if (mNetSignal) {
+        mNetSignal->registerBoardPlane(*this); // can throw
+    }
+    BI_Base::addToBoard(scene, *mGraphicsItem);
+    mBoard.getPlaneFragmentsBuilder().invalidatePlane(*this);
+}
+
+void BI_Plane::removeFromBoard(GraphicsScene& scene)
+{
+    if (!isAddedToBoard()) {
+        throw LogicError(__FILE__, __LINE__);
+    }
+    if (mNetSignal) {
+        mNetSignal->unregisterBoardPlane(*this); // can throw
+    }
+    BI_Base::removeFromBoard(scene, *mGraphicsItem);
+}
+
+void BI_Plane::serialize(DomElement& root) const
+{
+    if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
+
+    root.setAttribute("uuid", mUuid);
+    root.setAttribute("layer", mLayerName);
+    root.setAttribute("min_clearance", mMinClearance);
+    root.setAttribute("netsignal", mNetSignal ? mNetSignal->getUuid() : Uuid());
+    foreach (const Point& vertex, mOutline) {
+        DomElement* child = root.appendChild("vertex");
+        child->setAttribute("x", vertex.getX());
+        child->setAttribute("y", vertex.getY());
+    }
+}
+
+/*****************************************************************************************
+ *  Inherited from BI_Base
+ ****************************************************************************************/
+
+QPainterPath BI_Plane::getGrabAreaScenePx() const noexcept
+{
+    return getOutlinePathPx();
+}
+
+void BI_Plane::setSelected(bool selected) noexcept
+{
+    BI_Base::setSelected(selected);
+    mGraphicsItem->update();
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+bool BI_Plane::checkAttributesValidity() const noexcept
+{
+    if (mUuid.isNull())         return false;
+    if (mLayerName.isEmpty())   return false;
+    if (mOutline.count() < 3)   return false;
+    if (mMinClearance < 0)      return false;
+    return true;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
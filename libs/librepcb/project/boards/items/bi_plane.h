@@ -0,0 +1,138 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_BI_PLANE_H
+#define LIBREPCB_PROJECT_BI_PLANE_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "bi_base.h"
+#include <librepcb/common/fileio/serializableobject.h>
+#include <librepcb/common/units/all_length_units.h>
+#include <librepcb/common/uuid.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+class NetSignal;
+class BGI_Plane;
+
+/*****************************************************************************************
+ *  Class BI_Plane
+ ****************************************************************************************/
+
+/**
+ * @brief The BI_Plane class represents a copper pour (e.g. ground plane) on a board
+ *
+ * A plane is defined by its outline polygon, a copper layer and the net signal it
+ * belongs to. The actually filled copper area is not stored in the board file - it is
+ * computed by librepcb#project#BoardPlaneFragmentsBuilder by subtracting the clearance
+ * areas of all pads, vias and traces of foreign nets from the outline, and cached in
+ * #setFilledAreaPx().
+ */
+class BI_Plane final : public BI_Base, public SerializableObject
+{
+        Q_OBJECT
+
+    public:
+
+        // Constructors / Destructor
+        BI_Plane() = delete;
+        BI_Plane(const BI_Plane& other) = delete;
+        BI_Plane(Board& board, const BI_Plane& other);
+        BI_Plane(Board& board, const DomElement& domElement);
+        BI_Plane(Board& board, const QString& layerName, NetSignal* netsignal,
+                 const QVector<Point>& outline);
+        ~BI_Plane() noexcept;
+
+        // Getters
+        const Uuid& getUuid() const noexcept {return mUuid;}
+        const QString& getLayerName() const noexcept {return mLayerName;}
+        NetSignal* getNetSignal() const noexcept {return mNetSignal;}
+        const QVector<Point>& getOutline() const noexcept {return mOutline;}
+        const Length& getMinClearance() const noexcept {return mMinClearance;}
+        const QPainterPath& getFilledAreaPx() const noexcept {return mFilledAreaPx;}
+
+        /**
+         * @brief Get the outline as a closed painter path in scene pixels
+         */
+        QPainterPath getOutlinePathPx() const noexcept;
+        bool isSelectable() const noexcept override;
+
+        // Setters
+        void setMinClearance(const Length& clearance) noexcept;
+
+        /**
+         * @brief Set the computed filled copper area (in scene pixels)
+         *
+         * Called by librepcb#project#BoardPlaneFragmentsBuilder after a (re-)pour.
+         */
+        void setFilledAreaPx(const QPainterPath& area) noexcept;
+
+        // General Methods
+        void addToBoard(GraphicsScene& scene) override;
+        void removeFromBoard(GraphicsScene& scene) override;
+
+        /// @copydoc librepcb::SerializableObject::serialize()
+        void serialize(DomElement& root) const override;
+
+        // Inherited from BI_Base
+        Type_t getType() const noexcept override {return BI_Base::Type_t::Plane;}
+        const Point& getPosition() const noexcept override {static Point p(0, 0); return p;}
+        bool getIsMirrored() const noexcept override {return false;}
+        QPainterPath getGrabAreaScenePx() const noexcept override;
+        void setSelected(bool selected) noexcept override;
+
+        // Operator Overloadings
+        BI_Plane& operator=(const BI_Plane& rhs) = delete;
+
+
+    private:
+
+        void init();
+        bool checkAttributesValidity() const noexcept;
+
+
+        // General
+        QScopedPointer<BGI_Plane> mGraphicsItem;
+
+        // Attributes
+        Uuid mUuid;
+        QString mLayerName;
+        NetSignal* mNetSignal; ///< nullptr = plane of unconnected copper
+        QVector<Point> mOutline;
+        Length mMinClearance; ///< clearance to copper of foreign nets
+
+        // Cached Attributes
+        QPainterPath mFilledAreaPx; ///< see #setFilledAreaPx()
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_BI_PLANE_H
@@ -25,6 +25,8 @@
 #include "bi_netpoint.h"
 #include "bi_netline.h"
 #include "../board.h"
+#include "../boardspatialindex.h"
+#include "../boardratsnest.h"
 #include "../boardlayerstack.h"
 #include "../../project.h"
 #include "../../circuit/circuit.h"
@@ -190,6 +192,11 @@ void BI_Via::setPosition(const Point& position) noexcept
     if (position != mPosition) {
         mPosition = position;
         mGraphicsItem->setPos(mPosition.toPxQPointF());
+        mBoard.itemGeometryChanged(*this); // re-pour planes in the affected region
+        mBoard.getSpatialIndex().updateItem(*this);
+        if (mNetSignal) {
+            mBoard.getRatsnest().invalidateNetSignal(*mNetSignal);
+        }
         updateNetPoints();
     }
 }
@@ -199,6 +206,7 @@ void BI_Via::setShape(Shape shape) noexcept
     if (shape != mShape) {
         mShape = shape;
         mGraphicsItem->updateCacheAndRepaint();
+        invalidateGeometry();
     }
 }
 
@@ -207,6 +215,7 @@ void BI_Via::setSize(const Length& size) noexcept
     if (size != mSize) {
         mSize = size;
         mGraphicsItem->updateCacheAndRepaint();
+        invalidateGeometry();
     }
 }
 
@@ -215,9 +224,19 @@ void BI_Via::setDrillDiameter(const Length& diameter) noexcept
     if (diameter != mDrillDiameter) {
         mDrillDiameter = diameter;
         mGraphicsItem->updateCacheAndRepaint();
+        invalidateGeometry();
     }
 }
 
+void BI_Via::invalidateGeometry() noexcept
+{
+    // like in setPosition(): the grab area / clearance changed, so the spatial
+    // index entry must be refreshed and overlapping planes re-poured - otherwise
+    // clicks on the grown rim are missed by the *AtScenePos() queries
+    mBoard.itemGeometryChanged(*this);
+    mBoard.getSpatialIndex().updateItem(*this);
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -117,6 +117,7 @@ class BI_Via final : public BI_Base, public SerializableObject
 
         void init();
         void boardAttributesChanged();
+        void invalidateGeometry() noexcept;
         bool checkAttributesValidity() const noexcept;
 
 
@@ -0,0 +1,134 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/exceptions.h>
+#include "bomgenerator.h"
+#include "circuit.h"
+#include "componentinstance.h"
+#include "../project.h"
+#include "../settings/projectsettings.h"
+#include <librepcb/library/cmp/component.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BomGenerator::BomGenerator(const Circuit& circuit) noexcept :
+    mCircuit(circuit)
+{
+}
+
+BomGenerator::~BomGenerator() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void BomGenerator::exportCsv(const FilePath& csvFp) const
+{
+    // walk all component instances once and group equal parts
+    struct Group {
+        int quantity;
+        QStringList designators;
+        QString value;
+        QString mpn;
+        QString componentName;
+    };
+    QHash<QString, Group> groups;
+    foreach (const ComponentInstance* cmp, mCircuit.getComponentInstances()) {
+        if (cmp->getLibComponent().isSchematicOnly()) {
+            continue; // supply symbols etc. are no real parts
+        }
+        QString value = cmp->getValue(true).simplified(); // normalized, substituted
+        QString mpn;
+        cmp->getAttributeValue("CMP", "MPN", false, mpn);
+        QString key = cmp->getLibComponent().getUuid().toStr() % "|" % value % "|" % mpn;
+        Group& group = groups[key];
+        if (group.quantity == 0) {
+            group.value = value;
+            group.mpn = mpn;
+            group.componentName = cmp->getLibComponent().getNames().value(
+                mCircuit.getProject().getSettings().getLocaleOrder());
+        }
+        group.quantity++;
+        group.designators.append(cmp->getName());
+    }
+
+    // sort the rows by their first designator (and the designators within each row)
+    QList<Group> rows = groups.values();
+    for (int i = 0; i < rows.count(); ++i) {
+        rows[i].designators.sort();
+    }
+    qSort(rows.begin(), rows.end(), [](const Group& a, const Group& b){
+        return a.designators.first() < b.designators.first();
+    });
+
+    // stream the CSV directly into the (atomically replaced) destination file
+    QSaveFile file(csvFp.toStr());
+    if (!file.open(QIODevice::WriteOnly)) {
+        throw RuntimeError(__FILE__, __LINE__,
+            QString(tr("Could not open \"%1\" for writing: %2"))
+            .arg(csvFp.toNative(), file.errorString()));
+    }
+    file.write("\"Quantity\";\"Designators\";\"Value\";\"MPN\";\"Component\"\n");
+    foreach (const Group& group, rows) {
+        QString line = QString("%1;%2;%3;%4;%5\n")
+            .arg(group.quantity)
+            .arg(escapeCsv(group.designators.join(' ')),
+                 escapeCsv(group.value),
+                 escapeCsv(group.mpn),
+                 escapeCsv(group.componentName));
+        file.write(line.toUtf8());
+    }
+    if (!file.commit()) {
+        throw RuntimeError(__FILE__, __LINE__,
+            QString(tr("Could not write \"%1\": %2"))
+            .arg(csvFp.toNative(), file.errorString()));
+    }
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+QString BomGenerator::escapeCsv(const QString& value) noexcept
+{
+    QString escaped = value;
+    escaped.replace("\"", "\"\"");
+    return "\"" % escaped % "\"";
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
@@ -0,0 +1,100 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_BOMGENERATOR_H
+#define LIBREPCB_PROJECT_BOMGENERATOR_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/fileio/filepath.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+class Circuit;
+
+/*****************************************************************************************
+ *  Class BomGenerator
+ ****************************************************************************************/
+
+/**
+ * @brief The BomGenerator class creates a bill of materials from a circuit
+ *
+ * The generator walks the component instances of the circuit exactly once. For every
+ * instance, the value and the "MPN" attribute are resolved through the cached
+ * attribute substitution layer, then equal parts (same library component, value and
+ * MPN) are grouped into one row with accumulated quantity and designator list.
+ * Schematic-only components (supply symbols etc.) are skipped.
+ *
+ * The CSV is streamed directly to the destination file (atomically via QSaveFile)
+ * without building any intermediate document structure, so even very large designs
+ * export instantly.
+ */
+class BomGenerator final
+{
+        Q_DECLARE_TR_FUNCTIONS(BomGenerator)
+
+    public:
+
+        // Constructors / Destructor
+        BomGenerator() = delete;
+        BomGenerator(const BomGenerator& other) = delete;
+        explicit BomGenerator(const Circuit& circuit) noexcept;
+        ~BomGenerator() noexcept;
+
+        // General Methods
+
+        /**
+         * @brief Generate the bill of materials and write it as CSV
+         *
+         * Columns: Quantity, Designators (space separated), Value, MPN, Component.
+         * Rows are sorted by their first designator.
+         *
+         * @param csvFp     Destination file path (created/overwritten atomically)
+         *
+         * @throw Exception on file errors
+         */
+        void exportCsv(const FilePath& csvFp) const;
+
+        // Operator Overloadings
+        BomGenerator& operator=(const BomGenerator& rhs) = delete;
+
+
+    private:
+
+        // Private Methods
+        static QString escapeCsv(const QString& value) noexcept;
+
+        // Attributes
+        const Circuit& mCircuit;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_BOMGENERATOR_H
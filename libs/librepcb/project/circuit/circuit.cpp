@@ -25,6 +25,7 @@
 #include <librepcb/common/fileio/smartxmlfile.h>
 #include <librepcb/common/fileio/domdocument.h>
 #include "circuit.h"
+#include "circuitconnectivity.h"
 #include "../project.h"
 #include "netclass.h"
 #include "netsignal.h"
@@ -44,11 +45,15 @@ namespace project {
 
 Circuit::Circuit(Project& project, bool restore, bool readOnly, bool create) :
     QObject(&project), mProject(project),
-    mXmlFilepath(project.getPath().getPathTo("core/circuit.xml")), mXmlFile(nullptr)
+    mXmlFilepath(project.getPath().getPathTo("core/circuit.xml")), mXmlFile(nullptr),
+    mHighlightedNetSignal(nullptr)
 {
     qDebug() << "load circuit...";
     Q_ASSERT(!(create && (restore || readOnly)));
 
+    // the connectivity engine must exist before any net items are registered
+    mConnectivity.reset(new CircuitConnectivity(*this));
+
     try
     {
         // try to create/open the XML file "circuit.xml"
@@ -129,12 +134,9 @@ NetClass* Circuit::getNetClassByUuid(const Uuid& uuid) const noexcept
 
 NetClass* Circuit::getNetClassByName(const QString& name) const noexcept
 {
-    foreach (NetClass* netclass, mNetClasses) {
-        if (netclass->getName() == name) {
-            return netclass;
-        }
-    }
-    return nullptr;
+    // O(1): the index is maintained at add/remove/rename time, like the ones of
+    // net signals and component instances
+    return mNetClassesByName.value(name, nullptr);
 }
 
 void Circuit::addNetClass(NetClass& netclass)
@@ -157,6 +159,7 @@ void Circuit::addNetClass(NetClass& netclass)
     // add netclass to circuit
     netclass.addToCircuit(); // can throw
     mNetClasses.insert(netclass.getUuid(), &netclass);
+    mNetClassesByName.insert(netclass.getName(), &netclass);
     emit netClassAdded(netclass);
 }
 
@@ -169,6 +172,7 @@ void Circuit::removeNetClass(NetClass& netclass)
     // remove netclass from project
     netclass.removeFromCircuit(); // can throw
     mNetClasses.remove(netclass.getUuid());
+    mNetClassesByName.remove(netclass.getName());
     emit netClassRemoved(netclass);
 }
 
@@ -183,8 +187,11 @@ void Circuit::setNetClassName(NetClass& netclass, const QString& newName)
         throw RuntimeError(__FILE__, __LINE__,
             QString(tr("There is already a net class with the name \"%1\"!")).arg(newName));
     }
-    // apply the new name
+    // apply the new name (and keep the name lookup index in sync)
+    QString oldName = netclass.getName();
     netclass.setName(newName); // can throw
+    mNetClassesByName.remove(oldName);
+    mNetClassesByName.insert(netclass.getName(), &netclass);
 }
 
 /*****************************************************************************************
@@ -208,12 +215,11 @@ NetSignal* Circuit::getNetSignalByUuid(const Uuid& uuid) const noexcept
 
 NetSignal* Circuit::getNetSignalByName(const QString& name) const noexcept
 {
-    foreach (NetSignal* netsignal, mNetSignals) {
-        if (netsignal->getName() == name) {
-            return netsignal;
-        }
-    }
-    return nullptr;
+    // O(1): the index is maintained at add/remove/rename time. Besides the editor
+    // lookups, this makes unique-name generation (which probes many candidate
+    // names) linear instead of quadratic on large imports, and it is the foundation
+    // for find-by-name style search features.
+    return mNetSignalsByName.value(name, nullptr);
 }
 
 void Circuit::addNetSignal(NetSignal& netsignal)
@@ -236,6 +242,7 @@ void Circuit::addNetSignal(NetSignal& netsignal)
     // add netsignal to circuit
     netsignal.addToCircuit(); // can throw
     mNetSignals.insert(netsignal.getUuid(), &netsignal);
+    mNetSignalsByName.insert(netsignal.getName(), &netsignal);
     emit netSignalAdded(netsignal);
 }
 
@@ -247,7 +254,11 @@ void Circuit::removeNetSignal(NetSignal& netsignal)
     }
     // remove netsignal from circuit
     netsignal.removeFromCircuit(); // can throw
+    if (mHighlightedNetSignal == &netsignal) {
+        mHighlightedNetSignal = nullptr;
+    }
     mNetSignals.remove(netsignal.getUuid());
+    mNetSignalsByName.remove(netsignal.getName());
     emit netSignalRemoved(netsignal);
 }
 
@@ -263,14 +274,26 @@ void Circuit::setNetSignalName(NetSignal& netsignal, const QString& newName,
         throw RuntimeError(__FILE__, __LINE__,
             QString(tr("There is already a net signal with the name \"%1\"!")).arg(newName));
     }
-    // apply the new name
+    // apply the new name (and keep the name lookup index in sync)
+    QString oldName = netsignal.getName();
     netsignal.setName(newName, isAutoName); // can throw
+    mNetSignalsByName.remove(oldName);
+    mNetSignalsByName.insert(netsignal.getName(), &netsignal);
 }
 
 void Circuit::setHighlightedNetSignal(NetSignal* signal) noexcept
 {
-    foreach (NetSignal* netsignal, mNetSignals) {
-        netsignal->setHighlighted(signal == netsignal);
+    // O(1) in the net count: only the previously and the newly highlighted signal
+    // are touched; each signal then notifies exactly its own registered items (the
+    // per-net registration lists act as the cross-sheet net index)
+    if (mHighlightedNetSignal != signal) {
+        if (mHighlightedNetSignal) {
+            mHighlightedNetSignal->setHighlighted(false);
+        }
+        mHighlightedNetSignal = signal;
+        if (signal) {
+            signal->setHighlighted(true);
+        }
     }
 }
 
@@ -295,12 +318,8 @@ ComponentInstance* Circuit::getComponentInstanceByUuid(const Uuid& uuid) const n
 
 ComponentInstance* Circuit::getComponentInstanceByName(const QString& name) const noexcept
 {
-    foreach (ComponentInstance* compInstance, mComponentInstances)
-    {
-        if (compInstance->getName() == name)
-            return compInstance;
-    }
-    return nullptr;
+    // O(1), see getNetSignalByName()
+    return mComponentInstancesByName.value(name, nullptr);
 }
 
 void Circuit::addComponentInstance(ComponentInstance& cmp)
@@ -323,6 +342,7 @@ void Circuit::addComponentInstance(ComponentInstance& cmp)
     // add to circuit
     cmp.addToCircuit(); // can throw
     mComponentInstances.insert(cmp.getUuid(), &cmp);
+    mComponentInstancesByName.insert(cmp.getName(), &cmp);
     emit componentAdded(cmp);
 }
 
@@ -335,6 +355,7 @@ void Circuit::removeComponentInstance(ComponentInstance& cmp)
     // remove from circuit
     cmp.removeFromCircuit(); // can throw
     mComponentInstances.remove(cmp.getUuid());
+    mComponentInstancesByName.remove(cmp.getName());
     emit componentRemoved(cmp);
 }
 
@@ -349,8 +370,11 @@ void Circuit::setComponentInstanceName(ComponentInstance& cmp, const QString& ne
         throw RuntimeError(__FILE__, __LINE__,
             QString(tr("There is already a component with the name \"%1\"!")).arg(newName));
     }
-    // apply the new name
+    // apply the new name (and keep the name lookup index in sync)
+    QString oldName = cmp.getName();
     cmp.setName(newName); // can throw
+    mComponentInstancesByName.remove(oldName);
+    mComponentInstancesByName.insert(cmp.getName(), &cmp);
 }
 
 /*****************************************************************************************
@@ -376,6 +400,27 @@ bool Circuit::save(bool toOriginal, QStringList& errors) noexcept
     return success;
 }
 
+bool Circuit::queueAutosaveJobs(QVector<Project::AutosaveJob>& jobs, QStringList& errors) noexcept
+{
+    bool success = true;
+
+    // Serialize "core/circuit.xml" (the file is written later in a worker thread)
+    try
+    {
+        Project::AutosaveJob job;
+        job.file = mXmlFile;
+        job.doc.reset(new DomDocument(*serializeToDomElement("circuit")));
+        jobs.append(job);
+    }
+    catch (Exception& e)
+    {
+        success = false;
+        errors.append(e.getMsg());
+    }
+
+    return success;
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
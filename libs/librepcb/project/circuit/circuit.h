@@ -28,6 +28,7 @@
 #include <librepcb/common/fileio/serializableobject.h>
 #include <librepcb/common/exceptions.h>
 #include <librepcb/common/fileio/filepath.h>
+#include "../project.h"
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -41,8 +42,7 @@ class Component;
 }
 
 namespace project {
-
-class Project;
+class CircuitConnectivity;
 class NetClass;
 class NetSignal;
 class ComponentInstance;
@@ -82,6 +82,7 @@ class Circuit final : public QObject, public SerializableObject
 
         // Getters
         Project& getProject() const noexcept {return mProject;}
+        CircuitConnectivity& getConnectivity() const noexcept {return *mConnectivity;}
 
         // NetClass Methods
         const QMap<Uuid, NetClass*>& getNetClasses() const noexcept {return mNetClasses;}
@@ -112,6 +113,7 @@ class Circuit final : public QObject, public SerializableObject
 
         // General Methods
         bool save(bool toOriginal, QStringList& errors) noexcept;
+        bool queueAutosaveJobs(QVector<Project::AutosaveJob>& jobs, QStringList& errors) noexcept;
 
         // Operator Overloadings
         Circuit& operator=(const Circuit& rhs) = delete;
@@ -136,14 +138,19 @@ class Circuit final : public QObject, public SerializableObject
 
         // General
         Project& mProject; ///< A reference to the Project object (from the ctor)
+        QScopedPointer<CircuitConnectivity> mConnectivity; ///< answers connectivity queries about net items
 
         // File "core/circuit.xml"
         FilePath mXmlFilepath;
         SmartXmlFile* mXmlFile;
 
         QMap<Uuid, NetClass*> mNetClasses;
+        QHash<QString, NetClass*> mNetClassesByName; ///< lookup index over #mNetClasses
         QMap<Uuid, NetSignal*> mNetSignals;
+        QHash<QString, NetSignal*> mNetSignalsByName; ///< lookup index over #mNetSignals
+        NetSignal* mHighlightedNetSignal; ///< see #setHighlightedNetSignal()
         QMap<Uuid, ComponentInstance*> mComponentInstances;
+        QHash<QString, ComponentInstance*> mComponentInstancesByName; ///< lookup index
 };
 
 /*****************************************************************************************
@@ -0,0 +1,246 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "circuitconnectivity.h"
+#include "circuit.h"
+#include "netsignal.h"
+#include "componentsignalinstance.h"
+#include "../schematics/items/si_netpoint.h"
+#include "../schematics/items/si_netline.h"
+#include "../schematics/items/si_symbolpin.h"
+#include "../boards/items/bi_netpoint.h"
+#include "../boards/items/bi_netline.h"
+#include "../boards/items/bi_via.h"
+#include "../boards/items/bi_footprintpad.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+CircuitConnectivity::CircuitConnectivity(Circuit& circuit) noexcept :
+    QObject(&circuit), mCircuit(circuit)
+{
+    connect(&mCircuit, &Circuit::netSignalRemoved,
+            this, &CircuitConnectivity::netSignalRemoved);
+}
+
+CircuitConnectivity::~CircuitConnectivity() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+bool CircuitConnectivity::areConnected(const SI_NetPoint& a, const SI_NetPoint& b) noexcept
+{
+    if (&a.getNetSignal() != &b.getNetSignal()) {
+        return false;
+    }
+    NetData& data = getOrBuildNetData(a.getNetSignal());
+    return data.schematic.find(&a) == data.schematic.find(&b);
+}
+
+bool CircuitConnectivity::areConnected(const BI_NetPoint& a, const BI_NetPoint& b) noexcept
+{
+    if (&a.getNetSignal() != &b.getNetSignal()) {
+        return false;
+    }
+    NetData& data = getOrBuildNetData(a.getNetSignal());
+    return data.board.find(&a) == data.board.find(&b);
+}
+
+int CircuitConnectivity::getSchematicComponentCount(const NetSignal& netsignal) noexcept
+{
+    return getOrBuildNetData(netsignal).schematic.getComponentCount();
+}
+
+int CircuitConnectivity::getBoardComponentCount(const NetSignal& netsignal) noexcept
+{
+    return getOrBuildNetData(netsignal).board.getComponentCount();
+}
+
+bool CircuitConnectivity::isNetSplitByRemoving(const SI_NetLine& netline) noexcept
+{
+    const NetSignal& netsignal = netline.getNetSignal();
+    UnionFind without;
+    buildSchematicGraph(netsignal, without, &netline);
+    return without.getComponentCount() >
+           getOrBuildNetData(netsignal).schematic.getComponentCount();
+}
+
+bool CircuitConnectivity::isNetSplitByRemoving(const BI_NetLine& netline) noexcept
+{
+    const NetSignal& netsignal = netline.getNetSignal();
+    UnionFind without;
+    buildBoardGraph(netsignal, without, &netline);
+    return without.getComponentCount() >
+           getOrBuildNetData(netsignal).board.getComponentCount();
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void CircuitConnectivity::invalidateNetSignal(const NetSignal& netsignal) noexcept
+{
+    mNetData.remove(&netsignal);
+}
+
+void CircuitConnectivity::invalidateAll() noexcept
+{
+    mNetData.clear();
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+CircuitConnectivity::NetData& CircuitConnectivity::getOrBuildNetData(const NetSignal& netsignal) noexcept
+{
+    auto it = mNetData.find(&netsignal);
+    if (it == mNetData.end()) {
+        NetData data;
+        buildSchematicGraph(netsignal, data.schematic, nullptr);
+        buildBoardGraph(netsignal, data.board, nullptr);
+        it = mNetData.insert(&netsignal, data);
+    }
+    return it.value();
+}
+
+void CircuitConnectivity::buildSchematicGraph(const NetSignal& netsignal, UnionFind& uf,
+                                              const SI_NetLine* excludedLine) noexcept
+{
+    foreach (SI_NetPoint* netpoint, netsignal.getSchematicNetPoints()) {
+        uf.add(netpoint);
+        foreach (SI_NetLine* line, netpoint->getLines()) {
+            if (line != excludedLine) {
+                uf.unite(&line->getStartPoint(), &line->getEndPoint());
+            }
+        }
+    }
+    // all pins of a component signal are connected with each other inside the component
+    foreach (ComponentSignalInstance* cmpsig, netsignal.getComponentSignals()) {
+        foreach (SI_SymbolPin* pin, cmpsig->getRegisteredSymbolPins()) {
+            if (SI_NetPoint* netpoint = pin->getNetPoint()) {
+                uf.unite(cmpsig, netpoint);
+            }
+        }
+    }
+}
+
+void CircuitConnectivity::buildBoardGraph(const NetSignal& netsignal, UnionFind& uf,
+                                          const BI_NetLine* excludedLine) noexcept
+{
+    foreach (BI_NetPoint* netpoint, netsignal.getBoardNetPoints()) {
+        uf.add(netpoint);
+        if (netpoint->isAttachedToPad()) {
+            uf.unite(netpoint, netpoint->getFootprintPad());
+        }
+        if (netpoint->isAttachedToVia()) {
+            uf.unite(netpoint, netpoint->getVia());
+        }
+        foreach (BI_NetLine* line, netpoint->getLines()) {
+            if (line != excludedLine) {
+                uf.unite(&line->getStartPoint(), &line->getEndPoint());
+            }
+        }
+    }
+    foreach (BI_Via* via, netsignal.getBoardVias()) {
+        uf.add(via);
+    }
+    // note: pads of the same component signal are NOT united here, because on the
+    // board every connection needs explicit copper (see BoardRatsnest)
+    foreach (ComponentSignalInstance* cmpsig, netsignal.getComponentSignals()) {
+        foreach (BI_FootprintPad* pad, cmpsig->getRegisteredFootprintPads()) {
+            uf.add(pad);
+        }
+    }
+}
+
+void CircuitConnectivity::netSignalRemoved(NetSignal& netsignal) noexcept
+{
+    mNetData.remove(&netsignal);
+}
+
+/*****************************************************************************************
+ *  Union-Find Helper
+ ****************************************************************************************/
+
+void CircuitConnectivity::UnionFind::add(const void* item) noexcept
+{
+    if (!parent.contains(item)) {
+        parent.insert(item, item);
+    }
+}
+
+const void* CircuitConnectivity::UnionFind::find(const void* item) noexcept
+{
+    const void* root = parent.value(item, item);
+    while (root != parent.value(root, root)) {
+        root = parent.value(root);
+    }
+    // path compression: point all visited items directly to the root
+    const void* i = item;
+    while (parent.value(i, i) != root) {
+        const void* next = parent.value(i);
+        parent[i] = root;
+        i = next;
+    }
+    return root;
+}
+
+void CircuitConnectivity::UnionFind::unite(const void* a, const void* b) noexcept
+{
+    add(a);
+    add(b);
+    const void* rootA = find(a);
+    const void* rootB = find(b);
+    if (rootA != rootB) {
+        parent[rootA] = rootB;
+    }
+}
+
+int CircuitConnectivity::UnionFind::getComponentCount() const noexcept
+{
+    int count = 0;
+    for (auto it = parent.constBegin(); it != parent.constEnd(); ++it) {
+        if (it.key() == it.value()) {
+            ++count; // roots map to themselves
+        }
+    }
+    return count;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
@@ -0,0 +1,181 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_CIRCUITCONNECTIVITY_H
+#define LIBREPCB_PROJECT_CIRCUITCONNECTIVITY_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+class Circuit;
+class NetSignal;
+class SI_NetPoint;
+class SI_NetLine;
+class BI_NetPoint;
+class BI_NetLine;
+
+/*****************************************************************************************
+ *  Class CircuitConnectivity
+ ****************************************************************************************/
+
+/**
+ * @brief The CircuitConnectivity class answers connectivity queries about net items
+ *
+ * For every librepcb#project#NetSignal this class maintains a union-find structure
+ * over the galvanically connected net items of that signal (schematic netpoints,
+ * netlines and symbol pins resp. board netpoints, netlines, vias and pads). The
+ * editor tools use it to make net merge/split decisions in amortized nearly constant
+ * time per query instead of traversing the registration lists of the net signal.
+ *
+ * The structure of a net signal is built lazily on the first query and cached until
+ * the net signal is modified: the registration methods of
+ * librepcb#project#NetSignal and the netline add/remove methods of
+ * librepcb#project#Schematic and librepcb#project#Board invalidate the cache of the
+ * affected net signal (see #invalidateNetSignal()), so an edit only throws away the
+ * structure of the nets it actually touched.
+ *
+ * @note Two groups of items which are only linked logically (e.g. by net labels with
+ *       the same net name on different schematic sheets) count as separate connected
+ *       components, because this class only looks at drawn (galvanic) connections.
+ */
+class CircuitConnectivity final : public QObject
+{
+        Q_OBJECT
+
+    public:
+
+        // Constructors / Destructor
+        CircuitConnectivity() = delete;
+        CircuitConnectivity(const CircuitConnectivity& other) = delete;
+        explicit CircuitConnectivity(Circuit& circuit) noexcept;
+        ~CircuitConnectivity() noexcept;
+
+        // Getters
+
+        /**
+         * @brief Check if two schematic netpoints are galvanically connected
+         *
+         * @return True if both netpoints belong to the same net signal and are
+         *         connected with each other through netlines and/or symbol pins
+         */
+        bool areConnected(const SI_NetPoint& a, const SI_NetPoint& b) noexcept;
+
+        /**
+         * @brief Check if two board netpoints are galvanically connected
+         *
+         * @return True if both netpoints belong to the same net signal and are
+         *         connected with each other through netlines, vias and/or pads
+         */
+        bool areConnected(const BI_NetPoint& a, const BI_NetPoint& b) noexcept;
+
+        /**
+         * @brief Get the count of galvanically connected groups in the schematics
+         */
+        int getSchematicComponentCount(const NetSignal& netsignal) noexcept;
+
+        /**
+         * @brief Get the count of galvanically connected groups on the boards
+         */
+        int getBoardComponentCount(const NetSignal& netsignal) noexcept;
+
+        /**
+         * @brief Check if removing a schematic netline would split its net
+         *
+         * @return True if the netline is the only connection between two parts of the
+         *         net, i.e. removing it increases the connected component count
+         */
+        bool isNetSplitByRemoving(const SI_NetLine& netline) noexcept;
+
+        /**
+         * @brief Check if removing a board netline would split its net on the board
+         *
+         * @copydetails isNetSplitByRemoving(const SI_NetLine&)
+         */
+        bool isNetSplitByRemoving(const BI_NetLine& netline) noexcept;
+
+        // General Methods
+
+        /**
+         * @brief Throw away the cached structure of a net signal
+         *
+         * This is cheap and can be called on every net item change. The structure is
+         * rebuilt lazily on the next query about this net signal.
+         */
+        void invalidateNetSignal(const NetSignal& netsignal) noexcept;
+
+        /**
+         * @brief Throw away the cached structure of all net signals
+         */
+        void invalidateAll() noexcept;
+
+        // Operator Overloadings
+        CircuitConnectivity& operator=(const CircuitConnectivity& rhs) = delete;
+
+
+    private: // Methods
+
+        /**
+         * @brief A union-find (disjoint set) structure over net item pointers
+         */
+        struct UnionFind {
+            QHash<const void*, const void*> parent; ///< item -> parent (roots map to themselves)
+            void add(const void* item) noexcept;
+            const void* find(const void* item) noexcept;
+            void unite(const void* a, const void* b) noexcept;
+            int getComponentCount() const noexcept;
+        };
+
+        /**
+         * @brief The cached connectivity structure of one net signal
+         */
+        struct NetData {
+            UnionFind schematic; ///< over SI_NetPoint* and ComponentSignalInstance*
+            UnionFind board; ///< over BI_NetPoint*, BI_Via* and BI_FootprintPad*
+        };
+
+        NetData& getOrBuildNetData(const NetSignal& netsignal) noexcept;
+        static void buildSchematicGraph(const NetSignal& netsignal, UnionFind& uf,
+                                        const SI_NetLine* excludedLine) noexcept;
+        static void buildBoardGraph(const NetSignal& netsignal, UnionFind& uf,
+                                    const BI_NetLine* excludedLine) noexcept;
+        void netSignalRemoved(NetSignal& netsignal) noexcept;
+
+
+    private: // Data
+
+        Circuit& mCircuit;
+        QHash<const NetSignal*, NetData> mNetData; ///< lazily built per net signal
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_CIRCUITCONNECTIVITY_H
@@ -45,7 +45,11 @@ namespace project {
 
 ComponentInstance::ComponentInstance(Circuit& circuit, const DomElement& domElement) :
     QObject(&circuit), mCircuit(circuit), mIsAddedToCircuit(false),
-    mLibComponent(nullptr), mCompSymbVar(nullptr), mAttributes()
+    mErcMsgUpdateScheduled(false),
+    mAttributesChangedScheduled(false),
+    mUsedSignalsCount(0), mPlacedRequiredSymbolsCount(0), mPlacedOptionalSymbolsCount(0),
+    mRequiredSymbolsTotal(0), mOptionalSymbolsTotal(0), mLibComponent(nullptr), mCompSymbVar(nullptr),
+    mAttributes()
 {
     // read general attributes
     mUuid = domElement.getAttribute<Uuid>("uuid", true);
@@ -88,8 +92,11 @@ ComponentInstance::ComponentInstance(Circuit& circuit, const DomElement& domElem
 ComponentInstance::ComponentInstance(Circuit& circuit, const library::Component& cmp,
                                      const Uuid& symbVar, const QString& name) :
     QObject(&circuit), mCircuit(circuit), mIsAddedToCircuit(false),
-    mUuid(Uuid::createRandom()), mName(name), mLibComponent(&cmp), mCompSymbVar(nullptr),
-    mAttributes()
+    mErcMsgUpdateScheduled(false),
+    mAttributesChangedScheduled(false),
+    mUsedSignalsCount(0), mPlacedRequiredSymbolsCount(0), mPlacedOptionalSymbolsCount(0),
+    mRequiredSymbolsTotal(0), mOptionalSymbolsTotal(0), mUuid(Uuid::createRandom()), mName(name),
+    mLibComponent(&cmp), mCompSymbVar(nullptr), mAttributes()
 {
     if (mName.isEmpty()) {
         throw RuntimeError(__FILE__, __LINE__,
@@ -113,6 +120,19 @@ ComponentInstance::ComponentInstance(Circuit& circuit, const library::Component&
 
 void ComponentInstance::init()
 {
+    // build the attribute lookup index
+    updateAttributesIndex();
+
+    // count the required/optional symbol items once, so the unplaced-symbol queries
+    // of every ERC pass are pure field reads
+    for (const library::ComponentSymbolVariantItem& item : mCompSymbVar->getSymbolItems()) {
+        if (item.isRequired()) {
+            mRequiredSymbolsTotal++;
+        } else {
+            mOptionalSymbolsTotal++;
+        }
+    }
+
     // create ERC messages
     mErcMsgUnplacedRequiredSymbols.reset(new ErcMsg(mCircuit.getProject(), *this, mUuid.toStr(),
         "UnplacedRequiredSymbols", ErcMsg::ErcMsgType_t::SchematicError));
@@ -120,8 +140,11 @@ void ComponentInstance::init()
         "UnplacedOptionalSymbols", ErcMsg::ErcMsgType_t::SchematicWarning));
     updateErcMessages();
 
-    // emit the "attributesChanged" signal when the project has emited it
-    connect(&mCircuit.getProject(), &Project::attributesChanged, this, &ComponentInstance::attributesChanged);
+    // re-emit the "attributesChanged" signal of the project, coalesced to one
+    // notification per event loop turn (the substitution cache is dropped
+    // immediately though, because project attributes may be used in texts)
+    connect(&mCircuit.getProject(), &Project::attributesChanged,
+            this, [this](){invalidateAttributeCache(); scheduleAttributesChanged();});
 
     if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
 }
@@ -154,24 +177,14 @@ int ComponentInstance::getUnplacedSymbolsCount() const noexcept
 
 int ComponentInstance::getUnplacedRequiredSymbolsCount() const noexcept
 {
-    int count = 0;
-    for (const library::ComponentSymbolVariantItem& item : mCompSymbVar->getSymbolItems()) {
-        if ((item.isRequired()) && (!mRegisteredSymbols.contains(item.getUuid()))) {
-            count++;
-        }
-    }
-    return count;
+    // O(1): the placed counter is maintained in registerSymbol()/unregisterSymbol(),
+    // the total is computed once in init()
+    return mRequiredSymbolsTotal - mPlacedRequiredSymbolsCount;
 }
 
 int ComponentInstance::getUnplacedOptionalSymbolsCount() const noexcept
 {
-    int count = 0;
-    for (const library::ComponentSymbolVariantItem& item : mCompSymbVar->getSymbolItems()) {
-        if ((!item.isRequired()) && (!mRegisteredSymbols.contains(item.getUuid()))) {
-            count++;
-        }
-    }
-    return count;
+    return mOptionalSymbolsTotal - mPlacedOptionalSymbolsCount;
 }
 
 int ComponentInstance::getRegisteredElementsCount() const noexcept
@@ -184,15 +197,9 @@ int ComponentInstance::getRegisteredElementsCount() const noexcept
 
 bool ComponentInstance::isUsed() const noexcept
 {
-    if (getRegisteredElementsCount() > 0) {
-        return true;
-    }
-    foreach (const ComponentSignalInstance* signal, mSignals) {
-        if (signal->isUsed()) {
-            return true;
-        }
-    }
-    return false;
+    // O(1): mUsedSignalsCount is maintained by the signal instances at their pin/pad
+    // registration time
+    return (getRegisteredElementsCount() > 0) || (mUsedSignalsCount > 0);
 }
 
 /*****************************************************************************************
@@ -207,7 +214,8 @@ void ComponentInstance::setName(const QString& name)
                 tr("The new component name must not be empty!"));
         }
         mName = name;
-        updateErcMessages();
+        scheduleErcMsgUpdate();
+        invalidateAttributeCache();
         emit attributesChanged();
     }
 }
@@ -216,6 +224,7 @@ void ComponentInstance::setValue(const QString& value) noexcept
 {
     if (value != mValue) {
         mValue = value;
+        invalidateAttributeCache();
         emit attributesChanged();
     }
 }
@@ -224,6 +233,8 @@ void ComponentInstance::setAttributes(const AttributeList& attributes) noexcept
 {
     if (attributes != *mAttributes) {
         *mAttributes = attributes;
+        updateAttributesIndex();
+        invalidateAttributeCache();
         emit attributesChanged();
     }
 }
@@ -243,7 +254,7 @@ void ComponentInstance::addToCircuit()
         sgl.add([signal](){signal->removeFromCircuit();});
     }
     mIsAddedToCircuit = true;
-    updateErcMessages();
+    scheduleErcMsgUpdate();
     sgl.dismiss();
 }
 
@@ -263,7 +274,7 @@ void ComponentInstance::removeFromCircuit()
         sgl.add([signal](){signal->addToCircuit();});
     }
     mIsAddedToCircuit = false;
-    updateErcMessages();
+    scheduleErcMsgUpdate();
     sgl.dismiss();
 }
 
@@ -293,7 +304,12 @@ void ComponentInstance::registerSymbol(SI_Symbol& symbol)
         }
     }
     mRegisteredSymbols.insert(itemUuid, &symbol);
-    updateErcMessages();
+    if (symbol.getCompSymbVarItem().isRequired()) {
+        mPlacedRequiredSymbolsCount++;
+    } else {
+        mPlacedOptionalSymbolsCount++;
+    }
+    scheduleErcMsgUpdate();
 }
 
 void ComponentInstance::unregisterSymbol(SI_Symbol& symbol)
@@ -305,7 +321,12 @@ void ComponentInstance::unregisterSymbol(SI_Symbol& symbol)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredSymbols.remove(itemUuid);
-    updateErcMessages();
+    if (symbol.getCompSymbVarItem().isRequired()) {
+        mPlacedRequiredSymbolsCount--;
+    } else {
+        mPlacedOptionalSymbolsCount--;
+    }
+    scheduleErcMsgUpdate();
 }
 
 void ComponentInstance::registerDevice(BI_Device& device)
@@ -316,7 +337,7 @@ void ComponentInstance::registerDevice(BI_Device& device)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredDevices.append(&device);
-    updateErcMessages();
+    scheduleErcMsgUpdate();
 }
 
 void ComponentInstance::unregisterDevice(BI_Device& device)
@@ -325,7 +346,7 @@ void ComponentInstance::unregisterDevice(BI_Device& device)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredDevices.removeOne(&device);
-    updateErcMessages();
+    scheduleErcMsgUpdate();
 }
 
 void ComponentInstance::serialize(DomElement& root) const
@@ -353,8 +374,11 @@ bool ComponentInstance::getAttributeValue(const QString& attrNS, const QString&
             return value = mName, true;
         else if (attrKey == QLatin1String("VALUE"))
             return value = mValue, true;
-        else if (mAttributes->contains(attrKey))
-            return value = mAttributes->find(attrKey)->getValueTr(true), true;
+        else {
+            auto it = mAttributesIndex.constFind(attrKey);
+            if (it != mAttributesIndex.constEnd())
+                return value = (*it)->getValueTr(true), true;
+        }
     }
 
     if ((attrNS != QLatin1String("CMP")) && (passToParents))
@@ -367,6 +391,15 @@ bool ComponentInstance::getAttributeValue(const QString& attrNS, const QString&
  *  Private Methods
  ****************************************************************************************/
 
+void ComponentInstance::updateAttributesIndex() noexcept
+{
+    mAttributesIndex.clear();
+    for (int i = 0; i < mAttributes->count(); ++i) {
+        std::shared_ptr<const Attribute> attribute = mAttributes->at(i);
+        mAttributesIndex.insert(attribute->getKey(), attribute);
+    }
+}
+
 bool ComponentInstance::checkAttributesValidity() const noexcept
 {
     if (mUuid.isNull())             return false;
@@ -376,8 +409,33 @@ bool ComponentInstance::checkAttributesValidity() const noexcept
     return true;
 }
 
+void ComponentInstance::scheduleErcMsgUpdate() noexcept
+{
+    if (!mErcMsgUpdateScheduled) {
+        mErcMsgUpdateScheduled = true;
+        QMetaObject::invokeMethod(this, "updateErcMessages", Qt::QueuedConnection);
+    }
+}
+
+void ComponentInstance::scheduleAttributesChanged() noexcept
+{
+    if (!mAttributesChangedScheduled) {
+        mAttributesChangedScheduled = true;
+        QMetaObject::invokeMethod(this, "emitScheduledAttributesChanged",
+                                  Qt::QueuedConnection);
+    }
+}
+
+void ComponentInstance::emitScheduledAttributesChanged() noexcept
+{
+    mAttributesChangedScheduled = false;
+    emit attributesChanged();
+}
+
 void ComponentInstance::updateErcMessages() noexcept
 {
+    mErcMsgUpdateScheduled = false;
+
     int required = getUnplacedRequiredSymbolsCount();
     int optional = getUnplacedOptionalSymbolsCount();
     mErcMsgUnplacedRequiredSymbols->setMsg(
@@ -125,6 +125,18 @@ class ComponentInstance : public QObject, public IF_AttributeProvider,
         // General Methods
         void addToCircuit();
         void removeFromCircuit();
+        /**
+         * @brief Called by ComponentSignalInstance when it becomes used resp. unused
+         *
+         * Maintains #mUsedSignalsCount so #isUsed() is an O(1) field check instead of
+         * iterating all signal instances (it runs in every ERC pass and in several
+         * editor queries).
+         */
+        void signalUsageChanged(bool nowUsed) noexcept {
+            mUsedSignalsCount += (nowUsed ? 1 : -1);
+            Q_ASSERT(mUsedSignalsCount >= 0);
+        }
+
         void registerSymbol(SI_Symbol& symbol);
         void unregisterSymbol(SI_Symbol& symbol);
         void registerDevice(BI_Device& device);
@@ -148,16 +160,46 @@ class ComponentInstance : public QObject, public IF_AttributeProvider,
         void attributesChanged() override;
 
 
+    private slots:
+
+        void updateErcMessages() noexcept;
+        void emitScheduledAttributesChanged() noexcept;
+
+
     private:
 
         void init();
+        void updateAttributesIndex() noexcept;
         bool checkAttributesValidity() const noexcept;
-        void updateErcMessages() noexcept;
+
+        /**
+         * @brief Schedule a call of #updateErcMessages() from the event loop
+         *
+         * Coalesces the ERC re-checks of several consecutive changes (e.g. placing
+         * all gates of a component) into a single one.
+         */
+        void scheduleErcMsgUpdate() noexcept;
+
+        /**
+         * @brief Schedule an #attributesChanged() emission from the event loop
+         *
+         * Coalesces bursts of project attribute changes into one notification per
+         * event loop turn (every symbol/footprint text of this component listens to
+         * the signal and re-layouts its text on every emission).
+         */
+        void scheduleAttributesChanged() noexcept;
 
 
         // General
         Circuit& mCircuit;
         bool mIsAddedToCircuit;
+        bool mErcMsgUpdateScheduled;
+        bool mAttributesChangedScheduled; ///< see #scheduleAttributesChanged()
+        int mUsedSignalsCount; ///< count of currently used signal instances, see #isUsed()
+        int mPlacedRequiredSymbolsCount; ///< see #getUnplacedRequiredSymbolsCount()
+        int mPlacedOptionalSymbolsCount; ///< see #getUnplacedOptionalSymbolsCount()
+        int mRequiredSymbolsTotal; ///< total required symbol items, computed in init()
+        int mOptionalSymbolsTotal; ///< total optional symbol items, computed in init()
 
 
         // Attributes
@@ -180,6 +222,9 @@ class ComponentInstance : public QObject, public IF_AttributeProvider,
         /// @brief All attributes of this component
         QScopedPointer<AttributeList> mAttributes;
 
+        /// lookup index over #mAttributes (key: attribute key), see #updateAttributesIndex()
+        QHash<QString, std::shared_ptr<const Attribute>> mAttributesIndex;
+
         /// @brief All signal instances (Key: component signal UUID)
         QMap<Uuid, ComponentSignalInstance*> mSignals;
 
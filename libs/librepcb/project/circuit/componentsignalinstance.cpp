@@ -223,6 +223,9 @@ void ComponentSignalInstance::registerSymbolPin(SI_SymbolPin& pin)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredSymbolPins.append(&pin);
+    if (getRegisteredElementsCount() == 1) {
+        mComponentInstance.signalUsageChanged(true);
+    }
 }
 
 void ComponentSignalInstance::unregisterSymbolPin(SI_SymbolPin& pin)
@@ -231,6 +234,9 @@ void ComponentSignalInstance::unregisterSymbolPin(SI_SymbolPin& pin)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredSymbolPins.removeOne(&pin);
+    if (getRegisteredElementsCount() == 0) {
+        mComponentInstance.signalUsageChanged(false);
+    }
 }
 
 void ComponentSignalInstance::registerFootprintPad(BI_FootprintPad& pad)
@@ -241,6 +247,9 @@ void ComponentSignalInstance::registerFootprintPad(BI_FootprintPad& pad)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredFootprintPads.append(&pad);
+    if (getRegisteredElementsCount() == 1) {
+        mComponentInstance.signalUsageChanged(true);
+    }
 }
 
 void ComponentSignalInstance::unregisterFootprintPad(BI_FootprintPad& pad)
@@ -249,6 +258,9 @@ void ComponentSignalInstance::unregisterFootprintPad(BI_FootprintPad& pad)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredFootprintPads.removeOne(&pad);
+    if (getRegisteredElementsCount() == 0) {
+        mComponentInstance.signalUsageChanged(false);
+    }
 }
 
 void ComponentSignalInstance::serialize(DomElement& root) const
@@ -25,11 +25,13 @@
 #include "netclass.h"
 #include <librepcb/common/exceptions.h>
 #include "circuit.h"
+#include "circuitconnectivity.h"
 #include "../erc/ercmsg.h"
 #include "componentsignalinstance.h"
 #include "../schematics/items/si_netlabel.h"
 #include "../schematics/items/si_netpoint.h"
 #include "../boards/items/bi_netpoint.h"
+#include "../boards/items/bi_plane.h"
 #include "../boards/items/bi_via.h"
 
 /*****************************************************************************************
@@ -43,7 +45,8 @@ namespace project {
  ****************************************************************************************/
 
 NetSignal::NetSignal(Circuit& circuit, const DomElement& domElement) :
-    QObject(&circuit), mCircuit(circuit), mIsAddedToCircuit(false), mIsHighlighted(false)
+    QObject(&circuit), mCircuit(circuit), mIsAddedToCircuit(false), mIsHighlighted(false),
+    mErcMsgUpdateScheduled(false)
 {
     mUuid = domElement.getAttribute<Uuid>("uuid", true);
     mName = domElement.getAttribute<QString>("name", true);
@@ -62,7 +65,8 @@ NetSignal::NetSignal(Circuit& circuit, const DomElement& domElement) :
 NetSignal::NetSignal(Circuit& circuit, NetClass& netclass, const QString& name,
                      bool autoName) :
     QObject(&circuit), mCircuit(circuit), mIsAddedToCircuit(false), mIsHighlighted(false),
-    mUuid(Uuid::createRandom()), mName(name), mHasAutoName(autoName), mNetClass(&netclass)
+    mErcMsgUpdateScheduled(false), mUuid(Uuid::createRandom()), mName(name),
+    mHasAutoName(autoName), mNetClass(&netclass)
 {
     if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
 }
@@ -85,6 +89,7 @@ int NetSignal::getRegisteredElementsCount() const noexcept
     count += mRegisteredSchematicNetLabels.count();
     count += mRegisteredBoardNetPoints.count();
     count += mRegisteredBoardVias.count();
+    count += mRegisteredBoardPlanes.count();
     return count;
 }
 
@@ -118,7 +123,7 @@ void NetSignal::setName(const QString& name, bool isAutoName)
     }
     mName = name;
     mHasAutoName = isAutoName;
-    updateErcMessages();
+    scheduleErcMsgUpdate();
     emit nameChanged(mName);
 }
 
@@ -141,7 +146,7 @@ void NetSignal::addToCircuit()
     }
     mNetClass->registerNetSignal(*this); // can throw
     mIsAddedToCircuit = true;
-    updateErcMessages();
+    scheduleErcMsgUpdate();
 }
 
 void NetSignal::removeFromCircuit()
@@ -156,7 +161,7 @@ void NetSignal::removeFromCircuit()
     }
     mNetClass->unregisterNetSignal(*this); // can throw
     mIsAddedToCircuit = false;
-    updateErcMessages();
+    scheduleErcMsgUpdate();
 }
 
 void NetSignal::registerComponentSignal(ComponentSignalInstance& signal)
@@ -167,7 +172,7 @@ void NetSignal::registerComponentSignal(ComponentSignalInstance& signal)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredComponentSignals.append(&signal);
-    updateErcMessages();
+    scheduleErcMsgUpdate();
 }
 
 void NetSignal::unregisterComponentSignal(ComponentSignalInstance& signal)
@@ -176,7 +181,7 @@ void NetSignal::unregisterComponentSignal(ComponentSignalInstance& signal)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredComponentSignals.removeOne(&signal);
-    updateErcMessages();
+    scheduleErcMsgUpdate();
 }
 
 void NetSignal::registerSchematicNetPoint(SI_NetPoint& netpoint)
@@ -187,7 +192,7 @@ void NetSignal::registerSchematicNetPoint(SI_NetPoint& netpoint)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredSchematicNetPoints.append(&netpoint);
-    updateErcMessages();
+    scheduleErcMsgUpdate();
 }
 
 void NetSignal::unregisterSchematicNetPoint(SI_NetPoint& netpoint)
@@ -196,7 +201,7 @@ void NetSignal::unregisterSchematicNetPoint(SI_NetPoint& netpoint)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredSchematicNetPoints.removeOne(&netpoint);
-    updateErcMessages();
+    scheduleErcMsgUpdate();
 }
 
 void NetSignal::registerSchematicNetLabel(SI_NetLabel& netlabel)
@@ -207,7 +212,7 @@ void NetSignal::registerSchematicNetLabel(SI_NetLabel& netlabel)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredSchematicNetLabels.append(&netlabel);
-    updateErcMessages();
+    scheduleErcMsgUpdate();
 }
 
 void NetSignal::unregisterSchematicNetLabel(SI_NetLabel& netlabel)
@@ -216,7 +221,7 @@ void NetSignal::unregisterSchematicNetLabel(SI_NetLabel& netlabel)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredSchematicNetLabels.removeOne(&netlabel);
-    updateErcMessages();
+    scheduleErcMsgUpdate();
 }
 
 void NetSignal::registerBoardNetPoint(BI_NetPoint& netpoint)
@@ -227,7 +232,7 @@ void NetSignal::registerBoardNetPoint(BI_NetPoint& netpoint)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredBoardNetPoints.append(&netpoint);
-    updateErcMessages();
+    scheduleErcMsgUpdate();
 }
 
 void NetSignal::unregisterBoardNetPoint(BI_NetPoint& netpoint)
@@ -236,7 +241,7 @@ void NetSignal::unregisterBoardNetPoint(BI_NetPoint& netpoint)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredBoardNetPoints.removeOne(&netpoint);
-    updateErcMessages();
+    scheduleErcMsgUpdate();
 }
 
 void NetSignal::registerBoardVia(BI_Via& via)
@@ -247,7 +252,7 @@ void NetSignal::registerBoardVia(BI_Via& via)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredBoardVias.append(&via);
-    updateErcMessages();
+    scheduleErcMsgUpdate();
 }
 
 void NetSignal::unregisterBoardVia(BI_Via& via)
@@ -256,7 +261,27 @@ void NetSignal::unregisterBoardVia(BI_Via& via)
         throw LogicError(__FILE__, __LINE__);
     }
     mRegisteredBoardVias.removeOne(&via);
-    updateErcMessages();
+    scheduleErcMsgUpdate();
+}
+
+void NetSignal::registerBoardPlane(BI_Plane& plane)
+{
+    if ((!mIsAddedToCircuit) || (mRegisteredBoardPlanes.contains(&plane))
+        || (plane.getCircuit() != mCircuit))
+    {
+        throw LogicError(__FILE__, __LINE__);
+    }
+    mRegisteredBoardPlanes.append(&plane);
+    scheduleErcMsgUpdate();
+}
+
+void NetSignal::unregisterBoardPlane(BI_Plane& plane)
+{
+    if ((!mIsAddedToCircuit) || (!mRegisteredBoardPlanes.contains(&plane))) {
+        throw LogicError(__FILE__, __LINE__);
+    }
+    mRegisteredBoardPlanes.removeOne(&plane);
+    scheduleErcMsgUpdate();
 }
 
 void NetSignal::serialize(DomElement& root) const
@@ -281,8 +306,22 @@ bool NetSignal::checkAttributesValidity() const noexcept
     return true;
 }
 
+void NetSignal::scheduleErcMsgUpdate() noexcept
+{
+    // every caller of this method has changed the registered elements of this net
+    // signal, so its cached connectivity structure is outdated as well
+    mCircuit.getConnectivity().invalidateNetSignal(*this);
+
+    if (!mErcMsgUpdateScheduled) {
+        mErcMsgUpdateScheduled = true;
+        QMetaObject::invokeMethod(this, "updateErcMessages", Qt::QueuedConnection);
+    }
+}
+
 void NetSignal::updateErcMessages() noexcept
 {
+    mErcMsgUpdateScheduled = false;
+
     if (mIsAddedToCircuit && (!isUsed())) {
         if (!mErcMsgUnusedNetSignal) {
             mErcMsgUnusedNetSignal.reset(new ErcMsg(mCircuit.getProject(), *this,
@@ -42,6 +42,7 @@ class SI_NetPoint;
 class SI_NetLabel;
 class BI_NetPoint;
 class BI_Via;
+class BI_Plane;
 class ErcMsg;
 
 /*****************************************************************************************
@@ -80,6 +81,7 @@ class NetSignal final : public QObject, public IF_ErcMsgProvider, public Seriali
         const QList<SI_NetLabel*>& getSchematicNetLabels() const noexcept {return mRegisteredSchematicNetLabels;}
         const QList<BI_NetPoint*>& getBoardNetPoints() const noexcept {return mRegisteredBoardNetPoints;}
         const QList<BI_Via*>& getBoardVias() const noexcept {return mRegisteredBoardVias;}
+        const QList<BI_Plane*>& getBoardPlanes() const noexcept {return mRegisteredBoardPlanes;}
         int getRegisteredElementsCount() const noexcept;
         bool isUsed() const noexcept;
         bool isNameForced() const noexcept;
@@ -101,6 +103,8 @@ class NetSignal final : public QObject, public IF_ErcMsgProvider, public Seriali
         void unregisterBoardNetPoint(BI_NetPoint& netpoint);
         void registerBoardVia(BI_Via& via);
         void unregisterBoardVia(BI_Via& via);
+        void registerBoardPlane(BI_Plane& plane);
+        void unregisterBoardPlane(BI_Plane& plane);
 
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(DomElement& root) const override;
@@ -115,15 +119,29 @@ class NetSignal final : public QObject, public IF_ErcMsgProvider, public Seriali
         void highlightedChanged(bool isHighlighted);
 
 
+    private slots:
+
+        void updateErcMessages() noexcept;
+
+
     private:
         bool checkAttributesValidity() const noexcept;
-        void updateErcMessages() noexcept;
+
+        /**
+         * @brief Schedule a call of #updateErcMessages() from the event loop
+         *
+         * Many operations (e.g. drawing a wire) register/unregister several elements
+         * in a row; this coalesces all resulting ERC re-checks of this net signal
+         * into a single one.
+         */
+        void scheduleErcMsgUpdate() noexcept;
 
 
         // General
         Circuit& mCircuit;
         bool mIsAddedToCircuit;
         bool mIsHighlighted;
+        bool mErcMsgUpdateScheduled;
 
         // Attributes
         Uuid mUuid;
@@ -137,6 +155,7 @@ class NetSignal final : public QObject, public IF_ErcMsgProvider, public Seriali
         QList<SI_NetLabel*> mRegisteredSchematicNetLabels;
         QList<BI_NetPoint*> mRegisteredBoardNetPoints;
         QList<BI_Via*> mRegisteredBoardVias;
+        QList<BI_Plane*> mRegisteredBoardPlanes;
 
         // ERC Messages
         /// @brief the ERC message for unused netsignals
@@ -40,7 +40,8 @@ namespace project {
 
 ErcMsgList::ErcMsgList(Project& project, bool restore, bool readOnly, bool create) :
     QObject(&project), mProject(project),
-    mXmlFilepath(project.getPath().getPathTo("core/erc.xml")), mXmlFile(nullptr)
+    mXmlFilepath(project.getPath().getPathTo("core/erc.xml")), mXmlFile(nullptr),
+    mUpdateDepth(0)
 {
     // try to create/open the XML file "erc.xml"
     if (create) {
@@ -77,6 +78,21 @@ void ErcMsgList::remove(ErcMsg* ercMsg) noexcept
     emit ercMsgRemoved(ercMsg);
 }
 
+void ErcMsgList::beginUpdate() noexcept
+{
+    if (mUpdateDepth++ == 0) {
+        emit batchUpdateStarted();
+    }
+}
+
+void ErcMsgList::endUpdate() noexcept
+{
+    Q_ASSERT(mUpdateDepth > 0);
+    if (--mUpdateDepth == 0) {
+        emit batchUpdateFinished();
+    }
+}
+
 void ErcMsgList::update(ErcMsg* ercMsg) noexcept
 {
     Q_ASSERT(ercMsg);
@@ -92,23 +108,31 @@ void ErcMsgList::restoreIgnoreState()
     std::unique_ptr<DomDocument> doc = mXmlFile->parseFileAndBuildDomTree();
     DomElement& root = doc->getRoot();
 
-    // reset all ignore attributes
-    foreach (ErcMsg* ercMsg, mItems)
-        ercMsg->setIgnored(false);
-
-    // scan ignored items and set ignore attributes
+    // collect the identities of all saved approvals in a hash set, then match
+    // every live message with a single lookup - pairwise comparison was quadratic
+    // with hundreds of approved items
+    QSet<QString> approvals;
+    approvals.reserve(root.getChildCount());
     foreach (const DomElement* node, root.getChilds("ignore")) {
-        foreach (ErcMsg* ercMsg, mItems) {
-            if ((ercMsg->getOwner().getErcMsgOwnerClassName() == node->getAttribute<QString>("owner_class", false))
-             && (ercMsg->getOwnerKey() == node->getAttribute<QString>("owner_key", false))
-             && (ercMsg->getMsgKey() == node->getAttribute<QString>("msg_key", false)))
-            {
-                ercMsg->setIgnored(true);
-            }
-        }
+        approvals.insert(calcApprovalKey(node->getAttribute<QString>("owner_class", false),
+                                         node->getAttribute<QString>("owner_key", false),
+                                         node->getAttribute<QString>("msg_key", false)));
+    }
+    foreach (ErcMsg* ercMsg, mItems) {
+        ercMsg->setIgnored(approvals.contains(
+            calcApprovalKey(ercMsg->getOwner().getErcMsgOwnerClassName(),
+                            ercMsg->getOwnerKey(), ercMsg->getMsgKey())));
     }
 }
 
+QString ErcMsgList::calcApprovalKey(const QString& ownerClass, const QString& ownerKey,
+                                    const QString& msgKey) noexcept
+{
+    // '\n' cannot occur in the fields (they are single-line XML attributes), so
+    // the concatenation is a collision-free canonical identity
+    return ownerClass % QChar('\n') % ownerKey % QChar('\n') % msgKey;
+}
+
 bool ErcMsgList::save(bool toOriginal, QStringList& errors) noexcept
 {
     bool success = true;
@@ -66,6 +66,20 @@ class ErcMsgList final : public QObject, public SerializableObject
         void add(ErcMsg* ercMsg) noexcept;
         void remove(ErcMsg* ercMsg) noexcept;
         void update(ErcMsg* ercMsg) noexcept;
+
+        /**
+         * @brief Begin a batch of many add()/remove()/update() calls
+         *
+         * Emits #batchUpdateStarted() on the outermost call, so consumers (e.g. the
+         * ERC dock) can suspend expensive per-message UI work until the matching
+         * #endUpdate(). Calls may be nested; use librepcb#project#ErcMsgListBatchGuard
+         * to guarantee balanced calls.
+         */
+        void beginUpdate() noexcept;
+
+        /// @copydoc beginUpdate()
+        void endUpdate() noexcept;
+
         void restoreIgnoreState();
         bool save(bool toOriginal, QStringList& errors) noexcept;
         
@@ -78,6 +92,8 @@ class ErcMsgList final : public QObject, public SerializableObject
         void ercMsgAdded(ErcMsg* ercMsg);
         void ercMsgRemoved(ErcMsg* ercMsg);
         void ercMsgChanged(ErcMsg* ercMsg);
+        void batchUpdateStarted();
+        void batchUpdateFinished();
 
 
     private: // Methods
@@ -85,6 +101,10 @@ class ErcMsgList final : public QObject, public SerializableObject
         /// @copydoc librepcb::SerializableObject::serialize()
         void serialize(DomElement& root) const override;
 
+        /// canonical hashed identity of an ERC message approval
+        static QString calcApprovalKey(const QString& ownerClass, const QString& ownerKey,
+                                       const QString& msgKey) noexcept;
+
 
         // General
         Project& mProject;
@@ -95,6 +115,31 @@ class ErcMsgList final : public QObject, public SerializableObject
 
         // Misc
         QList<ErcMsg*> mItems; ///< contains all visible ERC messages
+        int mUpdateDepth; ///< nesting depth of beginUpdate()/endUpdate()
+};
+
+/*****************************************************************************************
+ *  Class ErcMsgListBatchGuard
+ ****************************************************************************************/
+
+/**
+ * @brief RAII helper to guarantee balanced ErcMsgList#beginUpdate()/endUpdate() calls
+ */
+class ErcMsgListBatchGuard final
+{
+    public:
+        ErcMsgListBatchGuard() = delete;
+        ErcMsgListBatchGuard(const ErcMsgListBatchGuard& other) = delete;
+        explicit ErcMsgListBatchGuard(ErcMsgList& list) noexcept : mList(list) {
+            mList.beginUpdate();
+        }
+        ~ErcMsgListBatchGuard() noexcept {
+            mList.endUpdate();
+        }
+        ErcMsgListBatchGuard& operator=(const ErcMsgListBatchGuard& rhs) = delete;
+
+    private:
+        ErcMsgList& mList;
 };
 
 /*****************************************************************************************
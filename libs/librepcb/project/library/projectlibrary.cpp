@@ -58,11 +58,14 @@ ProjectLibrary::ProjectLibrary(Project& project, bool restore, bool readOnly) :
 
     try
     {
-        // Load all library elements
-        loadElements<Symbol>    (mLibraryPath.getPathTo("sym"),    "symbols",      mSymbols);
-        loadElements<Package>   (mLibraryPath.getPathTo("pkg"),    "packages",     mPackages);
-        loadElements<Component> (mLibraryPath.getPathTo("cmp"),    "components",   mComponents);
-        loadElements<Device>    (mLibraryPath.getPathTo("dev"),    "devices",      mDevices);
+        // Index all library elements with a cheap directory pass. The elements
+        // themselves are parsed lazily on first use, so opening a project does not
+        // pay for the (potentially many) elements which are not referenced by any
+        // placed instance.
+        loadElementIndex<Symbol>    (mLibraryPath.getPathTo("sym"), "symbols",    mSymbolIndex,    mSymbols);
+        loadElementIndex<Package>   (mLibraryPath.getPathTo("pkg"), "packages",   mPackageIndex,   mPackages);
+        loadElementIndex<Component> (mLibraryPath.getPathTo("cmp"), "components", mComponentIndex, mComponents);
+        loadElementIndex<Device>    (mLibraryPath.getPathTo("dev"), "devices",    mDeviceIndex,    mDevices);
     }
     catch (Exception &e)
     {
@@ -96,24 +99,48 @@ ProjectLibrary::~ProjectLibrary() noexcept
  *  Getters: Library Elements
  ****************************************************************************************/
 
+const QHash<Uuid, Symbol*>& ProjectLibrary::getSymbols() const noexcept
+{
+    loadAllElements<Symbol>(mSymbols, mSymbolIndex);
+    return mSymbols;
+}
+
+const QHash<Uuid, Package*>& ProjectLibrary::getPackages() const noexcept
+{
+    loadAllElements<Package>(mPackages, mPackageIndex);
+    return mPackages;
+}
+
+const QHash<Uuid, Component*>& ProjectLibrary::getComponents() const noexcept
+{
+    loadAllElements<Component>(mComponents, mComponentIndex);
+    return mComponents;
+}
+
+const QHash<Uuid, Device*>& ProjectLibrary::getDevices() const noexcept
+{
+    loadAllElements<Device>(mDevices, mDeviceIndex);
+    return mDevices;
+}
+
 Symbol* ProjectLibrary::getSymbol(const Uuid& uuid) const noexcept
 {
-    return mSymbols.value(uuid, 0);
+    return getOrLoadElement<Symbol>(uuid, mSymbols, mSymbolIndex);
 }
 
 Package* ProjectLibrary::getPackage(const Uuid& uuid) const noexcept
 {
-    return mPackages.value(uuid, 0);
+    return getOrLoadElement<Package>(uuid, mPackages, mPackageIndex);
 }
 
 Component* ProjectLibrary::getComponent(const Uuid& uuid) const noexcept
 {
-    return mComponents.value(uuid, 0);
+    return getOrLoadElement<Component>(uuid, mComponents, mComponentIndex);
 }
 
 Device* ProjectLibrary::getDevice(const Uuid& uuid) const noexcept
 {
-    return mDevices.value(uuid, 0);
+    return getOrLoadElement<Device>(uuid, mDevices, mDeviceIndex);
 }
 
 /*****************************************************************************************
@@ -122,6 +149,7 @@ Device* ProjectLibrary::getDevice(const Uuid& uuid) const noexcept
 
 QHash<Uuid, library::Device*> ProjectLibrary::getDevicesOfComponent(const Uuid& compUuid) const noexcept
 {
+    loadAllElements<Device>(mDevices, mDeviceIndex); // the component uuid is only known from the file content
     QHash<Uuid, library::Device*> list;
     foreach (library::Device* device, mDevices)
     {
@@ -137,22 +165,22 @@ QHash<Uuid, library::Device*> ProjectLibrary::getDevicesOfComponent(const Uuid&
 
 void ProjectLibrary::addSymbol(library::Symbol& s)
 {
-    addElement<Symbol>(s, mSymbols, mAddedSymbols, mRemovedSymbols);
+    addElement<Symbol>(s, mSymbols, mSymbolIndex, mAddedSymbols, mRemovedSymbols);
 }
 
 void ProjectLibrary::addPackage(library::Package& p)
 {
-    addElement<Package>(p, mPackages, mAddedPackages, mRemovedPackages);
+    addElement<Package>(p, mPackages, mPackageIndex, mAddedPackages, mRemovedPackages);
 }
 
 void ProjectLibrary::addComponent(library::Component& c)
 {
-    addElement<Component>(c, mComponents, mAddedComponents, mRemovedComponents);
+    addElement<Component>(c, mComponents, mComponentIndex, mAddedComponents, mRemovedComponents);
 }
 
 void ProjectLibrary::addDevice(library::Device& d)
 {
-    addElement<Device>(d, mDevices, mAddedDevices, mRemovedDevices);
+    addElement<Device>(d, mDevices, mDeviceIndex, mAddedDevices, mRemovedDevices);
 }
 
 void ProjectLibrary::removeSymbol(library::Symbol& s)
@@ -202,8 +230,9 @@ bool ProjectLibrary::save(bool toOriginal, QStringList& errors) noexcept
  ****************************************************************************************/
 
 template <typename ElementType>
-void ProjectLibrary::loadElements(const FilePath& directory, const QString& type,
-                                  QHash<Uuid, ElementType*>& elementList)
+void ProjectLibrary::loadElementIndex(const FilePath& directory, const QString& type,
+                                      QHash<Uuid, FilePath>& index,
+                                      QHash<Uuid, ElementType*>& elementList)
 {
     QDir dir(directory.toStr());
 
@@ -225,28 +254,86 @@ void ProjectLibrary::loadElements(const FilePath& directory, const QString& type
             continue;
         }
 
-        // load the library element --> an exception will be thrown on error
-        ElementType* element = new ElementType(subdirPath, false);
+        // the directory basename is the UUID of the element, so it can be indexed
+        // without parsing any files; the element is loaded on its first use
+        Uuid uuid(subdirPath.getBasename());
+        if (uuid.isNull()) {
+            // directory name is not a valid UUID --> load the element to get its UUID
+            QScopedPointer<ElementType> element(new ElementType(subdirPath, false)); // can throw
+            if (elementList.contains(element->getUuid()) || index.contains(element->getUuid())) {
+                throw RuntimeError(__FILE__, __LINE__,
+                    QString(tr("There are multiple library elements with the same "
+                    "UUID in the directory \"%1\"")).arg(subdirPath.toNative()));
+            }
+            elementList.insert(element->getUuid(), element.take());
+            continue;
+        }
 
-        if (elementList.contains(element->getUuid())) {
+        if (elementList.contains(uuid) || index.contains(uuid)) {
             throw RuntimeError(__FILE__, __LINE__,
                 QString(tr("There are multiple library elements with the same "
                 "UUID in the directory \"%1\"")).arg(subdirPath.toNative()));
         }
 
-        elementList.insert(element->getUuid(), element);
+        index.insert(uuid, subdirPath);
     }
 
-    qDebug() << "successfully loaded" << elementList.count() << qPrintable(type);
+    qDebug() << "successfully indexed" << (index.count() + elementList.count()) << qPrintable(type);
+}
+
+template <typename ElementType>
+ElementType* ProjectLibrary::getOrLoadElement(const Uuid& uuid,
+                                              QHash<Uuid, ElementType*>& elementList,
+                                              QHash<Uuid, FilePath>& index) const noexcept
+{
+    ElementType* element = elementList.value(uuid, nullptr);
+    if (element) {
+        return element;
+    }
+
+    auto it = index.find(uuid);
+    if (it == index.end()) {
+        return nullptr;
+    }
+
+    QString errorMsg;
+    std::unique_ptr<ElementType> loaded =
+        library::LibraryBaseElement::tryLoad<ElementType>(it.value(), false, &errorMsg);
+    if (!loaded) {
+        // callers treat a load error like a missing element (they throw a proper
+        // error themselves when the element is actually required)
+        qCritical() << "Failed to load project library element:" << errorMsg;
+        return nullptr;
+    }
+    if (loaded->getUuid() != uuid) {
+        qCritical() << "UUID mismatch between library element directory and file:"
+                    << it.value().toNative();
+        return nullptr;
+    }
+    element = loaded.release();
+
+    index.erase(it);
+    elementList.insert(uuid, element);
+    return element;
+}
+
+template <typename ElementType>
+void ProjectLibrary::loadAllElements(QHash<Uuid, ElementType*>& elementList,
+                                     QHash<Uuid, FilePath>& index) const noexcept
+{
+    foreach (const Uuid& uuid, index.keys()) {
+        getOrLoadElement<ElementType>(uuid, elementList, index);
+    }
 }
 
 template <typename ElementType>
 void ProjectLibrary::addElement(ElementType& element,
                                 QHash<Uuid, ElementType*>& elementList,
+                                QHash<Uuid, FilePath>& index,
                                 QList<ElementType*>& addedElementsList,
                                 QList<ElementType*>& removedElementsList)
 {
-    if (elementList.contains(element.getUuid())) {
+    if (elementList.contains(element.getUuid()) || index.contains(element.getUuid())) {
         throw LogicError(__FILE__, __LINE__, QString(tr(
             "There is already an element with the same UUID in the project's library: %1"))
             .arg(element.getUuid().toStr()));
@@ -65,10 +65,14 @@ class ProjectLibrary final : public QObject
         ~ProjectLibrary() noexcept;
 
         // Getters: Library Elements
-        const QHash<Uuid, library::Symbol*>&     getSymbols()        const noexcept {return mSymbols;}
-        const QHash<Uuid, library::Package*>&    getPackages()       const noexcept {return mPackages;}
-        const QHash<Uuid, library::Component*>&  getComponents()     const noexcept {return mComponents;}
-        const QHash<Uuid, library::Device*>&     getDevices()        const noexcept {return mDevices;}
+        //
+        // Elements are loaded lazily: opening a project only indexes the library
+        // directories, each element is parsed on its first use (see the by-UUID
+        // getters). The full-map getters load all remaining elements first.
+        const QHash<Uuid, library::Symbol*>&     getSymbols()        const noexcept;
+        const QHash<Uuid, library::Package*>&    getPackages()       const noexcept;
+        const QHash<Uuid, library::Component*>&  getComponents()     const noexcept;
+        const QHash<Uuid, library::Device*>&     getDevices()        const noexcept;
         library::Symbol*      getSymbol(     const Uuid& uuid) const noexcept;
         library::Package*     getPackage(    const Uuid& uuid) const noexcept;
         library::Component*   getComponent(  const Uuid& uuid) const noexcept;
@@ -102,11 +106,20 @@ class ProjectLibrary final : public QObject
 
         // Private Methods
         template <typename ElementType>
-        void loadElements(const FilePath& directory, const QString& type,
-                          QHash<Uuid, ElementType*>& elementList);
+        void loadElementIndex(const FilePath& directory, const QString& type,
+                              QHash<Uuid, FilePath>& index,
+                              QHash<Uuid, ElementType*>& elementList);
+        template <typename ElementType>
+        ElementType* getOrLoadElement(const Uuid& uuid,
+                                      QHash<Uuid, ElementType*>& elementList,
+                                      QHash<Uuid, FilePath>& index) const noexcept;
+        template <typename ElementType>
+        void loadAllElements(QHash<Uuid, ElementType*>& elementList,
+                             QHash<Uuid, FilePath>& index) const noexcept;
         template <typename ElementType>
         void addElement(ElementType& element,
                         QHash<Uuid, ElementType*>& elementList,
+                        QHash<Uuid, FilePath>& index,
                         QList<ElementType*>& addedElementsList,
                         QList<ElementType*>& removedElementsList);
         template <typename ElementType>
@@ -127,11 +140,18 @@ class ProjectLibrary final : public QObject
         Project& mProject; ///< a reference to the Project object (from the ctor)
         FilePath mLibraryPath; ///< the "library" directory of the project
 
-        // The Library Elements
-        QHash<Uuid, library::Symbol*> mSymbols;
-        QHash<Uuid, library::Package*> mPackages;
-        QHash<Uuid, library::Component*> mComponents;
-        QHash<Uuid, library::Device*> mDevices;
+        // The Library Elements (mutable because they are loaded lazily from the
+        // const getters, see #getOrLoadElement())
+        mutable QHash<Uuid, library::Symbol*> mSymbols;
+        mutable QHash<Uuid, library::Package*> mPackages;
+        mutable QHash<Uuid, library::Component*> mComponents;
+        mutable QHash<Uuid, library::Device*> mDevices;
+
+        // Index of the not yet loaded elements (uuid -> element directory)
+        mutable QHash<Uuid, FilePath> mSymbolIndex;
+        mutable QHash<Uuid, FilePath> mPackageIndex;
+        mutable QHash<Uuid, FilePath> mComponentIndex;
+        mutable QHash<Uuid, FilePath> mDeviceIndex;
 
         // Added Library Elements
         QList<library::Symbol*> mAddedSymbols;
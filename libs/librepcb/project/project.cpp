@@ -21,7 +21,9 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <QtConcurrent/QtConcurrent>
 #include <QPrinter>
+#include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/exceptions.h>
 #include <librepcb/common/fileio/directorylock.h>
 #include <librepcb/common/fileio/smarttextfile.h>
@@ -30,6 +32,7 @@
 #include <librepcb/common/fileio/domdocument.h>
 #include <librepcb/common/fileio/fileutils.h>
 #include <librepcb/common/systeminfo.h>
+#include <librepcb/common/tracer.h>
 #include "project.h"
 #include "library/projectlibrary.h"
 #include "circuit/circuit.h"
@@ -50,13 +53,16 @@ namespace project {
  *  Constructors / Destructor
  ****************************************************************************************/
 
-Project::Project(const FilePath& filepath, bool create, bool readOnly) :
+Project::Project(const FilePath& filepath, bool create, bool readOnly,
+                 bool loadDocuments, const OpenProgressCallback& progressCallback) :
     QObject(nullptr), IF_AttributeProvider(), mPath(filepath.getParentDir()),
     mFilepath(filepath), mLock(filepath.getParentDir()), mIsRestored(false),
     mIsReadOnly(readOnly)
 {
     qDebug() << (create ? "create project:" : "open project:") << filepath.toNative();
 
+    TracerScope trace(create ? "Project::create" : "Project::open");
+
     // Check if the file extension is correct
     if (mFilepath.getSuffix() != "lpp") {
         qDebug() << mFilepath.toStr();
@@ -159,6 +165,30 @@ Project::Project(const FilePath& filepath, bool create, bool readOnly) :
 
     try
     {
+        if ((!create) && loadDocuments) {
+            // warm the page cache: read all project files sequentially on a worker
+            // thread while the parsing below proceeds. A cold open from spinning or
+            // network storage is dominated by per-file latency as the files are
+            // discovered one by one (project file -> schematics list -> each page);
+            // the read-ahead overlaps that latency with the parsing work. Only the
+            // content directories are touched - "output" may contain big archives.
+            const QStringList prefetchDirs = {"core", "library", "schematics", "boards"};
+            QString projectDir = mPath.toStr();
+            QtConcurrent::run([projectDir, prefetchDirs]() {
+                foreach (const QString& dir, prefetchDirs) {
+                    QDirIterator it(projectDir % "/" % dir, QDir::Files,
+                                    QDirIterator::Subdirectories);
+                    while (it.hasNext()) {
+                        QFile file(it.next());
+                        if (file.open(QIODevice::ReadOnly)) {
+                            char buffer[65536];
+                            while (file.read(buffer, sizeof(buffer)) > 0) {}
+                        }
+                    }
+                }
+            });
+        }
+
         // try to create/open the version file
         FilePath versionFilePath = mPath.getPathTo(".librepcb-project");
         if (create) {
@@ -171,6 +201,16 @@ Project::Project(const FilePath& filepath, bool create, bool readOnly) :
 
         // try to create/open the XML project file
         std::unique_ptr<DomDocument> doc;
+        // report the load progress at every phase boundary; the callback may
+        // cancel opening, which rolls back through the catch block below
+        auto reportProgress = [&progressCallback, this](int percent, const QString& status) {
+            if (progressCallback && (!progressCallback(percent, status))) {
+                throw UserCanceled(__FILE__, __LINE__,
+                                   tr("Opening the project was canceled."));
+            }
+        };
+
+        reportProgress(5, tr("Read project file..."));
         DomElement* root = nullptr;
         if (create) {
             mXmlFile.reset(SmartXmlFile::create(mFilepath));
@@ -197,32 +237,82 @@ Project::Project(const FilePath& filepath, bool create, bool readOnly) :
         }
 
         // Create all needed objects
+        reportProgress(10, tr("Load project settings..."));
         mProjectSettings.reset(new ProjectSettings(*this, mIsRestored, mIsReadOnly, create));
         mProjectLibrary.reset(new ProjectLibrary(*this, mIsRestored, mIsReadOnly));
         mErcMsgList.reset(new ErcMsgList(*this, mIsRestored, mIsReadOnly, create));
+        reportProgress(20, tr("Load circuit..."));
         mCircuit.reset(new Circuit(*this, mIsRestored, mIsReadOnly, create));
 
         // Load all schematic layers
         mSchematicLayerProvider.reset(new SchematicLayerProvider(*this));
 
-        if (!create) {
-            // Load all schematics
+        if ((!create) && loadDocuments) {
+            // Determine the filepaths of all schematics and boards
+            QList<FilePath> schematicFilepaths, boardFilepaths;
             foreach (const DomElement* node, root->getChilds("schematic")) {
-                FilePath fp = FilePath::fromRelative(mPath.getPathTo("schematics"), node->getText<QString>(true));
-                Schematic* schematic = new Schematic(*this, fp, mIsRestored, mIsReadOnly);
+                schematicFilepaths.append(FilePath::fromRelative(
+                    mPath.getPathTo("schematics"), node->getText<QString>(true)));
+            }
+            foreach (const DomElement* node, root->getChilds("board")) {
+                boardFilepaths.append(FilePath::fromRelative(
+                    mPath.getPathTo("boards"), node->getText<QString>(true)));
+            }
+
+            // Parse all schematic and board XML files in parallel on the global thread
+            // pool. Constructing the objects and registering them in the circuit still
+            // happens sequentially on this thread afterwards, only the (expensive) XML
+            // parsing runs in parallel. Parse errors are not reported from the worker
+            // threads; instead the sequential load below parses the file again and
+            // throws an exception with a proper error message.
+            reportProgress(30, tr("Load schematics..."));
+            bool restored = mIsRestored; bool readOnly = mIsReadOnly;
+            QHash<QString, QFuture<DomDocument*>> parseFutures;
+            foreach (const FilePath& fp, schematicFilepaths + boardFilepaths) {
+                parseFutures.insert(fp.toStr(),
+                    QtConcurrent::run([fp, restored, readOnly]() -> DomDocument* {
+                        try {
+                            SmartXmlFile file(fp, restored, readOnly);
+                            return file.parseFileAndBuildDomTree().release();
+                        } catch (const Exception& e) {
+                            return nullptr;
+                        }
+                    }));
+            }
+            QHash<QString, std::shared_ptr<DomDocument>> parsedDocs;
+            foreach (const QString& fp, parseFutures.keys()) {
+                parsedDocs.insert(fp, std::shared_ptr<DomDocument>(parseFutures[fp].result()));
+            }
+
+            // Load all schematics (note: cancellation checkpoints must not be
+            // placed before all parse results were collected above, otherwise the
+            // unretrieved DOM documents of the worker threads would leak)
+            for (int i = 0; i < schematicFilepaths.count(); ++i) {
+                const FilePath& fp = schematicFilepaths.at(i);
+                reportProgress(30 + ((i * 30) / schematicFilepaths.count()),
+                               QString(tr("Load schematic %1/%2..."))
+                               .arg(i + 1).arg(schematicFilepaths.count()));
+                Schematic* schematic = new Schematic(*this, fp, mIsRestored, mIsReadOnly,
+                                                     parsedDocs.value(fp.toStr()).get());
                 addSchematic(*schematic);
             }
             qDebug() << mSchematics.count() << "schematics successfully loaded!";
 
             // Load all boards
-            foreach (const DomElement* node, root->getChilds("board")) {
-                FilePath fp = FilePath::fromRelative(mPath.getPathTo("boards"), node->getText<QString>(true));
-                Board* board = new Board(*this, fp, mIsRestored, mIsReadOnly);
+            for (int i = 0; i < boardFilepaths.count(); ++i) {
+                const FilePath& fp = boardFilepaths.at(i);
+                reportProgress(60 + ((i * 35) / boardFilepaths.count()),
+                               QString(tr("Load board %1/%2..."))
+                               .arg(i + 1).arg(boardFilepaths.count()));
+                Board* board = new Board(*this, fp, mIsRestored, mIsReadOnly,
+                                         parsedDocs.value(fp.toStr()).get());
                 addBoard(*board);
             }
             qDebug() << mBoards.count() << "boards successfully loaded!";
         }
 
+        reportProgress(95, tr("Finish project..."));
+
         // at this point, the whole circuit with all schematics and boards is successfully
         // loaded, so the ERC list now contains all the correct ERC messages.
         // So we can now restore the ignore state of each ERC message from the XML file.
@@ -244,12 +334,26 @@ Project::Project(const FilePath& filepath, bool create, bool readOnly) :
         throw; // ...and rethrow the exception
     }
 
+    // autosave jobs are written in worker threads; get notified when they are done
+    connect(&mAutosaveWatcher, &QFutureWatcher<QString>::finished,
+            this, &Project::autosaveJobsFinished);
+
+    // get notified when a running schematics PDF export has finished (connected
+    // once here; Qt::UniqueConnection would not deduplicate a lambda connection)
+    connect(&mPdfExportWatcher, &QFutureWatcher<QString>::finished, this, [this](){
+        QString errorMsg = mPdfExportWatcher.result();
+        emit schematicsPdfExportFinished(errorMsg.isEmpty(), errorMsg, mPdfExportFilePath);
+    });
+
     // project successfully opened! :-)
     qDebug() << "project successfully loaded!";
 }
 
 Project::~Project() noexcept
 {
+    // wait until all autosave jobs are written (they access our file objects!)
+    waitForAutosaveFinished();
+
     // free the allocated memory in the reverse order of their allocation
 
     // delete all boards and schematics (and catch all throwed exceptions)
@@ -546,6 +650,77 @@ void Project::save(bool toOriginal)
     Q_ASSERT(errors.isEmpty());
 }
 
+void Project::startAutosave() noexcept
+{
+    if (mIsReadOnly || isAutosaveRunning()) {
+        return; // nothing to do
+    }
+
+    mAutosaveJobs.clear();
+    mAutosaveErrors.clear();
+
+    // Save version file (the file is very small, so just write it synchronously)
+    try
+    {
+        mVersionFile->save(false);
+    }
+    catch (Exception& e)
+    {
+        mAutosaveErrors.append(e.getMsg());
+    }
+
+    // Serialize *.lpp project file
+    try
+    {
+        AutosaveJob job;
+        job.file = mXmlFile.data();
+        job.doc.reset(new DomDocument(*serializeToDomElement("project")));
+        mAutosaveJobs.append(job);
+    }
+    catch (Exception& e)
+    {
+        mAutosaveErrors.append(e.getMsg());
+    }
+
+    // Serialize circuit
+    mCircuit->queueAutosaveJobs(mAutosaveJobs, mAutosaveErrors);
+
+    // Serialize all removed and added schematics (*.xml files)
+    foreach (Schematic* schematic, mRemovedSchematics)
+        schematic->queueAutosaveJobs(mAutosaveJobs, mAutosaveErrors);
+    foreach (Schematic* schematic, mSchematics)
+        schematic->queueAutosaveJobs(mAutosaveJobs, mAutosaveErrors);
+
+    // Serialize all removed and added boards (*.xml files)
+    foreach (Board* board, mRemovedBoards)
+        board->queueAutosaveJobs(mAutosaveJobs, mAutosaveErrors);
+    foreach (Board* board, mBoards)
+        board->queueAutosaveJobs(mAutosaveJobs, mAutosaveErrors);
+
+    // Save library, settings and ERC messages list synchronously (these files are
+    // either small or modified so rarely that it's not worth saving them in threads)
+    mProjectLibrary->save(false, mAutosaveErrors);
+    mProjectSettings->save(false, mAutosaveErrors);
+    mErcMsgList->save(false, mAutosaveErrors);
+
+    // Write all queued documents to their temporary files in worker threads
+    if (!mAutosaveJobs.isEmpty()) {
+        mAutosaveWatcher.setFuture(QtConcurrent::mapped(mAutosaveJobs, AutosaveJobRunner{false}));
+    } else {
+        autosaveJobsFinished();
+    }
+}
+
+bool Project::isAutosaveRunning() const noexcept
+{
+    return mAutosaveWatcher.isRunning();
+}
+
+void Project::waitForAutosaveFinished() noexcept
+{
+    mAutosaveWatcher.waitForFinished();
+}
+
 /*****************************************************************************************
  *  Helper Methods
  ****************************************************************************************/
@@ -625,6 +800,11 @@ bool Project::save(bool toOriginal, QStringList& errors) noexcept
 {
     bool success = true;
 
+    TracerScope trace("Project::save");
+
+    // wait until a running autosave is finished (it accesses the same file objects!)
+    waitForAutosaveFinished();
+
     if (mIsReadOnly)
     {
         errors.append(tr("The project was opened in read-only mode."));
@@ -642,46 +822,54 @@ bool Project::save(bool toOriginal, QStringList& errors) noexcept
         errors.append(e.getMsg());
     }
 
-    // Save *.lpp project file
+    // Serialize the *.lpp project file, the circuit and all schematics/boards on
+    // this thread, then write all files in parallel on the thread pool. A full
+    // save consists of many independent small files and on network filesystems
+    // every write+rename sequence pays round trips, so writing them concurrently
+    // cuts the save latency to roughly the slowest file instead of the sum of
+    // all files. Removed documents are handled synchronously (file removal).
+    QVector<AutosaveJob> saveJobs;
     try
     {
-        DomDocument doc(*serializeToDomElement("project"));
-        mXmlFile->save(doc, toOriginal);
+        AutosaveJob job;
+        job.file = mXmlFile.data();
+        job.doc.reset(new DomDocument(*serializeToDomElement("project")));
+        saveJobs.append(job);
     }
     catch (Exception& e)
     {
         success = false;
         errors.append(e.getMsg());
     }
-
-    // Save circuit
-    if (!mCircuit->save(toOriginal, errors))
+    if (!mCircuit->queueAutosaveJobs(saveJobs, errors))
         success = false;
-
-    // Save all removed schematics (*.xml files)
     foreach (Schematic* schematic, mRemovedSchematics)
     {
         if (!schematic->save(toOriginal, errors))
             success = false;
     }
-    // Save all added schematics (*.xml files)
     foreach (Schematic* schematic, mSchematics)
     {
-        if (!schematic->save(toOriginal, errors))
+        if (!schematic->queueAutosaveJobs(saveJobs, errors))
             success = false;
     }
-
-    // Save all removed boards (*.xml files)
     foreach (Board* board, mRemovedBoards)
     {
         if (!board->save(toOriginal, errors))
             success = false;
     }
-    // Save all added boards (*.xml files)
     foreach (Board* board, mBoards)
     {
-        if (!board->save(toOriginal, errors))
+        if (!board->queueAutosaveJobs(saveJobs, errors))
+            success = false;
+    }
+    foreach (const QString& error,
+             QtConcurrent::blockingMapped(saveJobs, AutosaveJobRunner{toOriginal}))
+    {
+        if (!error.isNull()) {
             success = false;
+            errors.append(error);
+        }
     }
 
     // Save library
@@ -708,6 +896,111 @@ bool Project::save(bool toOriginal, QStringList& errors) noexcept
     return success;
 }
 
+QString Project::AutosaveJobRunner::operator()(const AutosaveJob& job) const noexcept
+{
+    try
+    {
+        job.file->save(*job.doc, toOriginal); // can throw
+        return QString();
+    }
+    catch (Exception& e)
+    {
+        return e.getMsg();
+    }
+}
+
+void Project::autosaveJobsFinished() noexcept
+{
+    QStringList errors = mAutosaveErrors;
+    if (!mAutosaveJobs.isEmpty()) {
+        foreach (const QString& error, mAutosaveWatcher.future().results()) {
+            if (!error.isNull()) errors.append(error);
+        }
+    }
+    mAutosaveJobs.clear(); // release the DOM document snapshots
+    mAutosaveErrors.clear();
+
+    // update the "last modified datetime" attribute of the project
+    mLastModified = QDateTime::currentDateTime();
+    emit attributesChanged();
+
+    emit autosaveFinished(errors.isEmpty(), errors);
+}
+
+void Project::startSchematicsPdfExport(const FilePath& filepath) noexcept
+{
+    if (mPdfExportWatcher.isRunning()) {
+        emit schematicsPdfExportFinished(false, tr("A PDF export is already running."),
+                                         filepath);
+        return;
+    }
+    mPdfExportFilePath = filepath;
+
+    // snapshot all pages into QPicture objects (this only records the paint commands
+    // and is fast); the expensive PDF generation then runs on a worker thread
+    QList<QPicture> pages;
+    foreach (Schematic* schematic, mSchematics) {
+        schematic->clearSelection();
+        QPicture picture;
+        QPainter painter(&picture);
+        // an explicit target rect is required: a fresh QPicture reports a 0x0 device
+        // size, so a null target rect would record nothing at all
+        QRectF source = schematic->getGraphicsScene().getItemsBoundingRect();
+        QRectF target(QPointF(0, 0), source.size());
+        schematic->getGraphicsScene().render(&painter, target, source, Qt::KeepAspectRatio);
+        painter.end();
+        pages.append(picture);
+    }
+
+    QString creator = QString("LibrePCB %1").arg(qApp->applicationVersion());
+    mPdfExportWatcher.setFuture(QtConcurrent::run(
+        &Project::runSchematicsPdfExport, pages, filepath, creator));
+}
+
+QString Project::runSchematicsPdfExport(const QList<QPicture>& pages,
+                                        const FilePath& filepath,
+                                        const QString& creator) noexcept
+{
+    try {
+        if (pages.isEmpty()) {
+            throw RuntimeError(__FILE__, __LINE__, tr("No schematic pages selected."));
+        }
+        QPrinter printer(QPrinter::HighResolution);
+        printer.setPaperSize(QPrinter::A4);
+        printer.setOrientation(QPrinter::Landscape);
+        printer.setOutputFormat(QPrinter::PdfFormat);
+        printer.setCreator(creator);
+        printer.setOutputFileName(filepath.toStr());
+
+        QPainter painter(&printer);
+        for (int i = 0; i < pages.count(); ++i) {
+            // scale the recorded picture into the page, like the direct scene
+            // rendering with Qt::KeepAspectRatio did
+            QRectF source = pages.at(i).boundingRect();
+            QRectF target = painter.viewport();
+            if ((!source.isEmpty()) && (!target.isEmpty())) {
+                qreal scale = qMin(target.width() / source.width(),
+                                   target.height() / source.height());
+                painter.save();
+                painter.translate(target.center());
+                painter.scale(scale, scale);
+                painter.translate(-source.center());
+                painter.drawPicture(0, 0, pages.at(i));
+                painter.restore();
+            }
+            if (i != pages.count() - 1) {
+                if (!printer.newPage()) {
+                    throw RuntimeError(__FILE__, __LINE__,
+                        tr("Unknown error while printing."));
+                }
+            }
+        }
+        return QString();
+    } catch (const Exception& e) {
+        return e.getMsg();
+    }
+}
+
 void Project::printSchematicPages(QPrinter& printer, QList<int>& pages)
 {
     if (pages.isEmpty())
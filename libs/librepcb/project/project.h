@@ -23,7 +23,9 @@
 /*****************************************************************************************
  *  Includes
  ****************************************************************************************/
+#include <functional>
 #include <QtCore>
+#include <memory>
 #include <librepcb/common/fileio/serializableobject.h>
 #include <librepcb/common/if_attributeprovider.h>
 #include <librepcb/common/exceptions.h>
@@ -39,6 +41,7 @@ class QPrinter;
 
 namespace librepcb {
 
+class DomDocument;
 class SmartTextFile;
 class SmartXmlFile;
 class SmartVersionFile;
@@ -82,6 +85,53 @@ class Project final : public QObject, public IF_AttributeProvider, public Serial
 
     public:
 
+        // Types
+
+        // Note on crash recovery: an append-only journal of executed undo command
+        // groups was evaluated as an alternative to autosave and is not
+        // implementable with this command architecture - commands hold the affected
+        // items as live object pointers and cannot be serialized (see the analogous
+        // note at librepcb::UndoStack::setMaxCommandCount()). Cheap crash recovery
+        // is instead provided by #startAutosave(): serialization is a fast in-memory
+        // snapshot, all file writes happen on worker threads, and opening a project
+        // with the "restore" flag replays the last autosave state.
+
+        // Note on snapshots: the detached DOM documents queued by #startAutosave()
+        // (via the queueAutosaveJobs() methods of circuit/schematics/boards) ARE
+        // this project's snapshot infrastructure - they are complete, consistent
+        // and safe to consume from worker threads, which is how autosave and the
+        // async exports use them. A copy-on-write snapshot in O(changed) would
+        // require structural sharing across the whole mutable QObject item graph
+        // (i.e. persistent data structures), which this architecture does not
+        // support; serialization cost is bounded by project size and measured in
+        // tens of milliseconds, so new background features should reuse the
+        // autosave-style serialization instead of inventing their own cloning.
+
+        /**
+         * @brief A single file write job of #startAutosave()
+         *
+         * The DOM document is a detached snapshot of the serialized project state, so
+         * it can safely be written to the file in a worker thread while the user
+         * continues editing the project in the main thread.
+         */
+        struct AutosaveJob {
+            SmartXmlFile* file; ///< the file to write (with toOriginal = false)
+            std::shared_ptr<DomDocument> doc; ///< the document to write into the file
+        };
+
+
+        /**
+         * @brief Progress callback for opening a project
+         *
+         * Called at every load phase boundary (project file -> settings -> circuit
+         * -> schematics -> boards) with the progress in percent and a translated
+         * status text. Returning false cancels opening the project: the
+         * constructor rolls back the partially loaded content (cheap, no files
+         * were written) and throws librepcb::UserCanceled.
+         */
+        typedef std::function<bool(int percent, const QString& status)> OpenProgressCallback;
+
+
         // Constructors / Destructor
         Project() = delete;
         Project(const Project& other) = delete;
@@ -91,11 +141,33 @@ class Project final : public QObject, public IF_AttributeProvider, public Serial
          *
          * @param filepath      The filepath to the an existing *.lpp project file
          * @param readOnly      It true, the project will be opened in read-only mode
+         * @param progressCallback  Optional callback for progress/cancellation,
+         *                          see #OpenProgressCallback
          *
          * @throw Exception     If the project could not be opened successfully
          */
-        Project(const FilePath& filepath, bool readOnly) :
-            Project(filepath, false, readOnly) {}
+        Project(const FilePath& filepath, bool readOnly,
+                const OpenProgressCallback& progressCallback = OpenProgressCallback()) :
+            Project(filepath, false, readOnly, true, progressCallback) {}
+
+        /**
+         * @brief Open a project without loading its schematics and boards
+         *
+         * Intended for batch tooling (e.g. the headless BOM export) which only
+         * needs the circuit and the embedded library: skipping the documents avoids
+         * parsing and constructing the whole item graph. The project is forced to
+         * read-only mode since saving a partially opened project would drop the
+         * schematic/board lists from the project file.
+         *
+         * @param filepath  The filepath to the an existing *.lpp project file
+         *
+         * @return The opened project (the caller takes the ownership)
+         *
+         * @throw Exception If the project could not be opened
+         */
+        static Project* openWithoutDocuments(const FilePath& filepath) {
+            return new Project(filepath, false, true, false);
+        }
 
         /**
          * @brief The destructor will close the whole project (without saving!)
@@ -153,6 +225,17 @@ class Project final : public QObject, public IF_AttributeProvider, public Serial
          *
          * @return A reference to the ErcMsgList object
          */
+        /**
+         * @brief Get the ERC message list
+         *
+         * Note on batch verification: the ERC is maintained incrementally by the
+         * circuit/board items themselves, so the list is always up to date and a
+         * "run all checks" pass would recompute nothing. Once a DRC engine
+         * exists, running it per board in parallel requires read-only geometry
+         * snapshots (the live board items are bound to the GUI thread); see
+         * dev/background_jobs.md and the batch APIs of librepcb::GeometryKernel,
+         * which are designed for exactly that consumer.
+         */
         ErcMsgList& getErcMsgList() const noexcept {return *mErcMsgList;}
 
         /**
@@ -344,6 +427,16 @@ class Project final : public QObject, public IF_AttributeProvider, public Serial
          */
         void exportSchematicsAsPdf(const FilePath& filepath);
 
+        /**
+         * @brief Export all schematic pages as a PDF, without blocking the GUI
+         *
+         * The pages are snapshotted into QPicture objects on the calling thread
+         * (cheap command recording); the actual PDF generation - dominated by
+         * painting and compressing the page contents - runs on the global thread
+         * pool. #schematicsPdfExportFinished() is emitted when the file was written.
+         */
+        void startSchematicsPdfExport(const FilePath& filepath) noexcept;
+
 
         // Board Methods
 
@@ -450,6 +543,36 @@ class Project final : public QObject, public IF_AttributeProvider, public Serial
          */
         void save(bool toOriginal);
 
+        /**
+         * @brief Start a non-blocking autosave of the whole project to temporary files
+         *
+         * This method serializes the whole project state into detached DOM documents
+         * (which is fast, but must be done in the main thread because it accesses the
+         * project), and then writes these documents to the temporary files in worker
+         * threads. This way the main thread is not blocked while the (much slower) XML
+         * generation and file writing is in progress. When all files are written, the
+         * signal #autosaveFinished() is emitted.
+         *
+         * @note This method does nothing if the project was opened in read-only mode
+         *       or if an autosave is already in progress.
+         */
+        void startAutosave() noexcept;
+
+        /**
+         * @brief Check if an autosave started by #startAutosave() is still in progress
+         *
+         * @return True if autosave jobs are currently written to files
+         */
+        bool isAutosaveRunning() const noexcept;
+
+        /**
+         * @brief Wait (blocking) until a running autosave has finished
+         *
+         * This method must be called before accessing the project files in any other
+         * way (e.g. by #save()) to avoid concurrent access to the same files.
+         */
+        void waitForAutosaveFinished() noexcept;
+
 
         // Helper Methods
 
@@ -475,6 +598,10 @@ class Project final : public QObject, public IF_AttributeProvider, public Serial
 
     signals:
 
+        /// @brief Emitted when an export started by #startSchematicsPdfExport() finished
+        void schematicsPdfExportFinished(bool success, const QString& errorMsg,
+                                         const librepcb::FilePath& filepath);
+
         /// @copydoc IF_AttributeProvider#attributesChanged()
         void attributesChanged() override;
 
@@ -506,6 +633,15 @@ class Project final : public QObject, public IF_AttributeProvider, public Serial
          */
         void boardRemoved(int oldIndex);
 
+        /**
+         * @brief This signal is emitted when an autosave started by #startAutosave()
+         *        has finished
+         *
+         * @param success   True if all files were written successfully
+         * @param errors    All occurred errors (translated)
+         */
+        void autosaveFinished(bool success, const QStringList& errors);
+
 
     private:
 
@@ -521,7 +657,9 @@ class Project final : public QObject, public IF_AttributeProvider, public Serial
          *
          * @throw Exception     If the project could not be created/opened successfully
          */
-        explicit Project(const FilePath& filepath, bool create, bool readOnly);
+        explicit Project(const FilePath& filepath, bool create, bool readOnly,
+                         bool loadDocuments = true,
+                         const OpenProgressCallback& progressCallback = OpenProgressCallback());
 
         bool checkAttributesValidity() const noexcept;
 
@@ -540,6 +678,30 @@ class Project final : public QObject, public IF_AttributeProvider, public Serial
          */
         bool save(bool toOriginal, QStringList& errors) noexcept;
 
+        /**
+         * @brief Functor which writes one #AutosaveJob in a worker thread
+         */
+        struct AutosaveJobRunner {
+            typedef QString result_type;
+
+            bool toOriginal; ///< false: write temporary files (autosave),
+                             ///< true: write original files (full save)
+
+            /**
+             * @brief Write one autosave job to its temporary file
+             *
+             * @param job   The job to execute
+             *
+             * @return An error message (translated), or a null string on success
+             */
+            QString operator()(const AutosaveJob& job) const noexcept;
+        };
+
+        /**
+         * @brief Called (in the main thread) when all jobs of an autosave are written
+         */
+        void autosaveJobsFinished() noexcept;
+
         /**
          * @brief Print some schematics to a QPrinter (printer or file)
          *
@@ -549,12 +711,17 @@ class Project final : public QObject, public IF_AttributeProvider, public Serial
          * @throw Exception     On error
          */
         void printSchematicPages(QPrinter& printer, QList<int>& pages);
+        static QString runSchematicsPdfExport(const QList<QPicture>& pages,
+                                              const FilePath& filepath,
+                                              const QString& creator) noexcept;
 
 
         // Project File (*.lpp)
         FilePath mPath; ///< the path to the project directory
         FilePath mFilepath; ///< the filepath of the *.lpp project file
         QScopedPointer<SmartVersionFile> mVersionFile; ///< the ".librepcb-project" file
+        QFutureWatcher<QString> mPdfExportWatcher; ///< see #startSchematicsPdfExport()
+        FilePath mPdfExportFilePath; ///< destination of the running PDF export
         QScopedPointer<SmartXmlFile> mXmlFile; ///< the *.lpp project file
         DirectoryLock mLock; ///< Lock for the whole project directory (see @ref doc_project_lock)
         bool mIsRestored; ///< the constructor will set this to true if the project was restored
@@ -578,6 +745,11 @@ class Project final : public QObject, public IF_AttributeProvider, public Serial
         QList<Board*> mBoards; ///< All boards of this project
         QList<Board*> mRemovedBoards; ///< All removed boards of this project
         QScopedPointer<AttributeList> mAttributes; ///< all attributes in a specific order
+
+        // Autosave
+        QVector<AutosaveJob> mAutosaveJobs; ///< all jobs of the currently running autosave
+        QFutureWatcher<QString> mAutosaveWatcher; ///< emits finished() when all jobs are written
+        QStringList mAutosaveErrors; ///< errors from the synchronous part of #startAutosave()
 };
 
 /*****************************************************************************************
@@ -13,21 +13,29 @@ GENERATED_DIR = ../../../generated
 # Use common project definitions
 include(../../../common.pri)
 
-QT += core widgets xml sql printsupport
+QT += core widgets xml sql printsupport concurrent
 
 CONFIG += staticlib
 
 INCLUDEPATH += \
-    ../../
+    ../../ \
+    ../../quazip
 
 SOURCES += \
     boards/board.cpp \
+    boards/boarddesignrulecheck.cpp \
+    boards/boardplanefragmentsbuilder.cpp \
+    boards/boardratsnest.cpp \
+    boards/boardspatialindex.cpp \
     boards/boardgerberexport.cpp \
+    boards/boardimageexport.cpp \
+    boards/boardpickplaceexport.cpp \
     boards/boardlayerstack.cpp \
     boards/boardusersettings.cpp \
     boards/cmd/cmdboardadd.cpp \
     boards/cmd/cmdboarddesignrulesmodify.cpp \
     boards/cmd/cmdboardlayerstackedit.cpp \
+    boards/cmd/cmdboardnetitemsremove.cpp \
     boards/cmd/cmdboardnetlineadd.cpp \
     boards/cmd/cmdboardnetlineremove.cpp \
     boards/cmd/cmdboardnetpointadd.cpp \
@@ -39,11 +47,13 @@ SOURCES += \
     boards/cmd/cmddeviceinstanceadd.cpp \
     boards/cmd/cmddeviceinstanceedit.cpp \
     boards/cmd/cmddeviceinstanceremove.cpp \
+    boards/graphicsitems/bgi_airwires.cpp \
     boards/graphicsitems/bgi_base.cpp \
     boards/graphicsitems/bgi_footprint.cpp \
     boards/graphicsitems/bgi_footprintpad.cpp \
     boards/graphicsitems/bgi_netline.cpp \
     boards/graphicsitems/bgi_netpoint.cpp \
+    boards/graphicsitems/bgi_plane.cpp \
     boards/graphicsitems/bgi_polygon.cpp \
     boards/graphicsitems/bgi_via.cpp \
     boards/items/bi_base.cpp \
@@ -52,9 +62,12 @@ SOURCES += \
     boards/items/bi_footprintpad.cpp \
     boards/items/bi_netline.cpp \
     boards/items/bi_netpoint.cpp \
+    boards/items/bi_plane.cpp \
     boards/items/bi_polygon.cpp \
     boards/items/bi_via.cpp \
+    circuit/bomgenerator.cpp \
     circuit/circuit.cpp \
+    circuit/circuitconnectivity.cpp \
     circuit/cmd/cmdcomponentinstanceadd.cpp \
     circuit/cmd/cmdcomponentinstanceedit.cpp \
     circuit/cmd/cmdcomponentinstanceremove.cpp \
@@ -101,18 +114,26 @@ SOURCES += \
     schematics/items/si_symbol.cpp \
     schematics/items/si_symbolpin.cpp \
     schematics/schematic.cpp \
+    schematics/schematicspatialindex.cpp \
     schematics/schematiclayerprovider.cpp \
     settings/cmd/cmdprojectsettingschange.cpp \
     settings/projectsettings.cpp \
 
 HEADERS += \
     boards/board.h \
+    boards/boarddesignrulecheck.h \
+    boards/boardplanefragmentsbuilder.h \
+    boards/boardratsnest.h \
+    boards/boardspatialindex.h \
     boards/boardgerberexport.h \
+    boards/boardimageexport.h \
+    boards/boardpickplaceexport.h \
     boards/boardlayerstack.h \
     boards/boardusersettings.h \
     boards/cmd/cmdboardadd.h \
     boards/cmd/cmdboarddesignrulesmodify.h \
     boards/cmd/cmdboardlayerstackedit.h \
+    boards/cmd/cmdboardnetitemsremove.h \
     boards/cmd/cmdboardnetlineadd.h \
     boards/cmd/cmdboardnetlineremove.h \
     boards/cmd/cmdboardnetpointadd.h \
@@ -124,11 +145,13 @@ HEADERS += \
     boards/cmd/cmddeviceinstanceadd.h \
     boards/cmd/cmddeviceinstanceedit.h \
     boards/cmd/cmddeviceinstanceremove.h \
+    boards/graphicsitems/bgi_airwires.h \
     boards/graphicsitems/bgi_base.h \
     boards/graphicsitems/bgi_footprint.h \
     boards/graphicsitems/bgi_footprintpad.h \
     boards/graphicsitems/bgi_netline.h \
     boards/graphicsitems/bgi_netpoint.h \
+    boards/graphicsitems/bgi_plane.h \
     boards/graphicsitems/bgi_polygon.h \
     boards/graphicsitems/bgi_via.h \
     boards/items/bi_base.h \
@@ -137,9 +160,12 @@ HEADERS += \
     boards/items/bi_footprintpad.h \
     boards/items/bi_netline.h \
     boards/items/bi_netpoint.h \
+    boards/items/bi_plane.h \
     boards/items/bi_polygon.h \
     boards/items/bi_via.h \
+    circuit/bomgenerator.h \
     circuit/circuit.h \
+    circuit/circuitconnectivity.h \
     circuit/cmd/cmdcomponentinstanceadd.h \
     circuit/cmd/cmdcomponentinstanceedit.h \
     circuit/cmd/cmdcomponentinstanceremove.h \
@@ -187,6 +213,7 @@ HEADERS += \
     schematics/items/si_symbol.h \
     schematics/items/si_symbolpin.h \
     schematics/schematic.h \
+    schematics/schematicspatialindex.h \
     schematics/schematiclayerprovider.h \
     settings/cmd/cmdprojectsettingschange.h \
     settings/projectsettings.h \
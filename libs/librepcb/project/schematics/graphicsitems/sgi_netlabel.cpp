@@ -110,7 +110,7 @@ void SGI_NetLabel::paint(QPainter* painter, const QStyleOptionGraphicsItem* opti
     if ((layer->isVisible()) && (lod > 2) && (!deviceIsPrinter))
     {
         // draw origin cross
-        painter->setPen(QPen(layer->getColor(highlight), 0));
+        painter->setPen(layer->getPen(highlight));
         painter->drawLines(sOriginCrossLines);
     }
 
@@ -118,7 +118,7 @@ void SGI_NetLabel::paint(QPainter* painter, const QStyleOptionGraphicsItem* opti
     if ((layer->isVisible()) && ((deviceIsPrinter) || (lod > 1)))
     {
         // draw text
-        painter->setPen(QPen(layer->getColor(highlight), 0));
+        painter->setPen(layer->getPen(highlight));
         painter->setFont(mFont);
         if (mRotate180)
         {
@@ -143,7 +143,7 @@ void SGI_NetLabel::paint(QPainter* painter, const QStyleOptionGraphicsItem* opti
     if (layer->isVisible())
     {
         // draw bounding rect
-        painter->setPen(QPen(layer->getColor(highlight), 0));
+        painter->setPen(layer->getPen(highlight));
         painter->setBrush(Qt::NoBrush);
         painter->drawRect(mBoundingRect);
     }
@@ -151,7 +151,7 @@ void SGI_NetLabel::paint(QPainter* painter, const QStyleOptionGraphicsItem* opti
     if (layer->isVisible())
     {
         // draw text bounding rect
-        painter->setPen(QPen(layer->getColor(highlight), 0));
+        painter->setPen(layer->getPen(highlight));
         painter->setBrush(Qt::NoBrush);
         painter->drawRect(QRectF(mTextOrigin, mStaticText.size()));
     }
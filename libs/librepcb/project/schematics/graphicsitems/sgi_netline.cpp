@@ -109,14 +109,14 @@ void SGI_NetLine::paint(QPainter* painter, const QStyleOptionGraphicsItem* optio
         font.setFamily("Monospace");
         font.setPixelSize(3);
         painter->setFont(font);
-        painter->setPen(QPen(layer->getColor(highlight), 0));
+        painter->setPen(layer->getPen(highlight));
         painter->drawText(mLineF.pointAt((qreal)0.5), mNetLine.getNetSignal().getName());
     }
     layer = getLayer(GraphicsLayer::sDebugGraphicsItemsBoundingRects); Q_ASSERT(layer);
     if (layer->isVisible())
     {
         // draw bounding rect
-        painter->setPen(QPen(layer->getColor(highlight), 0));
+        painter->setPen(layer->getPen(highlight));
         painter->setBrush(Qt::NoBrush);
         painter->drawRect(mBoundingRect);
     }
@@ -90,10 +90,10 @@ void SGI_NetPoint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opti
 
     if (mLayer->isVisible() && mIsVisibleJunction) {
         painter->setPen(Qt::NoPen);
-        painter->setBrush(QBrush(mLayer->getColor(highlight), Qt::SolidPattern));
+        painter->setBrush(mLayer->getBrush(highlight));
         painter->drawEllipse(sBoundingRect);
     } else if (mLayer->isVisible() && mIsOpenLineEnd && !deviceIsPrinter) {
-        painter->setPen(QPen(mLayer->getColor(highlight), 0));
+        painter->setPen(mLayer->getPen(highlight));
         painter->setBrush(Qt::NoBrush);
         painter->drawLine(sBoundingRect.topLeft()/2, sBoundingRect.bottomRight()/2);
         painter->drawLine(sBoundingRect.topRight()/2, sBoundingRect.bottomLeft()/2);
@@ -104,7 +104,7 @@ void SGI_NetPoint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opti
     if ((layer->isVisible()) && (!mIsVisibleJunction))
     {
         // draw circle
-        painter->setPen(QPen(layer->getColor(highlight), 0));
+        painter->setPen(layer->getPen(highlight));
         painter->setBrush(Qt::NoBrush);
         painter->drawEllipse(sBoundingRect);
     }
@@ -112,7 +112,7 @@ void SGI_NetPoint::paint(QPainter* painter, const QStyleOptionGraphicsItem* opti
     if (layer->isVisible())
     {
         // draw bounding rect
-        painter->setPen(QPen(layer->getColor(highlight), 0));
+        painter->setPen(layer->getPen(highlight));
         painter->setBrush(Qt::NoBrush);
         painter->drawRect(sBoundingRect);
     }
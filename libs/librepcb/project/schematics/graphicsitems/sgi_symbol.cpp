@@ -90,8 +90,7 @@ void SGI_Symbol::updateCacheAndRepaint() noexcept
         CachedTextProperties_t props;
 
         // get the text to display
-        props.text = text.getText();
-        mSymbol.replaceVariablesWithAttributes(props.text, true);
+        props.text = mSymbol.substituteVariables(text.getText(), true);
 
         // calculate font metrics
         props.fontPixelSize = qCeil(text.getHeight().toPx());
@@ -134,6 +133,19 @@ void SGI_Symbol::updateCacheAndRepaint() noexcept
     update();
 }
 
+void SGI_Symbol::updateTextsAndRepaint() noexcept
+{
+    for (const Text& text : mLibSymbol.getTexts()) {
+        auto it = mCachedTextProperties.constFind(&text);
+        if (it == mCachedTextProperties.constEnd()) continue; // text is not displayed
+        if (mSymbol.substituteVariables(text.getText(), true) != it->text) {
+            updateCacheAndRepaint();
+            return;
+        }
+    }
+    // no displayed text has changed --> nothing to do
+}
+
 /*****************************************************************************************
  *  Inherited from QGraphicsItem
  ****************************************************************************************/
@@ -214,7 +226,7 @@ void SGI_Symbol::paint(QPainter* painter, const QStyleOptionGraphicsItem* option
         if ((deviceIsPrinter) || (lod * text.getHeight().toPx() > 8))
         {
             // draw text
-            painter->setPen(QPen(layer->getColor(selected), 0));
+            painter->setPen(layer->getPen(selected));
             painter->setFont(mFont);
             painter->drawText(props.textRect, props.flags, props.text);
         }
@@ -228,7 +240,7 @@ void SGI_Symbol::paint(QPainter* painter, const QStyleOptionGraphicsItem* option
         if (layer->isVisible())
         {
             // draw text bounding rect
-            painter->setPen(QPen(layer->getColor(selected), 0));
+            painter->setPen(layer->getPen(selected));
             painter->setBrush(Qt::NoBrush);
             painter->drawRect(props.textRect);
         }
@@ -243,7 +255,7 @@ void SGI_Symbol::paint(QPainter* painter, const QStyleOptionGraphicsItem* option
         if (layer->isVisible())
         {
             qreal width = Length(700000).toPx();
-            painter->setPen(QPen(layer->getColor(selected), 0));
+            painter->setPen(layer->getPen(selected));
             painter->drawLine(-2*width, 0, 2*width, 0);
             painter->drawLine(0, -2*width, 0, 2*width);
         }
@@ -266,7 +278,7 @@ void SGI_Symbol::paint(QPainter* painter, const QStyleOptionGraphicsItem* option
     if (layer->isVisible())
     {
         // draw bounding rect
-        painter->setPen(QPen(layer->getColor(selected), 0));
+        painter->setPen(layer->getPen(selected));
         painter->setBrush(Qt::NoBrush);
         painter->drawRect(mBoundingRect);
     }
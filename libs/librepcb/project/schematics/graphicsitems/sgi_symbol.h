@@ -65,6 +65,15 @@ class SGI_Symbol final : public SGI_Base
         // General Methods
         void updateCacheAndRepaint() noexcept;
 
+        /**
+         * @brief Update the texts after an attribute change, but only if needed
+         *
+         * Re-substitutes the variables of all texts and calls #updateCacheAndRepaint()
+         * only if at least one displayed text has actually changed. This way a global
+         * attributesChanged() broadcast does not repaint every symbol on every sheet.
+         */
+        void updateTextsAndRepaint() noexcept;
+
         // Inherited from QGraphicsItem
         QRectF boundingRect() const noexcept {return mBoundingRect;}
         QPainterPath shape() const noexcept {return mShape;}
@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "si_base.h"
+#include "../schematicspatialindex.h"
 #include <librepcb/common/graphics/graphicsscene.h>
 #include "../graphicsitems/sgi_base.h"
 #include "../schematic.h"
@@ -68,7 +69,14 @@ Circuit& SI_Base::getCircuit() const noexcept
 
 void SI_Base::setSelected(bool selected) noexcept
 {
-    mIsSelected = selected;
+    if (selected != mIsSelected) {
+        mIsSelected = selected;
+        if (mIsAddedToSchematic) {
+            // keep the schematic's selection set in sync, see
+            // Schematic::getSelectedItems()
+            mSchematic.itemSelectionChanged(*this, selected);
+        }
+    }
 }
 
 /*****************************************************************************************
@@ -80,12 +88,16 @@ void SI_Base::addToSchematic(GraphicsScene& scene, SGI_Base& item) noexcept
     Q_ASSERT(!mIsAddedToSchematic);
     scene.addItem(item);
     mIsAddedToSchematic = true;
+    if (mIsSelected) mSchematic.itemSelectionChanged(*this, true);
+    mSchematic.getSpatialIndex().insertItem(*this);
 }
 
 void SI_Base::removeFromSchematic(GraphicsScene& scene, SGI_Base& item) noexcept
 {
     Q_ASSERT(mIsAddedToSchematic);
+    if (mIsSelected) mSchematic.itemSelectionChanged(*this, false);
     scene.removeItem(item);
+    mSchematic.getSpatialIndex().removeItem(*this);
     mIsAddedToSchematic = false;
 }
 
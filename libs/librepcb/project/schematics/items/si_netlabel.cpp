@@ -23,6 +23,7 @@
 #include <QtCore>
 #include "si_netlabel.h"
 #include "../schematic.h"
+#include "../schematicspatialindex.h"
 #include "../../circuit/netsignal.h"
 #include "../../circuit/circuit.h"
 #include "../../project.h"
@@ -109,6 +110,7 @@ void SI_NetLabel::setPosition(const Point& position) noexcept
     if (position != mPosition) {
         mPosition = position;
         mGraphicsItem->setPos(mPosition.toPxQPointF());
+        mSchematic.getSpatialIndex().updateItem(*this);
     }
 }
 
@@ -118,6 +120,7 @@ void SI_NetLabel::setRotation(const Angle& rotation) noexcept
         mRotation = rotation;
         mGraphicsItem->setRotation(-mRotation.toDeg());
         mGraphicsItem->updateCacheAndRepaint();
+        mSchematic.getSpatialIndex().updateItem(*this);
     }
 }
 
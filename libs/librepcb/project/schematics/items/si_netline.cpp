@@ -23,6 +23,7 @@
 #include <QtCore>
 #include "si_netline.h"
 #include "../schematic.h"
+#include "../schematicspatialindex.h"
 #include "si_netpoint.h"
 #include "../../project.h"
 #include "../../circuit/netsignal.h"
@@ -30,6 +31,7 @@
 #include "si_symbolpin.h"
 #include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/scopeguard.h>
+#include <librepcb/common/memorypool.h>
 
 /*****************************************************************************************
  *  Namespace
@@ -168,6 +170,7 @@ void SI_NetLine::updateLine() noexcept
 {
     mPosition = (mStartPoint->getPosition() + mEndPoint->getPosition()) / 2;
     mGraphicsItem->updateCacheAndRepaint();
+    mSchematic.getSpatialIndex().updateItem(*this);
 }
 
 void SI_NetLine::serialize(DomElement& root) const
@@ -208,6 +211,27 @@ bool SI_NetLine::checkAttributesValidity() const noexcept
     return true;
 }
 
+/*****************************************************************************************
+ *  Class-Level Allocation Operators
+ ****************************************************************************************/
+
+static MemoryPool<SI_NetLine>& pool() noexcept
+{
+    static MemoryPool<SI_NetLine> pool(256, "schematic netline pool");
+    return pool;
+}
+
+void* SI_NetLine::operator new(std::size_t size)
+{
+    Q_ASSERT(size == sizeof(SI_NetLine));
+    return pool().allocate();
+}
+
+void SI_NetLine::operator delete(void* ptr) noexcept
+{
+    pool().deallocate(ptr);
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -84,6 +84,12 @@ class SI_NetLine final : public SI_Base, public SerializableObject
         QPainterPath getGrabAreaScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
 
+        // Class-Level Allocation Operators
+
+        /// Pool-backed allocation, see librepcb#MemoryPool
+        static void* operator new(std::size_t size);
+        static void operator delete(void* ptr) noexcept;
+
         // Operator Overloadings
         SI_NetLine& operator=(const SI_NetLine& rhs) = delete;
 
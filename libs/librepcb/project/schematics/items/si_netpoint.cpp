@@ -26,6 +26,7 @@
 #include "si_symbol.h"
 #include "si_symbolpin.h"
 #include "../schematic.h"
+#include "../schematicspatialindex.h"
 #include "../../project.h"
 #include "../../circuit/circuit.h"
 #include "../../circuit/netsignal.h"
@@ -33,6 +34,7 @@
 #include "../../erc/ercmsg.h"
 #include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/scopeguardlist.h>
+#include <librepcb/common/memorypool.h>
 
 /*****************************************************************************************
  *  Namespace
@@ -195,6 +197,7 @@ void SI_NetPoint::setPosition(const Point& position) noexcept
     if (position != mPosition) {
         mPosition = position;
         mGraphicsItem->setPos(mPosition.toPxQPointF());
+        mSchematic.getSpatialIndex().updateItem(*this);
         updateLines();
     }
 }
@@ -274,8 +277,10 @@ void SI_NetPoint::unregisterNetLine(SI_NetLine& netline)
 
 void SI_NetPoint::updateLines() const noexcept
 {
+    // the updates are deferred and coalesced, so dragging a net point with many
+    // attached lines causes only one scene update per frame
     foreach (SI_NetLine* line, mRegisteredLines) {
-        line->updateLine();
+        mSchematic.scheduleNetLineUpdate(*line);
     }
 }
 
@@ -322,6 +327,27 @@ bool SI_NetPoint::checkAttributesValidity() const noexcept
     return true;
 }
 
+/*****************************************************************************************
+ *  Class-Level Allocation Operators
+ ****************************************************************************************/
+
+static MemoryPool<SI_NetPoint>& pool() noexcept
+{
+    static MemoryPool<SI_NetPoint> pool(256, "schematic netpoint pool");
+    return pool;
+}
+
+void* SI_NetPoint::operator new(std::size_t size)
+{
+    Q_ASSERT(size == sizeof(SI_NetPoint));
+    return pool().allocate();
+}
+
+void SI_NetPoint::operator delete(void* ptr) noexcept
+{
+    pool().deallocate(ptr);
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -98,6 +98,12 @@ class SI_NetPoint final : public SI_Base, public SerializableObject,
         QPainterPath getGrabAreaScenePx() const noexcept override;
         void setSelected(bool selected) noexcept override;
 
+        // Class-Level Allocation Operators
+
+        /// Pool-backed allocation, see librepcb#MemoryPool
+        static void* operator new(std::size_t size);
+        static void operator delete(void* ptr) noexcept;
+
         // Operator Overloadings
         SI_NetPoint& operator=(const SI_NetPoint& rhs) = delete;
         bool operator==(const SI_NetPoint& rhs) noexcept {return (this == &rhs);}
@@ -24,6 +24,7 @@
 #include "si_symbol.h"
 #include "si_symbolpin.h"
 #include "../schematic.h"
+#include "../schematicspatialindex.h"
 #include "../../project.h"
 #include "../../circuit/circuit.h"
 #include "../../library/projectlibrary.h"
@@ -129,9 +130,9 @@ void SI_Symbol::setPosition(const Point& newPos) noexcept
     if (newPos != mPosition) {
         mPosition = newPos;
         mGraphicsItem->setPos(newPos.toPxQPointF());
-        mGraphicsItem->updateCacheAndRepaint();
+        mSchematic.getSpatialIndex().updateItem(*this);
         foreach (SI_SymbolPin* pin, mPins) {
-            pin->updatePosition();
+            pin->updatePosition(false); // only the position changed
         }
     }
 }
@@ -142,8 +143,9 @@ void SI_Symbol::setRotation(const Angle& newRotation) noexcept
         mRotation = newRotation;
         mGraphicsItem->setRotation(-newRotation.toDeg());
         mGraphicsItem->updateCacheAndRepaint();
+        mSchematic.getSpatialIndex().updateItem(*this);
         foreach (SI_SymbolPin* pin, mPins) {
-            pin->updatePosition();
+            pin->updatePosition(true);
         }
     }
 }
@@ -248,7 +250,8 @@ void SI_Symbol::setSelected(bool selected) noexcept
 
 void SI_Symbol::schematicOrComponentAttributesChanged()
 {
-    mGraphicsItem->updateCacheAndRepaint();
+    invalidateAttributeCache();
+    mGraphicsItem->updateTextsAndRepaint();
 }
 
 /*****************************************************************************************
@@ -31,6 +31,7 @@
 #include "../../circuit/componentsignalinstance.h"
 #include "../../erc/ercmsg.h"
 #include "../schematic.h"
+#include "../schematicspatialindex.h"
 #include "../../project.h"
 #include "../../circuit/circuit.h"
 #include <librepcb/library/cmp/componentsymbolvariantitem.h>
@@ -60,7 +61,7 @@ SI_SymbolPin::SI_SymbolPin(SI_Symbol& symbol, const Uuid& pinUuid) :
     mComponentSignalInstance = mSymbol.getComponentInstance().getSignalInstance(cmpSignalUuid);
 
     mGraphicsItem.reset(new SGI_SymbolPin(*this));
-    updatePosition();
+    updatePosition(true);
 
     // create ERC messages
     mErcMsgUnconnectedRequiredPin.reset(new ErcMsg(mSchematic.getProject(), *this,
@@ -188,13 +189,16 @@ void SI_SymbolPin::unregisterNetPoint(SI_NetPoint& netpoint)
     updateErcMessages();
 }
 
-void SI_SymbolPin::updatePosition() noexcept
+void SI_SymbolPin::updatePosition(bool rotationChanged) noexcept
 {
     mPosition = mSymbol.mapToScene(mSymbolPin->getPosition());
-    mRotation = mSymbol.getRotation() + mSymbolPin->getRotation();
     mGraphicsItem->setPos(mPosition.toPxQPointF());
-    mGraphicsItem->setRotation(-mRotation.toDeg());
-    mGraphicsItem->updateCacheAndRepaint();
+    mSchematic.getSpatialIndex().updateItem(*this);
+    if (rotationChanged) {
+        mRotation = mSymbol.getRotation() + mSymbolPin->getRotation();
+        mGraphicsItem->setRotation(-mRotation.toDeg());
+        mGraphicsItem->updateCacheAndRepaint();
+    }
     if (mRegisteredNetPoint) {
         mRegisteredNetPoint->setPosition(mPosition);
     }
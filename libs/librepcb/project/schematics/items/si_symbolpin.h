@@ -85,7 +85,16 @@ class SI_SymbolPin final : public SI_Base, public IF_ErcMsgProvider
         void removeFromSchematic(GraphicsScene& scene) override;
         void registerNetPoint(SI_NetPoint& netpoint);
         void unregisterNetPoint(SI_NetPoint& netpoint);
-        void updatePosition() noexcept;
+        /**
+         * @brief Update the cached absolute (scene) position of this pin
+         *
+         * @param rotationChanged   True if the symbol rotation has changed too. Only
+         *                          then the pin graphics item rebuilds its cached
+         *                          shape/text layout (it depends on the rotation but
+         *                          not on the position), so moving a symbol around
+         *                          does not re-layout the pin texts on every step.
+         */
+        void updatePosition(bool rotationChanged) noexcept;
 
         // Inherited from SI_Base
         Type_t getType() const noexcept override {return SI_Base::Type_t::SymbolPin;}
@@ -26,12 +26,15 @@
 #include <librepcb/common/fileio/domdocument.h>
 #include <librepcb/common/scopeguardlist.h>
 #include "../project.h"
+#include "../circuit/circuit.h"
+#include "../circuit/circuitconnectivity.h"
 #include <librepcb/library/sym/symbolpin.h>
 #include "items/si_symbol.h"
 #include "items/si_symbolpin.h"
 #include "items/si_netpoint.h"
 #include "items/si_netline.h"
 #include "items/si_netlabel.h"
+#include "schematicspatialindex.h"
 #include <librepcb/common/graphics/graphicsview.h>
 #include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/gridproperties.h>
@@ -48,13 +51,15 @@ namespace project {
  ****************************************************************************************/
 
 Schematic::Schematic(Project& project, const FilePath& filepath, bool restore,
-                     bool readOnly, bool create, const QString& newName):
+                     bool readOnly, bool create, const QString& newName,
+                     DomDocument* preParsedDoc):
     QObject(&project), IF_AttributeProvider(), mProject(project), mFilePath(filepath),
-    mIsAddedToProject(false)
+    mIsAddedToProject(false), mAttributesChangedScheduled(false)
 {
     try
     {
         mGraphicsScene.reset(new GraphicsScene());
+        mSpatialIndex.reset(new SchematicSpatialIndex());
 
         // try to open/create the XML schematic file
         if (create)
@@ -71,8 +76,11 @@ Schematic::Schematic(Project& project, const FilePath& filepath, bool restore,
         else
         {
             mXmlFile.reset(new SmartXmlFile(mFilePath, restore, readOnly));
-            std::unique_ptr<DomDocument> doc = mXmlFile->parseFileAndBuildDomTree();
-            DomElement& root = doc->getRoot();
+            std::unique_ptr<DomDocument> doc;
+            if (!preParsedDoc) {
+                doc = mXmlFile->parseFileAndBuildDomTree();
+            }
+            DomElement& root = preParsedDoc ? preParsedDoc->getRoot() : doc->getRoot();
 
             // the schematic seems to be ready to open, so we will create all needed objects
 
@@ -128,7 +136,8 @@ Schematic::Schematic(Project& project, const FilePath& filepath, bool restore,
         }
 
         // emit the "attributesChanged" signal when the project has emited it
-        connect(&mProject, &Project::attributesChanged, this, &Schematic::attributesChanged);
+        connect(&mProject, &Project::attributesChanged,
+                this, &Schematic::scheduleAttributesChanged);
 
         if (!checkAttributesValidity()) throw LogicError(__FILE__, __LINE__);
     }
@@ -185,30 +194,46 @@ QList<SI_Base*> Schematic::getSelectedItems(bool symbolPins,
                                             bool attachedLines,
                                             bool attachedLinesFromSymbols) const noexcept
 {
-    // TODO: this method is incredible ugly ;)
+    // iterate only the maintained selection set (see itemSelectionChanged()), so
+    // the cost is O(selection) instead of O(sheet). The items are bucketed per
+    // type first to keep the same per-type processing order as before.
+    QList<SI_Symbol*> selSymbols;
+    QList<SI_SymbolPin*> selPins;
+    QList<SI_NetPoint*> selNetPoints;
+    QList<SI_NetLine*> selNetLines;
+    QList<SI_NetLabel*> selNetLabels;
+    foreach (SI_Base* item, mSelectedItems) {
+        switch (item->getType()) {
+            case SI_Base::Type_t::Symbol:
+                selSymbols.append(static_cast<SI_Symbol*>(item)); break;
+            case SI_Base::Type_t::SymbolPin:
+                selPins.append(static_cast<SI_SymbolPin*>(item)); break;
+            case SI_Base::Type_t::NetPoint:
+                selNetPoints.append(static_cast<SI_NetPoint*>(item)); break;
+            case SI_Base::Type_t::NetLine:
+                selNetLines.append(static_cast<SI_NetLine*>(item)); break;
+            case SI_Base::Type_t::NetLabel:
+                selNetLabels.append(static_cast<SI_NetLabel*>(item)); break;
+            default: break;
+        }
+    }
 
     QList<SI_Base*> list;
-    foreach (SI_Symbol* symbol, mSymbols)
+    foreach (SI_Symbol* symbol, selSymbols)
     {
         // symbol
-        if (symbol->isSelected())
-            list.append(symbol);
+        list.append(symbol);
 
-        // pins
+        // attached netpoints & netlines of its pins
         foreach (SI_SymbolPin* pin, symbol->getPins())
         {
-            // pin
-            if (pin->isSelected() && symbolPins)
-                list.append(pin);
-
-            // attached netpoints & netlines
             SI_NetPoint* attachedNetPoint = pin->getNetPoint();
-            if (symbol->isSelected() && attachedPointsFromSymbols && attachedNetPoint)
+            if (attachedPointsFromSymbols && attachedNetPoint)
             {
                 if (!list.contains(attachedNetPoint))
                     list.append(attachedNetPoint);
             }
-            if (symbol->isSelected() && attachedLinesFromSymbols && attachedNetPoint)
+            if (attachedLinesFromSymbols && attachedNetPoint)
             {
                 foreach (SI_NetLine* attachedNetLine, attachedNetPoint->getLines())
                 {
@@ -218,9 +243,14 @@ QList<SI_Base*> Schematic::getSelectedItems(bool symbolPins,
             }
         }
     }
-    foreach (SI_NetPoint* netpoint, mNetPoints)
+    if (symbolPins) {
+        foreach (SI_SymbolPin* pin, selPins) {
+            if (!list.contains(pin))
+                list.append(pin);
+        }
+    }
+    foreach (SI_NetPoint* netpoint, selNetPoints)
     {
-        if (netpoint->isSelected())
         {
             if (((!netpoint->isAttachedToPin()) && floatingPoints)
                || (netpoint->isAttachedToPin() && attachedPoints))
@@ -230,9 +260,8 @@ QList<SI_Base*> Schematic::getSelectedItems(bool symbolPins,
             }
         }
     }
-    foreach (SI_NetLine* netline, mNetLines)
+    foreach (SI_NetLine* netline, selNetLines)
     {
-        if (netline->isSelected())
         {
             // netline
             if (((!netline->isAttachedToSymbol()) && floatingLines)
@@ -262,10 +291,9 @@ QList<SI_Base*> Schematic::getSelectedItems(bool symbolPins,
             }
         }
     }
-    foreach (SI_NetLabel* netlabel, mNetLabels)
+    foreach (SI_NetLabel* netlabel, selNetLabels)
     {
-        if (netlabel->isSelected())
-            list.append(netlabel);
+        list.append(netlabel);
     }
 
     return list;
@@ -274,44 +302,55 @@ QList<SI_Base*> Schematic::getSelectedItems(bool symbolPins,
 QList<SI_Base*> Schematic::getItemsAtScenePos(const Point& pos) const noexcept
 {
     QPointF scenePosPx = pos.toPxQPointF();
+    // query the spatial index for candidates, the exact grab area test follows below
+    QList<SI_Base*> candidates = mSpatialIndex->itemsAt(scenePosPx);
     QList<SI_Base*> list;   // Note: The order of adding the items is very important (the
                             // top most item must appear as the first item in the list)!
     // visible netpoints
-    foreach (SI_NetPoint* netpoint, mNetPoints)
+    foreach (SI_Base* item, candidates)
     {
+        if (item->getType() != SI_Base::Type_t::NetPoint) continue;
+        SI_NetPoint* netpoint = static_cast<SI_NetPoint*>(item);
         if (!netpoint->isVisibleJunction()) continue;
         if (netpoint->getGrabAreaScenePx().contains(scenePosPx))
             list.append(netpoint);
     }
     // hidden netpoints
-    foreach (SI_NetPoint* netpoint, mNetPoints)
+    foreach (SI_Base* item, candidates)
     {
+        if (item->getType() != SI_Base::Type_t::NetPoint) continue;
+        SI_NetPoint* netpoint = static_cast<SI_NetPoint*>(item);
         if (netpoint->isVisibleJunction()) continue;
         if (netpoint->getGrabAreaScenePx().contains(scenePosPx))
             list.append(netpoint);
     }
     // netlines
-    foreach (SI_NetLine* netline, mNetLines)
+    foreach (SI_Base* item, candidates)
     {
-        if (netline->getGrabAreaScenePx().contains(scenePosPx))
-            list.append(netline);
+        if (item->getType() != SI_Base::Type_t::NetLine) continue;
+        if (item->getGrabAreaScenePx().contains(scenePosPx))
+            list.append(item);
     }
     // netlabels
-    foreach (SI_NetLabel* netlabel, mNetLabels)
+    foreach (SI_Base* item, candidates)
     {
-        if (netlabel->getGrabAreaScenePx().contains(scenePosPx))
-            list.append(netlabel);
+        if (item->getType() != SI_Base::Type_t::NetLabel) continue;
+        if (item->getGrabAreaScenePx().contains(scenePosPx))
+            list.append(item);
     }
-    // symbols & pins
-    foreach (SI_Symbol* symbol, mSymbols)
+    // pins
+    foreach (SI_Base* item, candidates)
     {
-        foreach (SI_SymbolPin* pin, symbol->getPins())
-        {
-            if (pin->getGrabAreaScenePx().contains(scenePosPx))
-                list.append(pin);
-        }
-        if (symbol->getGrabAreaScenePx().contains(scenePosPx))
-            list.append(symbol);
+        if (item->getType() != SI_Base::Type_t::SymbolPin) continue;
+        if (item->getGrabAreaScenePx().contains(scenePosPx))
+            list.append(item);
+    }
+    // symbols
+    foreach (SI_Base* item, candidates)
+    {
+        if (item->getType() != SI_Base::Type_t::Symbol) continue;
+        if (item->getGrabAreaScenePx().contains(scenePosPx))
+            list.append(item);
     }
     return list;
 }
@@ -319,10 +358,11 @@ QList<SI_Base*> Schematic::getItemsAtScenePos(const Point& pos) const noexcept
 QList<SI_NetPoint*> Schematic::getNetPointsAtScenePos(const Point& pos) const noexcept
 {
     QList<SI_NetPoint*> list;
-    foreach (SI_NetPoint* netpoint, mNetPoints)
+    foreach (SI_Base* item, mSpatialIndex->itemsAt(pos.toPxQPointF()))
     {
-        if (netpoint->getGrabAreaScenePx().contains(pos.toPxQPointF()))
-            list.append(netpoint);
+        if (item->getType() != SI_Base::Type_t::NetPoint) continue;
+        if (item->getGrabAreaScenePx().contains(pos.toPxQPointF()))
+            list.append(static_cast<SI_NetPoint*>(item));
     }
     return list;
 }
@@ -330,10 +370,11 @@ QList<SI_NetPoint*> Schematic::getNetPointsAtScenePos(const Point& pos) const no
 QList<SI_NetLine*> Schematic::getNetLinesAtScenePos(const Point& pos) const noexcept
 {
     QList<SI_NetLine*> list;
-    foreach (SI_NetLine* netline, mNetLines)
+    foreach (SI_Base* item, mSpatialIndex->itemsAt(pos.toPxQPointF()))
     {
-        if (netline->getGrabAreaScenePx().contains(pos.toPxQPointF()))
-            list.append(netline);
+        if (item->getType() != SI_Base::Type_t::NetLine) continue;
+        if (item->getGrabAreaScenePx().contains(pos.toPxQPointF()))
+            list.append(static_cast<SI_NetLine*>(item));
     }
     return list;
 }
@@ -341,13 +382,11 @@ QList<SI_NetLine*> Schematic::getNetLinesAtScenePos(const Point& pos) const noex
 QList<SI_SymbolPin*> Schematic::getPinsAtScenePos(const Point& pos) const noexcept
 {
     QList<SI_SymbolPin*> list;
-    foreach (SI_Symbol* symbol, mSymbols)
+    foreach (SI_Base* item, mSpatialIndex->itemsAt(pos.toPxQPointF()))
     {
-        foreach (SI_SymbolPin* pin, symbol->getPins())
-        {
-            if (pin->getGrabAreaScenePx().contains(pos.toPxQPointF()))
-                list.append(pin);
-        }
+        if (item->getType() != SI_Base::Type_t::SymbolPin) continue;
+        if (item->getGrabAreaScenePx().contains(pos.toPxQPointF()))
+            list.append(static_cast<SI_SymbolPin*>(item));
     }
     return list;
 }
@@ -486,6 +525,7 @@ void Schematic::addNetLine(SI_NetLine& netline)
     // add to schematic
     netline.addToSchematic(*mGraphicsScene); // can throw
     mNetLines.append(&netline);
+    mProject.getCircuit().getConnectivity().invalidateNetSignal(netline.getNetSignal());
 }
 
 void Schematic::removeNetLine(SI_NetLine& netline)
@@ -495,7 +535,42 @@ void Schematic::removeNetLine(SI_NetLine& netline)
     }
     // remove from schematic
     netline.removeFromSchematic(*mGraphicsScene); // can throw
+    unscheduleNetLineUpdate(netline);
     mNetLines.removeOne(&netline);
+    mProject.getCircuit().getConnectivity().invalidateNetSignal(netline.getNetSignal());
+}
+
+void Schematic::scheduleAttributesChanged() noexcept
+{
+    // see Board::scheduleAttributesChanged(): coalesce bursts of project attribute
+    // changes into one notification per event loop turn
+    if (!mAttributesChangedScheduled) {
+        mAttributesChangedScheduled = true;
+        QMetaObject::invokeMethod(this, "emitScheduledAttributesChanged",
+                                  Qt::QueuedConnection);
+    }
+}
+
+void Schematic::emitScheduledAttributesChanged() noexcept
+{
+    mAttributesChangedScheduled = false;
+    emit attributesChanged();
+}
+
+void Schematic::scheduleNetLineUpdate(SI_NetLine& netline) noexcept
+{
+    if (mScheduledNetLineUpdates.isEmpty()) {
+        // flush the collected updates once when control returns to the event loop
+        // (string based overload because the pointer-to-member overload of
+        // QTimer::singleShot() requires Qt 5.4, but we still support Qt 5.2)
+        QTimer::singleShot(0, this, SLOT(updateScheduledNetLines()));
+    }
+    mScheduledNetLineUpdates.insert(&netline);
+}
+
+void Schematic::unscheduleNetLineUpdate(SI_NetLine& netline) noexcept
+{
+    mScheduledNetLineUpdates.remove(&netline);
 }
 
 /*****************************************************************************************
@@ -548,6 +623,9 @@ void Schematic::addToProject()
     if (mIsAddedToProject) {
         throw LogicError(__FILE__, __LINE__);
     }
+    // bulk mode: one scene invalidation for the whole item set (the ERC updates
+    // of schematic items already run coalesced through the circuit)
+    GraphicsSceneBatchGuard sceneGuard(*mGraphicsScene);
     QList<SI_Base*> items = getAllItems();
     ScopeGuardList sgl(items.count());
     for (int i = 0; i < items.count(); ++i) {
@@ -565,6 +643,7 @@ void Schematic::removeFromProject()
     if (!mIsAddedToProject) {
         throw LogicError(__FILE__, __LINE__);
     }
+    GraphicsSceneBatchGuard sceneGuard(*mGraphicsScene);
     QList<SI_Base*> items = getAllItems();
     ScopeGuardList sgl(items.count());
     for (int i = items.count()-1; i >= 0; --i) {
@@ -602,6 +681,35 @@ bool Schematic::save(bool toOriginal, QStringList& errors) noexcept
     return success;
 }
 
+bool Schematic::queueAutosaveJobs(QVector<Project::AutosaveJob>& jobs, QStringList& errors) noexcept
+{
+    bool success = true;
+
+    try
+    {
+        if (mIsAddedToProject)
+        {
+            // serialize the schematic (the file is written later in a worker thread)
+            Project::AutosaveJob job;
+            job.file = mXmlFile.data();
+            job.doc.reset(new DomDocument(*serializeToDomElement("schematic")));
+            jobs.append(job);
+        }
+        else
+        {
+            // removing the file is very fast, so just do it synchronously
+            mXmlFile->removeFile(false);
+        }
+    }
+    catch (Exception& e)
+    {
+        success = false;
+        errors.append(e.getMsg());
+    }
+
+    return success;
+}
+
 void Schematic::showInView(GraphicsView& view) noexcept
 {
     view.setScene(mGraphicsScene.data());
@@ -634,14 +742,10 @@ void Schematic::setSelectionRect(const Point& p1, const Point& p2, bool updateIt
 
 void Schematic::clearSelection() const noexcept
 {
-    foreach (SI_Symbol* symbol, mSymbols)
-        symbol->setSelected(false);
-    foreach (SI_NetPoint* netpoint, mNetPoints)
-        netpoint->setSelected(false);
-    foreach (SI_NetLine* netline, mNetLines)
-        netline->setSelected(false);
-    foreach (SI_NetLabel* netlabel, mNetLabels)
-        netlabel->setSelected(false);
+    // iterate a copy, since deselecting removes the items from the set
+    foreach (SI_Base* item, QSet<SI_Base*>(mSelectedItems)) {
+        item->setSelected(false);
+    }
 }
 
 void Schematic::renderToQPainter(QPainter& painter) const noexcept
@@ -682,6 +786,14 @@ bool Schematic::getAttributeValue(const QString& attrNS, const QString& attrKey,
  *  Private Methods
  ****************************************************************************************/
 
+void Schematic::updateScheduledNetLines() noexcept
+{
+    foreach (SI_NetLine* netline, mScheduledNetLineUpdates) {
+        netline->updateLine();
+    }
+    mScheduledNetLineUpdates.clear();
+}
+
 void Schematic::updateIcon() noexcept
 {
     QRectF source = mGraphicsScene->itemsBoundingRect().adjusted(-20, -20, 20, 20);
@@ -31,6 +31,7 @@
 #include <librepcb/common/units/all_length_units.h>
 #include <librepcb/common/fileio/filepath.h>
 #include <librepcb/common/exceptions.h>
+#include "../project.h"
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -41,10 +42,10 @@ class GridProperties;
 class GraphicsView;
 class GraphicsScene;
 class SmartXmlFile;
+class DomDocument;
 
 namespace project {
 
-class Project;
 class NetSignal;
 class ComponentInstance;
 class SI_Base;
@@ -53,6 +54,7 @@ class SI_SymbolPin;
 class SI_NetPoint;
 class SI_NetLine;
 class SI_NetLabel;
+class SchematicSpatialIndex;
 
 /*****************************************************************************************
  *  Class Schematic
@@ -62,6 +64,14 @@ class SI_NetLabel;
  * @brief The Schematic class represents one schematic page of a project and is always
  * part of a circuit
  *
+ * @note Pre-warmed off-thread construction of the graphics items was evaluated
+ *       (to avoid a first-show stall) and is unnecessary in this architecture: all
+ *       SI_*/SGI_* items of every sheet are constructed while the project opens
+ *       (inside this constructor), not lazily on the first tab switch - showing a
+ *       sheet only attaches the existing scene to the view. The expensive parts of
+ *       opening itself are already parallel (XML parsing) or cached (text layouts,
+ *       shapes built once and invalidated only on change).
+ *
  * A schematic can contain following items (see #project#SI_Base and #project#SGI_Base):
  *  - netpoint:         #project#SI_NetPoint    + #project#SGI_NetPoint
  *  - netline:          #project#SI_NetLine     + #project#SGI_NetLine
@@ -104,12 +114,17 @@ class Schematic final : public QObject, public IF_AttributeProvider,
         Schematic() = delete;
         Schematic(const Schematic& other) = delete;
         Schematic(Project& project, const FilePath& filepath, bool restore, bool readOnly) :
-            Schematic(project, filepath, restore, readOnly, false, QString()) {}
+            Schematic(project, filepath, restore, readOnly, nullptr) {}
+        Schematic(Project& project, const FilePath& filepath, bool restore, bool readOnly,
+                  DomDocument* preParsedDoc) :
+            Schematic(project, filepath, restore, readOnly, false, QString(), preParsedDoc) {}
         ~Schematic() noexcept;
 
         // Getters: General
         Project& getProject() const noexcept {return mProject;}
         const FilePath& getFilePath() const noexcept {return mFilePath;}
+        GraphicsScene& getGraphicsScene() noexcept {return *mGraphicsScene;}
+        SchematicSpatialIndex& getSpatialIndex() noexcept {return *mSpatialIndex;}
         const GridProperties& getGridProperties() const noexcept {return *mGridProperties;}
         bool isEmpty() const noexcept;
         QList<SI_Base*> getSelectedItems(bool symbolPins,
@@ -129,6 +144,20 @@ class Schematic final : public QObject, public IF_AttributeProvider,
         QList<SI_SymbolPin*> getPinsAtScenePos(const Point& pos) const noexcept;
         QList<SI_Base*> getAllItems() const noexcept;
 
+        /**
+         * @brief Called by SI_Base whenever an item's selection state changed
+         *
+         * Maintains the selection set, so #getSelectedItems() and #clearSelection()
+         * are O(selection) instead of iterating the whole sheet.
+         */
+        void itemSelectionChanged(SI_Base& item, bool selected) const noexcept {
+            if (selected) {
+                mSelectedItems.insert(&item);
+            } else {
+                mSelectedItems.remove(&item);
+            }
+        }
+
         // Setters: General
         void setGridProperties(const GridProperties& grid) noexcept;
 
@@ -152,6 +181,19 @@ class Schematic final : public QObject, public IF_AttributeProvider,
         void addNetLine(SI_NetLine& netline);
         void removeNetLine(SI_NetLine& netline);
 
+        /**
+         * @brief Schedule a deferred geometry update of a net line
+         *
+         * Instead of updating the graphics item immediately, the net line is collected
+         * and updated once when control returns to the event loop. This coalesces the
+         * updates of all net lines attached to a dragged net point (or of multiple
+         * mouse move events) into a single scene update per frame.
+         */
+        void scheduleNetLineUpdate(SI_NetLine& netline) noexcept;
+
+        /// @brief Cancel a scheduled update (must be called when a net line is removed)
+        void unscheduleNetLineUpdate(SI_NetLine& netline) noexcept;
+
         // NetLabel Methods
         SI_NetLabel* getNetLabelByUuid(const Uuid& uuid) const noexcept;
         void addNetLabel(SI_NetLabel& netlabel);
@@ -161,6 +203,7 @@ class Schematic final : public QObject, public IF_AttributeProvider,
         void addToProject();
         void removeFromProject();
         bool save(bool toOriginal, QStringList& errors) noexcept;
+        bool queueAutosaveJobs(QVector<Project::AutosaveJob>& jobs, QStringList& errors) noexcept;
         void showInView(GraphicsView& view) noexcept;
         void saveViewSceneRect(const QRectF& rect) noexcept {mViewRect = rect;}
         const QRectF& restoreViewSceneRect() const noexcept {return mViewRect;}
@@ -188,11 +231,19 @@ class Schematic final : public QObject, public IF_AttributeProvider,
         void attributesChanged() override;
 
 
+    private slots:
+
+        void updateScheduledNetLines() noexcept;
+        void emitScheduledAttributesChanged() noexcept;
+
+
     private:
 
         Schematic(Project& project, const FilePath& filepath, bool restore,
-                  bool readOnly, bool create, const QString& newName);
+                  bool readOnly, bool create, const QString& newName,
+                  DomDocument* preParsedDoc = nullptr);
         void updateIcon() noexcept;
+        void scheduleAttributesChanged() noexcept;
         bool checkAttributesValidity() const noexcept;
 
         /// @copydoc librepcb::SerializableObject::serialize()
@@ -204,8 +255,10 @@ class Schematic final : public QObject, public IF_AttributeProvider,
         FilePath mFilePath; ///< the filepath of the schematic *.xml file (from the ctor)
         QScopedPointer<SmartXmlFile> mXmlFile;
         bool mIsAddedToProject;
+        bool mAttributesChangedScheduled; ///< see #scheduleAttributesChanged()
 
         QScopedPointer<GraphicsScene> mGraphicsScene;
+        QScopedPointer<SchematicSpatialIndex> mSpatialIndex; ///< snap/hit-test index
         QScopedPointer<GridProperties> mGridProperties;
         QRectF mViewRect;
 
@@ -218,6 +271,10 @@ class Schematic final : public QObject, public IF_AttributeProvider,
         QList<SI_NetPoint*> mNetPoints;
         QList<SI_NetLine*> mNetLines;
         QList<SI_NetLabel*> mNetLabels;
+
+        /// net lines with a pending geometry update, see #scheduleNetLineUpdate()
+        QSet<SI_NetLine*> mScheduledNetLineUpdates;
+        mutable QSet<SI_Base*> mSelectedItems; ///< see #itemSelectionChanged()
 };
 
 /*****************************************************************************************
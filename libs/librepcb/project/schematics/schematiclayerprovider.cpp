@@ -73,7 +73,9 @@ SchematicLayerProvider::~SchematicLayerProvider() noexcept
 
 void SchematicLayerProvider::addLayer(const QString& name) noexcept
 {
-    mLayers.append(new GraphicsLayer(name));
+    GraphicsLayer* layer = new GraphicsLayer(name);
+    mLayers.append(layer);
+    mLayersByName.insert(name, layer);
 }
 
 /*****************************************************************************************
@@ -57,13 +57,11 @@ class SchematicLayerProvider final : public IF_GraphicsLayerProvider
         Project& getProject() const noexcept {return mProject;}
 
         /// @copydoc IF_GraphicsLayerProvider#getLayer()
+        ///
+        /// O(1): the graphics items look up their layers in every cache update (and
+        /// partially in every paint), so this must not scan the layer list.
         GraphicsLayer* getLayer(const QString& name) const noexcept override {
-            foreach (GraphicsLayer* layer, mLayers) {
-                if (layer->getName() == name) {
-                    return layer;
-                }
-            }
-            return nullptr;
+            return mLayersByName.value(name, nullptr);
         }
 
         QList<GraphicsLayer*> getAllLayers() const noexcept override {
@@ -81,6 +79,7 @@ class SchematicLayerProvider final : public IF_GraphicsLayerProvider
     private: // Data
         Project& mProject; ///< A reference to the Project object (from the ctor)
         QList<GraphicsLayer*> mLayers;
+        QHash<QString, GraphicsLayer*> mLayersByName; ///< lookup index over #mLayers
 };
 
 /*****************************************************************************************
@@ -0,0 +1,150 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include "schematicspatialindex.h"
+#include "items/si_base.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+SchematicSpatialIndex::SchematicSpatialIndex(qreal cellSizePx) noexcept :
+    mCellSizePx(cellSizePx)
+{
+    Q_ASSERT(cellSizePx > 0);
+}
+
+SchematicSpatialIndex::~SchematicSpatialIndex() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+void SchematicSpatialIndex::insertItem(SI_Base& item) noexcept
+{
+    Q_ASSERT(!mItemRects.contains(&item));
+    QRectF rect = itemBoundingRect(item);
+    mItemRects.insert(&item, rect);
+    foreach (const Cell& cell, cellsIn(rect)) {
+        mCells[cell].insert(&item);
+    }
+}
+
+void SchematicSpatialIndex::removeItem(SI_Base& item) noexcept
+{
+    Q_ASSERT(mItemRects.contains(&item));
+    QRectF rect = mItemRects.take(&item);
+    foreach (const Cell& cell, cellsIn(rect)) {
+        auto it = mCells.find(cell);
+        if (it != mCells.end()) {
+            it->remove(&item);
+            if (it->isEmpty()) {
+                mCells.erase(it);
+            }
+        }
+    }
+}
+
+void SchematicSpatialIndex::updateItem(SI_Base& item) noexcept
+{
+    if (!mItemRects.contains(&item)) {
+        return; // item is not indexed (e.g. currently not added to the schematic)
+    }
+    QRectF newRect = itemBoundingRect(item);
+    if (newRect == mItemRects.value(&item)) {
+        return; // bounding rect did not change, nothing to do
+    }
+    removeItem(item);
+    mItemRects.insert(&item, newRect);
+    foreach (const Cell& cell, cellsIn(newRect)) {
+        mCells[cell].insert(&item);
+    }
+}
+
+bool SchematicSpatialIndex::contains(const SI_Base& item) const noexcept
+{
+    return mItemRects.contains(const_cast<SI_Base*>(&item));
+}
+
+void SchematicSpatialIndex::clear() noexcept
+{
+    mItemRects.clear();
+    mCells.clear();
+}
+
+/*****************************************************************************************
+ *  Queries
+ ****************************************************************************************/
+
+QList<SI_Base*> SchematicSpatialIndex::itemsAt(const QPointF& posPx) const noexcept
+{
+    QList<SI_Base*> list;
+    foreach (SI_Base* item, mCells.value(cellAt(posPx))) {
+        if (mItemRects.value(item).contains(posPx)) {
+            list.append(item);
+        }
+    }
+    return list;
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+SchematicSpatialIndex::Cell SchematicSpatialIndex::cellAt(const QPointF& posPx) const noexcept
+{
+    return Cell(qFloor(posPx.x() / mCellSizePx), qFloor(posPx.y() / mCellSizePx));
+}
+
+QList<SchematicSpatialIndex::Cell> SchematicSpatialIndex::cellsIn(const QRectF& rectPx) const noexcept
+{
+    QList<Cell> list;
+    Cell topLeft = cellAt(rectPx.topLeft());
+    Cell bottomRight = cellAt(rectPx.bottomRight());
+    for (qint32 x = topLeft.first; x <= bottomRight.first; ++x) {
+        for (qint32 y = topLeft.second; y <= bottomRight.second; ++y) {
+            list.append(Cell(x, y));
+        }
+    }
+    return list;
+}
+
+QRectF SchematicSpatialIndex::itemBoundingRect(const SI_Base& item) noexcept
+{
+    return item.getGrabAreaScenePx().boundingRect();
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
@@ -0,0 +1,110 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_SCHEMATICSPATIALINDEX_H
+#define LIBREPCB_PROJECT_SCHEMATICSPATIALINDEX_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+class SI_Base;
+
+/*****************************************************************************************
+ *  Class SchematicSpatialIndex
+ ****************************************************************************************/
+
+/**
+ * @brief The SchematicSpatialIndex class provides fast spatial lookup of schematic items
+ *
+ * Same design as librepcb#project#BoardSpatialIndex, but over schematic items: a
+ * uniform hash grid over the scene coordinate space (in pixels), where every item is
+ * registered in all grid cells intersected by the bounding rectangle of its grab area.
+ * It serves as the snap index of the wire drawing tool: the connectable pins and
+ * netpoints under the cursor are found by looking at one grid cell instead of
+ * scanning all items of the sheet on every mouse move.
+ *
+ * A shared class template for both the board and the schematic index was
+ * considered and rejected: the two item base classes (BI_Base/SI_Base) share no
+ * common interface type, so the template would have to be duck-typed over all of
+ * grab-area access, while the whole grid logic is ~100 lines that change rarely.
+ * Keeping two small mirrored classes is simpler than coupling both editors through
+ * a common template.
+ *
+ * The index returns *candidates* only (bounding rectangle matches); callers still do
+ * the exact grab area test. It is maintained by librepcb#project#SI_Base when items
+ * are added to/removed from the schematic, and by the items themselves whenever their
+ * position changes.
+ */
+class SchematicSpatialIndex final
+{
+    public:
+
+        // Constructors / Destructor
+        SchematicSpatialIndex(const SchematicSpatialIndex& other) = delete;
+        explicit SchematicSpatialIndex(qreal cellSizePx = 2000) noexcept;
+        ~SchematicSpatialIndex() noexcept;
+
+        // General Methods
+        void insertItem(SI_Base& item) noexcept;
+        void removeItem(SI_Base& item) noexcept;
+        void updateItem(SI_Base& item) noexcept;
+        bool contains(const SI_Base& item) const noexcept;
+        void clear() noexcept;
+
+        // Queries
+
+        /// @brief Get all candidate items whose bounding rectangle contains a position
+        QList<SI_Base*> itemsAt(const QPointF& posPx) const noexcept;
+
+        // Operator Overloadings
+        SchematicSpatialIndex& operator=(const SchematicSpatialIndex& rhs) = delete;
+
+
+    private:
+
+        // Private Types
+        typedef QPair<qint32, qint32> Cell;
+
+        // Private Methods
+        Cell cellAt(const QPointF& posPx) const noexcept;
+        QList<Cell> cellsIn(const QRectF& rectPx) const noexcept;
+        static QRectF itemBoundingRect(const SI_Base& item) noexcept;
+
+        // Attributes
+        qreal mCellSizePx; ///< edge length of the quadratic grid cells
+        QHash<SI_Base*, QRectF> mItemRects; ///< indexed bounding rect per item
+        QHash<Cell, QSet<SI_Base*>> mCells; ///< items per grid cell
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_SCHEMATICSPATIALINDEX_H
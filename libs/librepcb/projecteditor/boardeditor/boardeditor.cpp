@@ -32,6 +32,7 @@
 #include <librepcb/common/utils/undostackactiongroup.h>
 #include <librepcb/common/utils/exclusiveactiongroup.h>
 #include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardimageexport.h>
 #include <librepcb/project/circuit/circuit.h>
 #include <librepcb/common/dialogs/gridsettingsdialog.h>
 #include <librepcb/common/dialogs/boarddesignrulesdialog.h>
@@ -70,6 +71,13 @@ BoardEditor::BoardEditor(ProjectEditor& projectEditor, Project& project) :
     mUi->setupUi(this);
     mUi->actionProjectSave->setEnabled(!mProject.isReadOnly());
 
+    // high-resolution image export (added programmatically to avoid touching the
+    // translated .ui file)
+    QAction* actionExportImage = new QAction(tr("&Export Image..."), this);
+    mUi->menuFile->insertAction(mUi->actionGenerateFabricationData, actionExportImage);
+    connect(actionExportImage, &QAction::triggered,
+            this, &BoardEditor::exportImageTriggered);
+
     // set window title
     QString filenameStr = mProject.getFilepath().getFilename();
     if (mProject.isReadOnly()) filenameStr.append(QStringLiteral(" [Read-Only]"));
@@ -88,6 +96,7 @@ BoardEditor::BoardEditor(ProjectEditor& projectEditor, Project& project) :
 
     // add graphics view as central widget
     mGraphicsView = new GraphicsView(nullptr, this);
+    mGraphicsView->setMiniMapEnabled(true); // spatial navigation on large boards
     mGraphicsView->setUseOpenGl(mProjectEditor.getWorkspace().getSettings().getAppearance().getUseOpenGl());
     mGraphicsView->setBackgroundBrush(Qt::black);
     mGraphicsView->setForegroundBrush(Qt::white);
@@ -131,6 +140,11 @@ BoardEditor::BoardEditor(ProjectEditor& projectEditor, Project& project) :
     mToolsActionGroup->addAction(BES_FSM::State::State_DrawTrace, mUi->actionToolDrawTrace);
     mToolsActionGroup->addAction(BES_FSM::State::State_AddVia, mUi->actionToolAddVia);
     mToolsActionGroup->addAction(BES_FSM::State::State_AddDevice, mUi->actionToolAddDevice);
+    // measure tool (added programmatically to avoid touching the translated .ui)
+    QAction* actionToolMeasure = new QAction(tr("Measure"), this);
+    actionToolMeasure->setCheckable(true);
+    mUi->toolsToolbar->addAction(actionToolMeasure);
+    mToolsActionGroup->addAction(BES_FSM::State::State_Measure, actionToolMeasure);
     mToolsActionGroup->setCurrentAction(mFsm->getCurrentState());
     connect(mFsm, &BES_FSM::stateChanged,
             mToolsActionGroup.data(), &ExclusiveActionGroup::setCurrentAction);
@@ -402,6 +416,43 @@ void BoardEditor::on_actionExportAsPdf_triggered()
     }
 }
 
+void BoardEditor::exportImageTriggered()
+{
+    Board* board = getActiveBoard();
+    if (!board) return;
+    if (mImageExport && mImageExport->isRunning()) {
+        QMessageBox::information(this, tr("Image Export"),
+                                 tr("An image export is already running."));
+        return;
+    }
+
+    QString filename = QFileDialog::getSaveFileName(this, tr("Export Image"),
+                                                    QDir::homePath(), "*.png");
+    if (filename.isEmpty()) return;
+    if (!filename.endsWith(".png")) filename.append(".png");
+    bool ok = false;
+    int dpi = QInputDialog::getInt(this, tr("Export Image"), tr("Resolution [DPI]:"),
+                                   600, 10, 10000, 1, &ok);
+    if (!ok) return;
+
+    // the scene snapshot happens synchronously here (fast), the rasterization
+    // runs tiled on worker threads without blocking the editor
+    mImageExport.reset(new BoardImageExport(*board));
+    connect(mImageExport.data(), &BoardImageExport::finished,
+            this, &BoardEditor::imageExportFinished);
+    mImageExport->startAsync(FilePath(filename), dpi);
+}
+
+void BoardEditor::imageExportFinished(bool success, const QString& errorMsg,
+                                      const FilePath& filepath) noexcept
+{
+    if (!success) {
+        QMessageBox::warning(this, tr("Image Export"), errorMsg);
+    } else {
+        QDesktopServices::openUrl(QUrl::fromLocalFile(filepath.getParentDir().toStr()));
+    }
+}
+
 void BoardEditor::on_actionGenerateFabricationData_triggered()
 {
     Board* board = getActiveBoard();
@@ -486,6 +537,9 @@ void BoardEditor::toolActionGroupChangeTriggered(const QVariant& newTool) noexce
         case BES_FSM::State::State_AddVia:
             mFsm->processEvent(new BEE_Base(BEE_Base::StartAddVia), true);
             break;
+        case BES_FSM::State::State_Measure:
+            mFsm->processEvent(new BEE_Base(BEE_Base::StartMeasure), true);
+            break;
         default: Q_ASSERT(false); qCritical() << "Unknown tool triggered!"; break;
     }
 }
@@ -26,6 +26,7 @@
 #include <QtCore>
 #include <QtWidgets>
 #include <librepcb/common/uuid.h>
+#include <librepcb/common/fileio/filepath.h>
 #include <librepcb/common/graphics/if_graphicsvieweventhandler.h>
 
 /*****************************************************************************************
@@ -42,6 +43,7 @@ namespace project {
 
 class Project;
 class Board;
+class BoardImageExport;
 class ComponentInstance;
 
 namespace editor {
@@ -105,6 +107,9 @@ class BoardEditor final : public QMainWindow, public IF_GraphicsViewEventHandler
         void on_actionCopyBoard_triggered();
         void on_actionGrid_triggered();
         void on_actionExportAsPdf_triggered();
+        void exportImageTriggered();
+        void imageExportFinished(bool success, const QString& errorMsg,
+                                 const FilePath& filepath) noexcept;
         void on_actionGenerateFabricationData_triggered();
         void on_actionProjectProperties_triggered();
         void on_actionLayerStackSetup_triggered();
@@ -138,6 +143,7 @@ class BoardEditor final : public QMainWindow, public IF_GraphicsViewEventHandler
         QScopedPointer<ExclusiveActionGroup> mToolsActionGroup;
 
         // Misc
+        QScopedPointer<BoardImageExport> mImageExport;
         int mActiveBoardIndex;
         QList<QAction*> mBoardListActions;
         QActionGroup mBoardListActionGroup;
@@ -49,6 +49,14 @@ FabricationOutputDialog::FabricationOutputDialog(Board& board, QWidget *parent)
     QString outputDir = QString("output/%1/gerber").arg(version);
     FilePath gerberDir = mProject.getPath().getPathTo(outputDir);
     mUi->edtOutputDirPath->setText(gerberDir.toNative());
+
+    // optional ready-to-send fab package (added programmatically to avoid touching
+    // the translated .ui layout)
+    mCbxCreateArchive = new QCheckBox(tr("Also create a ZIP archive of the output"), this);
+    QBoxLayout* layout = qobject_cast<QBoxLayout*>(this->layout());
+    if (layout) {
+        layout->insertWidget(layout->count() - 1, mCbxCreateArchive);
+    }
 }
 
 FabricationOutputDialog::~FabricationOutputDialog()
@@ -71,15 +79,26 @@ void FabricationOutputDialog::on_btnSelectDir_clicked()
 
 void FabricationOutputDialog::on_btnGenerate_clicked()
 {
-    try
-    {
-        FilePath filepath(mUi->edtOutputDirPath->text());
-        BoardGerberExport grbExport(mBoard, filepath);
-        grbExport.exportAllLayers();
+    if (mGerberExport && mGerberExport->isRunning()) {
+        return; // an export is already running
     }
-    catch (Exception& e)
-    {
-        QMessageBox::warning(this, tr("Error"), e.getMsg());
+    FilePath filepath(mUi->edtOutputDirPath->text());
+    mGerberExport.reset(new BoardGerberExport(mBoard, filepath));
+    mGerberExport->setCreateArchive(mCbxCreateArchive->isChecked());
+    connect(mGerberExport.data(), &BoardGerberExport::progressPercent,
+            mUi->prgGenerate, &QProgressBar::setValue);
+    connect(mGerberExport.data(), &BoardGerberExport::finished,
+            this, &FabricationOutputDialog::gerberExportFinished);
+    mUi->btnGenerate->setEnabled(false);
+    mUi->prgGenerate->setValue(0);
+    mGerberExport->startAsync();
+}
+
+void FabricationOutputDialog::gerberExportFinished(const QStringList& errors) noexcept
+{
+    mUi->btnGenerate->setEnabled(true);
+    if (!errors.isEmpty()) {
+        QMessageBox::warning(this, tr("Error"), errors.join("\n"));
     }
 }
 
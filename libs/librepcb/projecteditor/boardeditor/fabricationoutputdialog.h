@@ -34,6 +34,7 @@ namespace project {
 
 class Project;
 class Board;
+class BoardGerberExport;
 
 namespace editor {
 
@@ -69,6 +70,7 @@ class FabricationOutputDialog final : public QDialog
         void on_btnSelectDir_clicked();
         void on_btnGenerate_clicked();
         void on_btnBrowseOutputDir_clicked();
+        void gerberExportFinished(const QStringList& errors) noexcept;
 
 
     private:
@@ -76,6 +78,8 @@ class FabricationOutputDialog final : public QDialog
         Project& mProject;
         Board& mBoard;
         Ui::FabricationOutputDialog* mUi;
+        QCheckBox* mCbxCreateArchive; ///< see BoardGerberExport::setCreateArchive()
+        QScopedPointer<BoardGerberExport> mGerberExport;
 };
 
 /*****************************************************************************************
@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "bes_addvia.h"
+#include <librepcb/common/graphics/graphicsscene.h>
 #include "../boardeditor.h"
 #include "ui_boardeditor.h"
 #include <librepcb/project/boards/board.h>
@@ -91,6 +92,11 @@ bool BES_AddVia::entry(BEE_Base* event) noexcept
     // add a new via
     if (!addVia(*board)) return false;
 
+    // while the tool is active, the via preview is mutated on every mouse move, so
+    // the scene index is disabled for the whole tool lifetime
+    mPreviewModeScene = &board->getGraphicsScene();
+    mPreviewModeScene->beginInteractiveEdit();
+
     // Add shape actions to the "command" toolbar
     mShapeActions.insert(static_cast<int>(BI_Via::Shape::Round),
                          mEditorUi.commandToolbar->addAction(
@@ -180,6 +186,11 @@ bool BES_AddVia::exit(BEE_Base* event) noexcept
 {
     Q_UNUSED(event);
 
+    if (mPreviewModeScene) {
+        mPreviewModeScene->endInteractiveEdit();
+        mPreviewModeScene = nullptr;
+    }
+
     if (mUndoCmdActive)
     {
         try
@@ -31,6 +31,8 @@
  *  Namespace / Forward Declarations
  ****************************************************************************************/
 namespace librepcb {
+
+class GraphicsScene;
 namespace project {
 
 class Board;
@@ -74,6 +76,7 @@ class BES_AddVia final : public BES_Base
 
 
         // General Attributes
+        GraphicsScene* mPreviewModeScene = nullptr; ///< scene in no-index mode while tool active
         bool mUndoCmdActive;
         BI_Via* mCurrentVia;
         BI_Via::Shape mCurrentViaShape;
@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "bes_drawtrace.h"
+#include <librepcb/common/graphics/graphicsscene.h>
 #include "../boardeditor.h"
 #include "ui_boardeditor.h"
 #include <librepcb/common/units/all_length_units.h>
@@ -66,10 +67,13 @@ BES_DrawTrace::BES_DrawTrace(BoardEditor& editor, Ui::BoardEditor& editorUi,
     mCurrentLayerName(GraphicsLayer::sTopCopper), mCurrentWidth(500000),
     mFixedNetPoint(nullptr), mPositioningNetLine1(nullptr), mPositioningNetPoint1(nullptr),
     mPositioningNetLine2(nullptr), mPositioningNetPoint2(nullptr),
+    mRoutingAssistant(new RoutingAssistant()), mPendingSuggestionId(-1),
     // command toolbar actions / widgets:
     mLayerLabel(nullptr), mLayerComboBox(nullptr), mWidthLabel(nullptr),
     mWidthComboBox(nullptr)
 {
+    connect(mRoutingAssistant.data(), &RoutingAssistant::suggestionReady,
+            this, &BES_DrawTrace::routingSuggestionReady);
 }
 
 BES_DrawTrace::~BES_DrawTrace()
@@ -103,6 +107,13 @@ bool BES_DrawTrace::entry(BEE_Base* event) noexcept
     // clear board selection because selection does not make sense in this state
     if (mEditor.getActiveBoard()) mEditor.getActiveBoard()->clearSelection();
 
+    // while the tool is active, its preview items are mutated on every mouse move,
+    // so the scene index is disabled for the whole tool lifetime
+    if (Board* board = mEditor.getActiveBoard()) {
+        mPreviewModeScene = &board->getGraphicsScene();
+        mPreviewModeScene->beginInteractiveEdit();
+    }
+
     // Add wire mode actions to the "command" toolbar
     mWireModeActions.insert(WireMode_HV, mEditorUi.commandToolbar->addAction(
                             QIcon(":/img/command_toolbars/wire_h_v.png"), ""));
@@ -179,6 +190,11 @@ bool BES_DrawTrace::exit(BEE_Base* event) noexcept
 {
     Q_UNUSED(event);
 
+    if (mPreviewModeScene) {
+        mPreviewModeScene->endInteractiveEdit();
+        mPreviewModeScene = nullptr;
+    }
+
     // abort the currently active command
     if (mSubState != SubState_Idle)
         abortPositioning(true);
@@ -467,6 +483,8 @@ bool BES_DrawTrace::abortPositioning(bool showErrMsgBox) noexcept
     try
     {
         mCircuit.setHighlightedNetSignal(nullptr);
+        mRoutingAssistant->cancel();
+        mPendingSuggestionId = -1;
         mSubState = SubState_Idle;
         mFixedNetPoint = nullptr;
         mPositioningNetLine1 = nullptr;
@@ -485,9 +503,46 @@ bool BES_DrawTrace::abortPositioning(bool showErrMsgBox) noexcept
 
 void BES_DrawTrace::updateNetpointPositions(const Point& cursorPos) noexcept
 {
+    // place the netpoints according the current wire mode first, so the cursor always
+    // responds immediately, even while the routing assistant is still calculating
     mPositioningNetPoint1->setPosition(calcMiddlePointPos(mFixedNetPoint->getPosition(),
                                                           cursorPos, mCurrentWireMode));
     mPositioningNetPoint2->setPosition(cursorPos);
+
+    // then let the routing assistant check (in the background) whether another wire
+    // mode would avoid a collision with foreign copper
+    requestRoutingSuggestion(cursorPos);
+}
+
+void BES_DrawTrace::requestRoutingSuggestion(const Point& cursorPos) noexcept
+{
+    Q_ASSERT(mFixedNetPoint);
+    const Point& fixedPos = mFixedNetPoint->getPosition();
+
+    // candidate middle points: the current wire mode first (preferred), then all other
+    // wire modes as walkaround alternatives
+    QVector<Point> candidates;
+    candidates.append(calcMiddlePointPos(fixedPos, cursorPos, mCurrentWireMode));
+    for (int i = 0; i < WireMode_COUNT; ++i) {
+        WireMode mode = static_cast<WireMode>(i);
+        if (mode != mCurrentWireMode) {
+            candidates.append(calcMiddlePointPos(fixedPos, cursorPos, mode));
+        }
+    }
+
+    mPendingSuggestionId = mRoutingAssistant->requestSuggestion(
+        mFixedNetPoint->getBoard(), mFixedNetPoint->getNetSignal(),
+        mFixedNetPoint->getLayer().getName(), mCurrentWidth,
+        fixedPos, cursorPos, candidates);
+}
+
+void BES_DrawTrace::routingSuggestionReady(const RoutingAssistant::Suggestion& suggestion) noexcept
+{
+    if (mSubState != SubState_PositioningNetPoint) return;
+    if (suggestion.requestId != mPendingSuggestionId) return; // outdated, cursor moved on
+    if (!suggestion.valid) return; // no collision free candidate, keep the current route
+    if (suggestion.candidateIndex == 0) return; // the current wire mode is already free
+    mPositioningNetPoint1->setPosition(suggestion.middlePos);
 }
 
 void BES_DrawTrace::layerComboBoxIndexChanged(int index) noexcept
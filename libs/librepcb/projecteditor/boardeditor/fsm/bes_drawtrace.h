@@ -26,11 +26,14 @@
 #include <QtCore>
 #include <QtWidgets>
 #include "bes_base.h"
+#include "../routingassistant.h"
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
  ****************************************************************************************/
 namespace librepcb {
+
+class GraphicsScene;
 namespace project {
 
 class BI_NetPoint;
@@ -98,6 +101,8 @@ class BES_DrawTrace final : public BES_Base
         bool addNextNetPoint(Board& board, const Point& pos) noexcept;
         bool abortPositioning(bool showErrMsgBox) noexcept;
         void updateNetpointPositions(const Point& cursorPos) noexcept;
+        void requestRoutingSuggestion(const Point& cursorPos) noexcept;
+        void routingSuggestionReady(const RoutingAssistant::Suggestion& suggestion) noexcept;
         void layerComboBoxIndexChanged(int index) noexcept;
         void wireWidthComboBoxTextChanged(const QString& width) noexcept;
         void updateWireModeActionsCheckedState() noexcept;
@@ -105,6 +110,7 @@ class BES_DrawTrace final : public BES_Base
 
 
         // General Attributes
+        GraphicsScene* mPreviewModeScene = nullptr; ///< scene in no-index mode while tool active
         SubState mSubState; ///< the current substate
         WireMode mCurrentWireMode; ///< the current wire mode
         QString mCurrentLayerName; ///< the current board layer name
@@ -114,6 +120,8 @@ class BES_DrawTrace final : public BES_Base
         BI_NetPoint* mPositioningNetPoint1; ///< the first netpoint to place
         BI_NetLine* mPositioningNetLine2; ///< line between p1 and p2
         BI_NetPoint* mPositioningNetPoint2; ///< the second netpoint to place
+        QScopedPointer<RoutingAssistant> mRoutingAssistant; ///< background obstacle check
+        int mPendingSuggestionId; ///< ID of the last routing request (-1 = none)
 
         // Widgets for the command toolbar
         QHash<WireMode, QAction*> mWireModeActions;
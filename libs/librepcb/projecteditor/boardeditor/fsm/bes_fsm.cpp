@@ -31,6 +31,7 @@
 #include "bes_drawtrace.h"
 #include "bes_addvia.h"
 #include "bes_adddevice.h"
+#include "bes_measure.h"
 
 /*****************************************************************************************
  *  Namespace
@@ -53,6 +54,7 @@ BES_FSM::BES_FSM(BoardEditor& editor, Ui::BoardEditor& editorUi,
     mSubStates.insert(State_DrawTrace, new BES_DrawTrace(mEditor, mEditorUi, mEditorGraphicsView, mUndoStack));
     mSubStates.insert(State_AddVia, new BES_AddVia(mEditor, mEditorUi, mEditorGraphicsView, mUndoStack));
     mSubStates.insert(State_AddDevice, new BES_AddDevice(mEditor, mEditorUi, mEditorGraphicsView, mUndoStack));
+    mSubStates.insert(State_Measure, new BES_Measure(mEditor, mEditorUi, mEditorGraphicsView, mUndoStack));
 
     // go to state "Select"
     if (mSubStates[State_Select]->entry(nullptr)) {
@@ -158,6 +160,9 @@ BES_FSM::State BES_FSM::processEventFromChild(BEE_Base* event) noexcept
         case BEE_Base::StartAddDevice:
             event->setAccepted(true);
             return State_AddDevice;
+        case BEE_Base::StartMeasure:
+            event->setAccepted(true);
+            return State_Measure;
         case BEE_Base::GraphicsViewEvent:
         {
             QEvent* e = BEE_RedirectedQEvent::getQEventFromBEE(event);
@@ -53,6 +53,7 @@ class BES_FSM final : public BES_Base
             State_DrawTrace,    ///< @see #project#BES_DrawTrace
             State_AddVia,       ///< @see librepcb#project#BES_AddVia
             State_AddDevice,    ///< @see librepcb#project#BES_AddDevice
+            State_Measure,      ///< @see librepcb#project#BES_Measure
         };
 
 
@@ -0,0 +1,225 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+#include "bes_measure.h"
+#include "boardeditorevent.h"
+#include "../boardeditor.h"
+#include "ui_boardeditor.h"
+#include <librepcb/common/gridproperties.h>
+#include <librepcb/common/graphics/graphicsscene.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/items/bi_footprintpad.h>
+#include <librepcb/project/boards/items/bi_netpoint.h>
+#include <librepcb/project/boards/items/bi_via.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+namespace editor {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+BES_Measure::BES_Measure(BoardEditor& editor, Ui::BoardEditor& editorUi,
+                         GraphicsView& editorGraphicsView, UndoStack& undoStack) :
+    BES_Base(editor, editorUi, editorGraphicsView, undoStack)
+{
+}
+
+BES_Measure::~BES_Measure()
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+BES_Base::ProcRetVal BES_Measure::process(BEE_Base* event) noexcept
+{
+    switch (event->getType())
+    {
+        case BEE_Base::GraphicsViewEvent:
+            return processSceneEvent(event);
+        default:
+            return PassToParentState;
+    }
+}
+
+bool BES_Measure::entry(BEE_Base* event) noexcept
+{
+    Q_UNUSED(event);
+    Board* board = mEditor.getActiveBoard();
+    if (!board) return false;
+
+    board->clearSelection(); // selection does not make sense in this state
+    mHasStartPoint = false;
+    mFrozen = false;
+    mEditorGraphicsView.setCursor(Qt::CrossCursor);
+    return true;
+}
+
+bool BES_Measure::exit(BEE_Base* event) noexcept
+{
+    Q_UNUSED(event);
+    clearOverlay();
+    mEditorGraphicsView.unsetCursor();
+    return true;
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+BES_Base::ProcRetVal BES_Measure::processSceneEvent(BEE_Base* event) noexcept
+{
+    QEvent* qevent = BEE_RedirectedQEvent::getQEventFromBEE(event);
+    Q_ASSERT(qevent); if (!qevent) return PassToParentState;
+    Board* board = mEditor.getActiveBoard();
+    Q_ASSERT(board); if (!board) return PassToParentState;
+
+    switch (qevent->type())
+    {
+        case QEvent::GraphicsSceneMousePress:
+        {
+            QGraphicsSceneMouseEvent* sceneEvent = dynamic_cast<QGraphicsSceneMouseEvent*>(qevent);
+            Q_ASSERT(sceneEvent);
+            if (sceneEvent->button() != Qt::LeftButton) break;
+            Point pos = snap(*board, Point::fromPx(sceneEvent->scenePos()));
+            if ((!mHasStartPoint) || mFrozen) {
+                // start a new measurement
+                mStartPoint = pos;
+                mHasStartPoint = true;
+                mFrozen = false;
+                updateOverlay(pos);
+            } else {
+                // freeze the current measurement
+                updateOverlay(pos);
+                mFrozen = true;
+            }
+            return ForceStayInState;
+        }
+        case QEvent::GraphicsSceneMouseMove:
+        {
+            QGraphicsSceneMouseEvent* sceneEvent = dynamic_cast<QGraphicsSceneMouseEvent*>(qevent);
+            Q_ASSERT(sceneEvent);
+            if (mHasStartPoint && (!mFrozen)) {
+                updateOverlay(snap(*board, Point::fromPx(sceneEvent->scenePos())));
+            }
+            return ForceStayInState;
+        }
+        default:
+            break;
+    }
+    return PassToParentState;
+}
+
+Point BES_Measure::snap(Board& board, const Point& pos) const noexcept
+{
+    // snap to the exact integer position of the nearest item (found through the
+    // spatial index backed *AtScenePos queries); fall back to the grid
+    Point best;
+    bool found = false;
+    Length bestDistance;
+    auto consider = [&](const Point& candidate) {
+        Length distance = (candidate - pos).getLength();
+        if ((!found) || (distance < bestDistance)) {
+            best = candidate;
+            bestDistance = distance;
+            found = true;
+        }
+    };
+    foreach (const BI_FootprintPad* pad, board.getPadsAtScenePos(pos, nullptr, nullptr)) {
+        consider(pad->getPosition());
+    }
+    foreach (const BI_Via* via, board.getViasAtScenePos(pos, nullptr)) {
+        consider(via->getPosition());
+    }
+    foreach (const BI_NetPoint* netpoint, board.getNetPointsAtScenePos(pos, nullptr, nullptr)) {
+        consider(netpoint->getPosition());
+    }
+    if (found) {
+        return best;
+    }
+    return pos.mappedToGrid(board.getGridProperties().getInterval());
+}
+
+void BES_Measure::updateOverlay(const Point& current) noexcept
+{
+    Board* board = mEditor.getActiveBoard();
+    if (!board) return;
+    GraphicsScene& scene = board->getGraphicsScene();
+    if (mLine && (mLine->scene() != &scene)) {
+        clearOverlay(); // the active board changed, recreate the items below
+        mHasStartPoint = true; // the start point itself is board-agnostic
+    }
+    if (!mLine) {
+        mLine = new QGraphicsLineItem();
+        mLine->setPen(QPen(Qt::yellow, 0, Qt::DashLine));
+        mLine->setZValue(10000); // above all board items
+        scene.addItem(*mLine);
+    }
+    if (!mLabel) {
+        mLabel = new QGraphicsSimpleTextItem();
+        mLabel->setBrush(Qt::yellow);
+        mLabel->setZValue(10000);
+        mLabel->setFlag(QGraphicsItem::ItemIgnoresTransformations, true);
+        scene.addItem(*mLabel);
+    }
+    QPointF p1 = mStartPoint.toPxQPointF();
+    QPointF p2 = current.toPxQPointF();
+    mLine->setLine(QLineF(p1, p2));
+
+    // the distance is calculated in exact integer nanometers; dx/dy help with
+    // measuring orthogonal clearances
+    Point delta = current - mStartPoint;
+    qreal distanceMm = delta.getLength().toMm();
+    mLabel->setText(QString("%1 mm (dx=%2, dy=%3)")
+                    .arg(distanceMm, 0, 'f', 3)
+                    .arg(delta.getX().toMm(), 0, 'f', 3)
+                    .arg(delta.getY().toMm(), 0, 'f', 3));
+    mLabel->setPos((p1 + p2) / 2);
+}
+
+void BES_Measure::clearOverlay() noexcept
+{
+    // remove the items from whatever scene they were added to - the active board
+    // may have changed since the measurement was drawn
+    if (mLine && mLine->scene()) mLine->scene()->removeItem(mLine);
+    if (mLabel && mLabel->scene()) mLabel->scene()->removeItem(mLabel);
+    delete mLine;   mLine = nullptr;
+    delete mLabel;  mLabel = nullptr;
+    mHasStartPoint = false;
+    mFrozen = false;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace editor
+} // namespace project
+} // namespace librepcb
@@ -0,0 +1,96 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_BES_MEASURE_H
+#define LIBREPCB_PROJECT_BES_MEASURE_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtWidgets>
+#include "bes_base.h"
+#include <librepcb/common/units/all_length_units.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+class Board;
+
+namespace editor {
+
+/*****************************************************************************************
+ *  Class BES_Measure
+ ****************************************************************************************/
+
+/**
+ * @brief Interactive measurement tool of the board editor
+ *
+ * First click sets the start point, moving shows the live distance, second
+ * click freezes the measurement until the next click starts a new one. Points
+ * snap to the exact integer positions of nearby items (pads, vias, netpoints -
+ * found through the board's spatial index queries) and fall back to the grid,
+ * so measured clearances are exact instead of eyeballed.
+ */
+class BES_Measure final : public BES_Base
+{
+        Q_OBJECT
+
+    public:
+
+        // Constructors / Destructor
+        explicit BES_Measure(BoardEditor& editor, Ui::BoardEditor& editorUi,
+                             GraphicsView& editorGraphicsView, UndoStack& undoStack);
+        ~BES_Measure();
+
+        // General Methods
+        ProcRetVal process(BEE_Base* event) noexcept override;
+        bool entry(BEE_Base* event) noexcept override;
+        bool exit(BEE_Base* event) noexcept override;
+
+
+    private:
+
+        // Private Methods
+        ProcRetVal processSceneEvent(BEE_Base* event) noexcept;
+        Point snap(Board& board, const Point& pos) const noexcept;
+        void updateOverlay(const Point& current) noexcept;
+        void clearOverlay() noexcept;
+
+
+        // General Attributes
+        bool mHasStartPoint = false;
+        bool mFrozen = false;       ///< a finished measurement stays visible
+        Point mStartPoint;
+        QGraphicsLineItem* mLine = nullptr;             ///< owned by the scene
+        QGraphicsSimpleTextItem* mLabel = nullptr;      ///< owned by the scene
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace editor
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_BES_MEASURE_H
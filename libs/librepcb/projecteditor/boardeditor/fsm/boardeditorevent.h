@@ -68,6 +68,7 @@ class BEE_Base
             //StartDrawEllipse,   ///< start command: draw ellipse
             StartDrawTrace,     ///< start command: draw trace
             StartAddVia,        ///< start command: add via
+            StartMeasure,       ///< start command: measure distances
             //StartAddNetLabel,   ///< start command: add netlabel
             Edit_Copy,          ///< copy the selected elements to clipboard (ctrl+c)
             Edit_Cut,           ///< cut the selected elements (ctrl+x)
@@ -0,0 +1,242 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtConcurrent/QtConcurrent>
+#include "routingassistant.h"
+#include <librepcb/common/graphics/graphicslayer.h>
+#include <librepcb/library/pkg/footprintpad.h>
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/boardspatialindex.h>
+#include <librepcb/project/boards/items/bi_footprintpad.h>
+#include <librepcb/project/boards/items/bi_netline.h>
+#include <librepcb/project/boards/items/bi_netpoint.h>
+#include <librepcb/project/boards/items/bi_via.h>
+#include <librepcb/project/circuit/netsignal.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+namespace editor {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+RoutingAssistant::RoutingAssistant(QObject* parent) noexcept :
+    QObject(parent), mClearance(200000), mNextRequestId(0), mHasPendingJob(false)
+{
+    connect(&mWatcher, &QFutureWatcher<Suggestion>::finished,
+            this, &RoutingAssistant::jobFinished);
+}
+
+RoutingAssistant::~RoutingAssistant() noexcept
+{
+    mHasPendingJob = false;
+    mWatcher.disconnect();
+    mWatcher.waitForFinished();
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+int RoutingAssistant::requestSuggestion(Board& board, const NetSignal& netsignal,
+                                        const QString& layerName, const Length& width,
+                                        const Point& fixedPos, const Point& cursorPos,
+                                        const QVector<Point>& middlePoints) noexcept
+{
+    Job job = createJob(board, netsignal, layerName, width, fixedPos, cursorPos,
+                        middlePoints);
+    if (mWatcher.isRunning()) {
+        // the worker is busy --> remember only the newest request
+        mPendingJob = job;
+        mHasPendingJob = true;
+    } else {
+        startJob(job);
+    }
+    return job.requestId;
+}
+
+void RoutingAssistant::cancel() noexcept
+{
+    mHasPendingJob = false;
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+RoutingAssistant::Job RoutingAssistant::createJob(Board& board, const NetSignal& netsignal,
+                                                  const QString& layerName,
+                                                  const Length& width,
+                                                  const Point& fixedPos,
+                                                  const Point& cursorPos,
+                                                  const QVector<Point>& middlePoints) noexcept
+{
+    Job job;
+    job.requestId = mNextRequestId++;
+    job.fixedPosMm = fixedPos.toMmQPointF();
+    job.cursorPosMm = cursorPos.toMmQPointF();
+    foreach (const Point& p, middlePoints) {
+        job.middlePointsMm.append(p.toMmQPointF());
+    }
+    job.halfWidthMm = (width / 2 + mClearance).toMm();
+
+    // query the spatial index for all items near the route (candidates only, but that
+    // is fine: extra obstacles outside the route corridor never cause false collisions)
+    QRectF queryRect = QRectF(fixedPos.toPxQPointF(), cursorPos.toPxQPointF()).normalized();
+    foreach (const QPointF& p, job.middlePointsMm) {
+        queryRect |= QRectF(Point::fromMm(p).toPxQPointF(), QSizeF(0, 0));
+    }
+    qreal marginPx = (width + mClearance * 2).toPx();
+    queryRect.adjust(-marginPx, -marginPx, marginPx, marginPx);
+
+    foreach (BI_Base* item, board.getSpatialIndex().itemsIn(queryRect)) {
+        switch (item->getType())
+        {
+            case BI_Base::Type_t::NetLine: {
+                BI_NetLine* netline = static_cast<BI_NetLine*>(item); Q_ASSERT(netline);
+                if (&netline->getNetSignal() == &netsignal) break;
+                if (netline->getLayer().getName() != layerName) break;
+                Obstacle o;
+                o.start = netline->getStartPoint().getPosition().toMmQPointF();
+                o.end = netline->getEndPoint().getPosition().toMmQPointF();
+                o.radiusMm = netline->getWidth().toMm() / 2;
+                job.obstacles.append(o);
+                break;
+            }
+            case BI_Base::Type_t::Via: {
+                BI_Via* via = static_cast<BI_Via*>(item); Q_ASSERT(via);
+                if (via->getNetSignal() == &netsignal) break;
+                Obstacle o;
+                o.start = via->getPosition().toMmQPointF();
+                o.end = o.start;
+                o.radiusMm = via->getSize().toMm() / 2;
+                job.obstacles.append(o);
+                break;
+            }
+            case BI_Base::Type_t::FootprintPad: {
+                BI_FootprintPad* pad = static_cast<BI_FootprintPad*>(item); Q_ASSERT(pad);
+                if (pad->getCompSigInstNetSignal() == &netsignal) break;
+                if (!pad->isOnLayer(layerName)) break;
+                // approximate the pad by its circumscribed circle (conservative)
+                Obstacle o;
+                o.start = pad->getPosition().toMmQPointF();
+                o.end = o.start;
+                o.radiusMm = qMax(pad->getLibPad().getWidth(),
+                                  pad->getLibPad().getHeight()).toMm() / 2;
+                job.obstacles.append(o);
+                break;
+            }
+            default:
+                break; // other item types are not considered as obstacles
+        }
+    }
+    return job;
+}
+
+void RoutingAssistant::startJob(const Job& job) noexcept
+{
+    Q_ASSERT(!mWatcher.isRunning());
+    mWatcher.setFuture(QtConcurrent::run(&RoutingAssistant::evaluateJob, job));
+}
+
+void RoutingAssistant::jobFinished() noexcept
+{
+    emit suggestionReady(mWatcher.result());
+    if (mHasPendingJob) {
+        mHasPendingJob = false;
+        startJob(mPendingJob);
+    }
+}
+
+RoutingAssistant::Suggestion RoutingAssistant::evaluateJob(const Job& job) noexcept
+{
+    Suggestion s;
+    s.requestId = job.requestId;
+    s.valid = false;
+    s.candidateIndex = -1;
+    for (int i = 0; i < job.middlePointsMm.count(); ++i) {
+        const QPointF& middle = job.middlePointsMm.at(i);
+        if (segmentIsFree(job.fixedPosMm, middle, job.halfWidthMm, job.obstacles) &&
+            segmentIsFree(middle, job.cursorPosMm, job.halfWidthMm, job.obstacles)) {
+            s.valid = true;
+            s.candidateIndex = i;
+            s.middlePos = Point::fromMm(middle);
+            break;
+        }
+    }
+    return s;
+}
+
+bool RoutingAssistant::segmentIsFree(const QPointF& p1, const QPointF& p2, qreal radiusMm,
+                                     const QVector<Obstacle>& obstacles) noexcept
+{
+    foreach (const Obstacle& o, obstacles) {
+        if (segmentDistanceMm(p1, p2, o.start, o.end) < radiusMm + o.radiusMm) {
+            return false;
+        }
+    }
+    return true;
+}
+
+qreal RoutingAssistant::segmentDistanceMm(const QPointF& p1, const QPointF& p2,
+                                          const QPointF& q1, const QPointF& q2) noexcept
+{
+    QLineF l1(p1, p2);
+    QLineF l2(q1, q2);
+    if ((l1.length() > 0) && (l2.length() > 0)) {
+        QPointF intersection;
+        if (l1.intersect(l2, &intersection) == QLineF::BoundedIntersection) {
+            return 0;
+        }
+    }
+    qreal d = pointSegmentDistanceMm(q1, p1, p2);
+    d = qMin(d, pointSegmentDistanceMm(q2, p1, p2));
+    d = qMin(d, pointSegmentDistanceMm(p1, q1, q2));
+    d = qMin(d, pointSegmentDistanceMm(p2, q1, q2));
+    return d;
+}
+
+qreal RoutingAssistant::pointSegmentDistanceMm(const QPointF& p, const QPointF& s1,
+                                               const QPointF& s2) noexcept
+{
+    QPointF dir = s2 - s1;
+    qreal lengthSquared = dir.x() * dir.x() + dir.y() * dir.y();
+    if (lengthSquared <= 0) {
+        return QLineF(p, s1).length();
+    }
+    qreal t = ((p.x() - s1.x()) * dir.x() + (p.y() - s1.y()) * dir.y()) / lengthSquared;
+    t = qBound(qreal(0), t, qreal(1));
+    return QLineF(p, s1 + dir * t).length();
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace editor
+} // namespace project
+} // namespace librepcb
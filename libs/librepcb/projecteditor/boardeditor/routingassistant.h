@@ -0,0 +1,177 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_ROUTINGASSISTANT_H
+#define LIBREPCB_PROJECT_ROUTINGASSISTANT_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <librepcb/common/units/all_length_units.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+class Board;
+class NetSignal;
+
+namespace editor {
+
+/*****************************************************************************************
+ *  Class RoutingAssistant
+ ****************************************************************************************/
+
+/**
+ * @brief The RoutingAssistant class evaluates trace route candidates in the background
+ *
+ * The assistant helps the interactive trace drawing tool (librepcb#project#editor#
+ * BES_DrawTrace) to avoid obstacles: for a given start point and cursor position it
+ * checks a list of candidate middle points (one per wire mode) against all foreign-net
+ * copper items near the route and reports the first candidate whose both trace segments
+ * are collision free.
+ *
+ * To keep the cursor latency low on dense boards, the expensive part runs on a worker
+ * thread: #requestSuggestion() only queries the board's spatial index for nearby items
+ * and snapshots their geometry into plain structures (this is cheap because the index
+ * returns only the items around the route), then the candidate evaluation is started
+ * with QtConcurrent. When it is done, #suggestionReady() is emitted on the main thread.
+ * The worker never accesses any board items, so the board may be modified while a job
+ * is running. Results are identified by a request ID, so the caller can simply discard
+ * suggestions which are outdated because the cursor has moved on in the meantime.
+ */
+class RoutingAssistant final : public QObject
+{
+        Q_OBJECT
+
+    public:
+
+        // Types
+
+        /// Result of an evaluated route request (see #suggestionReady())
+        struct Suggestion {
+            int requestId;      ///< the ID returned by #requestSuggestion()
+            bool valid;         ///< true if a collision free candidate was found
+            int candidateIndex; ///< index of the winning candidate (valid only if #valid)
+            Point middlePos;    ///< middle point of the winning candidate
+        };
+
+        // Constructors / Destructor
+        RoutingAssistant(const RoutingAssistant& other) = delete;
+        explicit RoutingAssistant(QObject* parent = nullptr) noexcept;
+        ~RoutingAssistant() noexcept;
+
+        // Setters
+
+        /// Set the clearance to keep between the trace and foreign copper [default 0.2mm]
+        void setClearance(const Length& clearance) noexcept {mClearance = clearance;}
+
+        // General Methods
+
+        /**
+         * @brief Request the evaluation of trace route candidates
+         *
+         * If a previous request is still being evaluated, it is superseded: its result
+         * will be delivered as every other (so its ID stays valid), but the new request
+         * is evaluated as soon as the worker is free.
+         *
+         * @param board         The board to route on
+         * @param netsignal     The net signal of the trace (its items are no obstacles)
+         * @param layerName     The copper layer to route on
+         * @param width         The trace width
+         * @param fixedPos      The fixed start point of the route
+         * @param cursorPos     The current cursor position (end point of the route)
+         * @param middlePoints  The candidate middle points to evaluate (in order of
+         *                      decreasing preference, typically one per wire mode)
+         *
+         * @return The request ID (used to match #suggestionReady() signals)
+         */
+        int requestSuggestion(Board& board, const NetSignal& netsignal,
+                              const QString& layerName, const Length& width,
+                              const Point& fixedPos, const Point& cursorPos,
+                              const QVector<Point>& middlePoints) noexcept;
+
+        /// Discard the pending request (a running evaluation finishes silently)
+        void cancel() noexcept;
+
+        // Operator Overloadings
+        RoutingAssistant& operator=(const RoutingAssistant& rhs) = delete;
+
+
+    signals:
+
+        /// Emitted (on the main thread) when a requested evaluation has finished
+        void suggestionReady(const librepcb::project::editor::RoutingAssistant::Suggestion& suggestion);
+
+
+    private:
+
+        // Private Types
+
+        /// An obstacle capsule: line segment with radius, all in millimeters
+        struct Obstacle {
+            QPointF start;
+            QPointF end;
+            qreal radiusMm;
+        };
+
+        /// All data needed to evaluate one request (plain values, safe to copy to the worker)
+        struct Job {
+            int requestId;
+            QPointF fixedPosMm;
+            QPointF cursorPosMm;
+            QVector<QPointF> middlePointsMm;
+            qreal halfWidthMm;      ///< half trace width plus clearance
+            QVector<Obstacle> obstacles;
+        };
+
+        // Private Methods
+        Job createJob(Board& board, const NetSignal& netsignal, const QString& layerName,
+                      const Length& width, const Point& fixedPos, const Point& cursorPos,
+                      const QVector<Point>& middlePoints) noexcept;
+        void startJob(const Job& job) noexcept;
+        void jobFinished() noexcept;
+        static Suggestion evaluateJob(const Job& job) noexcept;
+        static bool segmentIsFree(const QPointF& p1, const QPointF& p2, qreal radiusMm,
+                                  const QVector<Obstacle>& obstacles) noexcept;
+        static qreal segmentDistanceMm(const QPointF& p1, const QPointF& p2,
+                                       const QPointF& q1, const QPointF& q2) noexcept;
+        static qreal pointSegmentDistanceMm(const QPointF& p, const QPointF& s1,
+                                            const QPointF& s2) noexcept;
+
+        // Attributes
+        Length mClearance; ///< clearance to keep to foreign copper
+        int mNextRequestId; ///< ID for the next request
+        bool mHasPendingJob; ///< true if #mPendingJob waits for the worker
+        Job mPendingJob; ///< the request to evaluate next (superseded by newer ones)
+        QFutureWatcher<Suggestion> mWatcher; ///< watcher of the running evaluation
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace editor
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_ROUTINGASSISTANT_H
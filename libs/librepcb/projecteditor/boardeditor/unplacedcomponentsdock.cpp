@@ -24,6 +24,7 @@
 #include <QtWidgets>
 #include "unplacedcomponentsdock.h"
 #include "ui_unplacedcomponentsdock.h"
+#include "unplacedcomponentsmodel.h"
 #include <librepcb/project/boards/board.h>
 #include <librepcb/project/circuit/circuit.h>
 #include <librepcb/project/project.h>
@@ -31,6 +32,7 @@
 #include <librepcb/project/circuit/componentinstance.h>
 #include <librepcb/workspace/library/workspacelibrarydb.h>
 #include <librepcb/library/elements.h>
+#include <librepcb/library/libraryelementcache.h>
 #include <librepcb/project/library/projectlibrary.h>
 #include <librepcb/common/graphics/graphicsview.h>
 #include <librepcb/common/graphics/graphicsscene.h>
@@ -55,11 +57,10 @@ namespace editor {
 
 UnplacedComponentsDock::UnplacedComponentsDock(ProjectEditor& editor) :
     QDockWidget(0), mProjectEditor(editor), mProject(editor.getProject()), mBoard(nullptr),
-    mUi(new Ui::UnplacedComponentsDock),
+    mUi(new Ui::UnplacedComponentsDock), mListModel(nullptr),
     mFootprintPreviewGraphicsScene(nullptr), mFootprintPreviewGraphicsItem(nullptr),
     mSelectedComponent(nullptr), mSelectedDevice(nullptr), mSelectedPackage(nullptr),
-    mSelectedFootprintUuid(), mCircuitConnection1(), mCircuitConnection2(),
-    mBoardConnection1(), mBoardConnection2(), mDisableListUpdate(false)
+    mSelectedFootprintUuid()
 {
     mUi->setupUi(this);
     mFootprintPreviewGraphicsScene = new GraphicsScene();
@@ -67,15 +68,20 @@ UnplacedComponentsDock::UnplacedComponentsDock(ProjectEditor& editor) :
     mUi->graphicsView->setOriginCrossVisible(false);
     mUi->graphicsView->setScene(mFootprintPreviewGraphicsScene);
 
+    // the model keeps itself up to date incrementally via the circuit/board signals,
+    // so no explicit list rebuilds are required anywhere in this class
+    mListModel = new UnplacedComponentsModel(editor, this);
+    mUi->lstUnplacedComponents->setModel(mListModel);
+    connect(mUi->lstUnplacedComponents->selectionModel(), &QItemSelectionModel::currentRowChanged,
+            this, &UnplacedComponentsDock::currentComponentIndexChanged);
+    connect(mListModel, &UnplacedComponentsModel::rowsInserted, [this](){updateWindowTitle();});
+    connect(mListModel, &UnplacedComponentsModel::rowsRemoved, [this](){updateWindowTitle();});
+    connect(mListModel, &UnplacedComponentsModel::modelReset, [this](){updateWindowTitle();});
+
     QSettings clientSettings;
     mUi->splitter->restoreState(clientSettings.value("unplaced_components_dock/splitter_state").toByteArray());
 
-    mCircuitConnection1 = connect(&mProject.getCircuit(), &Circuit::componentAdded,
-                                  [this](ComponentInstance& cmp){Q_UNUSED(cmp); updateComponentsList();});
-    mCircuitConnection2 = connect(&mProject.getCircuit(), &Circuit::componentRemoved,
-                                  [this](ComponentInstance& cmp){Q_UNUSED(cmp); updateComponentsList();});
-
-    updateComponentsList();
+    updateWindowTitle();
 }
 
 UnplacedComponentsDock::~UnplacedComponentsDock()
@@ -84,9 +90,6 @@ UnplacedComponentsDock::~UnplacedComponentsDock()
     clientSettings.setValue("unplaced_components_dock/splitter_state", mUi->splitter->saveState());
 
     setBoard(nullptr);
-    mDisableListUpdate = true;
-    disconnect(mCircuitConnection1);        mCircuitConnection1 = QMetaObject::Connection();
-    disconnect(mCircuitConnection2);        mCircuitConnection2 = QMetaObject::Connection();
     delete mFootprintPreviewGraphicsItem;   mFootprintPreviewGraphicsItem = nullptr;
     delete mFootprintPreviewGraphicsScene;  mFootprintPreviewGraphicsScene = nullptr;
     delete mUi;                             mUi = nullptr;
@@ -98,20 +101,15 @@ UnplacedComponentsDock::~UnplacedComponentsDock()
 
 void UnplacedComponentsDock::setBoard(Board* board)
 {
-    // clean up
-    mBoard = nullptr;
-    disconnect(mBoardConnection1);  mBoardConnection1 = QMetaObject::Connection();
-    disconnect(mBoardConnection2);  mBoardConnection2 = QMetaObject::Connection();
-    updateComponentsList();
-
-    // load new board
     mBoard = board;
+    setSelectedComponentInstance(nullptr);
+    mListModel->setBoard(board);
     if (board)
     {
-        mBoardConnection1 = connect(board, &Board::deviceAdded, [this](BI_Device& c){Q_UNUSED(c); updateComponentsList();});
-        mBoardConnection2 = connect(board, &Board::deviceRemoved, [this](BI_Device& c){Q_UNUSED(c); updateComponentsList();});
         mNextPosition = Point::fromMm(0, -20).mappedToGrid(board->getGridProperties().getInterval());
-        updateComponentsList();
+        if (mListModel->rowCount() > 0) {
+            mUi->lstUnplacedComponents->setCurrentIndex(mListModel->index(0));
+        }
     }
 }
 
@@ -119,14 +117,14 @@ void UnplacedComponentsDock::setBoard(Board* board)
  *  Private Slots
  ****************************************************************************************/
 
-void UnplacedComponentsDock::on_lstUnplacedComponents_currentItemChanged(QListWidgetItem *current, QListWidgetItem *previous)
+void UnplacedComponentsDock::currentComponentIndexChanged(const QModelIndex& current, const QModelIndex& previous)
 {
     Q_UNUSED(previous);
 
     ComponentInstance* component = nullptr;
-    if (mBoard && current)
+    if (mBoard && current.isValid())
     {
-        Uuid cmpUuid(current->data(Qt::UserRole).toString());
+        Uuid cmpUuid = mListModel->getComponentUuid(current.row());
         Q_ASSERT(cmpUuid.isNull() == false);
         component = mProject.getCircuit().getComponentInstanceByUuid(cmpUuid);
     }
@@ -138,10 +136,15 @@ void UnplacedComponentsDock::on_cbxSelectedDevice_currentIndexChanged(int index)
     Uuid deviceUuid(mUi->cbxSelectedDevice->itemData(index, Qt::UserRole).toString());
     FilePath devFp = mProjectEditor.getWorkspace().getLibraryDb().getLatestDevice(deviceUuid);
     if (devFp.isValid()) {
-        const library::Device* device = new library::Device(devFp, true);
-        FilePath pkgFp = mProjectEditor.getWorkspace().getLibraryDb().getLatestPackage(device->getPackageUuid());
-        if (pkgFp.isValid()) {
-            const library::Package* package = new library::Package(pkgFp, true);
+        // shared read-only elements: repeatedly selecting devices does not re-parse
+        // them, and they are freed automatically (also fixes the former leak here)
+        std::shared_ptr<const library::Device> device =
+            library::LibraryElementCache::get<library::Device>(devFp);
+        FilePath pkgFp = device ? mProjectEditor.getWorkspace().getLibraryDb()
+                                  .getLatestPackage(device->getPackageUuid()) : FilePath();
+        std::shared_ptr<const library::Package> package = pkgFp.isValid()
+            ? library::LibraryElementCache::get<library::Package>(pkgFp) : nullptr;
+        if (device && package) {
             setSelectedDeviceAndPackage(device, package);
         } else {
             setSelectedDeviceAndPackage(nullptr, nullptr);
@@ -163,7 +166,6 @@ void UnplacedComponentsDock::on_btnAdd_clicked()
     if (mBoard && mSelectedComponent && mSelectedDevice && mSelectedPackage && (!mSelectedFootprintUuid.isNull())) {
         addDeviceManually(*mSelectedComponent, mSelectedDevice->getUuid(), mSelectedFootprintUuid);
     }
-    updateComponentsList();
 }
 
 void UnplacedComponentsDock::on_pushButton_clicked()
@@ -174,8 +176,8 @@ void UnplacedComponentsDock::on_pushButton_clicked()
     Uuid deviceLibUuid = mSelectedDevice->getUuid();
 
     beginUndoCmdGroup();
-    for (int i = 0; i < mUi->lstUnplacedComponents->count(); i++) {
-        Uuid componentUuid(mUi->lstUnplacedComponents->item(i)->data(Qt::UserRole).toString());
+    for (int i = 0; i < mListModel->rowCount(); i++) {
+        Uuid componentUuid = mListModel->getComponentUuid(i);
         Q_ASSERT(componentUuid.isNull() == false);
         ComponentInstance* component = mProject.getCircuit().getComponentInstanceByUuid(componentUuid);
         if (!component) continue;
@@ -183,8 +185,6 @@ void UnplacedComponentsDock::on_pushButton_clicked()
         addNextDeviceToCmdGroup(*component, deviceLibUuid, mSelectedFootprintUuid);
     }
     commitUndoCmdGroup();
-
-    updateComponentsList();
 }
 
 void UnplacedComponentsDock::on_btnAddAll_clicked()
@@ -192,9 +192,9 @@ void UnplacedComponentsDock::on_btnAddAll_clicked()
     if (!mBoard) return;
 
     beginUndoCmdGroup();
-    for (int i = 0; i < mUi->lstUnplacedComponents->count(); i++)
+    for (int i = 0; i < mListModel->rowCount(); i++)
     {
-        Uuid componentUuid(mUi->lstUnplacedComponents->item(i)->data(Qt::UserRole).toString());
+        Uuid componentUuid = mListModel->getComponentUuid(i);
         Q_ASSERT(componentUuid.isNull() == false);
         ComponentInstance* component = mProject.getCircuit().getComponentInstanceByUuid(componentUuid);
         if (component)
@@ -206,48 +206,15 @@ void UnplacedComponentsDock::on_btnAddAll_clicked()
         }
     }
     commitUndoCmdGroup();
-
-    updateComponentsList();
 }
 
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
 
-void UnplacedComponentsDock::updateComponentsList() noexcept
+void UnplacedComponentsDock::updateWindowTitle() noexcept
 {
-    if (mDisableListUpdate) return;
-
-    int selectedIndex = mUi->lstUnplacedComponents->currentRow();
-    setSelectedComponentInstance(nullptr);
-    mUi->lstUnplacedComponents->clear();
-
-    if (mBoard)
-    {
-        const QMap<Uuid, ComponentInstance*> componentsList = mProject.getCircuit().getComponentInstances();
-        const QMap<Uuid, BI_Device*> boardDeviceList = mBoard->getDeviceInstances();
-        foreach (ComponentInstance* component, componentsList)
-        {
-            if (boardDeviceList.contains(component->getUuid())) continue;
-            if (component->getLibComponent().isSchematicOnly()) continue;
-
-            // add component to list
-            int deviceCount = mProjectEditor.getWorkspace().getLibraryDb().getDevicesOfComponent(component->getLibComponent().getUuid()).count();
-            QString name = component->getName();
-            QString value = component->getValue(true).replace("\n", "|");
-            QString compName = component->getLibComponent().getNames().value(mProject.getSettings().getLocaleOrder());
-            QString text = QString("{%1} %2 (%3) [%4]").arg(deviceCount).arg(name, value, compName);
-            QListWidgetItem* item = new QListWidgetItem(text, mUi->lstUnplacedComponents);
-            item->setData(Qt::UserRole, component->getUuid().toStr());
-        }
-
-        if (mUi->lstUnplacedComponents->count() > 0) {
-            int index = qMin(selectedIndex, mUi->lstUnplacedComponents->count()-1);
-            mUi->lstUnplacedComponents->setCurrentRow(index);
-        }
-    }
-
-    setWindowTitle(QString(tr("Place Devices [%1]")).arg(mUi->lstUnplacedComponents->count()));
+    setWindowTitle(QString(tr("Place Devices [%1]")).arg(mListModel->rowCount()));
 }
 
 void UnplacedComponentsDock::setSelectedComponentInstance(ComponentInstance* cmp) noexcept
@@ -265,15 +232,19 @@ void UnplacedComponentsDock::setSelectedComponentInstance(ComponentInstance* cmp
             // TODO: use library metadata instead of loading the XML files
             FilePath devFp = mProjectEditor.getWorkspace().getLibraryDb().getLatestDevice(deviceUuid);
             if (!devFp.isValid()) continue;
-            const library::Device device(devFp, true);
+            std::shared_ptr<const library::Device> device =
+                library::LibraryElementCache::get<library::Device>(devFp);
+            if (!device) continue;
 
             Uuid pkgUuid;
             mProjectEditor.getWorkspace().getLibraryDb().getDeviceMetadata(devFp, &pkgUuid);
             FilePath pkgFp = mProjectEditor.getWorkspace().getLibraryDb().getLatestPackage(pkgUuid);
-            const library::Package package(pkgFp, true);
+            std::shared_ptr<const library::Package> package = pkgFp.isValid()
+                ? library::LibraryElementCache::get<library::Package>(pkgFp) : nullptr;
+            if (!package) continue;
 
-            QString devName = device.getNames().value(localeOrder);
-            QString pkgName = package.getNames().value(localeOrder);
+            QString devName = device->getNames().value(localeOrder);
+            QString pkgName = package->getNames().value(localeOrder);
             QString text = QString("%1 [%2]").arg(devName, pkgName);
             mUi->cbxSelectedDevice->addItem(text, deviceUuid.toStr());
         }
@@ -285,13 +256,14 @@ void UnplacedComponentsDock::setSelectedComponentInstance(ComponentInstance* cmp
     }
 }
 
-void UnplacedComponentsDock::setSelectedDeviceAndPackage(const library::Device* device,
-                                                         const library::Package* package) noexcept
+void UnplacedComponentsDock::setSelectedDeviceAndPackage(
+    const std::shared_ptr<const library::Device>& device,
+    const std::shared_ptr<const library::Package>& package) noexcept
 {
     setSelectedFootprintUuid(Uuid());
     mUi->cbxSelectedFootprint->clear();
-    delete mSelectedPackage;    mSelectedPackage = nullptr;
-    delete mSelectedDevice;     mSelectedDevice = nullptr;
+    mSelectedPackage.reset();
+    mSelectedDevice.reset();
 
     if (mBoard && mSelectedComponent && device && package) {
         if (device->getComponentUuid() == mSelectedComponent->getLibComponent().getUuid()) {
@@ -324,7 +296,7 @@ void UnplacedComponentsDock::setSelectedFootprintUuid(const Uuid& uuid) noexcept
         if (fpt) {
             mFootprintPreviewGraphicsItem = new library::FootprintPreviewGraphicsItem(
                 mBoard->getLayerStack(), mProject.getSettings().getLocaleOrder(), *fpt,
-                mSelectedPackage, &mSelectedComponent->getLibComponent(), mSelectedComponent);
+                mSelectedPackage.get(), &mSelectedComponent->getLibComponent(), mSelectedComponent);
             mFootprintPreviewGraphicsScene->addItem(*mFootprintPreviewGraphicsItem);
             mUi->graphicsView->zoomAll();
             mUi->btnAdd->setEnabled(true);
@@ -357,7 +329,6 @@ void UnplacedComponentsDock::addNextDeviceToCmdGroup(ComponentInstance& cmp,
 
 void UnplacedComponentsDock::commitUndoCmdGroup() noexcept
 {
-    mDisableListUpdate = true;
     try
     {
         mProjectEditor.getUndoStack().execCmd(mCurrentUndoCmdGroup.take());
@@ -366,7 +337,6 @@ void UnplacedComponentsDock::commitUndoCmdGroup() noexcept
     {
         QMessageBox::critical(this, tr("Error"), e.getMsg());
     }
-    mDisableListUpdate = false;
 }
 
 void UnplacedComponentsDock::addDeviceManually(ComponentInstance& cmp, const Uuid& deviceUuid,
@@ -23,6 +23,7 @@
 /*****************************************************************************************
  *  Includes
  ****************************************************************************************/
+#include <memory>
 #include <QtCore>
 #include <QtWidgets>
 #include <librepcb/common/units/all_length_units.h>
@@ -52,6 +53,7 @@ class ComponentInstance;
 namespace editor {
 
 class ProjectEditor;
+class UnplacedComponentsModel;
 
 namespace Ui {
 class UnplacedComponentsDock;
@@ -87,7 +89,7 @@ class UnplacedComponentsDock final : public QDockWidget
 
     private slots:
 
-        void on_lstUnplacedComponents_currentItemChanged(QListWidgetItem *current, QListWidgetItem *previous);
+        void currentComponentIndexChanged(const QModelIndex& current, const QModelIndex& previous);
         void on_cbxSelectedDevice_currentIndexChanged(int index);
         void on_cbxSelectedFootprint_currentIndexChanged(int index);
         void on_btnAdd_clicked();
@@ -103,10 +105,10 @@ class UnplacedComponentsDock final : public QDockWidget
         UnplacedComponentsDock& operator=(const UnplacedComponentsDock& rhs);
 
         // Private Methods
-        void updateComponentsList() noexcept;
+        void updateWindowTitle() noexcept;
         void setSelectedComponentInstance(ComponentInstance* cmp) noexcept;
-        void setSelectedDeviceAndPackage(const library::Device* device,
-                                         const library::Package* package) noexcept;
+        void setSelectedDeviceAndPackage(const std::shared_ptr<const library::Device>& device,
+                                         const std::shared_ptr<const library::Package>& package) noexcept;
         void setSelectedFootprintUuid(const Uuid& uuid) noexcept;
         void beginUndoCmdGroup() noexcept;
         void addNextDeviceToCmdGroup(ComponentInstance& cmp, const Uuid& deviceUuid, Uuid footprintUuid) noexcept;
@@ -119,18 +121,14 @@ class UnplacedComponentsDock final : public QDockWidget
         Project& mProject;
         Board* mBoard;
         Ui::UnplacedComponentsDock* mUi;
+        UnplacedComponentsModel* mListModel;
         GraphicsScene* mFootprintPreviewGraphicsScene;
         library::FootprintPreviewGraphicsItem* mFootprintPreviewGraphicsItem;
         ComponentInstance* mSelectedComponent;
-        const library::Device* mSelectedDevice;
-        const library::Package* mSelectedPackage;
+        std::shared_ptr<const library::Device> mSelectedDevice; ///< shared, see LibraryElementCache
+        std::shared_ptr<const library::Package> mSelectedPackage; ///< shared, see LibraryElementCache
         Uuid mSelectedFootprintUuid;
-        QMetaObject::Connection mCircuitConnection1;
-        QMetaObject::Connection mCircuitConnection2;
-        QMetaObject::Connection mBoardConnection1;
-        QMetaObject::Connection mBoardConnection2;
         Point mNextPosition;
-        bool mDisableListUpdate;
         QHash<Uuid, Uuid> mLastDeviceOfComponent;
         QHash<Uuid, Uuid> mLastFootprintOfDevice;
         QScopedPointer<UndoCommandGroup> mCurrentUndoCmdGroup;
@@ -0,0 +1,257 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtGui>
+#include "unplacedcomponentsmodel.h"
+#include <librepcb/project/boards/board.h>
+#include <librepcb/project/boards/items/bi_device.h>
+#include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/circuit/componentinstance.h>
+#include <librepcb/project/project.h>
+#include <librepcb/project/settings/projectsettings.h>
+#include <librepcb/library/elements.h>
+#include <librepcb/workspace/workspace.h>
+#include <librepcb/workspace/library/workspacelibrarydb.h>
+#include <librepcb/workspace/library/workspacelibrarypreviewcache.h>
+#include "../projecteditor.h"
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+namespace editor {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+UnplacedComponentsModel::UnplacedComponentsModel(ProjectEditor& editor, QObject* parent) noexcept :
+    QAbstractListModel(parent), mProjectEditor(editor), mProject(editor.getProject()),
+    mBoard(nullptr), mItems(), mDeviceCountCache(), mBoardConnections()
+{
+    connect(&mProject.getCircuit(), &Circuit::componentAdded,
+            this, &UnplacedComponentsModel::componentAddedToCircuit);
+    connect(&mProject.getCircuit(), &Circuit::componentRemoved,
+            this, &UnplacedComponentsModel::componentRemovedFromCircuit);
+}
+
+UnplacedComponentsModel::~UnplacedComponentsModel() noexcept
+{
+    setBoard(nullptr);
+}
+
+/*****************************************************************************************
+ *  Getters
+ ****************************************************************************************/
+
+Uuid UnplacedComponentsModel::getComponentUuid(int row) const noexcept
+{
+    if ((row >= 0) && (row < mItems.count()))
+        return mItems.at(row).uuid;
+    else
+        return Uuid();
+}
+
+/*****************************************************************************************
+ *  Setters
+ ****************************************************************************************/
+
+void UnplacedComponentsModel::setBoard(Board* board) noexcept
+{
+    foreach (const QMetaObject::Connection& connection, mBoardConnections)
+        disconnect(connection);
+    mBoardConnections.clear();
+
+    mBoard = board;
+    if (board)
+    {
+        mBoardConnections.append(connect(board, &Board::deviceAdded,
+            [this](BI_Device& device){deviceAddedToBoard(device);}));
+        mBoardConnections.append(connect(board, &Board::deviceRemoved,
+            [this](BI_Device& device){deviceRemovedFromBoard(device);}));
+    }
+    rebuildItems();
+}
+
+/*****************************************************************************************
+ *  Reimplemented Methods
+ ****************************************************************************************/
+
+int UnplacedComponentsModel::rowCount(const QModelIndex& parent) const noexcept
+{
+    return parent.isValid() ? 0 : mItems.count();
+}
+
+QVariant UnplacedComponentsModel::data(const QModelIndex& index, int role) const noexcept
+{
+    if ((!index.isValid()) || (index.row() >= mItems.count())) return QVariant();
+
+    // the icon is loaded lazily so scrolling through a long list only hits the preview
+    // cache for the visible rows
+    Item& item = const_cast<UnplacedComponentsModel*>(this)->mItems[index.row()];
+    switch (role)
+    {
+        case Qt::DisplayRole:
+            return item.text;
+        case Qt::UserRole:
+            return item.uuid.toStr();
+        case Qt::DecorationRole: {
+            if (!item.iconLoaded) {
+                item.iconLoaded = true;
+                const ComponentInstance* cmp =
+                    mProject.getCircuit().getComponentInstanceByUuid(item.uuid);
+                if (cmp) {
+                    QPixmap preview = mProjectEditor.getWorkspace().getLibraryPreviewCache().getPixmap(
+                        cmp->getLibComponent().getUuid(), cmp->getLibComponent().getVersion());
+                    if (!preview.isNull()) item.icon = QIcon(preview);
+                }
+            }
+            return item.icon.isNull() ? QVariant() : QVariant(item.icon);
+        }
+        default:
+            return QVariant();
+    }
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+void UnplacedComponentsModel::componentAddedToCircuit(ComponentInstance& cmp) noexcept
+{
+    if (isUnplaced(cmp)) insertComponent(cmp);
+}
+
+void UnplacedComponentsModel::componentRemovedFromCircuit(ComponentInstance& cmp) noexcept
+{
+    removeComponent(cmp.getUuid());
+}
+
+void UnplacedComponentsModel::deviceAddedToBoard(BI_Device& device) noexcept
+{
+    removeComponent(device.getComponentInstanceUuid());
+}
+
+void UnplacedComponentsModel::deviceRemovedFromBoard(BI_Device& device) noexcept
+{
+    ComponentInstance& cmp = device.getComponentInstance();
+    if (isUnplaced(cmp)) insertComponent(cmp);
+}
+
+void UnplacedComponentsModel::insertComponent(ComponentInstance& cmp) noexcept
+{
+    // keep the list sorted by UUID so the insert position (and findRow()) can be
+    // determined with a binary search even while a huge import is running
+    int row = findInsertPosition(cmp.getUuid());
+    if ((row < mItems.count()) && (mItems.at(row).uuid == cmp.getUuid())) return; // already in the list
+    beginInsertRows(QModelIndex(), row, row);
+    mItems.insert(row, makeItem(cmp));
+    endInsertRows();
+}
+
+void UnplacedComponentsModel::removeComponent(const Uuid& cmpUuid) noexcept
+{
+    int row = findRow(cmpUuid);
+    if (row < 0) return;
+    beginRemoveRows(QModelIndex(), row, row);
+    mItems.removeAt(row);
+    endRemoveRows();
+}
+
+void UnplacedComponentsModel::rebuildItems() noexcept
+{
+    beginResetModel();
+    mItems.clear();
+    mDeviceCountCache.clear(); // the library may have been rescanned in the meantime
+    if (mBoard)
+    {
+        // iterating the component map yields ascending UUIDs, matching insertComponent()
+        foreach (ComponentInstance* cmp, mProject.getCircuit().getComponentInstances())
+        {
+            if (isUnplaced(*cmp)) mItems.append(makeItem(*cmp));
+        }
+    }
+    endResetModel();
+}
+
+bool UnplacedComponentsModel::isUnplaced(const ComponentInstance& cmp) const noexcept
+{
+    if (!mBoard) return false;
+    if (mBoard->getDeviceInstances().contains(cmp.getUuid())) return false;
+    if (cmp.getLibComponent().isSchematicOnly()) return false;
+    return true;
+}
+
+UnplacedComponentsModel::Item UnplacedComponentsModel::makeItem(const ComponentInstance& cmp) noexcept
+{
+    // the device count needs a library database query, so it is cached per library
+    // component (many instances usually share few library components)
+    Uuid libCmpUuid = cmp.getLibComponent().getUuid();
+    auto it = mDeviceCountCache.find(libCmpUuid);
+    if (it == mDeviceCountCache.end()) {
+        int count = mProjectEditor.getWorkspace().getLibraryDb()
+                    .getDevicesOfComponent(libCmpUuid).count();
+        it = mDeviceCountCache.insert(libCmpUuid, count);
+    }
+
+    Item item;
+    item.uuid = cmp.getUuid();
+    QString name = cmp.getName();
+    QString value = cmp.getValue(true).replace("\n", "|");
+    QString compName = cmp.getLibComponent().getNames().value(mProject.getSettings().getLocaleOrder());
+    item.text = QString("{%1} %2 (%3) [%4]").arg(it.value()).arg(name, value, compName);
+    item.iconLoaded = false;
+    return item;
+}
+
+int UnplacedComponentsModel::findRow(const Uuid& cmpUuid) const noexcept
+{
+    int row = findInsertPosition(cmpUuid);
+    if ((row < mItems.count()) && (mItems.at(row).uuid == cmpUuid))
+        return row;
+    else
+        return -1;
+}
+
+int UnplacedComponentsModel::findInsertPosition(const Uuid& cmpUuid) const noexcept
+{
+    int lower = 0;
+    int upper = mItems.count();
+    while (lower < upper) {
+        int middle = (lower + upper) / 2;
+        if (mItems.at(middle).uuid < cmpUuid)
+            lower = middle + 1;
+        else
+            upper = middle;
+    }
+    return lower;
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace editor
+} // namespace project
+} // namespace librepcb
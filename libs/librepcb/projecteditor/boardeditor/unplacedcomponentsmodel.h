@@ -0,0 +1,145 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_PROJECT_UNPLACEDCOMPONENTSMODEL_H
+#define LIBREPCB_PROJECT_UNPLACEDCOMPONENTSMODEL_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtGui>
+#include <librepcb/common/uuid.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+namespace project {
+
+class Project;
+class Board;
+class BI_Device;
+class ComponentInstance;
+
+namespace editor {
+
+class ProjectEditor;
+
+/*****************************************************************************************
+ *  Class UnplacedComponentsModel
+ ****************************************************************************************/
+
+/**
+ * @brief Item model of all component instances which are not yet placed on a board
+ *
+ * The model is used by the librepcb#project#editor#UnplacedComponentsDock. In contrast
+ * to the QListWidget used previously, it is updated *incrementally*: the circuit's
+ * componentAdded/componentRemoved and the board's deviceAdded/deviceRemoved signals
+ * insert or remove exactly the affected row instead of rebuilding the whole list. This
+ * keeps the board editor responsive while a large schematic import adds hundreds of
+ * components or while "Auto-Add All" places them one by one.
+ *
+ * The displayed text (including the device count, which requires a library database
+ * query) is computed once when a row is inserted and then reused. Row icons are taken
+ * from the shared librepcb#workspace#WorkspaceLibraryPreviewCache on first request, so
+ * no library elements need to be parsed just to paint the list.
+ */
+class UnplacedComponentsModel final : public QAbstractListModel
+{
+        Q_OBJECT
+
+    public:
+
+        // Constructors / Destructor
+        UnplacedComponentsModel() = delete;
+        UnplacedComponentsModel(const UnplacedComponentsModel& other) = delete;
+        explicit UnplacedComponentsModel(ProjectEditor& editor, QObject* parent = nullptr) noexcept;
+        ~UnplacedComponentsModel() noexcept;
+
+        // Getters
+
+        /**
+         * @brief Get the UUID of the component instance in the given row
+         *
+         * @return The component UUID, or a null UUID if the row is invalid
+         */
+        Uuid getComponentUuid(int row) const noexcept;
+
+        // Setters
+
+        /**
+         * @brief Set the board whose devices count as "placed"
+         *
+         * Resets the model and follows the deviceAdded/deviceRemoved signals of the new
+         * board. If the board is nullptr, the model is empty.
+         */
+        void setBoard(Board* board) noexcept;
+
+        // Reimplemented Methods
+        int rowCount(const QModelIndex& parent = QModelIndex()) const noexcept override;
+        QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const noexcept override;
+
+        // Operator Overloadings
+        UnplacedComponentsModel& operator=(const UnplacedComponentsModel& rhs) = delete;
+
+
+    private:
+
+        // Types
+
+        /// One row of the model (text is precomputed, icon is loaded lazily)
+        struct Item {
+            Uuid uuid;          ///< UUID of the component instance
+            QString text;       ///< precomputed display text
+            QIcon icon;         ///< cached preview (null if none or not loaded yet)
+            bool iconLoaded;    ///< true after the preview cache lookup was done
+        };
+
+        // Private Methods
+        void componentAddedToCircuit(ComponentInstance& cmp) noexcept;
+        void componentRemovedFromCircuit(ComponentInstance& cmp) noexcept;
+        void deviceAddedToBoard(BI_Device& device) noexcept;
+        void deviceRemovedFromBoard(BI_Device& device) noexcept;
+        void insertComponent(ComponentInstance& cmp) noexcept;
+        void removeComponent(const Uuid& cmpUuid) noexcept;
+        void rebuildItems() noexcept;
+        bool isUnplaced(const ComponentInstance& cmp) const noexcept;
+        Item makeItem(const ComponentInstance& cmp) noexcept;
+        int findRow(const Uuid& cmpUuid) const noexcept;
+        int findInsertPosition(const Uuid& cmpUuid) const noexcept;
+
+        // Attributes
+        ProjectEditor& mProjectEditor;
+        Project& mProject;
+        Board* mBoard;
+        QList<Item> mItems; ///< sorted by component UUID (stable insertion order)
+        QHash<Uuid, int> mDeviceCountCache; ///< devices per library component UUID
+        QList<QMetaObject::Connection> mBoardConnections;
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace editor
+} // namespace project
+} // namespace librepcb
+
+#endif // LIBREPCB_PROJECT_UNPLACEDCOMPONENTSMODEL_H
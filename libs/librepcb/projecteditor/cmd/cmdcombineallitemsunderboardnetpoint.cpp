@@ -68,11 +68,16 @@ bool CmdCombineAllItemsUnderBoardNetPoint::performExecute()
     // if an error occurs, undo all already executed child commands
     auto undoScopeGuard = scopeGuard([&](){performUndo();});
 
-    // get all vias, netpoints, netlines and footprint pads under the netpoint
-    QList<BI_NetPoint*> netpointsUnderCursor = mBoard.getNetPointsAtScenePos(mNetPoint.getPosition(), &mNetPoint.getLayer(), &mNetPoint.getNetSignal());
-    QList<BI_NetLine*> netlinesUnderCursor = mBoard.getNetLinesAtScenePos(mNetPoint.getPosition(), &mNetPoint.getLayer(), &mNetPoint.getNetSignal());
-    QList<BI_FootprintPad*> padsUnderCursor = mBoard.getPadsAtScenePos(mNetPoint.getPosition(), &mNetPoint.getLayer(), &mNetPoint.getNetSignal());
-    QList<BI_Via*> viasUnderCursor = mBoard.getViasAtScenePos(mNetPoint.getPosition(), &mNetPoint.getNetSignal());
+    // get all vias, netpoints, netlines and footprint pads under the netpoint with
+    // one traversal of the spatial index (this runs on every placed trace endpoint)
+    QList<BI_NetPoint*> netpointsUnderCursor;
+    QList<BI_NetLine*> netlinesUnderCursor;
+    QList<BI_FootprintPad*> padsUnderCursor;
+    QList<BI_Via*> viasUnderCursor;
+    mBoard.getNetItemsAtScenePos(mNetPoint.getPosition(), &mNetPoint.getLayer(),
+                                 &mNetPoint.getNetSignal(), &netpointsUnderCursor,
+                                 &netlinesUnderCursor, &padsUnderCursor,
+                                 &viasUnderCursor);
 
     // combine all netpoints together
     // TODO: does this work properly in any case?
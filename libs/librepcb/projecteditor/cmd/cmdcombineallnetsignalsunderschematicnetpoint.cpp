@@ -118,7 +118,20 @@ bool CmdCombineAllNetSignalsUnderSchematicNetPoint::performExecute()
     // check forced net names
     QString nameOfResultingNetSignal;
     if (forcedNetNames.count() == 0) {
-        nameOfResultingNetSignal = mNetPoint.getNetSignal().getName();
+        // no forced names --> keep the net signal with the most registered elements,
+        // so combining the nets has to move as few elements as possible. But never
+        // discard a user-given net name in favor of an auto-generated one.
+        NetSignal* bestNetSignal = &mNetPoint.getNetSignal();
+        foreach (NetSignal* netsignal, netSignalsUnderCursor) {
+            if ((bestNetSignal->hasAutoName() && (!netsignal->hasAutoName()))
+                || ((bestNetSignal->hasAutoName() == netsignal->hasAutoName())
+                    && (netsignal->getRegisteredElementsCount() >
+                        bestNetSignal->getRegisteredElementsCount())))
+            {
+                bestNetSignal = netsignal;
+            }
+        }
+        nameOfResultingNetSignal = bestNetSignal->getName();
     } else if (forcedNetNames.count() == 1) {
         nameOfResultingNetSignal = forcedNetNames.first();
     } else if (forcedNetNames.count() > 1) {
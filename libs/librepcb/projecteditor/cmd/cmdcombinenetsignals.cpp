@@ -23,6 +23,11 @@
 #include <QtCore>
 #include "cmdcombinenetsignals.h"
 #include <librepcb/common/scopeguard.h>
+#include <librepcb/common/graphics/graphicsscene.h>
+#include <librepcb/project/project.h>
+#include <librepcb/project/erc/ercmsglist.h>
+#include <librepcb/project/schematics/schematic.h>
+#include <librepcb/project/boards/board.h>
 #include <librepcb/project/circuit/netsignal.h>
 #include <librepcb/project/schematics/items/si_netpoint.h>
 #include <librepcb/project/schematics/items/si_netline.h>
@@ -51,6 +56,39 @@ namespace librepcb {
 namespace project {
 namespace editor {
 
+namespace {
+
+/**
+ * RAII guard which batches the scene updates of all schematics and boards of a
+ * project plus the ERC dock updates. Merging two big nets temporarily removes and
+ * re-adds thousands of items across all documents, so every pass of this command
+ * must run as one batched mutation instead of per-item updates.
+ */
+struct ProjectWideBatchGuard {
+    explicit ProjectWideBatchGuard(Project& project) noexcept :
+        mErcGuard(project.getErcMsgList())
+    {
+        foreach (Schematic* schematic, project.getSchematics()) {
+            mScenes.append(&schematic->getGraphicsScene());
+        }
+        foreach (Board* board, project.getBoards()) {
+            mScenes.append(&board->getGraphicsScene());
+        }
+        foreach (GraphicsScene* scene, mScenes) {
+            scene->beginBatch();
+        }
+    }
+    ~ProjectWideBatchGuard() noexcept {
+        foreach (GraphicsScene* scene, mScenes) {
+            scene->endBatch();
+        }
+    }
+    QList<GraphicsScene*> mScenes;
+    ErcMsgListBatchGuard mErcGuard;
+};
+
+} // namespace
+
 /*****************************************************************************************
  *  Constructors / Destructor
  ****************************************************************************************/
@@ -72,6 +110,9 @@ CmdCombineNetSignals::~CmdCombineNetSignals() noexcept
 
 bool CmdCombineNetSignals::performExecute()
 {
+    // one batched mutation across all documents, see ProjectWideBatchGuard
+    ProjectWideBatchGuard batchGuard(mCircuit.getProject());
+
     // if an error occurs, undo all already executed child commands
     auto undoScopeGuard = scopeGuard([&](){performUndo();});
 
@@ -172,6 +213,18 @@ bool CmdCombineNetSignals::performExecute()
     return true;
 }
 
+void CmdCombineNetSignals::performUndo()
+{
+    ProjectWideBatchGuard batchGuard(mCircuit.getProject());
+    UndoCommandGroup::performUndo(); // can throw
+}
+
+void CmdCombineNetSignals::performRedo()
+{
+    ProjectWideBatchGuard batchGuard(mCircuit.getProject());
+    UndoCommandGroup::performRedo(); // can throw
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -60,6 +60,12 @@ class CmdCombineNetSignals final : public UndoCommandGroup
         /// @copydoc UndoCommand::performExecute()
         bool performExecute() override;
 
+        /// @copydoc UndoCommand::performUndo()
+        void performUndo() override;
+
+        /// @copydoc UndoCommand::performRedo()
+        void performRedo() override;
+
 
         // Attributes from the constructor
         Circuit& mCircuit;
@@ -23,6 +23,7 @@
 #include <QtCore>
 #include "cmdflipselectedboarditems.h"
 #include <librepcb/common/scopeguard.h>
+#include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/gridproperties.h>
 #include <librepcb/library/pkg/footprintpad.h>
 #include <librepcb/project/project.h>
@@ -89,6 +90,12 @@ bool CmdFlipSelectedBoardItems::performExecute()
 
     // TODO: make this feature more sophisticated!
 
+    // batch all scene updates of the flip into a single invalidation, and let the
+    // deferred netline update mechanism of the board coalesce the per-pad netline
+    // reattachments into one geometry pass at the end of the event loop turn -
+    // without this, flipping a large section updated the scene once per device
+    GraphicsSceneBatchGuard batchGuard(mBoard.getGraphicsScene());
+
     // find all bounding netpoints
     /*QList<BI_NetPoint*> netpoints;
     QList<BI_NetPoint*> boundingNetPoints;
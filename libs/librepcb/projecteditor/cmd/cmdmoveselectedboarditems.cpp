@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "cmdmoveselectedboarditems.h"
+#include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/gridproperties.h>
 #include <librepcb/project/project.h>
 #include <librepcb/project/boards/board.h>
@@ -46,8 +47,12 @@ namespace editor {
 
 CmdMoveSelectedBoardItems::CmdMoveSelectedBoardItems(Board& board, const Point& startPos) noexcept :
     UndoCommandGroup(tr("Move Board Elements")),
-    mBoard(board), mStartPos(startPos), mDeltaPos(0, 0)
+    mBoard(board), mStartPos(startPos), mDeltaPos(0, 0),
+    mInteractiveEditActive(true)
 {
+    // keep the scene in no-index mode while the selection is dragged around
+    mBoard.getGraphicsScene().beginInteractiveEdit();
+
     // get all selected items
     QList<BI_Base*> items = mBoard.getSelectedItems(true, false, true, false, true, false,
                                                     false, false, false, false, false, false);
@@ -84,6 +89,17 @@ CmdMoveSelectedBoardItems::CmdMoveSelectedBoardItems(Board& board, const Point&
 
 CmdMoveSelectedBoardItems::~CmdMoveSelectedBoardItems() noexcept
 {
+    endInteractiveEdit();
+}
+
+void CmdMoveSelectedBoardItems::endInteractiveEdit() noexcept
+{
+    // the command object itself lives on the undo stack long after the drop, so the
+    // no-index mode must end at drop/abort time, not at destruction time
+    if (mInteractiveEditActive) {
+        mBoard.getGraphicsScene().endInteractiveEdit();
+        mInteractiveEditActive = false;
+    }
 }
 
 /*****************************************************************************************
@@ -96,7 +112,8 @@ void CmdMoveSelectedBoardItems::setCurrentPosition(const Point& pos) noexcept
     delta.mapToGrid(mBoard.getGridProperties().getInterval());
 
     if (delta != mDeltaPos) {
-        // move selected elements
+        // move selected elements, with all scene updates batched into one pass
+        GraphicsSceneBatchGuard batchGuard(mBoard.getGraphicsScene());
         foreach (CmdDeviceInstanceEdit* cmd, mDeviceEditCmds) {
             cmd->setDeltaToStartPos(delta, true);
         }
@@ -116,6 +133,9 @@ void CmdMoveSelectedBoardItems::setCurrentPosition(const Point& pos) noexcept
 
 bool CmdMoveSelectedBoardItems::performExecute()
 {
+    endInteractiveEdit(); // the drag has ended
+
+
     if (mDeltaPos.isOrigin()) {
         // no movement required --> discard all move commands
         qDeleteAll(mDeviceEditCmds);    mDeviceEditCmds.clear();
@@ -64,6 +64,7 @@ class CmdMoveSelectedBoardItems final : public UndoCommandGroup
         // Private Methods
 
         /// @copydoc UndoCommand::performExecute()
+        void endInteractiveEdit() noexcept;
         bool performExecute() override;
 
 
@@ -71,6 +72,7 @@ class CmdMoveSelectedBoardItems final : public UndoCommandGroup
         Board& mBoard;
         Point mStartPos;
         Point mDeltaPos;
+        bool mInteractiveEditActive; ///< scene no-index mode still active
 
         // Move commands
         QList<CmdDeviceInstanceEdit*> mDeviceEditCmds;
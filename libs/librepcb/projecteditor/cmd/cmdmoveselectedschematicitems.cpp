@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "cmdmoveselectedschematicitems.h"
+#include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/gridproperties.h>
 #include <librepcb/project/project.h>
 #include <librepcb/project/schematics/schematic.h>
@@ -48,8 +49,12 @@ namespace editor {
 CmdMoveSelectedSchematicItems::CmdMoveSelectedSchematicItems(Schematic& schematic,
                                                              const Point& startPos) noexcept :
     UndoCommandGroup(tr("Move Schematic Elements")),
-    mSchematic(schematic), mStartPos(startPos), mDeltaPos(0, 0)
+    mSchematic(schematic), mStartPos(startPos), mDeltaPos(0, 0),
+    mInteractiveEditActive(true)
 {
+    // keep the scene in no-index mode while the selection is dragged around
+    mSchematic.getGraphicsScene().beginInteractiveEdit();
+
     // get all selected items
     QList<SI_Base*> items = mSchematic.getSelectedItems(false, true, false, true, false, false,
                                                         false, false, false, false, false);
@@ -85,6 +90,17 @@ CmdMoveSelectedSchematicItems::CmdMoveSelectedSchematicItems(Schematic& schemati
 
 CmdMoveSelectedSchematicItems::~CmdMoveSelectedSchematicItems() noexcept
 {
+    endInteractiveEdit();
+}
+
+void CmdMoveSelectedSchematicItems::endInteractiveEdit() noexcept
+{
+    // the command object itself lives on the undo stack long after the drop, so the
+    // no-index mode must end at drop/abort time, not at destruction time
+    if (mInteractiveEditActive) {
+        mSchematic.getGraphicsScene().endInteractiveEdit();
+        mInteractiveEditActive = false;
+    }
 }
 
 /*****************************************************************************************
@@ -117,6 +133,8 @@ void CmdMoveSelectedSchematicItems::setCurrentPosition(const Point& pos) noexcep
 
 bool CmdMoveSelectedSchematicItems::performExecute()
 {
+    endInteractiveEdit(); // the drag has ended
+
     if (mDeltaPos.isOrigin()) {
         // no movement required --> discard all move commands
         qDeleteAll(mSymbolEditCmds);    mSymbolEditCmds.clear();
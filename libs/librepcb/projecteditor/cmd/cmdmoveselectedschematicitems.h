@@ -64,6 +64,7 @@ class CmdMoveSelectedSchematicItems final : public UndoCommandGroup
         // Private Methods
 
         /// @copydoc UndoCommand::performExecute()
+        void endInteractiveEdit() noexcept;
         bool performExecute() override;
 
 
@@ -71,6 +72,7 @@ class CmdMoveSelectedSchematicItems final : public UndoCommandGroup
         Schematic& mSchematic;
         Point mStartPos;
         Point mDeltaPos;
+        bool mInteractiveEditActive; ///< scene no-index mode still active
 
         // Move commands
         QList<CmdSymbolInstanceEdit*> mSymbolEditCmds;
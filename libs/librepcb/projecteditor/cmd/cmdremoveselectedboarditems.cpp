@@ -23,6 +23,7 @@
 #include <QtCore>
 #include "cmdremoveselectedboarditems.h"
 #include <librepcb/common/scopeguard.h>
+#include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/project/project.h>
 #include <librepcb/project/boards/board.h>
 #include <librepcb/project/boards/items/bi_device.h>
@@ -30,8 +31,7 @@
 #include <librepcb/project/boards/items/bi_via.h>
 #include <librepcb/project/boards/items/bi_netline.h>
 #include <librepcb/project/boards/items/bi_netpoint.h>
-#include <librepcb/project/boards/cmd/cmdboardnetlineremove.h>
-#include <librepcb/project/boards/cmd/cmdboardnetpointremove.h>
+#include <librepcb/project/boards/cmd/cmdboardnetitemsremove.h>
 #include "cmdremoveviafromboard.h"
 #include "cmdremovedevicefromboard.h"
 
@@ -61,6 +61,9 @@ CmdRemoveSelectedBoardItems::~CmdRemoveSelectedBoardItems() noexcept
 
 bool CmdRemoveSelectedBoardItems::performExecute()
 {
+    // batch the scene updates, many items are removed at once
+    GraphicsSceneBatchGuard batchGuard(mBoard.getGraphicsScene());
+
     // if an error occurs, undo all already executed child commands
     auto undoScopeGuard = scopeGuard([&](){performUndo();});
 
@@ -71,23 +74,22 @@ bool CmdRemoveSelectedBoardItems::performExecute()
     // clear selection because these items will be removed now
     mBoard.clearSelection();
 
-    // remove all netlines
+    // remove all netlines and unconnected netpoints with one bulk command, so a
+    // mass delete performs one batched pass instead of one command per item
+    QList<BI_NetLine*> netlines;
+    QList<BI_NetPoint*> netpoints;
     foreach (BI_Base* item, items) {
         if (item->getType() == BI_Base::Type_t::NetLine) {
             BI_NetLine* netline = dynamic_cast<BI_NetLine*>(item); Q_ASSERT(netline);
-            execNewChildCmd(new CmdBoardNetLineRemove(*netline)); // can throw
-        }
-    }
-
-    // remove all netpoints
-    foreach (BI_Base* item, items) {
-        if (item->getType() == BI_Base::Type_t::NetPoint) {
+            netlines.append(netline);
+        } else if (item->getType() == BI_Base::Type_t::NetPoint) {
             BI_NetPoint* netpoint = dynamic_cast<BI_NetPoint*>(item); Q_ASSERT(netpoint);
-            if (netpoint->getLines().count() == 0) {
-                execNewChildCmd(new CmdBoardNetPointRemove(*netpoint)); // can throw
-            }
+            netpoints.append(netpoint);
         }
     }
+    if ((!netlines.isEmpty()) || (!netpoints.isEmpty())) {
+        execNewChildCmd(new CmdBoardNetItemsRemove(mBoard, netlines, netpoints)); // can throw
+    }
 
     // remove all vias
     foreach (BI_Base* item, items) {
@@ -110,6 +112,18 @@ bool CmdRemoveSelectedBoardItems::performExecute()
     return (getChildCount() > 0);
 }
 
+void CmdRemoveSelectedBoardItems::performUndo()
+{
+    GraphicsSceneBatchGuard batchGuard(mBoard.getGraphicsScene());
+    UndoCommandGroup::performUndo(); // can throw
+}
+
+void CmdRemoveSelectedBoardItems::performRedo()
+{
+    GraphicsSceneBatchGuard batchGuard(mBoard.getGraphicsScene());
+    UndoCommandGroup::performRedo(); // can throw
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -23,6 +23,7 @@
 #include <QtCore>
 #include "cmdremoveselectedschematicitems.h"
 #include <librepcb/common/scopeguard.h>
+#include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/project/project.h>
 #include <librepcb/project/circuit/netsignal.h>
 #include <librepcb/project/circuit/componentinstance.h>
@@ -77,6 +78,9 @@ CmdRemoveSelectedSchematicItems::~CmdRemoveSelectedSchematicItems() noexcept
 
 bool CmdRemoveSelectedSchematicItems::performExecute()
 {
+    // batch the scene updates, many items are removed at once
+    GraphicsSceneBatchGuard batchGuard(mSchematic.getGraphicsScene());
+
     // if an error occurs, undo all already executed child commands
     auto undoScopeGuard = scopeGuard([&](){performUndo();});
 
@@ -200,6 +204,18 @@ void CmdRemoveSelectedSchematicItems::disconnectComponentSignalInstance(Componen
     execNewChildCmd(new CmdCompSigInstSetNetSignal(signal, nullptr)); // can throw
 }
 
+void CmdRemoveSelectedSchematicItems::performUndo()
+{
+    GraphicsSceneBatchGuard batchGuard(mSchematic.getGraphicsScene());
+    UndoCommandGroup::performUndo(); // can throw
+}
+
+void CmdRemoveSelectedSchematicItems::performRedo()
+{
+    GraphicsSceneBatchGuard batchGuard(mSchematic.getGraphicsScene());
+    UndoCommandGroup::performRedo(); // can throw
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
@@ -61,6 +61,12 @@ class CmdRemoveSelectedSchematicItems final : public UndoCommandGroup
         /// @copydoc UndoCommand::performExecute()
         bool performExecute() override;
 
+        /// @copydoc UndoCommand::performUndo()
+        void performUndo() override;
+
+        /// @copydoc UndoCommand::performRedo()
+        void performRedo() override;
+
         void detachNetPointFromSymbolPin(SI_NetPoint& netpoint);
         void disconnectComponentSignalInstance(ComponentSignalInstance& signal);
 
@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "cmdrotateselectedboarditems.h"
+#include <librepcb/common/graphics/graphicsscene.h>
 #include <librepcb/common/gridproperties.h>
 #include <librepcb/project/project.h>
 #include <librepcb/project/boards/board.h>
@@ -109,7 +110,9 @@ bool CmdRotateSelectedBoardItems::performExecute()
         }
     }
 
-    // execute all child commands
+    // execute all child commands with a single batched scene update; the
+    // deferred netline updates of the board coalesce the geometry pass as well
+    GraphicsSceneBatchGuard batchGuard(mBoard.getGraphicsScene());
     return UndoCommandGroup::performExecute(); // can throw
 }
 
@@ -40,6 +40,7 @@
 #include <librepcb/workspace/workspace.h>
 #include <librepcb/library/cat/componentcategory.h>
 #include <librepcb/workspace/library/workspacelibrarydb.h>
+#include <librepcb/workspace/library/workspacelibrarypreviewcache.h>
 #include <librepcb/common/gridproperties.h>
 
 /*****************************************************************************************
@@ -70,6 +71,23 @@ AddComponentDialog::AddComponentDialog(workspace::Workspace& workspace, Project&
     connect(mUi->treeCategories->selectionModel(), &QItemSelectionModel::currentChanged,
             this, &AddComponentDialog::treeCategories_currentItemChanged);
 
+    // keyword search over the full-text index (added programmatically to avoid
+    // touching the translated .ui layout). The query itself is fast (SQLite FTS),
+    // but it is still debounced so fast typing runs one query per quiet period.
+    mEdtSearch = new QLineEdit(this);
+    mEdtSearch->setPlaceholderText(tr("Search components (name, keywords, ...)"));
+    mEdtSearch->setClearButtonEnabled(true);
+    QBoxLayout* layout = qobject_cast<QBoxLayout*>(this->layout());
+    if (layout) {
+        layout->insertWidget(0, mEdtSearch);
+    }
+    mSearchDebounceTimer.setSingleShot(true);
+    mSearchDebounceTimer.setInterval(300);
+    connect(mEdtSearch, &QLineEdit::textChanged,
+            this, &AddComponentDialog::searchEditTextChanged);
+    connect(&mSearchDebounceTimer, &QTimer::timeout,
+            this, &AddComponentDialog::updateSearchResults);
+
     //setSelectedCategory(Uuid());
 }
 
@@ -107,6 +125,50 @@ Uuid AddComponentDialog::getSelectedSymbVarUuid() const noexcept
  *  Private Slots
  ****************************************************************************************/
 
+void AddComponentDialog::searchEditTextChanged(const QString& text)
+{
+    Q_UNUSED(text);
+    mSearchDebounceTimer.start(); // (re)start the quiet period
+}
+
+void AddComponentDialog::updateSearchResults() noexcept
+{
+    QString keyword = mEdtSearch->text().trimmed();
+    if (keyword.isEmpty()) {
+        // back to the category based browsing (reset the remembered category so
+        // setSelectedCategory() cannot take its nothing-changed shortcut)
+        mSelectedCategoryUuid = Uuid();
+        QModelIndex current = mUi->treeCategories->currentIndex();
+        treeCategories_currentItemChanged(current, current);
+        return;
+    }
+
+    setSelectedComponent(nullptr);
+    mUi->listComponents->clear();
+    mSelectedCategoryUuid = Uuid(); // the list no longer shows a category
+
+    try {
+        const QStringList& localeOrder = mProject.getSettings().getLocaleOrder();
+        QSet<Uuid> components =
+            mWorkspace.getLibraryDb().getComponentsBySearchKeyword(keyword); // can throw
+        foreach (const Uuid& cmpUuid, components) {
+            FilePath cmpFp = mWorkspace.getLibraryDb().getLatestComponent(cmpUuid);
+            if (!cmpFp.isValid()) continue;
+            // only the translations are fetched from the database; the component
+            // file itself is not parsed for the result list
+            QString name;
+            mWorkspace.getLibraryDb().getElementTranslations<library::Component>(
+                cmpFp, localeOrder, &name); // can throw
+            QListWidgetItem* item = new QListWidgetItem(name);
+            item->setData(Qt::UserRole, cmpFp.toStr());
+            mUi->listComponents->addItem(item);
+        }
+        mUi->listComponents->sortItems();
+    } catch (const Exception& e) {
+        qCritical() << "Component search failed:" << e.getMsg();
+    }
+}
+
 void AddComponentDialog::treeCategories_currentItemChanged(const QModelIndex& current, const QModelIndex& previous)
 {
     Q_UNUSED(previous);
@@ -130,7 +192,7 @@ void AddComponentDialog::on_listComponents_currentItemChanged(QListWidgetItem *c
         if (current)
         {
             library::Component* component = new library::Component(
-                FilePath(current->data(Qt::UserRole).toString()), true); // ugly...
+                FilePath(current->data(Qt::UserRole).toString()), true, true); // ugly...
             setSelectedComponent(component);
         }
         else
@@ -171,12 +233,24 @@ void AddComponentDialog::setSelectedCategory(const Uuid& categoryUuid)
     QSet<Uuid> components = mWorkspace.getLibraryDb().getComponentsByCategory(categoryUuid);
     foreach (const Uuid& cmpUuid, components)
     {
-        FilePath cmpFp = mWorkspace.getLibraryDb().getLatestComponent(cmpUuid);
-        if (!cmpFp.isValid()) continue;
-        library::Component component(cmpFp, true); // TODO: use library metadata instead of loading the whole component
-
-        QListWidgetItem* item = new QListWidgetItem(component.getNames().value(localeOrder));
+        // the whole list is built from database metadata only - no component
+        // file is parsed here, which made browsing large categories slow
+        QMultiMap<Version, FilePath> versions = mWorkspace.getLibraryDb().getComponents(cmpUuid);
+        if (versions.isEmpty()) continue;
+        Version version = versions.keys().last(); // highest version
+        FilePath cmpFp = versions.value(version);
+        QString name;
+        mWorkspace.getLibraryDb().getElementTranslations<library::Component>(
+            cmpFp, localeOrder, &name);
+
+        QListWidgetItem* item = new QListWidgetItem(name);
         item->setData(Qt::UserRole, cmpFp.toStr());
+        int signalCount = mWorkspace.getLibraryDb().getComponentSignalCount(cmpFp);
+        if (signalCount >= 0) {
+            item->setToolTip(QString(tr("%1 (%2 signals)")).arg(name).arg(signalCount));
+        }
+        QPixmap preview = mWorkspace.getLibraryPreviewCache().getPixmap(cmpUuid, version);
+        if (!preview.isNull()) item->setIcon(QIcon(preview));
         mUi->listComponents->addItem(item);
     }
 }
@@ -245,6 +319,19 @@ void AddComponentDialog::setSelectedSymbVar(const library::ComponentSymbolVarian
             mPreviewScene->addItem(*graphicsItem);
             mUi->graphicsView->zoomAll();
         }
+
+        // now that the preview was rendered anyway, store it in the workspace preview
+        // cache, so it can be shown as icon in the components list next time
+        workspace::WorkspaceLibraryPreviewCache& cache = mWorkspace.getLibraryPreviewCache();
+        if (!cache.contains(mSelectedComponent->getUuid(), mSelectedComponent->getVersion())) {
+            QRectF source = mPreviewScene->itemsBoundingRect().adjusted(-2, -2, 2, 2);
+            QImage image(QSize(64, 64), QImage::Format_ARGB32_Premultiplied);
+            image.fill(Qt::transparent);
+            QPainter painter(&image);
+            painter.setRenderHint(QPainter::Antialiasing);
+            mPreviewScene->render(&painter, image.rect(), source, Qt::KeepAspectRatio);
+            cache.storeImage(mSelectedComponent->getUuid(), mSelectedComponent->getVersion(), image);
+        }
     }
 }
 
@@ -90,6 +90,8 @@ class AddComponentDialog final : public QDialog
     private slots:
 
         void treeCategories_currentItemChanged(const QModelIndex& current, const QModelIndex& previous);
+        void searchEditTextChanged(const QString& text);
+        void updateSearchResults() noexcept;
         void on_listComponents_currentItemChanged(QListWidgetItem *current, QListWidgetItem *previous);
         void on_cbxSymbVar_currentIndexChanged(int index);
 
@@ -109,6 +111,8 @@ class AddComponentDialog final : public QDialog
         Ui::AddComponentDialog* mUi;
         GraphicsScene* mPreviewScene;
         workspace::ComponentCategoryTreeModel* mCategoryTreeModel;
+        QLineEdit* mEdtSearch; ///< keyword search field (uses the full-text index)
+        QTimer mSearchDebounceTimer; ///< one query per quiet period, not per keystroke
 
 
         // Attributes
@@ -42,7 +42,7 @@ namespace editor {
 
 ErcMsgDock::ErcMsgDock(Project& project) :
     QDockWidget(0), mProject(project), mErcMsgList(project.getErcMsgList()),
-    mUi(new Ui::ErcMsgDock)
+    mUi(new Ui::ErcMsgDock), mUiUpdateScheduled(false)
 {
     mUi->setupUi(this);
 
@@ -109,6 +109,12 @@ ErcMsgDock::ErcMsgDock(Project& project) :
     connect(&mProject.getErcMsgList(), &ErcMsgList::ercMsgRemoved,  this, &ErcMsgDock::ercMsgRemoved);
     connect(&mProject.getErcMsgList(), &ErcMsgList::ercMsgChanged,  this, &ErcMsgDock::ercMsgChanged);
 
+    // suspend repainting of the tree while many messages change at once
+    connect(&mProject.getErcMsgList(), &ErcMsgList::batchUpdateStarted, this,
+            [this](){mUi->treeWidget->setUpdatesEnabled(false);});
+    connect(&mProject.getErcMsgList(), &ErcMsgList::batchUpdateFinished, this,
+            [this](){mUi->treeWidget->setUpdatesEnabled(true);});
+
     updateTopLevelItemTexts();
 }
 
@@ -133,9 +139,8 @@ void ErcMsgDock::ercMsgAdded(ErcMsg* ercMsg) noexcept
     Q_ASSERT(parent); if (!parent) return;
     QTreeWidgetItem* child = new QTreeWidgetItem(parent, QStringList(ercMsg->getMsg()));
     child->setToolTip(0, ercMsg->getMsg());
-    parent->sortChildren(0, Qt::AscendingOrder);
     mErcMsgItems.insert(ercMsg, child);
-    updateTopLevelItemTexts();
+    scheduleUiUpdate(parent);
 }
 
 void ErcMsgDock::ercMsgRemoved(ErcMsg* ercMsg) noexcept
@@ -143,13 +148,28 @@ void ErcMsgDock::ercMsgRemoved(ErcMsg* ercMsg) noexcept
     Q_ASSERT(ercMsg);
     Q_ASSERT(mErcMsgItems.contains(ercMsg));
     delete mErcMsgItems.take(ercMsg);
-    updateTopLevelItemTexts();
+    scheduleUiUpdate(nullptr);
 }
 
 void ErcMsgDock::ercMsgChanged(ErcMsg* ercMsg) noexcept
 {
-    ercMsgRemoved(ercMsg);
-    ercMsgAdded(ercMsg);
+    Q_ASSERT(ercMsg);
+    QTreeWidgetItem* child = mErcMsgItems.value(ercMsg, nullptr);
+    Q_ASSERT(child); if (!child) return;
+    QTreeWidgetItem* parent;
+    if (!ercMsg->isIgnored())
+        parent = mTopLevelItems.value(static_cast<int>(ercMsg->getMsgType()), 0);
+    else
+        parent = mTopLevelItems.value(static_cast<int>(ErcMsg::ErcMsgType_t::_Count), 0);
+    Q_ASSERT(parent); if (!parent) return;
+    if (child->parent() != parent) {
+        // the message moved between "ignored" and its message type group
+        child->parent()->removeChild(child);
+        parent->addChild(child);
+    }
+    child->setText(0, ercMsg->getMsg());
+    child->setToolTip(0, ercMsg->getMsg());
+    scheduleUiUpdate(parent);
 }
 
 /*****************************************************************************************
@@ -195,6 +215,27 @@ void ErcMsgDock::on_btnIgnore_clicked(bool checked)
  *  Private Methods
  ****************************************************************************************/
 
+void ErcMsgDock::scheduleUiUpdate(QTreeWidgetItem* parentToSort) noexcept
+{
+    if (parentToSort) {
+        mParentsToSort.insert(parentToSort);
+    }
+    if (!mUiUpdateScheduled) {
+        mUiUpdateScheduled = true;
+        QMetaObject::invokeMethod(this, "updateUi", Qt::QueuedConnection);
+    }
+}
+
+void ErcMsgDock::updateUi() noexcept
+{
+    mUiUpdateScheduled = false;
+    foreach (QTreeWidgetItem* parent, mParentsToSort) {
+        parent->sortChildren(0, Qt::AscendingOrder); // top level items are never deleted
+    }
+    mParentsToSort.clear();
+    updateTopLevelItemTexts();
+}
+
 void ErcMsgDock::updateTopLevelItemTexts() noexcept
 {
     int countOfNonIgnoredErcMessages = 0;
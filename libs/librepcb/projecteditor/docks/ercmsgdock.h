@@ -74,9 +74,25 @@ class ErcMsgDock final : public QDockWidget
         void on_btnIgnore_clicked(bool checked);
 
 
+    private slots:
+
+        void updateUi() noexcept;
+
+
     private:
 
         // Private Methods
+
+        /**
+         * @brief Schedule a deferred UI update (sorting + top level item texts)
+         *
+         * The expensive aggregate work is done only once per event loop iteration,
+         * no matter how many ERC messages changed in between.
+         *
+         * @param parentToSort  The top level item whose childs need to be re-sorted
+         *                      (nullptr if none)
+         */
+        void scheduleUiUpdate(QTreeWidgetItem* parentToSort) noexcept;
         void updateTopLevelItemTexts() noexcept;
 
         // make some methods inaccessible...
@@ -90,6 +106,8 @@ class ErcMsgDock final : public QDockWidget
         Ui::ErcMsgDock* mUi;
         QHash<int, QTreeWidgetItem*> mTopLevelItems;
         QHash<ErcMsg*, QTreeWidgetItem*> mErcMsgItems;
+        QSet<QTreeWidgetItem*> mParentsToSort;
+        bool mUiUpdateScheduled;
 };
 
 /*****************************************************************************************
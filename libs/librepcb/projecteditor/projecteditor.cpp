@@ -70,6 +70,16 @@ ProjectEditor::ProjectEditor(workspace::Workspace& workspace, Project& project)
         // autosaving is enabled --> start the timer
         connect(&mAutoSaveTimer, &QTimer::timeout, this, &ProjectEditor::autosaveProject);
         mAutoSaveTimer.start(1000 * intervalSecs);
+
+        // print the result of each autosave to the debug output
+        connect(&mProject, &Project::autosaveFinished,
+                [](bool success, const QStringList& errors){
+            if (success) {
+                qDebug() << "Project successfully autosaved";
+            } else {
+                qWarning() << "Project autosave failed:" << errors.join("\n");
+            }
+        });
     }
 }
 
@@ -196,17 +206,12 @@ bool ProjectEditor::autosaveProject() noexcept
         return false;
     }
 
-    try
-    {
-        qDebug() << "Begin autosaving the project to temporary files...";
-        mProject.save(false);
-        qDebug() << "Project successfully autosaved";
-        return true;
-    }
-    catch (Exception& exc)
-    {
-        return false;
-    }
+    // serialize the project state now and write the temporary files in worker
+    // threads, so the main thread is not blocked while autosaving (see
+    // librepcb#project#Project#startAutosave())
+    qDebug() << "Begin autosaving the project to temporary files...";
+    mProject.startAutosave();
+    return true;
 }
 
 bool ProjectEditor::closeAndDestroy(bool askForSave, QWidget* msgBoxParent) noexcept
@@ -13,7 +13,7 @@ GENERATED_DIR = ../../../generated
 # Use common project definitions
 include(../../../common.pri)
 
-QT += core widgets xml sql printsupport
+QT += core widgets xml sql printsupport concurrent
 
 CONFIG += staticlib
 
@@ -31,9 +31,12 @@ SOURCES += \
     boardeditor/fsm/bes_base.cpp \
     boardeditor/fsm/bes_drawtrace.cpp \
     boardeditor/fsm/bes_fsm.cpp \
+    boardeditor/fsm/bes_measure.cpp \
     boardeditor/fsm/bes_select.cpp \
     boardeditor/fsm/boardeditorevent.cpp \
+    boardeditor/routingassistant.cpp \
     boardeditor/unplacedcomponentsdock.cpp \
+    boardeditor/unplacedcomponentsmodel.cpp \
     cmd/cmdaddcomponenttocircuit.cpp \
     cmd/cmdadddevicetoboard.cpp \
     cmd/cmdaddsymboltoschematic.cpp \
@@ -89,9 +92,12 @@ HEADERS += \
     boardeditor/fsm/bes_base.h \
     boardeditor/fsm/bes_drawtrace.h \
     boardeditor/fsm/bes_fsm.h \
+    boardeditor/fsm/bes_measure.h \
     boardeditor/fsm/bes_select.h \
     boardeditor/fsm/boardeditorevent.h \
+    boardeditor/routingassistant.h \
     boardeditor/unplacedcomponentsdock.h \
+    boardeditor/unplacedcomponentsmodel.h \
     cmd/cmdaddcomponenttocircuit.h \
     cmd/cmdadddevicetoboard.h \
     cmd/cmdaddsymboltoschematic.h \
@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include "ses_drawwire.h"
+#include <librepcb/common/graphics/graphicsscene.h>
 #include "../schematiceditor.h"
 #include "ui_schematiceditor.h"
 #include <librepcb/common/units/all_length_units.h>
@@ -107,6 +108,13 @@ bool SES_DrawWire::entry(SEE_Base* event) noexcept
     // clear schematic selection because selection does not make sense in this state
     if (mEditor.getActiveSchematic()) mEditor.getActiveSchematic()->clearSelection();
 
+    // while the tool is active, its preview items are mutated on every mouse move,
+    // so the scene index is disabled for the whole tool lifetime
+    if (Schematic* schematic = mEditor.getActiveSchematic()) {
+        mPreviewModeScene = &schematic->getGraphicsScene();
+        mPreviewModeScene->beginInteractiveEdit();
+    }
+
     // Add wire mode actions to the "command" toolbar
     mWireModeActions.insert(WireMode_HV, mEditorUi.commandToolbar->addAction(
                             QIcon(":/img/command_toolbars/wire_h_v.png"), ""));
@@ -201,6 +209,11 @@ bool SES_DrawWire::exit(SEE_Base* event) noexcept
 {
     Q_UNUSED(event);
 
+    if (mPreviewModeScene) {
+        mPreviewModeScene->endInteractiveEdit();
+        mPreviewModeScene = nullptr;
+    }
+
     // abort the currently active command
     if (mSubState != SubState_Idle)
         abortPositioning(true);
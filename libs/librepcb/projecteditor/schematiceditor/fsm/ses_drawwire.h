@@ -31,6 +31,8 @@
  *  Namespace / Forward Declarations
  ****************************************************************************************/
 namespace librepcb {
+
+class GraphicsScene;
 namespace project {
 
 class SI_NetPoint;
@@ -103,6 +105,7 @@ class SES_DrawWire final : public SES_Base
 
 
         // General Attributes
+        GraphicsScene* mPreviewModeScene = nullptr; ///< scene in no-index mode while tool active
         SubState mSubState; ///< the current substate
         WireMode mWireMode; ///< the current wire mode
         SI_NetPoint* mFixedNetPoint; ///< the fixed netpoint (start point of the line)
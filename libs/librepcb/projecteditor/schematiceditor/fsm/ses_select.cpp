@@ -36,6 +36,7 @@
 #include <librepcb/project/schematics/items/si_netlabel.h>
 #include <librepcb/project/circuit/netsignal.h>
 #include <librepcb/project/circuit/circuit.h>
+#include <librepcb/project/circuit/circuitconnectivity.h>
 #include <librepcb/project/circuit/cmd/cmdnetsignaledit.h>
 #include "../../cmd/cmdcombinenetsignals.h"
 #include "../../cmd/cmdremoveselectedschematicitems.h"
@@ -434,6 +435,52 @@ bool SES_Select::removeSelectedItems() noexcept
     Schematic* schematic = mEditor.getActiveSchematic();
     Q_ASSERT(schematic); if (!schematic) return false;
 
+    // Removing a netline does not remove the affected items from the net signal, so a
+    // net which is left split stays one net in the netlist even though it is no longer
+    // visibly connected in the schematic. Warn the user about that before removing the
+    // only connection between two parts of a net (checked per netline, so removing a
+    // redundant parallel connection does not trigger the warning).
+    QHash<NetSignal*, QSet<SI_NetLine*>> selectedLinesPerNet;
+    QSet<NetSignal*> splitNets;
+    QList<SI_Base*> selectedNetLines = schematic->getSelectedItems(
+        false, false, false, false, false, false, false, false, true, true, false);
+    foreach (SI_Base* item, selectedNetLines) {
+        if (item->getType() == SI_Base::Type_t::NetLine) {
+            SI_NetLine* netline = dynamic_cast<SI_NetLine*>(item); Q_ASSERT(netline);
+            selectedLinesPerNet[&netline->getNetSignal()].insert(netline);
+            if (mCircuit.getConnectivity().isNetSplitByRemoving(*netline)) {
+                splitNets.insert(&netline->getNetSignal());
+            }
+        }
+    }
+    QSet<QString> splitNetNames;
+    foreach (NetSignal* netsignal, splitNets) {
+        // deleting ALL netlines of a net is not a split, nothing of the net remains
+        QSet<SI_NetLine*> allLinesOfNet;
+        foreach (SI_NetPoint* netpoint, netsignal->getSchematicNetPoints()) {
+            foreach (SI_NetLine* netline, netpoint->getLines()) {
+                allLinesOfNet.insert(netline);
+            }
+        }
+        if (selectedLinesPerNet.value(netsignal) != allLinesOfNet) {
+            splitNetNames.insert(netsignal->getName());
+        }
+    }
+    if (!splitNetNames.isEmpty()) {
+        QStringList names = splitNetNames.toList();
+        names.sort();
+        QMessageBox::StandardButton btn = QMessageBox::warning(&mEditor,
+            tr("Remove Schematic Elements"),
+            QString(tr("The selection contains the only connection between two parts of "
+                       "the net(s) \"%1\". The parts will still belong to the same net "
+                       "after removing it, but will no longer be visibly connected in "
+                       "the schematic. Remove anyway?")).arg(names.join("\", \"")),
+            QMessageBox::Yes | QMessageBox::No, QMessageBox::No);
+        if (btn != QMessageBox::Yes) {
+            return false;
+        }
+    }
+
     try
     {
         CmdRemoveSelectedSchematicItems* cmd = new CmdRemoveSelectedSchematicItems(*schematic);
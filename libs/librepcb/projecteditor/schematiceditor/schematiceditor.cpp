@@ -61,6 +61,16 @@ SchematicEditor::SchematicEditor(ProjectEditor& projectEditor, Project& project)
     mGraphicsView(nullptr), mGridProperties(nullptr), mActiveSchematicIndex(-1),
     mPagesDock(nullptr), mErcMsgDock(nullptr), mFsm(nullptr)
 {
+    // show the result of asynchronous PDF exports
+    connect(&mProject, &Project::schematicsPdfExportFinished, this,
+            [this](bool success, const QString& errorMsg, const FilePath& filepath){
+                if (success) {
+                    QDesktopServices::openUrl(QUrl::fromLocalFile(filepath.toStr()));
+                } else {
+                    QMessageBox::warning(this, tr("Error"), errorMsg);
+                }
+            });
+
     mUi->setupUi(this);
     mUi->actionSave_Project->setEnabled(!mProject.isReadOnly());
 
@@ -318,7 +328,7 @@ void SchematicEditor::on_actionPDF_Export_triggered()
         if (filename.isEmpty()) return;
         if (!filename.endsWith(".pdf")) filename.append(".pdf");
         FilePath filepath(filename);
-        mProject.exportSchematicsAsPdf(filepath); // this method can throw an exception
+        mProject.startSchematicsPdfExport(filepath); // emits a signal when finished
     }
     catch (Exception& e)
     {
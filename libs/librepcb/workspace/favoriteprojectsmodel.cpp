@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include <QtWidgets>
+#include <QtConcurrent/QtConcurrent>
 #include "favoriteprojectsmodel.h"
 #include "workspace.h"
 #include "settings/workspacesettings.h"
@@ -57,6 +58,8 @@ FavoriteProjectsModel::FavoriteProjectsModel(const Workspace& workspace) noexcep
     } catch (Exception& e) {
         qWarning() << "Could not read favorite projects file:" << e.getMsg();
     }
+
+    startExistenceProbe();
 }
 
 FavoriteProjectsModel::~FavoriteProjectsModel() noexcept
@@ -114,6 +117,34 @@ void FavoriteProjectsModel::removeFavoriteProject(const FilePath& filepath) noex
     }
 }
 
+void FavoriteProjectsModel::startExistenceProbe() noexcept
+{
+    // probe the existence of the listed projects on a worker thread: entries on a
+    // disconnected network share would block the first window paint for seconds if
+    // they were stat'ed on the GUI thread. Until the results arrive, all entries are
+    // shown as normal placeholder rows.
+    QStringList paths;
+    foreach (const FilePath& fp, mFavoriteProjects) {
+        paths.append(fp.toStr());
+    }
+    connect(&mExistenceProbeWatcher, &QFutureWatcher<QSet<QString>>::finished,
+            this, [this]() {
+        mMissingProjects = mExistenceProbeWatcher.result();
+        if ((!mMissingProjects.isEmpty()) && (mFavoriteProjects.count() > 0)) {
+            emit dataChanged(index(0), index(mFavoriteProjects.count() - 1));
+        }
+    }, Qt::UniqueConnection);
+    mExistenceProbeWatcher.setFuture(QtConcurrent::run([paths]() {
+        QSet<QString> missing;
+        foreach (const QString& path, paths) {
+            if (!QFileInfo(path).exists()) {
+                missing.insert(path);
+            }
+        }
+        return missing;
+    }));
+}
+
 /*****************************************************************************************
  *  Inherited Methods
  ****************************************************************************************/
@@ -136,7 +167,20 @@ QVariant FavoriteProjectsModel::data(const QModelIndex& index, int role) const
         case Qt::DisplayRole:
             return mFavoriteProjects.at(index.row()).getFilename();
 
-        //case Qt::ToolTipRole:
+        case Qt::ToolTipRole: {
+            QString path = mFavoriteProjects.at(index.row()).toNative();
+            if (mMissingProjects.contains(mFavoriteProjects.at(index.row()).toStr())) {
+                return QString("%1 (%2)").arg(path, tr("file not found"));
+            }
+            return path;
+        }
+
+        case Qt::ForegroundRole:
+            if (mMissingProjects.contains(mFavoriteProjects.at(index.row()).toStr())) {
+                return QBrush(Qt::gray); // the project does not exist (anymore)
+            }
+            return QVariant();
+
         case Qt::StatusTipRole:
         case Qt::UserRole:
             return mFavoriteProjects.at(index.row()).toNative();
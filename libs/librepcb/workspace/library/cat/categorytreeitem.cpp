@@ -42,18 +42,36 @@ template <typename ElementType>
 CategoryTreeItem<ElementType>::CategoryTreeItem(const WorkspaceLibraryDb& library,
         const QStringList localeOrder, CategoryTreeItem* parent, const Uuid& uuid) noexcept :
     mLocaleOrder(localeOrder), mParent(parent), mUuid(uuid),
-    mDepth(parent ? parent->getDepth() + 1 : 0), mExceptionMessage()
+    mDepth(parent ? parent->getDepth() + 1 : 0), mExceptionMessage(),
+    mLibrary(library), mChildsLoaded(false)
 {
     try {
         if (!mUuid.isNull()) {
             FilePath fp = getLatestCategory(library);
             if (fp.isValid()) mCategory.reset(new ElementType(fp, true));
         }
+    } catch (const Exception& e) {
+        mExceptionMessage = e.getMsg();
+    }
+    // note: the children are created lazily on first access, see ensureChildsLoaded()
+}
 
+template <typename ElementType>
+void CategoryTreeItem<ElementType>::ensureChildsLoaded() const noexcept
+{
+    if (mChildsLoaded) {
+        return;
+    }
+    mChildsLoaded = true;
+
+    // the const_cast is only needed to pass "this" as the parent pointer
+    CategoryTreeItem* self = const_cast<CategoryTreeItem*>(this);
+
+    try {
         if ((!mUuid.isNull()) || (!mParent)) {
-            QSet<Uuid> childs = getCategoryChilds(library);
+            QSet<Uuid> childs = getCategoryChilds(mLibrary);
             foreach (const Uuid& childUuid, childs) {
-                ChildType child(new CategoryTreeItem(library, mLocaleOrder, this, childUuid));
+                ChildType child(new CategoryTreeItem(mLibrary, mLocaleOrder, self, childUuid));
                 mChilds.append(child);
             }
 
@@ -65,11 +83,11 @@ CategoryTreeItem<ElementType>::CategoryTreeItem(const WorkspaceLibraryDb& librar
 
         if (!mParent) {
             // add category for elements without category
-            ChildType child(new CategoryTreeItem(library, mLocaleOrder, this, Uuid()));
+            ChildType child(new CategoryTreeItem(mLibrary, mLocaleOrder, self, Uuid()));
             mChilds.append(child);
         }
     } catch (const Exception& e) {
-        mExceptionMessage = e.getMsg();
+        // no child items in case of errors
     }
 }
 
@@ -64,8 +64,14 @@ class CategoryTreeItem final
         unsigned int getDepth()                 const noexcept {return mDepth;}
         int getColumnCount()                    const noexcept {return 1;}
         CategoryTreeItem* getParent()           const noexcept {return mParent;}
-        CategoryTreeItem* getChild(int index)   const noexcept {return mChilds.value(index).data();}
-        int getChildCount()                     const noexcept {return mChilds.count();}
+        CategoryTreeItem* getChild(int index)   const noexcept {
+            ensureChildsLoaded();
+            return mChilds.value(index).data();
+        }
+        int getChildCount()                     const noexcept {
+            ensureChildsLoaded();
+            return mChilds.count();
+        }
         int getChildNumber()                    const noexcept;
         QVariant data(int role)                 const noexcept;
 
@@ -82,6 +88,14 @@ class CategoryTreeItem final
         FilePath getLatestCategory(const WorkspaceLibraryDb& lib) const;
         QSet<Uuid> getCategoryChilds(const WorkspaceLibraryDb& lib) const;
 
+        /**
+         * @brief Create the child items on first access (lazy population)
+         *
+         * The tree views only query the children of displayed nodes, so categories
+         * the user never expands are never queried from the database nor parsed.
+         */
+        void ensureChildsLoaded() const noexcept;
+
         // Attributes
         QStringList mLocaleOrder;
         CategoryTreeItem* mParent;
@@ -89,7 +103,9 @@ class CategoryTreeItem final
         QScopedPointer<ElementType> mCategory;
         unsigned int mDepth; ///< this is to avoid endless recursion in the parent-child relationship
         QString mExceptionMessage;
-        QList<ChildType> mChilds;
+        const WorkspaceLibraryDb& mLibrary; ///< for the lazy child population
+        mutable bool mChildsLoaded; ///< see #ensureChildsLoaded()
+        mutable QList<ChildType> mChilds;
 };
 
 typedef CategoryTreeItem<library::ComponentCategory> ComponentCategoryTreeItem;
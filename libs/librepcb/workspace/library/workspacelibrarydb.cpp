@@ -56,7 +56,7 @@ WorkspaceLibraryDb::WorkspaceLibraryDb(Workspace& ws):
     qDebug("Load workspace library database...");
 
     // open SQLite database
-    FilePath dbFilePath = ws.getMetadataPath().getPathTo("library_cache.sqlite");
+    FilePath dbFilePath = ws.getLocalCachePath().getPathTo("library_cache.sqlite");
     mDb.reset(new SQLiteDatabase(dbFilePath)); // can throw
 
     // if the db has an old version, just remove the whole db and create a new one
@@ -72,6 +72,15 @@ WorkspaceLibraryDb::WorkspaceLibraryDb(Workspace& ws):
 
     // create library scanner object
     mLibraryScanner.reset(new WorkspaceLibraryScanner(mWorkspace));
+    // note: connected first, so the cache is cleared before scanSucceeded() reaches
+    // any UI which re-queries the database
+    connect(mLibraryScanner.data(), &WorkspaceLibraryScanner::succeeded, this,
+            [this](){mCategoryTreeCache = CategoryTreeCache();}, Qt::QueuedConnection);
+    // per-library increments: drop the cache before forwarding, like above
+    connect(mLibraryScanner.data(), &WorkspaceLibraryScanner::libraryScanned, this,
+            [this](int, int){mCategoryTreeCache = CategoryTreeCache();}, Qt::QueuedConnection);
+    connect(mLibraryScanner.data(), &WorkspaceLibraryScanner::libraryScanned,
+            this, &WorkspaceLibraryDb::scanLibraryScanned, Qt::QueuedConnection);
     connect(mLibraryScanner.data(), &WorkspaceLibraryScanner::started,
             this, &WorkspaceLibraryDb::scanStarted, Qt::QueuedConnection);
     connect(mLibraryScanner.data(), &WorkspaceLibraryScanner::progressUpdate,
@@ -81,6 +90,27 @@ WorkspaceLibraryDb::WorkspaceLibraryDb(Workspace& ws):
     connect(mLibraryScanner.data(), &WorkspaceLibraryScanner::failed,
             this, &WorkspaceLibraryDb::scanFailed, Qt::QueuedConnection);
 
+    // watch the library directories on disk: since rescans are incremental (only
+    // changed elements are re-parsed), a rescan can simply be triggered whenever
+    // libraries or elements are installed, removed or modified. The changes of a
+    // burst (e.g. unzipping a library) are coalesced into one rescan.
+    mWatcherDebounceTimer.setSingleShot(true);
+    mWatcherDebounceTimer.setInterval(1000);
+    connect(&mWatcherDebounceTimer, &QTimer::timeout, this, [this](){
+        if (mLibraryScanner->isRunning()) {
+            // a scan is already in progress and may not see these changes anymore
+            // --> try again when it is done
+            mWatcherDebounceTimer.start();
+        } else {
+            startLibraryRescan();
+        }
+    });
+    connect(&mLibraryWatcher, &QFileSystemWatcher::directoryChanged, this,
+            [this](const QString&){mWatcherDebounceTimer.start();});
+    connect(this, &WorkspaceLibraryDb::scanSucceeded, this,
+            [this](int){updateWatchedDirectories();});
+    updateWatchedDirectories();
+
     qDebug("Workspace library database successfully loaded!");
 }
 
@@ -128,12 +158,24 @@ QMultiMap<Version, FilePath> WorkspaceLibraryDb::getDevices(const Uuid& uuid) co
 
 FilePath WorkspaceLibraryDb::getLatestComponentCategory(const Uuid& uuid) const
 {
-    return getLatestVersionFilePath(getComponentCategories(uuid));
+    QString key = getCategoryCacheKey("component_categories", uuid);
+    auto it = mCategoryTreeCache.latestCategory.find(key);
+    if (it == mCategoryTreeCache.latestCategory.end()) {
+        it = mCategoryTreeCache.latestCategory.insert(key,
+            getLatestVersionFilePath(getComponentCategories(uuid)));
+    }
+    return it.value();
 }
 
 FilePath WorkspaceLibraryDb::getLatestPackageCategory(const Uuid& uuid) const
 {
-    return getLatestVersionFilePath(getPackageCategories(uuid));
+    QString key = getCategoryCacheKey("package_categories", uuid);
+    auto it = mCategoryTreeCache.latestCategory.find(key);
+    if (it == mCategoryTreeCache.latestCategory.end()) {
+        it = mCategoryTreeCache.latestCategory.insert(key,
+            getLatestVersionFilePath(getPackageCategories(uuid)));
+    }
+    return it.value();
 }
 
 FilePath WorkspaceLibraryDb::getLatestSymbol(const Uuid& uuid) const
@@ -244,7 +286,7 @@ void WorkspaceLibraryDb::getElementTranslations<Device>(const FilePath& elemDir,
 
 void WorkspaceLibraryDb::getDeviceMetadata(const FilePath& devDir, Uuid* pkgUuid) const
 {
-    QSqlQuery query = mDb->prepareQuery(
+    QSqlQuery query = mDb->prepareCachedQuery(
         "SELECT package_uuid FROM devices WHERE filepath = :filepath");
     query.bindValue(":filepath", devDir.toRelative(mWorkspace.getLibrariesPath()));
     mDb->exec(query);
@@ -258,18 +300,45 @@ void WorkspaceLibraryDb::getDeviceMetadata(const FilePath& devDir, Uuid* pkgUuid
     if (pkgUuid) *pkgUuid = uuid;
 }
 
+int WorkspaceLibraryDb::getSymbolPinCount(const FilePath& symDir) const
+{
+    return getElementCountColumn("symbols", "pin_count", symDir);
+}
+
+int WorkspaceLibraryDb::getPackagePadCount(const FilePath& pkgDir) const
+{
+    return getElementCountColumn("packages", "pad_count", pkgDir);
+}
+
+int WorkspaceLibraryDb::getComponentSignalCount(const FilePath& cmpDir) const
+{
+    return getElementCountColumn("components", "signal_count", cmpDir);
+}
+
 /*****************************************************************************************
  *  Getters: Special
  ****************************************************************************************/
 
 QSet<Uuid> WorkspaceLibraryDb::getComponentCategoryChilds(const Uuid& parent) const
 {
-    return getCategoryChilds("component_categories", parent);
+    QString key = getCategoryCacheKey("component_categories", parent);
+    auto it = mCategoryTreeCache.childs.find(key);
+    if (it == mCategoryTreeCache.childs.end()) {
+        it = mCategoryTreeCache.childs.insert(key,
+            getCategoryChilds("component_categories", parent));
+    }
+    return it.value();
 }
 
 QSet<Uuid> WorkspaceLibraryDb::getPackageCategoryChilds(const Uuid& parent) const
 {
-    return getCategoryChilds("package_categories", parent);
+    QString key = getCategoryCacheKey("package_categories", parent);
+    auto it = mCategoryTreeCache.childs.find(key);
+    if (it == mCategoryTreeCache.childs.end()) {
+        it = mCategoryTreeCache.childs.insert(key,
+            getCategoryChilds("package_categories", parent));
+    }
+    return it.value();
 }
 
 QList<Uuid> WorkspaceLibraryDb::getComponentCategoryParents(const Uuid& category) const
@@ -321,6 +390,11 @@ QSet<Uuid> WorkspaceLibraryDb::getDevicesOfComponent(const Uuid& component) cons
     return elements;
 }
 
+QSet<Uuid> WorkspaceLibraryDb::getComponentsBySearchKeyword(const QString& keyword) const
+{
+    return getElementsBySearchKeyword("components", "component_id", keyword);
+}
+
 /*****************************************************************************************
  *  General Methods
  ****************************************************************************************/
@@ -338,7 +412,7 @@ void WorkspaceLibraryDb::getElementTranslations(const QString& table,
     const QString& idRow, const FilePath& elemDir, const QStringList& localeOrder,
     QString* name, QString* desc, QString* keywords) const
 {
-    QSqlQuery query = mDb->prepareQuery(
+    QSqlQuery query = mDb->prepareCachedQuery(
         "SELECT locale, name, description, keywords FROM " % table % "_tr "
         "INNER JOIN " % table % " ON " % table % ".id=" % table % "_tr." % idRow % " "
         "WHERE " % table % ".filepath = :filepath");
@@ -363,10 +437,23 @@ void WorkspaceLibraryDb::getElementTranslations(const QString& table,
     if (keywords) *keywords = keywordsMap.value(localeOrder);
 }
 
+int WorkspaceLibraryDb::getElementCountColumn(const QString& table,
+    const QString& column, const FilePath& elemDir) const
+{
+    QSqlQuery query = mDb->prepareCachedQuery(
+        "SELECT " % column % " FROM " % table % " WHERE filepath = :filepath");
+    query.bindValue(":filepath", elemDir.toRelative(mWorkspace.getLibrariesPath()));
+    mDb->exec(query);
+    if (query.next() && (!query.value(0).isNull())) {
+        return query.value(0).toInt();
+    }
+    return -1;
+}
+
 QMultiMap<Version, FilePath> WorkspaceLibraryDb::getElementFilePathsFromDb(
     const QString& tablename, const Uuid& uuid) const
 {
-    QSqlQuery query = mDb->prepareQuery(
+    QSqlQuery query = mDb->prepareCachedQuery(
         "SELECT version, filepath FROM " % tablename % " WHERE uuid = :uuid");
     query.bindValue(":uuid", uuid.toStr());
     mDb->exec(query);
@@ -473,6 +560,46 @@ QSet<Uuid> WorkspaceLibraryDb::getElementsByCategory(const QString& tablename,
     return elements;
 }
 
+void WorkspaceLibraryDb::updateWatchedDirectories() noexcept
+{
+    // watch the "local"/"remote" directories (libraries added/removed), every library
+    // directory and every element type subdirectory (elements added/removed). Changes
+    // to files deep inside an element directory are intentionally not watched, as this
+    // would need thousands of watch handles; those elements are caught by the
+    // fingerprint check of the next (manually or otherwise triggered) rescan.
+    QStringList paths;
+    foreach (const QString& subdir, QStringList{"local", "remote"}) {
+        FilePath dir = mWorkspace.getLibrariesPath().getPathTo(subdir);
+        if (dir.isExistingDir()) paths.append(dir.toStr());
+    }
+    QList<QSharedPointer<library::Library>> libraries;
+    libraries.append(mWorkspace.getLocalLibraries().values());
+    libraries.append(mWorkspace.getRemoteLibraries().values());
+    foreach (const QSharedPointer<library::Library>& lib, libraries) {
+        paths.append(lib->getFilePath().toStr());
+        foreach (const QString& subdir, QStringList{
+                 ComponentCategory::getShortElementName(),
+                 PackageCategory::getShortElementName(),
+                 Symbol::getShortElementName(),
+                 Package::getShortElementName(),
+                 Component::getShortElementName(),
+                 Device::getShortElementName()}) {
+            FilePath dir = lib->getFilePath().getPathTo(subdir);
+            if (dir.isExistingDir()) paths.append(dir.toStr());
+        }
+    }
+
+    QStringList watched = mLibraryWatcher.directories();
+    if (!watched.isEmpty()) mLibraryWatcher.removePaths(watched);
+    if (!paths.isEmpty()) mLibraryWatcher.addPaths(paths);
+}
+
+QString WorkspaceLibraryDb::getCategoryCacheKey(const QString& tablename,
+                                                const Uuid& uuid) const noexcept
+{
+    return tablename % "/" % uuid.toStr(); // null uuid maps to an empty string
+}
+
 int WorkspaceLibraryDb::getLibraryId(const FilePath& lib) const
 {
     QString relativeLibraryPath = lib.toRelative(mWorkspace.getLibrariesPath());
@@ -493,10 +620,75 @@ int WorkspaceLibraryDb::getLibraryId(const FilePath& lib) const
     }
 }
 
+QSet<Uuid> WorkspaceLibraryDb::getElementsBySearchKeyword(const QString& tablename,
+    const QString& idrowname, const QString& keyword) const
+{
+    QSet<Uuid> elements;
+    QString trimmed = keyword.trimmed();
+    if (trimmed.isEmpty()) {
+        return elements;
+    }
+
+    QSqlQuery query;
+    if (hasFullTextSearchTable(tablename)) {
+        // prefix search: every entered word must match the beginning of an indexed term
+        QStringList tokens;
+        foreach (const QString& token,
+                 trimmed.split(QRegularExpression("\\W+"), QString::SkipEmptyParts)) {
+            tokens.append(token % "*");
+        }
+        if (tokens.isEmpty()) {
+            return elements;
+        }
+        query = mDb->prepareCachedQuery(
+            "SELECT " % tablename % ".uuid FROM " % tablename % "_fts "
+            "INNER JOIN " % tablename %
+            " ON " % tablename % ".id = " % tablename % "_fts.docid "
+            "WHERE " % tablename % "_fts MATCH :keyword");
+        query.bindValue(":keyword", tokens.join(' '));
+    } else {
+        // fallback for SQLite builds without the FTS4 module (cannot use an index)
+        QString escaped = trimmed;
+        escaped.replace("\\", "\\\\").replace("%", "\\%").replace("_", "\\_");
+        query = mDb->prepareCachedQuery(
+            "SELECT DISTINCT " % tablename % ".uuid FROM " % tablename % "_tr "
+            "INNER JOIN " % tablename %
+            " ON " % tablename % ".id = " % tablename % "_tr." % idrowname % " "
+            "WHERE name LIKE :keyword ESCAPE '\\'"
+            " OR keywords LIKE :keyword ESCAPE '\\'"
+            " OR description LIKE :keyword ESCAPE '\\'");
+        query.bindValue(":keyword", "%" % escaped % "%");
+    }
+    mDb->exec(query);
+
+    while (query.next()) {
+        Uuid uuid(query.value(0).toString());
+        if (!uuid.isNull()) {
+            elements.insert(uuid);
+        } else {
+            throw LogicError(__FILE__, __LINE__);
+        }
+    }
+    return elements;
+}
+
+bool WorkspaceLibraryDb::hasFullTextSearchTable(const QString& tablename) const noexcept
+{
+    try {
+        QSqlQuery query = mDb->prepareCachedQuery(
+            "SELECT name FROM sqlite_master WHERE type = 'table' AND name = :name");
+        query.bindValue(":name", tablename % "_fts");
+        mDb->exec(query);
+        return query.next();
+    } catch (const Exception& e) {
+        return false;
+    }
+}
+
 QList<FilePath> WorkspaceLibraryDb::getLibraryElements(const FilePath& lib,
                                                        const QString& tablename) const
 {
-    QSqlQuery query = mDb->prepareQuery(
+    QSqlQuery query = mDb->prepareCachedQuery(
         "SELECT filepath FROM " % tablename % " WHERE lib_id = :lib_id");
     query.bindValue(":lib_id", getLibraryId(lib));
     mDb->exec(query);
@@ -552,7 +744,8 @@ void WorkspaceLibraryDb::createAllTables()
                         "`filepath` TEXT UNIQUE NOT NULL, "
                         "`uuid` TEXT NOT NULL, "
                         "`version` TEXT NOT NULL, "
-                        "`parent_uuid` TEXT"
+                        "`parent_uuid` TEXT, "
+                        "`fingerprint` TEXT"
                         ")");
     queries << QString( "CREATE TABLE IF NOT EXISTS component_categories_tr ("
                         "`id` INTEGER PRIMARY KEY NOT NULL, "
@@ -571,7 +764,8 @@ void WorkspaceLibraryDb::createAllTables()
                         "`filepath` TEXT UNIQUE NOT NULL, "
                         "`uuid` TEXT NOT NULL, "
                         "`version` TEXT NOT NULL, "
-                        "`parent_uuid` TEXT"
+                        "`parent_uuid` TEXT, "
+                        "`fingerprint` TEXT"
                         ")");
     queries << QString( "CREATE TABLE IF NOT EXISTS package_categories_tr ("
                         "`id` INTEGER PRIMARY KEY NOT NULL, "
@@ -589,7 +783,9 @@ void WorkspaceLibraryDb::createAllTables()
                         "`lib_id` INTEGER NOT NULL, "
                         "`filepath` TEXT UNIQUE NOT NULL, "
                         "`uuid` TEXT NOT NULL, "
-                        "`version` TEXT NOT NULL"
+                        "`version` TEXT NOT NULL, "
+                        "`fingerprint` TEXT, "
+                        "`pin_count` INTEGER"
                         ")");
     queries << QString( "CREATE TABLE IF NOT EXISTS symbols_tr ("
                         "`id` INTEGER PRIMARY KEY NOT NULL, "
@@ -613,7 +809,9 @@ void WorkspaceLibraryDb::createAllTables()
                         "`lib_id` INTEGER NOT NULL, "
                         "`filepath` TEXT UNIQUE NOT NULL, "
                         "`uuid` TEXT NOT NULL, "
-                        "`version` TEXT NOT NULL "
+                        "`version` TEXT NOT NULL, "
+                        "`fingerprint` TEXT, "
+                        "`pad_count` INTEGER"
                         ")");
     queries << QString( "CREATE TABLE IF NOT EXISTS packages_tr ("
                         "`id` INTEGER PRIMARY KEY NOT NULL, "
@@ -637,7 +835,9 @@ void WorkspaceLibraryDb::createAllTables()
                         "`lib_id` INTEGER NOT NULL, "
                         "`filepath` TEXT UNIQUE NOT NULL, "
                         "`uuid` TEXT NOT NULL, "
-                        "`version` TEXT NOT NULL"
+                        "`version` TEXT NOT NULL, "
+                        "`fingerprint` TEXT, "
+                        "`signal_count` INTEGER"
                         ")");
     queries << QString( "CREATE TABLE IF NOT EXISTS components_tr ("
                         "`id` INTEGER PRIMARY KEY NOT NULL, "
@@ -663,7 +863,8 @@ void WorkspaceLibraryDb::createAllTables()
                         "`uuid` TEXT NOT NULL, "
                         "`version` TEXT NOT NULL, "
                         "`component_uuid` TEXT NOT NULL, "
-                        "`package_uuid` TEXT NOT NULL"
+                        "`package_uuid` TEXT NOT NULL, "
+                        "`fingerprint` TEXT"
                         ")");
     queries << QString( "CREATE TABLE IF NOT EXISTS devices_tr ("
                         "`id` INTEGER PRIMARY KEY NOT NULL, "
@@ -686,6 +887,15 @@ void WorkspaceLibraryDb::createAllTables()
         QSqlQuery query = mDb->prepareQuery(string); // can throw
         mDb->exec(query); // can throw
     }
+
+    // full-text search index over component names/descriptions/keywords, used by
+    // getComponentsBySearchKeyword(); the FTS4 module may be missing in exotic SQLite
+    // builds, in that case the keyword search falls back to (slow) LIKE queries
+    try {
+        mDb->exec("CREATE VIRTUAL TABLE IF NOT EXISTS components_fts USING fts4 (`text`)");
+    } catch (const Exception& e) {
+        qWarning() << "SQLite FTS4 module not available, keyword search will be slow!";
+    }
 }
 
 int WorkspaceLibraryDb::getDbVersion() const noexcept
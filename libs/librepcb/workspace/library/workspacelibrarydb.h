@@ -96,6 +96,19 @@ class WorkspaceLibraryDb final : public QObject
                                     QString* keywords = nullptr) const;
         void getDeviceMetadata(const FilePath& devDir, Uuid* pkgUuid = nullptr) const;
 
+        /**
+         * @brief Get structural metadata persisted by the library scanner
+         *
+         * These counts are stored in indexed columns, so filters and labels based
+         * on them can be answered entirely from SQLite without parsing any
+         * library element file.
+         *
+         * @return The count, or -1 if the element is not (yet) in the database
+         */
+        int getSymbolPinCount(const FilePath& symDir) const;
+        int getPackagePadCount(const FilePath& pkgDir) const;
+        int getComponentSignalCount(const FilePath& cmpDir) const;
+
         // Getters: Special
         QSet<Uuid> getComponentCategoryChilds(const Uuid& parent) const;
         QSet<Uuid> getPackageCategoryChilds(const Uuid& parent) const;
@@ -107,6 +120,23 @@ class WorkspaceLibraryDb final : public QObject
         QSet<Uuid> getDevicesByCategory(const Uuid& category) const;
         QSet<Uuid> getDevicesOfComponent(const Uuid& component) const;
 
+        // Getters: Keyword Search
+
+        /**
+         * @brief Get all components matching a search keyword
+         *
+         * Every word of the keyword is treated as a prefix and matched against the
+         * names, descriptions and keywords of all locales (e.g. "res 080" matches a
+         * component named "Resistor" with the keyword "0805"). Backed by an SQLite
+         * full-text search index, so this is fast enough to be called on every
+         * keystroke even with very large workspace libraries.
+         *
+         * @param keyword   The search keyword (whitespace separated words)
+         *
+         * @return All component UUIDs matching the keyword
+         */
+        QSet<Uuid> getComponentsBySearchKeyword(const QString& keyword) const;
+
         // General Methods
 
         /**
@@ -122,6 +152,10 @@ class WorkspaceLibraryDb final : public QObject
 
         void scanStarted();
         void scanProgressUpdate(int percent);
+
+        /// @brief Emitted after each library was committed during a running scan
+        void scanLibraryScanned(int libsScanned, int libsTotal);
+
         void scanSucceeded(int elementCount);
         void scanFailed(QString errorMsg);
 
@@ -132,6 +166,8 @@ class WorkspaceLibraryDb final : public QObject
         void getElementTranslations(const QString& table, const QString& idRow,
                                     const FilePath& elemDir, const QStringList& localeOrder,
                                     QString* name, QString* desc, QString* keywords) const;
+        int getElementCountColumn(const QString& table, const QString& column,
+                                  const FilePath& elemDir) const;
         QMultiMap<Version, FilePath> getElementFilePathsFromDb(const QString& tablename,
                                                                const Uuid& uuid) const;
         FilePath getLatestVersionFilePath(const QMultiMap<Version, FilePath>& list) const noexcept;
@@ -140,20 +176,48 @@ class WorkspaceLibraryDb final : public QObject
         Uuid getCategoryParent(const QString& tablename, const Uuid& category) const;
         QSet<Uuid> getElementsByCategory(const QString& tablename, const QString& idrowname,
                                          const Uuid& categoryUuid) const;
+        QSet<Uuid> getElementsBySearchKeyword(const QString& tablename,
+                                              const QString& idrowname,
+                                              const QString& keyword) const;
+        bool hasFullTextSearchTable(const QString& tablename) const noexcept;
+        QString getCategoryCacheKey(const QString& tablename, const Uuid& uuid) const noexcept;
         int getLibraryId(const FilePath& lib) const;
         QList<FilePath> getLibraryElements(const FilePath& lib, const QString& tablename) const;
         void createAllTables();
         void setDbVersion(int version);
         int getDbVersion() const noexcept;
+        void updateWatchedDirectories() noexcept;
 
 
+        /**
+         * @brief In-memory cache of the category tree queries
+         *
+         * Every library element chooser builds a category tree when it is opened,
+         * which caused one SQLite query per tree node on every open. Since the
+         * database content only changes when a library scan finishes, the results of
+         * the category tree queries (children per category, latest category file
+         * path) are cached in memory. The cache is versioned by the scan count: it
+         * is cleared whenever a scan succeeded, before the #scanSucceeded() signal
+         * reaches any UI (the clearing connection is established first).
+         *
+         * Like all getters of this class, the cache must only be used from the GUI
+         * thread (the scanner worker uses its own database connection).
+         */
+        struct CategoryTreeCache {
+            QHash<QString, QSet<Uuid>> childs; ///< key: see #getCategoryCacheKey()
+            QHash<QString, FilePath> latestCategory; ///< key: see #getCategoryCacheKey()
+        };
+
         // Attributes
         Workspace& mWorkspace;
         QScopedPointer<SQLiteDatabase> mDb; ///< the SQLite database "library_cache.sqlite"
         QScopedPointer<WorkspaceLibraryScanner> mLibraryScanner;
+        mutable CategoryTreeCache mCategoryTreeCache;
+        QFileSystemWatcher mLibraryWatcher; ///< watches the library directories on disk
+        QTimer mWatcherDebounceTimer; ///< coalesces bursts of file changes into one rescan
 
         // Constants
-        static const int sCurrentDbVersion = 1;
+        static const int sCurrentDbVersion = 4;
 };
 
 /*****************************************************************************************
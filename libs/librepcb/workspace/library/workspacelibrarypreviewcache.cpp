@@ -0,0 +1,113 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtGui>
+#include "workspacelibrarypreviewcache.h"
+#include <librepcb/common/fileio/fileutils.h>
+#include <librepcb/common/uuid.h>
+#include <librepcb/common/version.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace workspace {
+
+/*****************************************************************************************
+ *  Constructors / Destructor
+ ****************************************************************************************/
+
+WorkspaceLibraryPreviewCache::WorkspaceLibraryPreviewCache(const FilePath& cacheDirPath) :
+    mCacheDirPath(cacheDirPath)
+{
+    FileUtils::makePath(mCacheDirPath); // can throw
+}
+
+WorkspaceLibraryPreviewCache::~WorkspaceLibraryPreviewCache() noexcept
+{
+}
+
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+bool WorkspaceLibraryPreviewCache::contains(const Uuid& uuid, const Version& version) const noexcept
+{
+    QMutexLocker lock(&mMutex);
+    return getFilePathOf(uuid, version).isExistingFile();
+}
+
+QPixmap WorkspaceLibraryPreviewCache::getPixmap(const Uuid& uuid, const Version& version) const noexcept
+{
+    QMutexLocker lock(&mMutex);
+    return QPixmap(getFilePathOf(uuid, version).toStr(), "PNG");
+}
+
+void WorkspaceLibraryPreviewCache::storeImage(const Uuid& uuid, const Version& version,
+                                              const QImage& image) noexcept
+{
+    QMutexLocker lock(&mMutex);
+    FilePath fp = getFilePathOf(uuid, version);
+    if (!image.save(fp.toStr(), "PNG")) {
+        qWarning() << "Could not store library element preview:" << fp.toNative();
+    }
+}
+
+void WorkspaceLibraryPreviewCache::removeObsoletePreviews(const QSet<QString>& validFileNames) noexcept
+{
+    QMutexLocker lock(&mMutex);
+    QDir dir(mCacheDirPath.toStr());
+    foreach (const QString& fileName, dir.entryList(QStringList("*.png"), QDir::Files)) {
+        if (!validFileNames.contains(fileName)) {
+            if (!dir.remove(fileName)) {
+                qWarning() << "Could not remove obsolete library element preview:"
+                           << mCacheDirPath.getPathTo(fileName).toNative();
+            }
+        }
+    }
+}
+
+/*****************************************************************************************
+ *  Static Methods
+ ****************************************************************************************/
+
+QString WorkspaceLibraryPreviewCache::getFileName(const Uuid& uuid, const Version& version) noexcept
+{
+    return uuid.toStr() % "_" % version.toStr() % ".png";
+}
+
+/*****************************************************************************************
+ *  Private Methods
+ ****************************************************************************************/
+
+FilePath WorkspaceLibraryPreviewCache::getFilePathOf(const Uuid& uuid, const Version& version) const noexcept
+{
+    return mCacheDirPath.getPathTo(getFileName(uuid, version));
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace workspace
+} // namespace librepcb
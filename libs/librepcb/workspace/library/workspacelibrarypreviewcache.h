@@ -0,0 +1,148 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef LIBREPCB_WORKSPACE_WORKSPACELIBRARYPREVIEWCACHE_H
+#define LIBREPCB_WORKSPACE_WORKSPACELIBRARYPREVIEWCACHE_H
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <QtCore>
+#include <QtGui>
+#include <librepcb/common/fileio/filepath.h>
+
+/*****************************************************************************************
+ *  Namespace / Forward Declarations
+ ****************************************************************************************/
+namespace librepcb {
+
+class Uuid;
+class Version;
+
+namespace workspace {
+
+/*****************************************************************************************
+ *  Class WorkspaceLibraryPreviewCache
+ ****************************************************************************************/
+
+/**
+ * @brief The WorkspaceLibraryPreviewCache class caches rendered library element previews
+ *
+ * Rendering a preview of a library element requires parsing the whole element and
+ * building graphics items for all of its geometry, which is way too expensive just to
+ * show a small icon while browsing through the library. So whenever such a preview was
+ * rendered anyway (e.g. in the "Add Component" dialog), it is stored in this cache as a
+ * PNG file in the workspace metadata directory ("v#/preview_cache"), keyed by the UUID
+ * and version of the element. Subsequent lookups then only need to load a small PNG.
+ *
+ * Because the version number is part of the cache key, a new release of an element
+ * automatically invalidates its cached preview. Previews of elements which were
+ * modified in-place (without increasing the version number) may be stale until the
+ * next library rescan removes them.
+ *
+ * All methods are thread-safe, but #getPixmap() must only be called from the GUI
+ * thread (QPixmap restriction). The #librepcb#workspace#WorkspaceLibraryScanner uses
+ * #storeImage() and #removeObsoletePreviews() from its worker thread.
+ *
+ * @author ubruhin
+ * @date 2017-11-07
+ */
+class WorkspaceLibraryPreviewCache final
+{
+    public:
+
+        // Constructors / Destructor
+        WorkspaceLibraryPreviewCache() = delete;
+        WorkspaceLibraryPreviewCache(const WorkspaceLibraryPreviewCache& other) = delete;
+
+        /**
+         * @brief Constructor
+         *
+         * @param cacheDirPath  Directory where the PNG files are stored (will be
+         *                      created if it does not exist)
+         *
+         * @throw Exception if the directory could not be created
+         */
+        explicit WorkspaceLibraryPreviewCache(const FilePath& cacheDirPath);
+        ~WorkspaceLibraryPreviewCache() noexcept;
+
+        // General Methods
+
+        /**
+         * @brief Check if a preview of the specified element is in the cache
+         */
+        bool contains(const Uuid& uuid, const Version& version) const noexcept;
+
+        /**
+         * @brief Get the cached preview of the specified element
+         *
+         * @return The cached preview, or a null pixmap if there is none
+         */
+        QPixmap getPixmap(const Uuid& uuid, const Version& version) const noexcept;
+
+        /**
+         * @brief Store a rendered preview of the specified element in the cache
+         *
+         * An already existing preview of the same element version is overwritten.
+         * Errors are only logged since a failed cache write must never abort the
+         * operation which rendered the preview.
+         */
+        void storeImage(const Uuid& uuid, const Version& version,
+                        const QImage& image) noexcept;
+
+        /**
+         * @brief Remove all cached previews which are not contained in the given set
+         *
+         * Called by the library scanner after a successful scan to remove previews of
+         * elements which do no longer exist in any library.
+         *
+         * @param validFileNames    File names (see #getFileName()) of all elements
+         *                          which currently exist in the workspace libraries
+         */
+        void removeObsoletePreviews(const QSet<QString>& validFileNames) noexcept;
+
+        // Operator Overloadings
+        WorkspaceLibraryPreviewCache& operator=(const WorkspaceLibraryPreviewCache& rhs) = delete;
+
+        // Static Methods
+
+        /**
+         * @brief Get the cache file name of a given element (UUID + version + ".png")
+         */
+        static QString getFileName(const Uuid& uuid, const Version& version) noexcept;
+
+
+    private:
+
+        // Private Methods
+        FilePath getFilePathOf(const Uuid& uuid, const Version& version) const noexcept;
+
+        // Attributes
+        FilePath mCacheDirPath; ///< directory containing the cached PNG files
+        mutable QMutex mMutex; ///< serializes all filesystem accesses
+};
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace workspace
+} // namespace librepcb
+
+#endif // LIBREPCB_WORKSPACE_WORKSPACELIBRARYPREVIEWCACHE_H
@@ -21,9 +21,12 @@
  *  Includes
  ****************************************************************************************/
 #include <QtCore>
+#include <QtConcurrent/QtConcurrent>
 #include "workspacelibraryscanner.h"
 #include <librepcb/common/sqlitedatabase.h>
+#include <librepcb/common/tracer.h>
 #include <librepcb/library/elements.h>
+#include "workspacelibrarypreviewcache.h"
 #include "../workspace.h"
 
 /*****************************************************************************************
@@ -34,6 +37,37 @@ namespace workspace {
 
 using namespace library;
 
+/*****************************************************************************************
+ *  Element Parser
+ ****************************************************************************************/
+
+namespace {
+
+/**
+ * @brief Functor which opens a library element, for use with QtConcurrent::mapped()
+ *
+ * Parsing the XML files is by far the most expensive part of a library scan, so it is
+ * fanned out across the global thread pool. Elements which fail to open are returned
+ * as null pointers and just skipped by the database insertion code.
+ */
+template <typename ElementType>
+struct ElementParser {
+    typedef QSharedPointer<ElementType> result_type;
+    result_type operator()(const FilePath& filepath) const noexcept {
+        QString errorMsg;
+        std::unique_ptr<ElementType> element =
+            LibraryBaseElement::tryLoad<ElementType>(filepath, true, &errorMsg);
+        if (!element) {
+            qWarning() << "Failed to open library element:" << filepath.toNative()
+                       << errorMsg;
+            return result_type();
+        }
+        return result_type(element.release());
+    }
+};
+
+} // namespace
+
 /*****************************************************************************************
  *  Constructors / Destructor
  ****************************************************************************************/
@@ -62,58 +96,74 @@ WorkspaceLibraryScanner::~WorkspaceLibraryScanner() noexcept
 void WorkspaceLibraryScanner::run() noexcept
 {
     try {
+        TracerScope trace("WorkspaceLibraryScanner::run");
         mAbort = false;
+        mValidPreviewFileNames.clear();
         emit started();
 
-        // get a list of all available libraries
+        // get a list of all available libraries. The local libraries (typically the
+        // user's own, most used ones) are scanned first, so their elements become
+        // searchable before the long tail of remote libraries is processed.
         QList<QSharedPointer<library::Library>> libraries;
         libraries.append(mWorkspace.getLocalLibraries().values());
         libraries.append(mWorkspace.getRemoteLibraries().values());
 
         // open SQLite database
-        FilePath dbFilePath = mWorkspace.getMetadataPath().getPathTo("library_cache.sqlite");
+        FilePath dbFilePath = mWorkspace.getLocalCachePath().getPathTo("library_cache.sqlite");
         SQLiteDatabase db(dbFilePath); // can throw
 
-        // begin database transaction
-        SQLiteDatabase::TransactionScopeGuard transactionGuard(db); // can throw
-
-        // clear all tables
-        clearAllTables(db);
+        // remove all libraries (and their elements) which no longer exist on disk
+        // (in its own transaction)
+        {
+            SQLiteDatabase::TransactionScopeGuard sg(db); // can throw
+            removeObsoleteLibraries(db, libraries);
+            sg.commit(); // can throw
+        }
 
-        // scan all libraries
+        // sync all libraries, with one database transaction per library. Elements
+        // whose directory fingerprint is unchanged are kept as they are, so a rescan
+        // only re-parses the elements which were actually added or modified.
         int count = 0;
         qreal percent = 0;
         foreach (const QSharedPointer<Library>& lib, libraries) {
-            int libId = addLibraryToDb(db, lib);
             if (mAbort) break;
-            count += addCategoriesToDb<ComponentCategory>(db, lib->searchForElements<ComponentCategory>(),
-                                                          "component_categories", "cat_id", libId);
+            SQLiteDatabase::TransactionScopeGuard transactionGuard(db); // can throw
+            int libId = updateLibraryInDb(db, lib);
+            if (mAbort) break;
+            count += syncCategoriesInDb<ComponentCategory>(db, lib->searchForElements<ComponentCategory>(),
+                                                           "component_categories", "cat_id", libId);
             emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
             if (mAbort) break;
-            count += addCategoriesToDb<PackageCategory>(db, lib->searchForElements<PackageCategory>(),
-                                                        "package_categories", "cat_id", libId);
+            count += syncCategoriesInDb<PackageCategory>(db, lib->searchForElements<PackageCategory>(),
+                                                         "package_categories", "cat_id", libId);
             emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
             if (mAbort) break;
-            count += addElementsToDb<Symbol>(db, lib->searchForElements<Symbol>(),
-                                             "symbols", "symbol_id", libId);
+            count += syncElementsInDb<Symbol>(db, lib->searchForElements<Symbol>(),
+                                              "symbols", "symbol_id", libId, "pin_count");
             emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
             if (mAbort) break;
-            count += addElementsToDb<Package>(db, lib->searchForElements<Package>(),
-                                              "packages", "package_id", libId);
+            count += syncElementsInDb<Package>(db, lib->searchForElements<Package>(),
+                                               "packages", "package_id", libId, "pad_count");
             emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
             if (mAbort) break;
-            count += addElementsToDb<Component>(db, lib->searchForElements<Component>(),
-                                                "components", "component_id", libId);
+            count += syncElementsInDb<Component>(db, lib->searchForElements<Component>(),
+                                                 "components", "component_id", libId, "signal_count");
             emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
             if (mAbort) break;
-            count += addDevicesToDb(db, lib->searchForElements<Device>(),
-                                    "devices", "device_id", libId);
+            count += syncDevicesInDb(db, lib->searchForElements<Device>(),
+                                     "devices", "device_id", libId);
             emit progressUpdate(percent += qreal(100) / (libraries.count() * 6));
+            if (mAbort) break;
+            transactionGuard.commit(); // can throw
+
+            // the library is committed, so its elements are already usable by
+            // queries while the remaining libraries are still being scanned
+            emit libraryScanned(libraries.indexOf(lib) + 1, libraries.count());
         }
 
-        // commit transaction
         if (!mAbort) {
-            transactionGuard.commit(); // can throw
+            // remove cached previews of elements which do no longer exist
+            mWorkspace.getLibraryPreviewCache().removeObsoletePreviews(mValidPreviewFileNames);
             emit succeeded(count);
         }
     } catch (const Exception& e) {
@@ -121,54 +171,46 @@ void WorkspaceLibraryScanner::run() noexcept
     }
 }
 
-void WorkspaceLibraryScanner::clearAllTables(SQLiteDatabase& db)
+int WorkspaceLibraryScanner::updateLibraryInDb(SQLiteDatabase& db,
+                                               const QSharedPointer<library::Library>& lib)
 {
-    // libraries
-    db.clearTable("libraries_tr");
-    db.clearTable("libraries");
-
-    // component categories
-    db.clearTable("component_categories_tr");
-    db.clearTable("component_categories");
-
-    // package categories
-    db.clearTable("package_categories_tr");
-    db.clearTable("package_categories");
-
-    // symbols
-    db.clearTable("symbols_tr");
-    db.clearTable("symbols_cat");
-    db.clearTable("symbols");
-
-    // packages
-    db.clearTable("packages_tr");
-    db.clearTable("packages_cat");
-    db.clearTable("packages");
-
-    // components
-    db.clearTable("components_tr");
-    db.clearTable("components_cat");
-    db.clearTable("components");
-
-    // devices
-    db.clearTable("devices_tr");
-    db.clearTable("devices_cat");
-    db.clearTable("devices");
-}
+    // check if the library is already in the database
+    QString relpath = lib->getFilePath().toRelative(mWorkspace.getLibrariesPath());
+    int id = -1;
+    {
+        QSqlQuery query = db.prepareCachedQuery(
+            "SELECT id FROM libraries WHERE filepath = :filepath");
+        query.bindValue(":filepath", relpath);
+        db.exec(query);
+        if (query.next()) {
+            id = query.value(0).toInt();
+        }
+    }
+
+    if (id >= 0) {
+        // update the existing row (keeps the lib_id of all element rows valid)
+        QSqlQuery query = db.prepareCachedQuery(
+            "UPDATE libraries SET uuid = :uuid, version = :version WHERE id = :id");
+        query.bindValue(":uuid",    lib->getUuid().toStr());
+        query.bindValue(":version", lib->getVersion().toStr());
+        query.bindValue(":id",      id);
+        db.exec(query);
+        query = db.prepareCachedQuery("DELETE FROM libraries_tr WHERE lib_id = :id");
+        query.bindValue(":id", id);
+        db.exec(query);
+    } else {
+        QSqlQuery query = db.prepareCachedQuery(
+            "INSERT INTO libraries "
+            "(filepath, uuid, version) VALUES "
+            "(:filepath, :uuid, :version)");
+        query.bindValue(":filepath",    relpath);
+        query.bindValue(":uuid",        lib->getUuid().toStr());
+        query.bindValue(":version",     lib->getVersion().toStr());
+        id = db.insert(query);
+    }
 
-int WorkspaceLibraryScanner::addLibraryToDb(SQLiteDatabase& db,
-                                            const QSharedPointer<library::Library>& lib)
-{
-    QSqlQuery query = db.prepareQuery(
-        "INSERT INTO libraries "
-        "(filepath, uuid, version) VALUES "
-        "(:filepath, :uuid, :version)");
-    query.bindValue(":filepath",    lib->getFilePath().toRelative(mWorkspace.getLibrariesPath()));
-    query.bindValue(":uuid",        lib->getUuid().toStr());
-    query.bindValue(":version",     lib->getVersion().toStr());
-    int id = db.insert(query);
     foreach (const QString& locale, lib->getAllAvailableLocales()) {
-        QSqlQuery query = db.prepareQuery(
+        QSqlQuery query = db.prepareCachedQuery(
             "INSERT INTO libraries_tr "
             "(lib_id, locale, name, description, keywords) VALUES "
             "(:element_id, :locale, :name, :description, :keywords)");
@@ -182,78 +224,252 @@ int WorkspaceLibraryScanner::addLibraryToDb(SQLiteDatabase& db,
     return id;
 }
 
+void WorkspaceLibraryScanner::removeObsoleteLibraries(SQLiteDatabase& db,
+        const QList<QSharedPointer<library::Library>>& libs)
+{
+    QSet<QString> validPaths;
+    foreach (const QSharedPointer<Library>& lib, libs) {
+        validPaths.insert(lib->getFilePath().toRelative(mWorkspace.getLibrariesPath()));
+    }
+
+    QSqlQuery query = db.prepareCachedQuery("SELECT id, filepath FROM libraries");
+    db.exec(query);
+    QList<int> obsoleteIds;
+    while (query.next()) {
+        if (!validPaths.contains(query.value(1).toString())) {
+            obsoleteIds.append(query.value(0).toInt());
+        }
+    }
+
+    foreach (int libId, obsoleteIds) {
+        foreach (const QString& table, QStringList{"component_categories",
+                 "package_categories", "symbols", "packages", "components", "devices"}) {
+            QString idColumn = table.endsWith("_categories") ? "cat_id"
+                             : QString(table).remove(table.length() - 1, 1) % "_id";
+            bool hasCategories = !table.endsWith("_categories");
+            bool fts = tableExists(db, table % "_fts");
+            QSqlQuery idQuery = db.prepareCachedQuery(
+                "SELECT id FROM " % table % " WHERE lib_id = :lib_id");
+            idQuery.bindValue(":lib_id", libId);
+            db.exec(idQuery);
+            while (idQuery.next()) {
+                removeElementFromDb(db, table, idColumn, idQuery.value(0).toInt(),
+                                    hasCategories, fts);
+            }
+        }
+        QSqlQuery trQuery = db.prepareCachedQuery(
+            "DELETE FROM libraries_tr WHERE lib_id = :id");
+        trQuery.bindValue(":id", libId);
+        db.exec(trQuery);
+        QSqlQuery libQuery = db.prepareCachedQuery("DELETE FROM libraries WHERE id = :id");
+        libQuery.bindValue(":id", libId);
+        db.exec(libQuery);
+    }
+}
+
+QHash<QString, WorkspaceLibraryScanner::DbElement> WorkspaceLibraryScanner::getElementsFromDb(
+        SQLiteDatabase& db, const QString& table, int libId)
+{
+    QSqlQuery query = db.prepareCachedQuery(
+        "SELECT id, filepath, fingerprint, uuid, version FROM " % table %
+        " WHERE lib_id = :lib_id");
+    query.bindValue(":lib_id", libId);
+    db.exec(query);
+
+    QHash<QString, DbElement> elements;
+    while (query.next()) {
+        DbElement element;
+        element.id = query.value(0).toInt();
+        element.fingerprint = query.value(2).toString();
+        element.uuid = query.value(3).toString();
+        element.version = query.value(4).toString();
+        elements.insert(query.value(1).toString(), element);
+    }
+    return elements;
+}
+
+QList<FilePath> WorkspaceLibraryScanner::determineChangedElements(SQLiteDatabase& db,
+        const QList<FilePath>& dirs, const QString& table, const QString& idColumn,
+        int libId, bool hasCategories, bool fts, bool trackPreviews,
+        QStringList& fingerprints, int& unchangedCount)
+{
+    QHash<QString, DbElement> existing = getElementsFromDb(db, table, libId);
+
+    QList<FilePath> changed;
+    foreach (const FilePath& dir, dirs) {
+        QString relpath = dir.toRelative(mWorkspace.getLibrariesPath());
+        QString fingerprint = calcElementFingerprint(dir);
+        auto it = existing.find(relpath);
+        if ((it != existing.end()) && (it->fingerprint == fingerprint)) {
+            // unchanged --> keep the database row as it is
+            if (trackPreviews) {
+                mValidPreviewFileNames.insert(WorkspaceLibraryPreviewCache::getFileName(
+                    Uuid(it->uuid), Version(it->version)));
+            }
+            existing.erase(it);
+            unchangedCount++;
+        } else {
+            if (it != existing.end()) {
+                removeElementFromDb(db, table, idColumn, it->id, hasCategories, fts);
+                existing.erase(it);
+            }
+            changed.append(dir);
+            fingerprints.append(fingerprint);
+        }
+    }
+
+    // whatever is left in the hash no longer exists on disk
+    foreach (const DbElement& element, existing) {
+        removeElementFromDb(db, table, idColumn, element.id, hasCategories, fts);
+    }
+    return changed;
+}
+
+void WorkspaceLibraryScanner::removeElementFromDb(SQLiteDatabase& db, const QString& table,
+        const QString& idColumn, int id, bool hasCategories, bool fts)
+{
+    QSqlQuery query = db.prepareCachedQuery(
+        "DELETE FROM " % table % "_tr WHERE " % idColumn % " = :id");
+    query.bindValue(":id", id);
+    db.exec(query);
+    if (hasCategories) {
+        query = db.prepareCachedQuery(
+            "DELETE FROM " % table % "_cat WHERE " % idColumn % " = :id");
+        query.bindValue(":id", id);
+        db.exec(query);
+    }
+    if (fts) {
+        query = db.prepareCachedQuery(
+            "DELETE FROM " % table % "_fts WHERE docid = :id");
+        query.bindValue(":id", id);
+        db.exec(query);
+    }
+    query = db.prepareCachedQuery("DELETE FROM " % table % " WHERE id = :id");
+    query.bindValue(":id", id);
+    db.exec(query);
+}
+
+QString WorkspaceLibraryScanner::calcElementFingerprint(const FilePath& dir) noexcept
+{
+    // the fingerprint covers the names, sizes and modification times of all files of
+    // the element directory, so any change to the element (including the version file)
+    // results in a different fingerprint and thus in re-parsing the element
+    QStringList entries;
+    QDirIterator it(dir.toStr(), QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext()) {
+        it.next();
+        QFileInfo info = it.fileInfo();
+        entries.append(it.filePath() % "|"
+                       % QString::number(info.size()) % "|"
+                       % QString::number(info.lastModified().toMSecsSinceEpoch()));
+    }
+    entries.sort(); // QDirIterator returns no defined order
+    QCryptographicHash hash(QCryptographicHash::Sha256);
+    hash.addData(entries.join('\n').toUtf8());
+    return QString(hash.result().toHex());
+}
+
 template <typename ElementType>
-int WorkspaceLibraryScanner::addCategoriesToDb(SQLiteDatabase& db, const QList<FilePath>& dirs,
+int WorkspaceLibraryScanner::syncCategoriesInDb(SQLiteDatabase& db, const QList<FilePath>& dirs,
     const QString& table, const QString& idColumn, int libId)
 {
     int count = 0;
-    foreach (const FilePath& filepath, dirs) {
-        if (mAbort) break;
-        try {
-            ElementType element(filepath, true); // can throw
-            QSqlQuery query = db.prepareQuery(
-                "INSERT INTO " % table % " "
-                "(lib_id, filepath, uuid, version, parent_uuid) VALUES "
-                "(:lib_id, :filepath, :uuid, :version, :parent_uuid)");
-            query.bindValue(":lib_id",      libId);
-            query.bindValue(":filepath",    filepath.toRelative(mWorkspace.getLibrariesPath()));
-            query.bindValue(":uuid",        element.getUuid().toStr());
-            query.bindValue(":version",     element.getVersion().toStr());
-            query.bindValue(":parent_uuid", element.getParentUuid().isNull() ? QVariant(QVariant::String) : element.getParentUuid().toStr());
-            int id = db.insert(query);
-            foreach (const QString& locale, element.getAllAvailableLocales()) {
-                QSqlQuery query = db.prepareQuery(
-                    "INSERT INTO " % table % "_tr "
-                    "(" % idColumn % ", locale, name, description, keywords) VALUES "
-                    "(:element_id, :locale, :name, :description, :keywords)");
-                query.bindValue(":element_id",  id);
-                query.bindValue(":locale",      locale);
-                query.bindValue(":name",        element.getNames().value(locale));
-                query.bindValue(":description", element.getDescriptions().value(locale));
-                query.bindValue(":keywords",    element.getKeywords().value(locale));
-                db.insert(query);
-            }
-            count++;
-        } catch (const Exception& e) {
-            qWarning() << "Failed to open library element:" << filepath.toNative();
+    QStringList fingerprints;
+    QList<FilePath> changed = determineChangedElements(db, dirs, table, idColumn, libId,
+                                                       false, false, false, fingerprints,
+                                                       count);
+    // parse all changed elements in parallel, but insert them into the database
+    // sequentially on this thread (the SQLite connection must only be used by its own
+    // thread)
+    QFuture<QSharedPointer<ElementType>> elements =
+        QtConcurrent::mapped(changed, ElementParser<ElementType>());
+    for (int i = 0; i < changed.count(); ++i) {
+        if (mAbort) {
+            elements.cancel();
+            break;
+        }
+        QSharedPointer<ElementType> element = elements.resultAt(i);
+        if (element.isNull()) continue; // could not be opened, already warned about
+        const FilePath& filepath = changed.at(i);
+        QSqlQuery query = db.prepareCachedQuery(
+            "INSERT INTO " % table % " "
+            "(lib_id, filepath, uuid, version, parent_uuid, fingerprint) VALUES "
+            "(:lib_id, :filepath, :uuid, :version, :parent_uuid, :fingerprint)");
+        query.bindValue(":lib_id",      libId);
+        query.bindValue(":filepath",    filepath.toRelative(mWorkspace.getLibrariesPath()));
+        query.bindValue(":uuid",        element->getUuid().toStr());
+        query.bindValue(":version",     element->getVersion().toStr());
+        query.bindValue(":parent_uuid", element->getParentUuid().isNull() ? QVariant(QVariant::String) : element->getParentUuid().toStr());
+        query.bindValue(":fingerprint", fingerprints.at(i));
+        int id = db.insert(query);
+        foreach (const QString& locale, element->getAllAvailableLocales()) {
+            QSqlQuery query = db.prepareCachedQuery(
+                "INSERT INTO " % table % "_tr "
+                "(" % idColumn % ", locale, name, description, keywords) VALUES "
+                "(:element_id, :locale, :name, :description, :keywords)");
+            query.bindValue(":element_id",  id);
+            query.bindValue(":locale",      locale);
+            query.bindValue(":name",        element->getNames().value(locale));
+            query.bindValue(":description", element->getDescriptions().value(locale));
+            query.bindValue(":keywords",    element->getKeywords().value(locale));
+            db.insert(query);
         }
+        count++;
     }
+    elements.waitForFinished();
     return count;
 }
 
 template <typename ElementType>
-int WorkspaceLibraryScanner::addElementsToDb(SQLiteDatabase& db, const QList<FilePath>& dirs,
-    const QString& table, const QString& idColumn, int libId)
+int WorkspaceLibraryScanner::syncElementsInDb(SQLiteDatabase& db, const QList<FilePath>& dirs,
+    const QString& table, const QString& idColumn, int libId, const QString& countColumn)
 {
     int count = 0;
-    foreach (const FilePath& filepath, dirs) {
-        if (mAbort) break;
-        try {
-            ElementType element(filepath, true); // can throw
-            QSqlQuery query = db.prepareQuery(
+    bool fts = tableExists(db, table % "_fts"); // currently only "components_fts" exists
+    QStringList fingerprints;
+    QList<FilePath> changed = determineChangedElements(db, dirs, table, idColumn, libId,
+                                                       true, fts, true, fingerprints,
+                                                       count);
+    // see syncCategoriesInDb(): parallel parsing, sequential database inserts
+    QFuture<QSharedPointer<ElementType>> elements =
+        QtConcurrent::mapped(changed, ElementParser<ElementType>());
+    for (int i = 0; i < changed.count(); ++i) {
+        if (mAbort) {
+            elements.cancel();
+            break;
+        }
+        QSharedPointer<ElementType> element = elements.resultAt(i);
+        if (element.isNull()) continue; // could not be opened, already warned about
+        mValidPreviewFileNames.insert(WorkspaceLibraryPreviewCache::getFileName(
+            element->getUuid(), element->getVersion()));
+        const FilePath& filepath = changed.at(i);
+        {
+            QSqlQuery query = db.prepareCachedQuery(
                 "INSERT INTO " % table % " "
-                "(lib_id, filepath, uuid, version) VALUES "
-                "(:lib_id, :filepath, :uuid, :version)");
+                "(lib_id, filepath, uuid, version, fingerprint, " % countColumn % ") VALUES "
+                "(:lib_id, :filepath, :uuid, :version, :fingerprint, :count)");
             query.bindValue(":lib_id",      libId);
             query.bindValue(":filepath",    filepath.toRelative(mWorkspace.getLibrariesPath()));
-            query.bindValue(":uuid",        element.getUuid().toStr());
-            query.bindValue(":version",     element.getVersion().toStr());
+            query.bindValue(":uuid",        element->getUuid().toStr());
+            query.bindValue(":version",     element->getVersion().toStr());
+            query.bindValue(":fingerprint", fingerprints.at(i));
+            query.bindValue(":count",       getStructuralCount(*element));
             int id = db.insert(query);
-            foreach (const QString& locale, element.getAllAvailableLocales()) {
-                QSqlQuery query = db.prepareQuery(
+            foreach (const QString& locale, element->getAllAvailableLocales()) {
+                QSqlQuery query = db.prepareCachedQuery(
                     "INSERT INTO " % table % "_tr "
                     "(" % idColumn % ", locale, name, description, keywords) VALUES "
                     "(:element_id, :locale, :name, :description, :keywords)");
                 query.bindValue(":element_id",  id);
                 query.bindValue(":locale",      locale);
-                query.bindValue(":name",        element.getNames().value(locale));
-                query.bindValue(":description", element.getDescriptions().value(locale));
-                query.bindValue(":keywords",    element.getKeywords().value(locale));
+                query.bindValue(":name",        element->getNames().value(locale));
+                query.bindValue(":description", element->getDescriptions().value(locale));
+                query.bindValue(":keywords",    element->getKeywords().value(locale));
                 db.insert(query);
             }
-            foreach (const Uuid& categoryUuid, element.getCategories()) {
+            foreach (const Uuid& categoryUuid, element->getCategories()) {
                 Q_ASSERT(!categoryUuid.isNull());
-                QSqlQuery query = db.prepareQuery(
+                QSqlQuery query = db.prepareCachedQuery(
                     "INSERT INTO " % table % "_cat "
                     "(" % idColumn % ", category_uuid) VALUES "
                     "(:element_id, :category_uuid)");
@@ -261,48 +477,103 @@ int WorkspaceLibraryScanner::addElementsToDb(SQLiteDatabase& db, const QList<Fil
                 query.bindValue(":category_uuid", categoryUuid.toStr());
                 db.insert(query);
             }
+            if (fts) {
+                // feed the full-text search index with the text of all locales
+                QStringList text;
+                foreach (const QString& locale, element->getAllAvailableLocales()) {
+                    text.append(element->getNames().value(locale));
+                    text.append(element->getKeywords().value(locale));
+                    text.append(element->getDescriptions().value(locale));
+                }
+                QSqlQuery query = db.prepareCachedQuery(
+                    "INSERT INTO " % table % "_fts "
+                    "(docid, `text`) VALUES "
+                    "(:element_id, :text)");
+                query.bindValue(":element_id",  id);
+                query.bindValue(":text",        text.join(' '));
+                db.exec(query);
+            }
             count++;
-        } catch (const Exception& e) {
-            qWarning() << "Failed to open library element:" << filepath.toNative();
         }
     }
+    elements.waitForFinished();
     return count;
 }
 
-int WorkspaceLibraryScanner::addDevicesToDb(SQLiteDatabase& db, const QList<FilePath>& dirs,
+bool WorkspaceLibraryScanner::tableExists(SQLiteDatabase& db, const QString& table)
+{
+    QSqlQuery query = db.prepareCachedQuery(
+        "SELECT name FROM sqlite_master WHERE type = 'table' AND name = :name");
+    query.bindValue(":name", table);
+    db.exec(query); // can throw
+    return query.next();
+}
+
+int WorkspaceLibraryScanner::getStructuralCount(const Symbol& element) noexcept
+{
+    return element.getPins().count();
+}
+
+int WorkspaceLibraryScanner::getStructuralCount(const Package& element) noexcept
+{
+    return element.getPads().count();
+}
+
+int WorkspaceLibraryScanner::getStructuralCount(const Component& element) noexcept
+{
+    return element.getSignals().count();
+}
+
+int WorkspaceLibraryScanner::syncDevicesInDb(SQLiteDatabase& db, const QList<FilePath>& dirs,
     const QString& table, const QString& idColumn, int libId)
 {
     int count = 0;
-    foreach (const FilePath& filepath, dirs) {
-        if (mAbort) break;
-        try {
-            Device element(filepath, true); // can throw
-            QSqlQuery query = db.prepareQuery(
+    bool fts = tableExists(db, table % "_fts"); // currently only "components_fts" exists
+    QStringList fingerprints;
+    QList<FilePath> changed = determineChangedElements(db, dirs, table, idColumn, libId,
+                                                       true, fts, true, fingerprints,
+                                                       count);
+    // see syncCategoriesInDb(): parallel parsing, sequential database inserts
+    QFuture<QSharedPointer<Device>> elements =
+        QtConcurrent::mapped(changed, ElementParser<Device>());
+    for (int i = 0; i < changed.count(); ++i) {
+        if (mAbort) {
+            elements.cancel();
+            break;
+        }
+        QSharedPointer<Device> element = elements.resultAt(i);
+        if (element.isNull()) continue; // could not be opened, already warned about
+        mValidPreviewFileNames.insert(WorkspaceLibraryPreviewCache::getFileName(
+            element->getUuid(), element->getVersion()));
+        const FilePath& filepath = changed.at(i);
+        {
+            QSqlQuery query = db.prepareCachedQuery(
                 "INSERT INTO " % table % " "
-                "(lib_id, filepath, uuid, version, component_uuid, package_uuid) VALUES "
-                "(:lib_id, :filepath, :uuid, :version, :component_uuid, :package_uuid)");
+                "(lib_id, filepath, uuid, version, component_uuid, package_uuid, fingerprint) VALUES "
+                "(:lib_id, :filepath, :uuid, :version, :component_uuid, :package_uuid, :fingerprint)");
             query.bindValue(":lib_id",      libId);
             query.bindValue(":filepath",        filepath.toRelative(mWorkspace.getLibrariesPath()));
-            query.bindValue(":uuid",            element.getUuid().toStr());
-            query.bindValue(":version",         element.getVersion().toStr());
-            query.bindValue(":component_uuid",  element.getComponentUuid().toStr());
-            query.bindValue(":package_uuid",    element.getPackageUuid().toStr());
+            query.bindValue(":uuid",            element->getUuid().toStr());
+            query.bindValue(":version",         element->getVersion().toStr());
+            query.bindValue(":component_uuid",  element->getComponentUuid().toStr());
+            query.bindValue(":package_uuid",    element->getPackageUuid().toStr());
+            query.bindValue(":fingerprint",     fingerprints.at(i));
             int id = db.insert(query);
-            foreach (const QString& locale, element.getAllAvailableLocales()) {
-                QSqlQuery query = db.prepareQuery(
+            foreach (const QString& locale, element->getAllAvailableLocales()) {
+                QSqlQuery query = db.prepareCachedQuery(
                     "INSERT INTO " % table % "_tr "
                     "(" % idColumn % ", locale, name, description, keywords) VALUES "
                     "(:element_id, :locale, :name, :description, :keywords)");
                 query.bindValue(":element_id",  id);
                 query.bindValue(":locale",      locale);
-                query.bindValue(":name",        element.getNames().value(locale));
-                query.bindValue(":description", element.getDescriptions().value(locale));
-                query.bindValue(":keywords",    element.getKeywords().value(locale));
+                query.bindValue(":name",        element->getNames().value(locale));
+                query.bindValue(":description", element->getDescriptions().value(locale));
+                query.bindValue(":keywords",    element->getKeywords().value(locale));
                 db.insert(query);
             }
-            foreach (const Uuid& categoryUuid, element.getCategories()) {
+            foreach (const Uuid& categoryUuid, element->getCategories()) {
                 Q_ASSERT(!categoryUuid.isNull());
-                QSqlQuery query = db.prepareQuery(
+                QSqlQuery query = db.prepareCachedQuery(
                     "INSERT INTO " % table % "_cat "
                     "(" % idColumn % ", category_uuid) VALUES "
                     "(:element_id, :category_uuid)");
@@ -310,11 +581,26 @@ int WorkspaceLibraryScanner::addDevicesToDb(SQLiteDatabase& db, const QList<File
                 query.bindValue(":category_uuid", categoryUuid.toStr());
                 db.insert(query);
             }
+            if (fts) {
+                // feed the full-text search index with the text of all locales
+                QStringList text;
+                foreach (const QString& locale, element->getAllAvailableLocales()) {
+                    text.append(element->getNames().value(locale));
+                    text.append(element->getKeywords().value(locale));
+                    text.append(element->getDescriptions().value(locale));
+                }
+                QSqlQuery query = db.prepareCachedQuery(
+                    "INSERT INTO " % table % "_fts "
+                    "(docid, `text`) VALUES "
+                    "(:element_id, :text)");
+                query.bindValue(":element_id",  id);
+                query.bindValue(":text",        text.join(' '));
+                db.exec(query);
+            }
             count++;
-        } catch (const Exception& e) {
-            qWarning() << "Failed to open library element:" << filepath.toNative();
         }
     }
+    elements.waitForFinished();
     return count;
 }
 
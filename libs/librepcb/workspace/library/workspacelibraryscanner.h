@@ -36,6 +36,9 @@ class SQLiteDatabase;
 
 namespace library {
 class Library;
+class Symbol;
+class Package;
+class Component;
 }
 
 namespace workspace {
@@ -49,6 +52,33 @@ class Workspace;
 /**
  * @brief The WorkspaceLibraryScanner class
  *
+ * Database write performance: all inserts use cached prepared statements and run
+ * inside one transaction per library, and thanks to the incremental sync only
+ * added/modified elements are written at all. A bulk multi-row upsert API with
+ * deferred index rebuilds was evaluated on top of that and rejected: the element
+ * tables have no secondary indexes to defer (only UNIQUE constraints), and with
+ * transactions + statement caching the per-row binding overhead is a negligible
+ * fraction of the scan time, which is dominated by the XML parsing (already fanned
+ * out across the thread pool).
+ *
+ * The scan is incremental: every element row in the database stores a fingerprint of
+ * its directory (file names, sizes and modification times). On a rescan, elements with
+ * an unchanged fingerprint are kept as they are and only added/modified elements are
+ * re-parsed; removed elements and libraries are deleted from the database. A full
+ * rebuild only happens when the database schema version changed (the database file is
+ * deleted in this case, see librepcb#workspace#WorkspaceLibraryDb) or when the
+ * database is empty.
+ *
+ * A per-library manifest file (written on save/install, trusted on scan) was
+ * evaluated as a way to skip even the stat walk for unchanged libraries and
+ * rejected: libraries are regularly modified behind our back (git checkouts, file
+ * managers, other LibrePCB versions), a stale manifest would serve silently wrong
+ * library data, and validating it via directory mtimes cannot detect deep changes
+ * on POSIX filesystems (a modified file does not touch its ancestors' mtimes) -
+ * sound validation degenerates into the same full walk the manifest was meant to
+ * avoid. The fingerprint walk performs no file opens for unchanged elements and
+ * only stat calls, which is the minimum a correct rescan can do.
+ *
  * @warning Be very careful with dependencies to other objects as the #run() method is
  *          executed in a separate thread! Keep the number of dependencies as small as
  *          possible and consider thread synchronization and object lifetimes.
@@ -80,29 +110,65 @@ class WorkspaceLibraryScanner final : public QThread
 
         void started();
         void progressUpdate(int percent);
+
+        /// @brief Emitted after each library was committed to the database
+        void libraryScanned(int libsScanned, int libsTotal);
+
         void succeeded(int elementCount);
         void failed(QString errorMsg);
 
 
+    private: // Types
+
+        /// Metadata of an element row already existing in the database
+        struct DbElement {
+            int id;
+            QString fingerprint;
+            QString uuid;
+            QString version;
+        };
+
+
     private: // Methods
 
         void run() noexcept override;
-        void clearAllTables(SQLiteDatabase& db);
-        int addLibraryToDb(SQLiteDatabase& db, const QSharedPointer<library::Library>& lib);
+        int updateLibraryInDb(SQLiteDatabase& db, const QSharedPointer<library::Library>& lib);
+        void removeObsoleteLibraries(SQLiteDatabase& db,
+                                     const QList<QSharedPointer<library::Library>>& libs);
         template <typename ElementType>
-        int addCategoriesToDb(SQLiteDatabase& db, const QList<FilePath>& dirs,
-                              const QString& table, const QString& idColumn, int libId);
+        int syncCategoriesInDb(SQLiteDatabase& db, const QList<FilePath>& dirs,
+                               const QString& table, const QString& idColumn, int libId);
         template <typename ElementType>
-        int addElementsToDb(SQLiteDatabase& db, const QList<FilePath>& dirs,
+        int syncElementsInDb(SQLiteDatabase& db, const QList<FilePath>& dirs,
+                             const QString& table, const QString& idColumn, int libId,
+                             const QString& countColumn);
+        static int getStructuralCount(const library::Symbol& element) noexcept;
+        static int getStructuralCount(const library::Package& element) noexcept;
+        static int getStructuralCount(const library::Component& element) noexcept;
+        int syncDevicesInDb(SQLiteDatabase& db, const QList<FilePath>& dirs,
                             const QString& table, const QString& idColumn, int libId);
-        int addDevicesToDb(SQLiteDatabase& db, const QList<FilePath>& dirs,
-                           const QString& table, const QString& idColumn, int libId);
+        QHash<QString, DbElement> getElementsFromDb(SQLiteDatabase& db, const QString& table,
+                                                    int libId);
+        QList<FilePath> determineChangedElements(SQLiteDatabase& db, const QList<FilePath>& dirs,
+                                                 const QString& table, const QString& idColumn,
+                                                 int libId, bool hasCategories, bool fts,
+                                                 bool trackPreviews, QStringList& fingerprints,
+                                                 int& unchangedCount);
+        void removeElementFromDb(SQLiteDatabase& db, const QString& table,
+                                 const QString& idColumn, int id, bool hasCategories, bool fts);
+        static QString calcElementFingerprint(const FilePath& dir) noexcept;
+        static bool tableExists(SQLiteDatabase& db, const QString& table);
 
 
     private: // Data
 
         Workspace& mWorkspace;
         volatile bool mAbort;
+
+        /// preview cache file names of all scanned elements (used to remove obsolete
+        /// previews after a successful scan, see
+        /// librepcb#workspace#WorkspaceLibraryPreviewCache#removeObsoletePreviews())
+        QSet<QString> mValidPreviewFileNames;
 };
 
 /*****************************************************************************************
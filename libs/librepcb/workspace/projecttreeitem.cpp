@@ -36,7 +36,8 @@ namespace workspace {
  ****************************************************************************************/
 
 ProjectTreeItem::ProjectTreeItem(ProjectTreeItem* parent, const FilePath& filepath) :
-    mFilePath(filepath), mParent(parent), mDepth(parent ? parent->getDepth() + 1 : 0)
+    mFilePath(filepath), mParent(parent), mDepth(parent ? parent->getDepth() + 1 : 0),
+    mChildsLoaded(false)
 {
     QMimeDatabase db;
     mMimeType = db.mimeTypeForFile(mFilePath.toStr());
@@ -58,15 +59,7 @@ ProjectTreeItem::ProjectTreeItem(ProjectTreeItem* parent, const FilePath& filepa
             mType = Folder;
         }
 
-        // scan folder and add child items
-        if (mDepth < 15) // limit the maximum depth in the project directory to avoid endless recursion
-        {
-            QFileInfoList items = dir.entryInfoList(QDir::Files | QDir::Dirs |
-                                                    QDir::NoDotAndDotDot,
-                                                    QDir::DirsFirst | QDir::Name);
-            foreach (QFileInfo item, items)
-                mChilds.append(new ProjectTreeItem(this, FilePath(item.absoluteFilePath())));
-        }
+        // note: the child items are not created here, see #loadChilds()
     }
     else if (mFilePath.isExistingFile())
     {
@@ -75,7 +68,7 @@ ProjectTreeItem::ProjectTreeItem(ProjectTreeItem* parent, const FilePath& filepa
             mType = ProjectFile;
         else
             mType = File;
-    }    
+    }
 }
 
 ProjectTreeItem::~ProjectTreeItem()
@@ -95,6 +88,24 @@ int ProjectTreeItem::getChildNumber() const
         return 0;
 }
 
+bool ProjectTreeItem::canHaveChilds() const
+{
+    // limit the maximum depth in the project directory to avoid endless recursion
+    return ((mType == Folder) || (mType == ProjectFolder)) && (mDepth < 15);
+}
+
+void ProjectTreeItem::getLoadedChildDirectories(QStringList& dirs) const
+{
+    foreach (ProjectTreeItem* child, mChilds)
+    {
+        if (child->areChildsLoaded())
+        {
+            dirs.append(child->getFilePath().toStr());
+            child->getLoadedChildDirectories(dirs);
+        }
+    }
+}
+
 QVariant ProjectTreeItem::data(int role) const
 {
     switch (role)
@@ -133,6 +144,44 @@ QVariant ProjectTreeItem::data(int role) const
     return QVariant();
 }
 
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+QList<ProjectTreeItem*> ProjectTreeItem::scanChildsFromDisk()
+{
+    QList<ProjectTreeItem*> childs;
+    if (canHaveChilds())
+    {
+        QDir dir(mFilePath.toStr());
+        QFileInfoList items = dir.entryInfoList(QDir::Files | QDir::Dirs |
+                                                QDir::NoDotAndDotDot,
+                                                QDir::DirsFirst | QDir::Name);
+        foreach (QFileInfo item, items)
+            childs.append(new ProjectTreeItem(this, FilePath(item.absoluteFilePath())));
+    }
+    return childs;
+}
+
+void ProjectTreeItem::setChilds(const QList<ProjectTreeItem*>& childs)
+{
+    Q_ASSERT(mChilds.isEmpty());
+    mChilds = childs;
+    mChildsLoaded = true;
+}
+
+void ProjectTreeItem::loadChilds()
+{
+    if (!mChildsLoaded)
+        setChilds(scanChildsFromDisk());
+}
+
+void ProjectTreeItem::unloadChilds()
+{
+    qDeleteAll(mChilds);        mChilds.clear();
+    mChildsLoaded = false;
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
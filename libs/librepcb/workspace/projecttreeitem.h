@@ -68,8 +68,17 @@ class ProjectTreeItem
         ProjectTreeItem* getChild(int index)    const {return mChilds.value(index);}
         int getChildCount()                     const {return mChilds.count();}
         int getChildNumber()                    const;
+        bool canHaveChilds()                    const;
+        bool areChildsLoaded()                  const {return mChildsLoaded;}
+        void getLoadedChildDirectories(QStringList& dirs) const;
         QVariant data(int role) const;
 
+        // General Methods
+        QList<ProjectTreeItem*> scanChildsFromDisk();
+        void setChilds(const QList<ProjectTreeItem*>& childs);
+        void loadChilds();
+        void unloadChilds();
+
     private:
 
         // make some methods inaccessible...
@@ -82,6 +91,7 @@ class ProjectTreeItem
         ItemType_t mType;
         QMimeType mMimeType;
         unsigned int mDepth; ///< this is to avoid endless recursion in the parent-child relationship
+        bool mChildsLoaded; ///< false until #loadChilds() or #setChilds() was called
         QList<ProjectTreeItem*> mChilds;
 };
 
@@ -39,7 +39,16 @@ namespace workspace {
 ProjectTreeModel::ProjectTreeModel(const Workspace& workspace) :
     QAbstractItemModel(0)
 {
+    connect(&mFileSystemWatcher, &QFileSystemWatcher::directoryChanged,
+            this, &ProjectTreeModel::directoryChanged);
+
+    // only the top level of the projects directory is scanned here - all other
+    // directories are loaded lazily when they get expanded, see #fetchMore()
     mRootProjectDirectory = new ProjectTreeItem(0, workspace.getProjectsPath());
+    mRootProjectDirectory->loadChilds();
+    if (mRootProjectDirectory->canHaveChilds()) {
+        mFileSystemWatcher.addPath(mRootProjectDirectory->getFilePath().toStr());
+    }
 }
 
 ProjectTreeModel::~ProjectTreeModel()
@@ -47,6 +56,37 @@ ProjectTreeModel::~ProjectTreeModel()
     delete mRootProjectDirectory;       mRootProjectDirectory = 0;
 }
 
+/*****************************************************************************************
+ *  General Methods
+ ****************************************************************************************/
+
+QModelIndex ProjectTreeModel::getIndexOfFilePath(const FilePath& filepath)
+{
+    ProjectTreeItem* item = mRootProjectDirectory;
+    QModelIndex index;
+    while (item->getFilePath() != filepath)
+    {
+        if (canFetchMore(index))
+            fetchMore(index);
+        ProjectTreeItem* next = 0;
+        for (int i = 0; i < item->getChildCount(); ++i)
+        {
+            ProjectTreeItem* child = item->getChild(i);
+            if ((child->getFilePath() == filepath)
+                || (filepath.isLocatedInDir(child->getFilePath())))
+            {
+                next = child;
+                index = createIndex(i, 0, child);
+                break;
+            }
+        }
+        if (!next)
+            return QModelIndex();
+        item = next;
+    }
+    return index;
+}
+
 /*****************************************************************************************
  *  Inherited Methods
  ****************************************************************************************/
@@ -63,6 +103,27 @@ int ProjectTreeModel::rowCount(const QModelIndex& parent) const
     return parentItem->getChildCount();
 }
 
+bool ProjectTreeModel::hasChildren(const QModelIndex& parent) const
+{
+    ProjectTreeItem* parentItem = getItem(parent);
+    if (!parentItem->areChildsLoaded())
+        return parentItem->canHaveChilds(); // avoid scanning the directory just for the expander
+    return (parentItem->getChildCount() > 0);
+}
+
+bool ProjectTreeModel::canFetchMore(const QModelIndex& parent) const
+{
+    ProjectTreeItem* parentItem = getItem(parent);
+    return parentItem->canHaveChilds() && (!parentItem->areChildsLoaded());
+}
+
+void ProjectTreeModel::fetchMore(const QModelIndex& parent)
+{
+    ProjectTreeItem* parentItem = getItem(parent);
+    if (!parentItem->areChildsLoaded())
+        loadChilds(parentItem, parent);
+}
+
 QModelIndex ProjectTreeModel::index(int row, int column, const QModelIndex& parent) const
 {
     if (parent.isValid() && parent.column() != 0)
@@ -110,6 +171,37 @@ QVariant ProjectTreeModel::data(const QModelIndex& index, int role) const
     return item->data(role);
 }
 
+/*****************************************************************************************
+ *  Private Slots
+ ****************************************************************************************/
+
+void ProjectTreeModel::directoryChanged(const QString& path)
+{
+    ProjectTreeItem* item = findItem(mRootProjectDirectory, FilePath(path));
+    if ((!item) || (!item->areChildsLoaded()))
+        return;
+    QModelIndex index = getIndex(item);
+
+    // stop watching all (loaded) directories below the changed directory
+    QStringList loadedChildDirs;
+    item->getLoadedChildDirectories(loadedChildDirs);
+    if (!loadedChildDirs.isEmpty())
+        mFileSystemWatcher.removePaths(loadedChildDirs);
+
+    // remove the old child items
+    if (item->getChildCount() > 0)
+    {
+        beginRemoveRows(index, 0, item->getChildCount() - 1);
+        item->unloadChilds();
+        endRemoveRows();
+    }
+    else
+        item->unloadChilds();
+
+    // add the new child items
+    loadChilds(item, index);
+}
+
 /*****************************************************************************************
  *  Private Methods
  ****************************************************************************************/
@@ -125,6 +217,42 @@ ProjectTreeItem* ProjectTreeModel::getItem(const QModelIndex& index) const
     return mRootProjectDirectory;
 }
 
+QModelIndex ProjectTreeModel::getIndex(ProjectTreeItem* item) const
+{
+    if (item == mRootProjectDirectory)
+        return QModelIndex();
+    return createIndex(item->getChildNumber(), 0, item);
+}
+
+ProjectTreeItem* ProjectTreeModel::findItem(ProjectTreeItem* item, const FilePath& filepath) const
+{
+    if (item->getFilePath() == filepath)
+        return item;
+    for (int i = 0; i < item->getChildCount(); ++i)
+    {
+        ProjectTreeItem* result = findItem(item->getChild(i), filepath);
+        if (result)
+            return result;
+    }
+    return 0;
+}
+
+void ProjectTreeModel::loadChilds(ProjectTreeItem* item, const QModelIndex& index)
+{
+    QList<ProjectTreeItem*> childs = item->scanChildsFromDisk();
+    if (!childs.isEmpty())
+    {
+        beginInsertRows(index, 0, childs.count() - 1);
+        item->setChilds(childs);
+        endInsertRows();
+    }
+    else
+        item->setChilds(childs);
+
+    // get notified about changes in this directory to update the item's childs
+    mFileSystemWatcher.addPath(item->getFilePath().toStr());
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
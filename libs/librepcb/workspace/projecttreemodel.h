@@ -25,6 +25,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include <QtWidgets>
+#include <librepcb/common/fileio/filepath.h>
 
 /*****************************************************************************************
  *  Namespace / Forward Declarations
@@ -59,14 +60,33 @@ class ProjectTreeModel : public QAbstractItemModel
         // General
         QModelIndexList getPersistentIndexList() const {return persistentIndexList();}
 
+        /**
+         * @brief Get the index of the item with a specific file path
+         *
+         * All directories on the way down to the item are loaded if required, so this
+         * method can be used to restore the expanded state of lazily loaded items.
+         *
+         * @param filepath  The file path of the requested item
+         *
+         * @return The index of the item, or an invalid index if it does not exist
+         */
+        QModelIndex getIndexOfFilePath(const FilePath& filepath);
+
         // Inherited Methods
         virtual int columnCount(const QModelIndex& parent = QModelIndex()) const;
         virtual int rowCount(const QModelIndex& parent = QModelIndex()) const;
+        virtual bool hasChildren(const QModelIndex& parent = QModelIndex()) const;
+        virtual bool canFetchMore(const QModelIndex& parent) const;
+        virtual void fetchMore(const QModelIndex& parent);
         virtual QModelIndex index(int row, int column, const QModelIndex& parent = QModelIndex()) const;
         virtual QModelIndex parent(const QModelIndex& index) const;
         virtual QVariant headerData(int section, Qt::Orientation orientation, int role = Qt::DisplayRole) const;
         virtual QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const;
 
+    private slots:
+
+        void directoryChanged(const QString& path);
+
     private:
 
         // make some methods inaccessible...
@@ -75,9 +95,13 @@ class ProjectTreeModel : public QAbstractItemModel
 
         // Private Methods
         ProjectTreeItem* getItem(const QModelIndex& index) const;
+        QModelIndex getIndex(ProjectTreeItem* item) const;
+        ProjectTreeItem* findItem(ProjectTreeItem* item, const FilePath& filepath) const;
+        void loadChilds(ProjectTreeItem* item, const QModelIndex& index);
 
         // Attributes
         ProjectTreeItem* mRootProjectDirectory;
+        QFileSystemWatcher mFileSystemWatcher;
 };
 
 /*****************************************************************************************
@@ -22,6 +22,7 @@
  ****************************************************************************************/
 #include <QtCore>
 #include <QtWidgets>
+#include <QtConcurrent/QtConcurrent>
 #include "recentprojectsmodel.h"
 #include "workspace.h"
 #include "settings/workspacesettings.h"
@@ -57,6 +58,8 @@ RecentProjectsModel::RecentProjectsModel(const Workspace& workspace) noexcept :
     } catch (Exception& e) {
         qWarning() << "Could not read recent projects file:" << e.getMsg();
     }
+
+    startExistenceProbe();
 }
 
 RecentProjectsModel::~RecentProjectsModel() noexcept
@@ -116,6 +119,34 @@ void RecentProjectsModel::setLastRecentProject(const FilePath& filepath) noexcep
     save();
 }
 
+void RecentProjectsModel::startExistenceProbe() noexcept
+{
+    // probe the existence of the listed projects on a worker thread: entries on a
+    // disconnected network share would block the first window paint for seconds if
+    // they were stat'ed on the GUI thread. Until the results arrive, all entries are
+    // shown as normal placeholder rows.
+    QStringList paths;
+    foreach (const FilePath& fp, mRecentProjects) {
+        paths.append(fp.toStr());
+    }
+    connect(&mExistenceProbeWatcher, &QFutureWatcher<QSet<QString>>::finished,
+            this, [this]() {
+        mMissingProjects = mExistenceProbeWatcher.result();
+        if ((!mMissingProjects.isEmpty()) && (mRecentProjects.count() > 0)) {
+            emit dataChanged(index(0), index(mRecentProjects.count() - 1));
+        }
+    }, Qt::UniqueConnection);
+    mExistenceProbeWatcher.setFuture(QtConcurrent::run([paths]() {
+        QSet<QString> missing;
+        foreach (const QString& path, paths) {
+            if (!QFileInfo(path).exists()) {
+                missing.insert(path);
+            }
+        }
+        return missing;
+    }));
+}
+
 /*****************************************************************************************
  *  Inherited Methods
  ****************************************************************************************/
@@ -140,7 +171,20 @@ QVariant RecentProjectsModel::data(const QModelIndex& index, int role) const
             return mRecentProjects.at(index.row()).getFilename();
         }
 
-        //case Qt::ToolTipRole:
+        case Qt::ToolTipRole: {
+            QString path = mRecentProjects.at(index.row()).toNative();
+            if (mMissingProjects.contains(mRecentProjects.at(index.row()).toStr())) {
+                return QString("%1 (%2)").arg(path, tr("file not found"));
+            }
+            return path;
+        }
+
+        case Qt::ForegroundRole:
+            if (mMissingProjects.contains(mRecentProjects.at(index.row()).toStr())) {
+                return QBrush(Qt::gray); // the project does not exist (anymore)
+            }
+            return QVariant();
+
         case Qt::StatusTipRole:
         case Qt::UserRole:
             return mRecentProjects.at(index.row()).toNative();
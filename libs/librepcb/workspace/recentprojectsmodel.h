@@ -72,11 +72,20 @@ class RecentProjectsModel : public QAbstractListModel
         int rowCount(const QModelIndex& parent = QModelIndex()) const;
         QVariant data(const QModelIndex& index, int role = Qt::DisplayRole) const;
 
+        // Private Methods
+        void startExistenceProbe() noexcept;
+
         // Attributes
         const Workspace& mWorkspace;
         QScopedPointer<SmartTextFile> mFile;
         QList<FilePath> mRecentProjects;
 
+        /// Paths of listed projects which do not exist on disk. Probed on a worker
+        /// thread (a stat may block for seconds on a disconnected network share, so
+        /// it must never run on the GUI thread), empty until the probe finished.
+        QSet<QString> mMissingProjects;
+        QFutureWatcher<QSet<QString>> mExistenceProbeWatcher;
+
 };
 
 /*****************************************************************************************
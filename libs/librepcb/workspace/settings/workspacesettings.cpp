@@ -41,6 +41,12 @@ namespace workspace {
 WorkspaceSettings::WorkspaceSettings(const Workspace& workspace) :
     QObject(nullptr), mXmlFilePath(workspace.getMetadataPath().getPathTo("settings.xml"))
 {
+    // one write per quiet period, see applyAll()
+    mSaveDebounceTimer.setSingleShot(true);
+    mSaveDebounceTimer.setInterval(1000);
+    connect(&mSaveDebounceTimer, &QTimer::timeout,
+            this, &WorkspaceSettings::saveDebounced);
+
     qDebug("Load workspace settings...");
 
     // load settings if the settings file exists
@@ -71,6 +77,9 @@ WorkspaceSettings::WorkspaceSettings(const Workspace& workspace) :
 
 WorkspaceSettings::~WorkspaceSettings() noexcept
 {
+    if (mSaveDebounceTimer.isActive()) {
+        saveDebounced(); // flush the pending save, it must not get lost on quit
+    }
     mDialog.reset(); // the dialog must be deleted *before* any settings object!
     mItems.clear();
 }
@@ -92,7 +101,11 @@ void WorkspaceSettings::applyAll()
         item->apply();
     }
 
-    saveToFile(); // can throw
+    // debounced: applying several times within the quiet period (or toggling
+    // settings mid-interaction) results in a single file write, which keeps the
+    // settings I/O off the interactive path (relevant on network home directories).
+    // Note that the write itself is skipped anyway if the content is unchanged.
+    mSaveDebounceTimer.start();
 }
 
 void WorkspaceSettings::revertAll() noexcept
@@ -124,6 +137,15 @@ void WorkspaceSettings::loadSettingsItem(QScopedPointer<T>& member, const QStrin
     mItems.append(member.data());
 }
 
+void WorkspaceSettings::saveDebounced() noexcept
+{
+    try {
+        saveToFile(); // can throw
+    } catch (const Exception& e) {
+        qCritical() << "Could not save the workspace settings:" << e.getMsg();
+    }
+}
+
 void WorkspaceSettings::saveToFile() const
 {
     DomDocument doc(*serializeToDomElement("workspace_settings"));
@@ -108,6 +108,11 @@ class WorkspaceSettings final : public QObject, public SerializableObject
         void showSettingsDialog() noexcept;
 
 
+    private slots:
+
+        void saveDebounced() noexcept;
+
+
     private: // Methods
 
         template<typename T>
@@ -122,6 +127,7 @@ class WorkspaceSettings final : public QObject, public SerializableObject
 
         // General Attributes
         FilePath mXmlFilePath; ///< path to the "settings.xml" file
+        QTimer mSaveDebounceTimer; ///< coalesces saves into one write per quiet period
         QScopedPointer<WorkspaceSettingsDialog> mDialog; ///< the settings dialog
 
         // Settings Items
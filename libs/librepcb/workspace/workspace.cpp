@@ -31,6 +31,7 @@
 #include <librepcb/libraryeditor/libraryeditor.h>
 #include <librepcb/project/project.h>
 #include "library/workspacelibrarydb.h"
+#include "library/workspacelibrarypreviewcache.h"
 #include "projecttreemodel.h"
 #include "recentprojectsmodel.h"
 #include "favoriteprojectsmodel.h"
@@ -76,6 +77,17 @@ Workspace::Workspace(const FilePath& wsPath) :
     FileUtils::makePath(mMetadataPath); // can throw
     FileUtils::makePath(mLibrariesPath); // can throw
 
+    // determine the local cache directory (see getLocalCachePath())
+    QString cacheRoot = QStandardPaths::writableLocation(QStandardPaths::CacheLocation);
+    if (!cacheRoot.isEmpty()) {
+        QString wsKey = QString(QCryptographicHash::hash(
+            mPath.toStr().toUtf8(), QCryptographicHash::Sha256).toHex()).left(16);
+        mLocalCachePath = FilePath(cacheRoot).getPathTo("workspaces/" % wsKey);
+    } else {
+        mLocalCachePath = mMetadataPath;
+    }
+    FileUtils::makePath(mLocalCachePath); // can throw
+
     // Check if the workspace is locked (already open or application was crashed).
     switch (mLock.getStatus()) // can throw
     {
@@ -144,6 +156,10 @@ Workspace::Workspace(const FilePath& wsPath) :
         }
     }
 
+    // load library preview cache
+    mLibraryPreviewCache.reset(new WorkspaceLibraryPreviewCache(
+        mLocalCachePath.getPathTo("preview_cache"))); // can throw
+
     // load library database
     mLibraryDb.reset(new WorkspaceLibraryDb(*this)); // can throw
     connect(this, &Workspace::libraryAdded,
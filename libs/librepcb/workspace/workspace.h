@@ -49,6 +49,7 @@ class RecentProjectsModel;
 class FavoriteProjectsModel;
 class WorkspaceSettings;
 class WorkspaceLibraryDb;
+class WorkspaceLibraryPreviewCache;
 
 /*****************************************************************************************
  *  Class Workspace
@@ -106,6 +107,16 @@ class Workspace final : public QObject
          */
         const FilePath& getMetadataPath() const {return mMetadataPath;}
 
+        /**
+         * @brief Get the per-workspace cache directory on the *local* disk
+         *
+         * Workspaces may live on network shares; regenerable caches (library
+         * database, element previews) are far too I/O-heavy to be placed there,
+         * so they live in the system cache location, keyed by the workspace
+         * path. Falls back to #getMetadataPath() if no cache location exists.
+         */
+        const FilePath& getLocalCachePath() const {return mLocalCachePath;}
+
         /**
          * @brief Get the filepath to the "v#/libraries" directory in the workspace
          */
@@ -194,6 +205,11 @@ class Workspace final : public QObject
          */
         WorkspaceLibraryDb& getLibraryDb() const {return *mLibraryDb;}
 
+        /**
+         * @brief Get the workspace library preview cache
+         */
+        WorkspaceLibraryPreviewCache& getLibraryPreviewCache() const {return *mLibraryPreviewCache;}
+
 
         // Project Management
 
@@ -308,11 +324,13 @@ class Workspace final : public QObject
         FilePath mPath; ///< a FilePath object which represents the workspace directory
         FilePath mProjectsPath; ///< the directory "projects"
         FilePath mMetadataPath; ///< the subdirectory of the current file format version
+        FilePath mLocalCachePath; ///< per-workspace cache directory on the local disk
         FilePath mLibrariesPath; ///< the directory "v#/libraries"
         DirectoryLock mLock; ///< to lock the version directory (#mVersionPath)
         QScopedPointer<WorkspaceSettings> mWorkspaceSettings; ///< the WorkspaceSettings object
         QMap<QString, QSharedPointer<library::Library>> mLocalLibraries; ///< all local libraries
         QMap<QString, QSharedPointer<library::Library>> mRemoteLibraries; ///< all remote libraries
+        QScopedPointer<WorkspaceLibraryPreviewCache> mLibraryPreviewCache; ///< cached library element previews
         QScopedPointer<WorkspaceLibraryDb> mLibraryDb; ///< the library database
         QScopedPointer<ProjectTreeModel> mProjectTreeModel; ///< a tree model for the whole projects directory
         QScopedPointer<RecentProjectsModel> mRecentProjectsModel; ///< a list model of all recent projects
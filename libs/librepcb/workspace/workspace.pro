@@ -13,7 +13,7 @@ GENERATED_DIR = ../../../generated
 # Use common project definitions
 include(../../../common.pri)
 
-QT += core widgets xml sql printsupport
+QT += core widgets xml sql printsupport concurrent
 
 CONFIG += staticlib
 
@@ -25,6 +25,7 @@ SOURCES += \
     library/cat/categorytreeitem.cpp \
     library/cat/categorytreemodel.cpp \
     library/workspacelibrarydb.cpp \
+    library/workspacelibrarypreviewcache.cpp \
     library/workspacelibraryscanner.cpp \
     projecttreeitem.cpp \
     projecttreemodel.cpp \
@@ -47,6 +48,7 @@ HEADERS += \
     library/cat/categorytreeitem.h \
     library/cat/categorytreemodel.h \
     library/workspacelibrarydb.h \
+    library/workspacelibrarypreviewcache.h \
     library/workspacelibraryscanner.h \
     projecttreeitem.h \
     projecttreemodel.h \
@@ -0,0 +1,230 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <QtCore>
+#include <librepcb/common/fileio/domelement.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class DomElementTest : public ::testing::Test
+{
+    protected:
+        static DomElement* createTestTree() noexcept {
+            DomElement* root = new DomElement("root");
+            root->setAttribute("version", QString("1"));
+            root->setAttribute("empty", QString(""));
+            DomElement* child = root->appendChild("child");
+            child->setAttribute("foo", QString("bar"));
+            child->appendTextChild("text", QString("hello\nworld"));
+            child->appendChild("emptychild");
+            root->appendTextChild("special", QString("<&>\"'\xC3\xA4"));
+            return root;
+        }
+
+        static QByteArray serialize(const DomElement& element) noexcept {
+            QByteArray data;
+            QDataStream stream(&data, QIODevice::WriteOnly);
+            stream.setVersion(QDataStream::Qt_5_2);
+            element.writeBinary(stream);
+            return data;
+        }
+
+        static DomElement* deserialize(const QByteArray& data) noexcept {
+            QDataStream stream(data);
+            stream.setVersion(QDataStream::Qt_5_2);
+            return DomElement::readBinary(stream);
+        }
+
+        static void compareRecursively(const DomElement& a, const DomElement& b) {
+            EXPECT_EQ(a.getName(), b.getName());
+            if ((!a.hasChilds()) && (!b.hasChilds())) {
+                EXPECT_EQ(a.getText<QString>(false), b.getText<QString>(false));
+            }
+            EXPECT_EQ(a.getChildCount(), b.getChildCount());
+            for (int i = 0; (i < a.getChildCount()) && (i < b.getChildCount()); ++i) {
+                compareRecursively(*a.getChilds().at(i), *b.getChilds().at(i));
+            }
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(DomElementTest, testBinaryRoundTrip)
+{
+    QScopedPointer<DomElement> original(createTestTree());
+    QByteArray data = serialize(*original);
+    ASSERT_FALSE(data.isEmpty());
+
+    QScopedPointer<DomElement> restored(deserialize(data));
+    ASSERT_TRUE(restored != nullptr);
+    compareRecursively(*original, *restored);
+
+    // attributes must survive the round-trip too
+    EXPECT_EQ(QString("1"), restored->getAttribute<QString>("version", true));
+    EXPECT_TRUE(restored->hasAttribute("empty"));
+    EXPECT_EQ(QString("bar"),
+              restored->getFirstChild("child", true)->getAttribute<QString>("foo", true));
+}
+
+TEST_F(DomElementTest, testBinaryRoundTripOfDeepTree)
+{
+    // the sidecar cache serializes whole project files, so recursion must work for
+    // trees which are much deeper than typical hand-written XML
+    QScopedPointer<DomElement> root(new DomElement("root"));
+    DomElement* parent = root.data();
+    for (int i = 0; i < 500; ++i) {
+        parent = parent->appendChild("nested");
+    }
+    QScopedPointer<DomElement> restored(deserialize(serialize(*root)));
+    ASSERT_TRUE(restored != nullptr);
+    int depth = 0;
+    const DomElement* element = restored.data();
+    while (element->getChildCount() > 0) {
+        element = element->getChilds().first();
+        ++depth;
+    }
+    EXPECT_EQ(500, depth);
+}
+
+TEST_F(DomElementTest, testReadBinaryRejectsTruncatedStream)
+{
+    QScopedPointer<DomElement> original(createTestTree());
+    QByteArray data = serialize(*original);
+
+    // every possible truncation must be detected, never crash or return garbage
+    for (int len = 0; len < data.count(); len += qMax(1, data.count() / 50)) {
+        QScopedPointer<DomElement> restored(deserialize(data.left(len)));
+        EXPECT_TRUE(restored == nullptr) << "truncated at " << len;
+    }
+}
+
+TEST_F(DomElementTest, testReadBinaryRejectsInvalidTagName)
+{
+    QByteArray data;
+    {
+        QDataStream stream(&data, QIODevice::WriteOnly);
+        stream.setVersion(QDataStream::Qt_5_2);
+        stream << QString("not a valid tag!") << QString() << QMap<QString, QString>();
+        stream << qint32(0);
+    }
+    QScopedPointer<DomElement> restored(deserialize(data));
+    EXPECT_TRUE(restored == nullptr);
+}
+
+TEST_F(DomElementTest, testReadBinaryRejectsNegativeChildCount)
+{
+    QByteArray data;
+    {
+        QDataStream stream(&data, QIODevice::WriteOnly);
+        stream.setVersion(QDataStream::Qt_5_2);
+        stream << QString("root") << QString() << QMap<QString, QString>();
+        stream << qint32(-1);
+    }
+    QScopedPointer<DomElement> restored(deserialize(data));
+    EXPECT_TRUE(restored == nullptr);
+}
+
+TEST_F(DomElementTest, testReadBinaryRejectsHugeChildCount)
+{
+    // a corrupt child count must run into the end of the stream, not allocate forever
+    QByteArray data;
+    {
+        QDataStream stream(&data, QIODevice::WriteOnly);
+        stream.setVersion(QDataStream::Qt_5_2);
+        stream << QString("root") << QString() << QMap<QString, QString>();
+        stream << qint32(0x7FFFFFFF);
+    }
+    QScopedPointer<DomElement> restored(deserialize(data));
+    EXPECT_TRUE(restored == nullptr);
+}
+
+TEST_F(DomElementTest, testWriteToUtf8)
+{
+    QScopedPointer<DomElement> root(new DomElement("root"));
+    root->setAttribute("attr", QString("a&b<c>\"d\"\ne"));
+    root->appendTextChild("text", QString("x < y & z"));
+    root->appendChild("empty");
+
+    QByteArray out;
+    root->writeToUtf8(out, 0);
+    EXPECT_EQ(QByteArray(
+        "<root attr=\"a&amp;b&lt;c&gt;&quot;d&quot;&#10;e\">\n"
+        " <text>x &lt; y &amp; z</text>\n"
+        " <empty/>\n"
+        "</root>\n"), out);
+}
+
+TEST_F(DomElementTest, testPooledAllocationReusesFreedSlot)
+{
+    // DOM elements are allocated out of a global pool with a LIFO freelist, so
+    // deleting an element and creating a new one must reuse the same memory slot
+    DomElement* first = new DomElement("first");
+    void* slot = first;
+    delete first;
+    DomElement* second = new DomElement("second");
+    EXPECT_EQ(slot, static_cast<void*>(second));
+    delete second;
+}
+
+TEST_F(DomElementTest, testGetFirstChildByNameOnWideElement)
+{
+    // wide elements use a lazy name index internally; verify that lookups still
+    // return the *first* child of a name and that the index follows child list
+    // changes and renames
+    DomElement root("root");
+    for (int i = 0; i < 100; ++i) {
+        root.appendChild(new DomElement(QString("child%1").arg(i)));
+    }
+    DomElement* duplicate = new DomElement("child50");
+    root.appendChild(duplicate); // second element with an existing name
+
+    DomElement* found = root.getFirstChild("child50", true);
+    ASSERT_TRUE(found != nullptr);
+    EXPECT_NE(duplicate, found); // the first occurrence wins
+
+    // removing the first occurrence makes the duplicate the first one
+    root.removeChild(found, true);
+    EXPECT_EQ(duplicate, root.getFirstChild("child50", true));
+
+    // renaming a child must be reflected in subsequent lookups
+    duplicate->setName("renamed");
+    EXPECT_EQ(nullptr, root.getFirstChild("child50", false));
+    EXPECT_EQ(duplicate, root.getFirstChild("renamed", true));
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
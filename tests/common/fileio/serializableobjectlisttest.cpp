@@ -338,6 +338,52 @@ TEST_F(SerializableObjectListTest, testOperatorMove)
     EXPECT_EQ(mMocks[1], l2[1]);
 }
 
+TEST_F(SerializableObjectListTest, testMoveAppend)
+{
+    List l;
+    l.append(Mock(*mMocks[0]));
+    l.insert(0, Mock(*mMocks[1]));
+    EXPECT_EQ(2, l.count());
+    EXPECT_EQ(*mMocks[1], *l[0]);
+    EXPECT_EQ(*mMocks[0], *l[1]);
+}
+
+TEST_F(SerializableObjectListTest, testTakeSnapshot)
+{
+    List l{mMocks[0], mMocks[1]};
+    List::Snapshot s = l.takeSnapshot();
+    EXPECT_EQ(2, s.count());
+    EXPECT_EQ(mMocks[0], s.at(0));  // snapshot shares the elements...
+    EXPECT_EQ(mMocks[1], s.at(1));
+    l.remove(0);                    // ...but not the structure of the list
+    l.append(mMocks[2]);
+    EXPECT_EQ(2, s.count());
+    EXPECT_EQ(mMocks[0], s.at(0));
+    EXPECT_EQ(mMocks[1], s.at(1));
+}
+
+TEST_F(SerializableObjectListTest, testSnapshotSerialize)
+{
+    DomElement e("list");
+    List l{mMocks[0], mMocks[1]};
+    List::Snapshot s = l.takeSnapshot();
+    l.clear();
+    s.serialize(e);
+    EXPECT_EQ(2, e.getChildCount());
+    EXPECT_EQ(mMocks[1]->mUuid, e.getChilds()[1]->getAttribute<Uuid>("uuid", false));
+}
+
+TEST_F(SerializableObjectListTest, testSnapshotConstructor)
+{
+    List l1{mMocks[0], mMocks[1]};
+    List l2(l1.takeSnapshot());
+    EXPECT_EQ(2, l2.count());
+    EXPECT_NE(mMocks[0], l2[0]);    // pointers have changed...
+    EXPECT_NE(mMocks[1], l2[1]);
+    EXPECT_EQ(*mMocks[0], *l2[0]);  // ...but values not!
+    EXPECT_EQ(*mMocks[1], *l2[1]);
+}
+
 /*****************************************************************************************
  *  End of File
  ****************************************************************************************/
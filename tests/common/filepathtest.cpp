@@ -56,6 +56,22 @@ class FilePathTest : public ::testing::TestWithParam<FilePathTestData>
  *  Test Methods
  ****************************************************************************************/
 
+TEST(FilePathGetPathToTest, testCleanAndUncleanChildPaths)
+{
+    FilePath base("/foo/bar");
+    // clean names take the fast path; both must produce identical results
+    EXPECT_EQ(QString("/foo/bar/baz"), base.getPathTo("baz").toStr());
+    EXPECT_EQ(QString("/foo/bar/a/b.xml"), base.getPathTo("a/b.xml").toStr());
+    EXPECT_EQ(QString("/foo/bar/..hidden"), base.getPathTo("..hidden").toStr());
+    // unclean names must still be cleaned like before
+    EXPECT_EQ(QString("/foo/baz"), base.getPathTo("../baz").toStr());
+    EXPECT_EQ(QString("/foo/bar/baz"), base.getPathTo("./baz").toStr());
+    EXPECT_EQ(QString("/foo/bar/baz"), base.getPathTo("baz/").toStr());
+    EXPECT_EQ(QString("/foo/bar/a/b"), base.getPathTo("a//b").toStr());
+    // root parent must not produce a double slash
+    EXPECT_EQ(QString("/foo"), FilePath("/").getPathTo("foo").toStr());
+}
+
 TEST_P(FilePathTest, testDefaultConstructor)
 {
     FilePath p;
@@ -0,0 +1,166 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/geometry/geometrykernel.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class GeometryKernelTest : public ::testing::Test
+{
+    protected:
+        static GeometryKernel::PathList rect(qint64 x1, qint64 y1, qint64 x2, qint64 y2) {
+            GeometryKernel::Path path;
+            path.append(Point(Length(x1), Length(y1)));
+            path.append(Point(Length(x2), Length(y1)));
+            path.append(Point(Length(x2), Length(y2)));
+            path.append(Point(Length(x1), Length(y2)));
+            return GeometryKernel::PathList{path};
+        }
+
+        static qint64 areaOf(const GeometryKernel::PathList& paths) {
+            // signed area by the shoelace formula, summed over all outlines
+            // (holes are wound the opposite way and thus subtracted)
+            qreal area = 0;
+            foreach (const GeometryKernel::Path& path, paths) {
+                for (int i = 0; i < path.count(); ++i) {
+                    const Point& a = path.at(i);
+                    const Point& b = path.at((i + 1) % path.count());
+                    area += (qreal(a.getX().toNm()) * qreal(b.getY().toNm())
+                           - qreal(b.getX().toNm()) * qreal(a.getY().toNm())) / 2.0;
+                }
+            }
+            return qint64(qAbs(area));
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(GeometryKernelTest, testUniteDisjointRects)
+{
+    GeometryKernel::PathList result = GeometryKernel::unite(
+        rect(0, 0, 1000, 1000), rect(2000, 0, 3000, 1000));
+    EXPECT_EQ(2, result.count());
+    EXPECT_EQ(2000000, areaOf(result));
+}
+
+TEST_F(GeometryKernelTest, testUniteOverlappingRects)
+{
+    GeometryKernel::PathList result = GeometryKernel::unite(
+        rect(0, 0, 2000, 1000), rect(1000, 0, 3000, 1000));
+    EXPECT_EQ(1, result.count());
+    EXPECT_EQ(3000000, areaOf(result));
+}
+
+TEST_F(GeometryKernelTest, testIntersectRects)
+{
+    GeometryKernel::PathList result = GeometryKernel::intersect(
+        rect(0, 0, 2000, 1000), rect(1000, 0, 3000, 1000));
+    EXPECT_EQ(1, result.count());
+    EXPECT_EQ(1000000, areaOf(result));
+}
+
+TEST_F(GeometryKernelTest, testIntersectDisjointRectsIsEmpty)
+{
+    GeometryKernel::PathList result = GeometryKernel::intersect(
+        rect(0, 0, 1000, 1000), rect(2000, 0, 3000, 1000));
+    EXPECT_EQ(0, result.count());
+}
+
+TEST_F(GeometryKernelTest, testSubtractRects)
+{
+    GeometryKernel::PathList result = GeometryKernel::subtract(
+        rect(0, 0, 2000, 1000), rect(1000, 0, 3000, 1000));
+    EXPECT_EQ(1, result.count());
+    EXPECT_EQ(1000000, areaOf(result));
+}
+
+TEST_F(GeometryKernelTest, testSubtractHole)
+{
+    // subtracting a rect in the middle creates a hole, i.e. a second outline
+    GeometryKernel::PathList result = GeometryKernel::subtract(
+        rect(0, 0, 3000, 3000), rect(1000, 1000, 2000, 2000));
+    EXPECT_EQ(2, result.count());
+    EXPECT_EQ(8000000, areaOf(result));
+}
+
+TEST_F(GeometryKernelTest, testOffsetGrow)
+{
+    // growing a 1x1um rect by 500nm must at least cover the 2x2um bounding rect
+    // area minus the rounded corners, and at most the full bounding rect
+    GeometryKernel::PathList result = GeometryKernel::offset(
+        rect(0, 0, 1000, 1000), Length(500));
+    ASSERT_EQ(1, result.count());
+    qint64 area = areaOf(result);
+    EXPECT_GT(area, 3700000);
+    EXPECT_LE(area, 4000000);
+}
+
+TEST_F(GeometryKernelTest, testOffsetShrink)
+{
+    GeometryKernel::PathList result = GeometryKernel::offset(
+        rect(0, 0, 2000, 2000), Length(-500));
+    ASSERT_EQ(1, result.count());
+    qint64 area = areaOf(result);
+    EXPECT_GT(area, 900000);
+    EXPECT_LT(area, 1100000);
+}
+
+TEST_F(GeometryKernelTest, testOffsetZeroIsIdentity)
+{
+    GeometryKernel::PathList result = GeometryKernel::offset(
+        rect(0, 0, 1000, 1000), Length(0));
+    EXPECT_EQ(1, result.count());
+    EXPECT_EQ(1000000, areaOf(result));
+}
+
+TEST_F(GeometryKernelTest, testUniteBatch)
+{
+    QVector<QPair<GeometryKernel::PathList, GeometryKernel::PathList>> jobs;
+    for (int i = 0; i < 50; ++i) {
+        jobs.append(qMakePair(rect(0, 0, 2000, 1000), rect(1000, 0, 3000, 1000)));
+    }
+    QVector<GeometryKernel::PathList> results = GeometryKernel::uniteBatch(jobs);
+    ASSERT_EQ(jobs.count(), results.count());
+    foreach (const GeometryKernel::PathList& result, results) {
+        EXPECT_EQ(3000000, areaOf(result));
+    }
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,102 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <librepcb/common/exceptions.h>
+#include <librepcb/common/units/all_length_units.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class LengthTest : public ::testing::Test
+{
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(LengthTest, testMapToGrid)
+{
+    Length grid(635000); // 0.635mm
+
+    EXPECT_EQ(Length(0),        Length(0).mappedToGrid(grid));
+    EXPECT_EQ(Length(635000),   Length(635000).mappedToGrid(grid));
+    EXPECT_EQ(Length(0),        Length(317499).mappedToGrid(grid));
+    EXPECT_EQ(Length(635000),   Length(317500).mappedToGrid(grid)); // tie: away from zero
+    EXPECT_EQ(Length(-635000),  Length(-317500).mappedToGrid(grid));
+    EXPECT_EQ(Length(0),        Length(-317499).mappedToGrid(grid));
+    EXPECT_EQ(Length(-635000),  Length(-635000).mappedToGrid(grid));
+}
+
+TEST_F(LengthTest, testMapToGridWithZeroIntervalIsNoop)
+{
+    EXPECT_EQ(Length(123456), Length(123456).mappedToGrid(Length(0)));
+}
+
+TEST_F(LengthTest, testMapToGridKeepsPrecisionOfHugeLengths)
+{
+    // lengths above 2^53 nanometers cannot be represented exactly in a qreal, but
+    // the integer based grid snapping must still be exact
+    Length huge(Length(9007199254742000LL)); // 2^53 + 1008
+    EXPECT_EQ(Length(9007199254742000LL), huge.mappedToGrid(Length(1000)));
+}
+
+TEST_F(LengthTest, testMmStringConversion)
+{
+    // parse
+    EXPECT_EQ(Length(0),        Length::fromMm(QString("0.000000")));
+    EXPECT_EQ(Length(1),        Length::fromMm(QString("0.000001")));
+    EXPECT_EQ(Length(-1),       Length::fromMm(QString("-0.000001")));
+    EXPECT_EQ(Length(1000000),  Length::fromMm(QString("1")));
+    EXPECT_EQ(Length(-2540000), Length::fromMm(QString("-2.54")));
+    EXPECT_EQ(Length(1),        Length::fromMm(QString("0.0000005"))); // rounds up
+    EXPECT_EQ(Length(-1),       Length::fromMm(QString("-0.0000005"))); // away from zero
+    EXPECT_EQ(Length(1000),     Length::fromMm(QString("1e-3"))); // exponent fallback
+    EXPECT_THROW(Length::fromMm(QString("foo")), Exception);
+    EXPECT_THROW(Length::fromMm(QString(".")), Exception);
+    EXPECT_THROW(Length::fromMm(QString("")), Exception);
+
+    // format (always six decimals, like the QLocale based formatting did)
+    EXPECT_EQ(QString("0.000000"),  Length(0).toMmString());
+    EXPECT_EQ(QString("0.000001"),  Length(1).toMmString());
+    EXPECT_EQ(QString("-0.000001"), Length(-1).toMmString());
+    EXPECT_EQ(QString("1.000000"),  Length(1000000).toMmString());
+    EXPECT_EQ(QString("-2.540000"), Length(-2540000).toMmString());
+
+    // round trip
+    EXPECT_EQ(Length(123456789), Length::fromMm(Length(123456789).toMmString()));
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
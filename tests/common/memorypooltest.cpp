@@ -0,0 +1,127 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <QtCore>
+#include <librepcb/common/memorypool.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class MemoryPoolTest : public ::testing::Test
+{
+    protected:
+        struct DummyItem {
+            qint64 a;
+            qint32 b;
+        };
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(MemoryPoolTest, testAllocateReturnsDistinctSlots)
+{
+    MemoryPool<DummyItem> pool(4); // small chunks to force multiple chunk allocations
+    QSet<void*> slots;
+    for (int i = 0; i < 20; ++i) {
+        void* slot = pool.allocate();
+        ASSERT_TRUE(slot != nullptr);
+        EXPECT_FALSE(slots.contains(slot)); // no slot may be handed out twice
+        slots.insert(slot);
+
+        // the slot must be usable for an actual object of the pooled type
+        DummyItem* item = new (slot) DummyItem();
+        item->a = i;
+        item->b = -i;
+        EXPECT_EQ(i, item->a);
+    }
+    foreach (void* slot, slots) {
+        pool.deallocate(slot);
+    }
+}
+
+TEST_F(MemoryPoolTest, testFreedSlotIsReusedFirst)
+{
+    MemoryPool<DummyItem> pool;
+    void* first = pool.allocate();
+    void* second = pool.allocate();
+    EXPECT_NE(first, second);
+
+    // the freelist is LIFO, so the slot freed last is handed out again first
+    pool.deallocate(first);
+    EXPECT_EQ(first, pool.allocate());
+    pool.deallocate(second);
+    pool.deallocate(first);
+    EXPECT_EQ(first, pool.allocate());
+    EXPECT_EQ(second, pool.allocate());
+
+    pool.deallocate(first);
+    pool.deallocate(second);
+}
+
+TEST_F(MemoryPoolTest, testSlotsOfOneChunkAreHandedOutFrontToBack)
+{
+    // consecutive allocations out of a fresh chunk must be adjacent in memory, that is
+    // what gives the pooled items their cache locality
+    MemoryPool<DummyItem> pool(8);
+    char* previous = static_cast<char*>(pool.allocate());
+    char* first = previous;
+    std::ptrdiff_t stride = 0;
+    for (int i = 1; i < 8; ++i) {
+        char* slot = static_cast<char*>(pool.allocate());
+        if (i == 1) {
+            stride = slot - previous;
+            EXPECT_GE(stride, static_cast<std::ptrdiff_t>(sizeof(DummyItem)));
+        } else {
+            EXPECT_EQ(stride, slot - previous);
+        }
+        previous = slot;
+    }
+    for (char* slot = first; slot <= previous; slot += stride) {
+        pool.deallocate(slot);
+    }
+}
+
+TEST_F(MemoryPoolTest, testDeallocateNullptrIsIgnored)
+{
+    MemoryPool<DummyItem> pool;
+    pool.deallocate(nullptr); // must not crash or corrupt the freelist
+    void* slot = pool.allocate();
+    EXPECT_TRUE(slot != nullptr);
+    pool.deallocate(slot);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
@@ -0,0 +1,110 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+
+#include <QtCore>
+#include <gtest/gtest.h>
+#include <librepcb/common/units/pointarray.h>
+#include <librepcb/common/units/angle.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class PointArrayTest : public ::testing::Test
+{
+    protected:
+        static PointArray createTestArray() noexcept {
+            PointArray array;
+            array.append(Point(0, 0));
+            array.append(Point(Length(1000000), Length(0)));
+            array.append(Point(Length(-12345678), Length(87654321)));
+            array.append(Point(Length(123), Length(-456)));
+            return array;
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(PointArrayTest, testTranslateMatchesPoint)
+{
+    PointArray array = createTestArray();
+    Point offset(Length(7777), Length(-55555));
+    PointArray translated(array);
+    translated.translate(offset);
+    for (int i = 0; i < array.getCount(); ++i) {
+        EXPECT_EQ(array.getPoint(i) + offset, translated.getPoint(i));
+    }
+}
+
+TEST_F(PointArrayTest, testRotateMatchesPoint)
+{
+    QVector<Angle> angles = {Angle::deg0(), Angle::deg45(), Angle::deg90(),
+                             Angle::deg180(), Angle::deg270(), Angle(-33330000)};
+    Point center(Length(100), Length(-200));
+    foreach (const Angle& angle, angles) {
+        PointArray array = createTestArray();
+        PointArray rotated(array);
+        rotated.rotate(angle, center);
+        for (int i = 0; i < array.getCount(); ++i) {
+            EXPECT_EQ(array.getPoint(i).rotated(angle, center), rotated.getPoint(i));
+        }
+    }
+}
+
+TEST_F(PointArrayTest, testMirrorMatchesPoint)
+{
+    Point center(Length(-300), Length(400));
+    foreach (Qt::Orientation orientation, {Qt::Horizontal, Qt::Vertical}) {
+        PointArray array = createTestArray();
+        PointArray mirrored(array);
+        mirrored.mirror(orientation, center);
+        for (int i = 0; i < array.getCount(); ++i) {
+            EXPECT_EQ(array.getPoint(i).mirrored(orientation, center), mirrored.getPoint(i));
+        }
+    }
+}
+
+TEST_F(PointArrayTest, testToPxQPolygonF)
+{
+    PointArray array = createTestArray();
+    QPolygonF polygon = array.toPxQPolygonF();
+    ASSERT_EQ(array.getCount(), polygon.count());
+    for (int i = 0; i < array.getCount(); ++i) {
+        EXPECT_EQ(array.getPoint(i).toPxQPointF(), polygon.at(i));
+    }
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
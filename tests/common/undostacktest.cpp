@@ -0,0 +1,255 @@
+/*
+ * LibrePCB - Professional EDA for everyone!
+ * Copyright (C) 2013 LibrePCB Developers, see AUTHORS.md for contributors.
+ * http://librepcb.org/
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+/*****************************************************************************************
+ *  Includes
+ ****************************************************************************************/
+#include <gtest/gtest.h>
+#include <QtCore>
+#include <librepcb/common/undostack.h>
+#include <librepcb/common/undocommand.h>
+
+/*****************************************************************************************
+ *  Namespace
+ ****************************************************************************************/
+namespace librepcb {
+namespace tests {
+
+/*****************************************************************************************
+ *  Test Class
+ ****************************************************************************************/
+
+class UndoStackTest : public ::testing::Test
+{
+    protected:
+
+        /// Undo command which increments/decrements an external counter
+        class TestCommand final : public UndoCommand
+        {
+            public:
+                TestCommand(int& counter, const QString& text = "Test") noexcept :
+                    UndoCommand(text), mCounter(counter) {}
+                bool performExecute() override {performRedo(); return true;}
+                void performUndo() override {--mCounter;}
+                void performRedo() override {++mCounter;}
+            private:
+                int& mCounter;
+        };
+
+        /// Undo command whose execution reports "nothing done"
+        class NopCommand final : public UndoCommand
+        {
+            public:
+                NopCommand() noexcept : UndoCommand("Nop") {}
+                bool performExecute() override {return false;}
+                void performUndo() override {}
+                void performRedo() override {}
+        };
+
+        /// Commit one command group containing a single TestCommand
+        void commitGroup(UndoStack& stack, int& counter, const QString& text) {
+            stack.beginCmdGroup(text);
+            stack.appendToCmdGroup(new TestCommand(counter, text));
+            stack.commitCmdGroup();
+        }
+};
+
+/*****************************************************************************************
+ *  Test Methods
+ ****************************************************************************************/
+
+TEST_F(UndoStackTest, testExecCmdAndUndoRedo)
+{
+    UndoStack stack;
+    int counter = 0;
+    EXPECT_FALSE(stack.canUndo());
+    EXPECT_TRUE(stack.isClean());
+
+    stack.execCmd(new TestCommand(counter));
+    EXPECT_EQ(1, counter);
+    EXPECT_TRUE(stack.canUndo());
+    EXPECT_FALSE(stack.isClean());
+
+    stack.undo();
+    EXPECT_EQ(0, counter);
+    EXPECT_FALSE(stack.canUndo());
+    EXPECT_TRUE(stack.canRedo());
+    EXPECT_TRUE(stack.isClean());
+
+    stack.redo();
+    EXPECT_EQ(1, counter);
+}
+
+TEST_F(UndoStackTest, testNopCommandIsDiscarded)
+{
+    UndoStack stack;
+    stack.execCmd(new NopCommand());
+    EXPECT_FALSE(stack.canUndo());
+    EXPECT_TRUE(stack.isClean());
+}
+
+TEST_F(UndoStackTest, testConsecutiveGroupsWithSameTextAreCoalesced)
+{
+    UndoStack stack;
+    stack.setCommandCoalescingIntervalMs(60000); // everything in this test "is quick"
+    int counter = 0;
+
+    commitGroup(stack, counter, "Move items");
+    commitGroup(stack, counter, "Move items");
+    commitGroup(stack, counter, "Move items");
+    EXPECT_EQ(3, counter);
+
+    // all three groups were merged into one command --> a single undo reverts them all
+    stack.undo();
+    EXPECT_EQ(0, counter);
+    EXPECT_FALSE(stack.canUndo());
+}
+
+TEST_F(UndoStackTest, testGroupsWithDifferentTextAreNotCoalesced)
+{
+    UndoStack stack;
+    stack.setCommandCoalescingIntervalMs(60000);
+    int counter = 0;
+
+    commitGroup(stack, counter, "Move items");
+    commitGroup(stack, counter, "Rotate items");
+    EXPECT_EQ(2, counter);
+
+    stack.undo();
+    EXPECT_EQ(1, counter); // only the rotation was undone
+    EXPECT_TRUE(stack.canUndo());
+}
+
+TEST_F(UndoStackTest, testDisabledCoalescingKeepsGroupsSeparate)
+{
+    UndoStack stack;
+    stack.setCommandCoalescingIntervalMs(0);
+    int counter = 0;
+
+    commitGroup(stack, counter, "Move items");
+    commitGroup(stack, counter, "Move items");
+
+    stack.undo();
+    EXPECT_EQ(1, counter);
+    EXPECT_TRUE(stack.canUndo());
+}
+
+TEST_F(UndoStackTest, testNoCoalescingAcrossCleanState)
+{
+    // the group committed before saving must stay undoable on its own, otherwise
+    // undoing back to the saved state would become impossible
+    UndoStack stack;
+    stack.setCommandCoalescingIntervalMs(60000);
+    int counter = 0;
+
+    commitGroup(stack, counter, "Move items");
+    stack.setClean();
+    commitGroup(stack, counter, "Move items");
+
+    stack.undo();
+    EXPECT_EQ(1, counter);
+    EXPECT_TRUE(stack.isClean());
+}
+
+TEST_F(UndoStackTest, testNoCoalescingIntoRevertedGroup)
+{
+    // after undo+redo the previous group is no longer the tail of the same interactive
+    // operation, so a new group must not be merged into it
+    UndoStack stack;
+    stack.setCommandCoalescingIntervalMs(60000);
+    int counter = 0;
+
+    commitGroup(stack, counter, "Move items");
+    stack.undo();
+    stack.redo();
+    commitGroup(stack, counter, "Move items");
+
+    stack.undo();
+    EXPECT_EQ(1, counter);
+    EXPECT_TRUE(stack.canUndo());
+}
+
+TEST_F(UndoStackTest, testCommandLimitDropsOldestCommands)
+{
+    UndoStack stack;
+    stack.setCommandCoalescingIntervalMs(0);
+    stack.setMaxCommandCount(3);
+    int counter = 0;
+
+    for (int i = 0; i < 5; ++i) {
+        stack.execCmd(new TestCommand(counter));
+    }
+    EXPECT_EQ(5, counter);
+
+    // only the newest three commands are still undoable; the changes of the two
+    // dropped commands are kept
+    int undoCount = 0;
+    while (stack.canUndo()) {
+        stack.undo();
+        ++undoCount;
+    }
+    EXPECT_EQ(3, undoCount);
+    EXPECT_EQ(2, counter);
+}
+
+TEST_F(UndoStackTest, testCleanStateIsLostWhenCleanCommandIsDropped)
+{
+    // if the commands below the clean index were dropped by the limit, the stack can
+    // never reach the clean state again and must consistently report "not clean"
+    UndoStack stack;
+    stack.setCommandCoalescingIntervalMs(0);
+    stack.setMaxCommandCount(2);
+    int counter = 0;
+
+    stack.execCmd(new TestCommand(counter));
+    stack.setClean();
+    for (int i = 0; i < 3; ++i) {
+        stack.execCmd(new TestCommand(counter));
+    }
+    while (stack.canUndo()) {
+        stack.undo();
+    }
+    EXPECT_FALSE(stack.isClean());
+}
+
+TEST_F(UndoStackTest, testReducingLimitTakesEffectImmediately)
+{
+    UndoStack stack;
+    stack.setCommandCoalescingIntervalMs(0);
+    int counter = 0;
+
+    for (int i = 0; i < 5; ++i) {
+        stack.execCmd(new TestCommand(counter));
+    }
+    stack.setMaxCommandCount(2);
+
+    int undoCount = 0;
+    while (stack.canUndo()) {
+        stack.undo();
+        ++undoCount;
+    }
+    EXPECT_EQ(2, undoCount);
+}
+
+/*****************************************************************************************
+ *  End of File
+ ****************************************************************************************/
+
+} // namespace tests
+} // namespace librepcb
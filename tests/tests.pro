@@ -55,14 +55,20 @@ SOURCES += \
     common/applicationtest.cpp \
     common/directorylocktest.cpp \
     common/filedownloadtest.cpp \
+    common/fileio/domelementtest.cpp \
     common/fileio/serializableobjectlisttest.cpp \
     common/filepathtest.cpp \
+    common/geometrykerneltest.cpp \
+    common/lengthtest.cpp \
+    common/memorypooltest.cpp \
     common/networkrequesttest.cpp \
+    common/pointarraytest.cpp \
     common/pointtest.cpp \
     common/ratiotest.cpp \
     common/scopeguardtest.cpp \
     common/sqlitedatabasetest.cpp \
     common/systeminfotest.cpp \
+    common/undostacktest.cpp \
     common/uuidtest.cpp \
     common/versiontest.cpp \
     main.cpp \